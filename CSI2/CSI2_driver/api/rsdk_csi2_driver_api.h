@@ -109,19 +109,32 @@ extern "C" {
 #define RSDK_CSI2_ERR_SPURIOUS_PHY  (1UL << 22u) /**< Spurious error at PHY level.                                  */
 #define RSDK_CSI2_ERR_SPURIOUS_PKT  (1UL << 23u) /**< Spurious error at Packet level.                               */
 #define RSDK_CSI2_ERR_SPURIOUS_EVT  (1UL << 24u) /**< Spurious error at Data level.                                 */
+//<!-- frame ring errors ------------- -->
+#define RSDK_CSI2_ERR_FRAME_OVERRUN (1UL << 25u) /**< Frame ring overrun : all other ring buffers are still held by
+                                                  * the application, so the frame was dropped.                      */
+#define RSDK_CSI2_ERR_CONSUMER_OVERRUN (1UL << 26u) /**< A buffer line was overwritten by the interface before the
+                                                  * line consumer used it, see rsdkCsi2LineWatermark_t              */
 
 //<!-- Masking parameters for CSI2 callback - events requesting/reporting -------------- -->
 #define RSDK_CSI2_EVT_FRAME_START       (1UL << 0u) /**< Frame start event (FS)                                     */
 #define RSDK_CSI2_EVT_FRAME_END         (1UL << 1u) /**< Frame end event (FE)                                       */
 #define RSDK_CSI2_EVT_SHORT_PACKET      (1UL << 2u) /**< Generic short packet received (GNSP)                       */
 #define RSDK_CSI2_EVT_LINE_END          (1UL << 3u) /**< Line end event (LINEDONE)                                  */
+#define RSDK_CSI2_EVT_CHANNEL_STAT      (1UL << 4u) /**< Channels statistics of the frame, reported at FrameEnd in
+                                                     * rsdkCsi2Report_t::chStat; needs the channels statistics
+                                                     * (statManagement not \ref RSDK_CSI2_STAT_NO)              */
 #define RSDK_CSI2_EVT_BIT_NOT_TOGGLE    (1UL << 5u) /**< Bit not toggled on a channel,
                                                      * reported in rsdkCsi2Report_t::notToggledBits.                */
+#define RSDK_CSI2_EVT_FRAME_READY       (1UL << 7u) /**< Frame ring buffer ready and owned by the application, the
+                                                     * buffer is reported in rsdkCsi2Report_t::readyFrameBuf; it is
+                                                     * always reported in frame ring mode, even not requested.      */
 
  //<!-- Specific min/max API working parameters. ------------- -->
 #define RSDK_CSI2_MIN_NR_LANES                  1u      /**< Minimum number of physical lanes to be used            */
 #define RSDK_CSI2_MIN_VC_BUF_NR_LINES           1u      /**< Minimum number of VC to be defined                     */
 #define RSDK_CSI2_MAX_ANTENNA_NR                4u      /**< Maximum number of receiving channels (real/complex)    */
+#define RSDK_CSI2_MAX_FRAME_BUFS                4u      /**< Maximum number of buffers in a VC frame ring           */
+#define RSDK_CSI2_TELEMETRY_ERR_BITS            32u     /**< Number of error classes counted by the telemetry       */
 
 //<!-- Frequency limits for each platform --------------- -->
 #define RSDK_CSI2_MAX_RX_FREQ                   2500u   /**< Max. 2.5Gbps input data for \b S32R45/S32R294          */
@@ -153,6 +166,8 @@ extern "C" {
                                                         * is written into te memory                                  */
 
 #define RSDK_CSI2_OFFSET_AUTOCOMPUTE       0x7fff      /**< Definition for auto computing offset for incoming data   */
+#define RSDK_CSI2_DC_EMA_MAX_SHIFT          8u         /**< Maximum smoothing shift of \ref RSDK_CSI2_DC_EST_EMA     */
+#define RSDK_CSI2_DC_WINDOW_MAX             16u        /**< Maximum frames of \ref RSDK_CSI2_DC_EST_WINDOW           */
 #define RSDK_CSI2_MIN_VAL_UNSIGNED         0x0000u     /**< Definition for minimum unsigned sample value (default)   */
 #define RSDK_CSI2_MIN_VAL_SIGNED           0xc000      /**< Definition for minimum signed sample value               */
 #define RSDK_CSI2_MAX_VAL_UNSIGNED         0xffffu     /**< Definition for maximum unsigned sample value             */
@@ -345,6 +360,22 @@ typedef enum {
     RSDK_CSI2_STAT_MAX                  /**< Statistics max limit, to not be used in application                    */
 }rsdkCsi2AutoDCComputeTime_t;
 
+/**
+ * @brief       Auto DC offset estimator type enum.
+ * @details     How the auto computed DC offset follows the frame mean given by the statistics. All the estimators
+ *              are computed without divisions in the interrupt handler, the reciprocals being prepared at
+ *              initialization.
+ *
+ */
+typedef enum {
+    RSDK_CSI2_DC_EST_FRAME = 0u,        /**< The offset is the mean of the last frame (default)                     */
+    RSDK_CSI2_DC_EST_EMA,               /**< Exponential moving average of the frames means, the new mean weighted
+                                         * by 1 / 2^dcEstParam (dcEstParam = 1 ... \ref RSDK_CSI2_DC_EMA_MAX_SHIFT) */
+    RSDK_CSI2_DC_EST_WINDOW,            /**< Mean of the last dcEstParam frames means
+                                         * (dcEstParam = 2 ... \ref RSDK_CSI2_DC_WINDOW_MAX)                        */
+    RSDK_CSI2_DC_EST_MAX                /**< Estimators max limit, to not be used in application                    */
+}rsdkCsi2DCEstimator_t;
+
 
 /**
  * @brief       Initialization options for DPHY layer
@@ -484,6 +515,27 @@ typedef struct {
                                                  * to application, if the \ref RSDK_CSI2_EVT_LINE_END is required in
                                                  * vcEventsReq. It correspond to RM - Table 81-7 -
                                                  * LINEDONE field and cap. 81.8.41                                  */
+    uint8_t     numFrameBufs;                   /**< Number of buffers in the frame ring, 0 or 1 = single buffer.
+                                                 * In frame ring mode, at each frame end the interface is retargeted
+                                                 * to the next buffer not held by the application and the completed
+                                                 * buffer is handed to the application with
+                                                 * \ref RSDK_CSI2_EVT_FRAME_READY; the application must give it back
+                                                 * using \ref RsdkCsi2ReleaseFrameBuf. The new buffer is used by the
+                                                 * hardware starting with the next frame start.                     */
+    void        *pNextBufData[RSDK_CSI2_MAX_FRAME_BUFS - 1u];
+                                                /**< Pointers to the ring buffers 1 ... numFrameBufs-1, the ring
+                                                 * buffer 0 is \ref pBufData; same size and alignment as \ref pBufData,
+                                                 * physical addresses                                               */
+    uint16_t    lineEvtMaxLines;                /**< LINEDONE moderation : maximum lines covered by one
+                                                 * \ref RSDK_CSI2_EVT_LINE_END report; 0 = no moderation, one report
+                                                 * for each \ref bufNumLinesTrigger lines. With moderation, the
+                                                 * triggers are coalesced and the report gives the covered range in
+                                                 * rsdkCsi2Report_t::lineFirst ... rsdkCsi2Report_t::lineLast; a
+                                                 * pending range is always reported with the frame end.             */
+    uint32_t    lineEvtMaxLatencyUs;            /**< LINEDONE moderation : maximum delay, in microseconds, of a
+                                                 * covered line. At each frame end the lines budget is adapted to
+                                                 * the observed line rate, up to \ref lineEvtMaxLines.
+                                                 * 0 = only \ref lineEvtMaxLines is used                            */
 }rsdkCsi2VCParams_t;
 
 /**
@@ -511,6 +563,20 @@ typedef struct {
 }rsdkCsi2MetaDataParams_t;
 
 
+/**
+ * @brief       Channel statistics for one received frame.
+ * @details     Reported for each channel of a RadarData VC with \ref RSDK_CSI2_EVT_CHANNEL_STAT requested, in
+ *              rsdkCsi2Report_t::chStat, so the antenna health and the saturation can be monitored without
+ *              scanning the frame data.
+ *
+ */
+typedef struct {
+    int16_t     chMin;              /**< Minimum sample value in the frame                                          */
+    int16_t     chMax;              /**< Maximum sample value in the frame                                          */
+    int16_t     chMean;             /**< Mean sample value in the frame (the measured DC level), over the lines
+                                     * used for the statistics (see rsdkCsi2AutoDCComputeTime_t)                    */
+    uint16_t    chToggle;           /**< Bits toggled in the frame, 1 = toggled                                     */
+} rsdkCsi2ChStat_t;
 /**
  * @brief       Structure which describe the errors/events signaled by an interrupt request.
  * @details     The cumulated errors/events are put in this structure.
@@ -559,9 +625,284 @@ typedef struct {
     rsdkCsi2ShortPacket_t shortPackets[RSDK_CSI2_MAX_VC];   /**< Specific data for short packet received
                                                      * \if (S32R45_DOCS || S32R294_DOCS)
                                                      * , if \ref RSDK_CSI2_EVT_SHORT_PACKET bit is set.  \endif     */
+    uint8_t     readyFrameBuf[RSDK_CSI2_MAX_VC];    /**< The frame ring buffer (0 ... numFrameBufs-1) handed to the
+                                                     * application, if \ref RSDK_CSI2_EVT_FRAME_READY is set       */
+    uint32_t    frameCounter[RSDK_CSI2_MAX_VC];     /**< The VC frames counter at report time, the same value as
+                                                     * returned by RsdkCsi2GetFramesCounter                         */
+    uint64_t    timeFrameStart[RSDK_CSI2_MAX_VC];   /**< Timestamp of the last FrameStart on the VC, in ticks of the
+                                                     * system (arch) counter, taken at the events irq entry          */
+    uint64_t    timeFrameEnd[RSDK_CSI2_MAX_VC];     /**< Timestamp of the last FrameEnd on the VC; while a frame is
+                                                     * received it is older than timeFrameStart                     */
+    uint64_t    timeLineDone[RSDK_CSI2_MAX_VC];     /**< Timestamp of the last LINEDONE on the VC                    */
+    uint16_t    lineFirst[RSDK_CSI2_MAX_VC];        /**< First line (1 ... expectedNumLines) covered by the
+                                                     * \ref RSDK_CSI2_EVT_LINE_END report                           */
+    uint16_t    lineLast[RSDK_CSI2_MAX_VC];         /**< Last line covered by the \ref RSDK_CSI2_EVT_LINE_END report */
+    rsdkCsi2ChStat_t chStat[RSDK_CSI2_MAX_VC][RSDK_CSI2_MAX_CHANNEL];   /**< Channels statistics of the frame, if
+                                                     * \ref RSDK_CSI2_EVT_CHANNEL_STAT is set for the VC            */
 } rsdkCsi2Report_t;
 
 
+/**
+ * @brief   Throughput and jitter telemetry for one Virtual Channel.
+ * @details All times are in ticks of the system (arch) counter, see rsdkCsi2Telemetry_t::counterFreq.
+ *          The mean values are computed by the reader : periodSum / periodsNum, frameTimeSum / framesNum.
+ *
+ */
+typedef struct
+{
+    uint32_t    framesNum;          /**< Frames received, FrameStart followed by FrameEnd                           */
+    uint32_t    periodsNum;         /**< FrameStart to FrameStart periods measured                                  */
+    uint64_t    periodMin;          /**< Minimum frame period                                                       */
+    uint64_t    periodMax;          /**< Maximum frame period                                                       */
+    uint64_t    periodSum;          /**< Sum of all the frame periods                                               */
+    uint64_t    frameTimeMin;       /**< Minimum FrameStart to FrameEnd duration                                    */
+    uint64_t    frameTimeMax;       /**< Maximum FrameStart to FrameEnd duration                                    */
+    uint64_t    frameTimeSum;       /**< Sum of all the FrameStart to FrameEnd durations                            */
+    uint64_t    linesNum;           /**< Lines (LINEDONE) received                                                  */
+    uint64_t    timeFirstLine;      /**< Timestamp of the first line; the lines per second are
+                                     * linesNum / (timeLastLine - timeFirstLine) * counterFreq                      */
+    uint64_t    timeLastLine;       /**< Timestamp of the last line                                                 */
+} rsdkCsi2VCTelemetry_t;
+
+/**
+ * @brief   Telemetry for one CSI2 interrupt handler.
+ *
+ */
+typedef struct
+{
+    uint32_t    callsNum;           /**< Number of handler executions                                               */
+    uint32_t    reserved;
+    uint64_t    timeMax;            /**< Maximum handler execution time, including the application callback         */
+    uint64_t    timeSum;            /**< Sum of the handler execution times                                         */
+    uint32_t    errCount[RSDK_CSI2_TELEMETRY_ERR_BITS]; /**< Reports of each RSDK_CSI2_ERR_* class, indexed by the
+                                     * bit position in rsdkCsi2Report_t::errMaskU                                   */
+} rsdkCsi2IrqTelemetry_t;
+
+/**
+ * @brief   Unit telemetry, maintained by the interrupt handlers since the last unit initialization.
+ * @details The counters are updated lock-free, each by only one interrupt handler. A snapshot is coherent for
+ *          each counter, but not necessarily between different counters.
+ *
+ */
+typedef struct
+{
+    uint64_t                counterFreq;                    /**< System counter frequency, ticks per second, 0 if
+                                                             * unknown                                              */
+    rsdkCsi2IrqTelemetry_t  irq[RSDK_CSI2_MAX_IRQ_ID];      /**< Per interrupt handler, see rsdkCsi2IrqId_t         */
+    rsdkCsi2VCTelemetry_t   vc[RSDK_CSI2_MAX_VC];           /**< Per Virtual Channel                                */
+} rsdkCsi2Telemetry_t;
+
+/**
+ * @brief   Lines committed watermark of a Virtual Channel, for the line-granular (pipelined) consumers.
+ * @details The watermark is updated by the driver at each LINEDONE interrupt, which is enabled for the VC by a
+ *          not null rsdkCsi2VCParams_t::bufNumLinesTrigger. All the line counters are free running since the unit
+ *          initialization; in the current frame, the counter value L is the chirp (L - frameFirstLine) and it is
+ *          kept in the buffer line ((L - frameFirstLine - 1) % bufNumLines).<br>
+ *          A consumer which processes the lines while the frame is still received :
+ *          - waits for linesCommitted to pass the next line to be processed (see \ref RsdkCsi2WaitForLine)
+ *          - publishes in linesConsumed the counter value of the lines already used and sets consumerOn
+ *          - the driver reports \ref RSDK_CSI2_ERR_CONSUMER_OVERRUN when the interface writes a buffer line
+ *          holding a line not consumed yet, i.e. (linesCommitted - linesConsumed) > bufNumLines. The check is
+ *          exact when expectedNumLines is a multiple of bufNumLines.<br>
+ *          In Linux the watermarks are part of the unit event ring, which can be mapped in the user-space.
+ *
+ */
+typedef struct
+{
+    volatile uint32_t   frameSeq;           /**< Frames started on the VC                                           */
+    volatile uint32_t   frameFirstLine;     /**< Line counter value at the current FrameStart                       */
+    volatile uint32_t   linesCommitted;     /**< Lines completely written in the buffer                             */
+    volatile uint32_t   linesConsumed;      /**< Lines already used, written only by the consumer                   */
+    volatile uint32_t   consumerOn;         /**< Written by the consumer, not 0 to check for consumer overrun       */
+    volatile uint32_t   overruns;           /**< Consumer overruns detected                                         */
+} rsdkCsi2LineWatermark_t;
+
+/**
+ * @brief   Unit status page, to read the unit status without any driver call.
+ * @details The page is updated by the driver at each interrupt handler end (so at least at each frame end) and at
+ *          each unit state change. It is protected by a sequence counter : seq is odd while the driver writes the
+ *          page, so a consistent copy is the one taken between two equal and even reads of seq
+ *          (see \ref RsdkCsi2ReadStatusPage).<br>
+ *          In Linux the page can be mapped read-only in the user-space, using mmap() on the unit device with the
+ *          offset (RSDK_CSI2_STATUS_PAGE_PGOFF * page size); the status reads become plain memory loads.
+ *
+ */
+typedef struct
+{
+    volatile uint32_t   seq;                            /**< Sequence counter, odd while the page is updated        */
+    volatile uint32_t   ifaceStatus;                    /**< Interface status, see \ref RsdkCsi2GetInterfaceStatus  */
+    volatile uint32_t   laneStatus[RSDK_CSI2_MAX_LANE]; /**< Lanes status at the last state change or error report,
+                                                         * see \ref RsdkCsi2GetLaneStatus                           */
+    volatile uint32_t   framesCounter[RSDK_CSI2_MAX_VC];/**< Received frames, see \ref RsdkCsi2GetFramesCounter    */
+    volatile uint32_t   irqCount[RSDK_CSI2_MAX_IRQ_ID]; /**< Executions of each interrupt handler                   */
+    volatile uint32_t   errCount[RSDK_CSI2_MAX_IRQ_ID]; /**< Reports with errors, for each interrupt handler        */
+    volatile uint32_t   lastErrMask[RSDK_CSI2_MAX_IRQ_ID];  /**< The last not null errMaskU, for each handler       */
+    volatile uint32_t   reserved;
+    volatile uint64_t   timeUpdate;                     /**< System counter at the last update, 0 if not available  */
+} rsdkCsi2StatusPage_t;
+
+/**
+ * @brief   Member bit of a (unit, Virtual Channel) pair, for rsdkCsi2SyncParams_t::memberMask.
+ *
+ */
+#define RSDK_CSI2_SYNC_MEMBER(unit, vc)     (1UL << (((uint32_t)(unit) * (uint32_t)RSDK_CSI2_MAX_VC) + (uint32_t)(vc)))
+
+/**
+ * @brief   Multi-unit frame synchronizer parameters.
+ * @details The synchronizer groups the FrameEnds of several (unit, VC) pairs, for example several front-ends of
+ *          the same radar cycle, so the processing can start once per cycle (see \ref RsdkCsi2SyncWait).
+ *
+ */
+typedef struct
+{
+    uint32_t    memberMask;                     /**< The members of a cycle, see \ref RSDK_CSI2_SYNC_MEMBER; 0 stops
+                                                 * the synchronizer                                                 */
+    uint32_t    skewUs;                         /**< Maximum time between the first and the last member FrameEnd of
+                                                 * a cycle, in microseconds                                         */
+} rsdkCsi2SyncParams_t;
+
+/**
+ * @brief   A cycle closed by the frame synchronizer.
+ * @details A cycle is complete when all the members reported FrameEnd in the skew window. It is closed with the
+ *          missing members when a present member reports FrameEnd again, when a member reports FrameEnd out of the
+ *          skew window or, in Linux, when the skew window expired at the wait time.
+ *
+ */
+typedef struct
+{
+    uint32_t    cycleId;                        /**< Closed cycles counter, the first cycle is 1                    */
+    uint32_t    presentMask;                    /**< The members with FrameEnd in the cycle                         */
+    uint32_t    missingMask;                    /**< The members without FrameEnd, 0 for a complete cycle           */
+    uint32_t    lostCycles;                     /**< Cycles between the requested and the returned one, dropped
+                                                 * because not retrieved in time                                    */
+    uint64_t    timeFirst;                      /**< System counter at the first member FrameEnd                    */
+    uint64_t    timeLast;                       /**< System counter at the last member FrameEnd; the cycle skew is
+                                                 * (timeLast - timeFirst)                                           */
+    uint32_t    frameCounter[RSDK_CSI2_MAX_UNITS * RSDK_CSI2_MAX_VC];   /**< Frames counter of each present member
+                                                 * at its FrameEnd, indexed by the member bit position              */
+} rsdkCsi2SyncCycle_t;
+
+/**
+ * @brief   Raw frames capture container.
+ * @details A capture is a rsdkCsi2CapFileHdr_t followed by frame records. Each record is a rsdkCsi2CapFrameHdr_t
+ *          followed by the frame sections, in this order : radar data, auxiliary data and metadata. A section is
+ *          made of lines, as found in the VC buffers (the line statistics included), without the padding to the
+ *          buffer line length. The record is padded to RSDK_CSI2_CAP_ALIGN bytes.
+ *          The headers lengths are part of the headers, so new fields can be appended without breaking the
+ *          existing readers.
+ *
+ */
+#define RSDK_CSI2_CAP_FILE_MAGIC    0x46433243u     /**< "C2CF" : capture file header magic                         */
+#define RSDK_CSI2_CAP_FRAME_MAGIC   0x52463243u     /**< "C2FR" : frame record header magic                         */
+#define RSDK_CSI2_CAP_VERSION       1u              /**< Capture container version                                  */
+#define RSDK_CSI2_CAP_ALIGN         16u             /**< Frame records alignment, in bytes                          */
+
+/**
+ * @brief   Raw frames capture file header.
+ *
+ */
+typedef struct
+{
+    uint32_t    magic;                          /**< RSDK_CSI2_CAP_FILE_MAGIC                                       */
+    uint16_t    version;                        /**< RSDK_CSI2_CAP_VERSION                                          */
+    uint16_t    hdrLen;                         /**< Header length, in bytes; the first frame record follows it     */
+    uint32_t    framesNum;                      /**< Frame records number, 0 if not known (streamed capture)        */
+    uint32_t    reserved;                       /**< Reserved, 0                                                    */
+    uint64_t    counterFreq;                    /**< Frequency of the system counter used for the timestamps, 0 if
+                                                 * the frames have no timestamps                                    */
+    uint64_t    timeStart;                      /**< System counter at the capture start                            */
+} rsdkCsi2CapFileHdr_t;
+
+/**
+ * @brief   Raw frames capture, frame record header.
+ *
+ */
+typedef struct
+{
+    uint32_t    magic;                          /**< RSDK_CSI2_CAP_FRAME_MAGIC                                      */
+    uint16_t    hdrLen;                         /**< Header length, in bytes; the radar data section follows it     */
+    uint8_t     unitId;                         /**< The unit which received the frame                              */
+    uint8_t     vcId;                           /**< The Virtual Channel which received the frame                   */
+    uint32_t    recLen;                         /**< Record length, header and padding included, in bytes          */
+    uint32_t    frameSeq;                       /**< Frames counter of the VC at the frame end                      */
+    uint64_t    timeFrameStart;                 /**< System counter at the FrameStart                               */
+    uint64_t    timeFrameEnd;                   /**< System counter at the FrameEnd                                 */
+    uint16_t    dataLineLen;                    /**< Radar data line length, in bytes                               */
+    uint16_t    dataLines;                      /**< Radar data lines number                                        */
+    uint16_t    auxLineLen;                     /**< Auxiliary data line length, in bytes, 0 for none               */
+    uint16_t    auxLines;                       /**< Auxiliary data lines number                                    */
+    uint16_t    metaLineLen;                    /**< Metadata line length, in bytes, 0 for none                     */
+    uint16_t    metaLines;                      /**< Metadata lines number                                          */
+    uint32_t    framesLost;                     /**< Frames of the VC not captured before this one                  */
+} rsdkCsi2CapFrameHdr_t;
+
+#define RSDK_CSI2_CAP_DIO_ALIGN     4096u           /**< Alignment of the buffers and lengths for the direct I/O    */
+#define RSDK_CSI2_CAP_QUEUE_LEN     64u             /**< Maximum frames queued to the capture writer                */
+
+/**
+ * @brief   Raw capture recorder, buffer region recorded for each frame of a VC.
+ * @details The region is (lineLen * numLines) bytes from the frame buffer start. The frame ring frames are written
+ *          straight from the buffers (no copy); a single buffer VC frame is copied at its FrameEnd report, as the
+ *          next frame overwrites the buffer. For the direct I/O the buffers addresses and the region length must be
+ *          RSDK_CSI2_CAP_DIO_ALIGN multiples.
+ *
+ */
+typedef struct
+{
+    void        *pBuf[RSDK_CSI2_MAX_FRAME_BUFS];    /**< User-space addresses of the frame ring buffers, indexed by
+                                                     * rsdkCsi2Report_t::readyFrameBuf; only pBuf[0] for a single
+                                                     * buffer VC. NULL if the region is not recorded              */
+    uint32_t    lineLen;                            /**< Buffer line length, at least the length returned by
+                                                     * RsdkCsi2GetBufferRealLineLen                                 */
+    uint32_t    numLines;                           /**< Recorded lines                                             */
+} rsdkCsi2CapRegion_t;
+
+/**
+ * @brief   Definition of the callback called by the capture writer when a frame buffer is not used anymore.
+ * @details The buffer was written to the capture file or the frame was dropped. A frame ring buffer can be given
+ *          back to the driver (\ref RsdkCsi2ReleaseFrameBuf) once both the recorder and the processing are done.
+ *
+ */
+typedef void (*rsdkCsi2CapDoneCb_t)(const rsdkCsi2UnitId_t unitId, const rsdkCsi2VirtChnlId_t vcId,
+                                    const uint8_t bufIdx);
+
+/**
+ * @brief   Raw capture recorder parameters.
+ *
+ */
+typedef struct
+{
+    const char              *pFileName;             /**< The capture file, created or truncated                 */
+    rsdkCsi2CapRegion_t     data[RSDK_CSI2_MAX_UNITS][RSDK_CSI2_MAX_VC];    /**< Radar data regions, by unit & VC;
+                                                     * only the VCs with a data region are recorded                 */
+    rsdkCsi2CapRegion_t     aux[RSDK_CSI2_MAX_UNITS][RSDK_CSI2_MAX_VC];     /**< Auxiliary data regions          */
+    rsdkCsi2CapRegion_t     meta[RSDK_CSI2_MAX_UNITS][RSDK_CSI2_MAX_VC];    /**< Metadata regions; pBuf[0] only  */
+    uint32_t                queueLen;               /**< Frames queued to the writer, 1 ... RSDK_CSI2_CAP_QUEUE_LEN;
+                                                     * a frame found the queue full is dropped                      */
+    uint8_t                 directIo;               /**< 1 to write the file with O_DIRECT, if all the regions
+                                                     * are aligned (see rsdkCsi2CapStats_t::directIo)               */
+    rsdkCsi2CapDoneCb_t     pDone;                  /**< Called by the writer for each frame, can be NULL       */
+} rsdkCsi2CapParams_t;
+
+/**
+ * @brief   Raw capture recorder statistics.
+ *
+ */
+typedef struct
+{
+    uint32_t    framesWritten;                      /**< Frames written to the capture file                         */
+    uint32_t    framesDropped;                      /**< Frames dropped, the writer queue being full                */
+    uint32_t    writeErrors;                        /**< Frames not written because of an I/O error                 */
+    uint32_t    queueMax;                           /**< Maximum frames waiting in the writer queue                 */
+    uint64_t    bytesWritten;                       /**< Bytes written, the headers included                        */
+    uint64_t    timeElapsedUs;                      /**< Time since the capture start, in microseconds              */
+    uint64_t    writeTimeMaxUs;                     /**< Maximum time to write a frame, in microseconds             */
+    uint32_t    mbPerSec;                           /**< Sustained write rate, in MB/s : bytesWritten / timeElapsedUs */
+    uint8_t     directIo;                           /**< 1 if the file is written with O_DIRECT; 0 also after the
+                                                     * direct I/O was refused at a write (buffered from then on)    */
+} rsdkCsi2CapStats_t;
+
+
 /**
  * @brief   Definition of callback function type to be called by the CSI2 interrupt handler.
  * @details This callback must be used for processing a CSI2 error/event interrupt.<br>
@@ -599,6 +940,10 @@ typedef struct {
                                                  * managed. Use one of RSDK_CSI2_STAT_... definitions. The value is
                                                  * used only at least one of the VC channels has the DC offset
                                                  * specified as \ref RSDK_CSI2_OFFSET_AUTOCOMPUTE .                 */
+    uint8_t     dcEstimator;                    /**< The auto DC offset estimator, see \ref rsdkCsi2DCEstimator_t  */
+    uint8_t     dcEstParam;                     /**< The estimator parameter : smoothing shift for
+                                                 * \ref RSDK_CSI2_DC_EST_EMA, frames number for
+                                                 * \ref RSDK_CSI2_DC_EST_WINDOW                                     */
     uint32_t    rxClkFreq;                      /**< Receiving (Rx) frequency (between \ref RSDK_CSI2_MIN_RX_FREQ
                                                  * and \ref RSDK_CSI2_MAX_RX_FREQ), in Mbps.                        
                                                  * \if SAF85XX_DOCS For SAF85XX, this parameter define the data source :
@@ -698,6 +1043,73 @@ typedef struct {
 rsdkStatus_t RsdkCsi2Init(const rsdkCsi2UnitId_t unitId, const rsdkCsi2InitParams_t *pCsi2InitParam);
 
 
+/**
+ * @brief          Asynchronous CSI2 unit initialization (Linux only).
+ * @details        The initialization request is only queued and the call returns; the initialization itself is the
+ *                 one of \ref RsdkCsi2Init, done by the kernel driver without blocking the other driver calls.
+ *                 So several units can be initialized in parallel, the D-PHY calibration and the STOP state waits
+ *                 overlapping. A second unit of a D-PHY PLL pair (\if (S32R45_DOCS) \ref RSDK_CSI2_UNIT_1 /
+ *                 \ref RSDK_CSI2_UNIT_3 \endif) can be queued just after its first unit, its initialization
+ *                 starts when the first unit initialization ends. The end is reported by \ref RsdkCsi2InitWait.
+ *                 Until then, the other calls for the unit are rejected with RSDK_CSI2_DRV_WRG_STATE.
+ *
+ * @param[in] unitId            - unit : rsdkCsi2UnitID_t &isin; [ \ref RSDK_CSI2_UNIT_0 , \ref RSDK_CSI2_MAX_UNITS )
+ * @param[in] pCsi2InitParam    - pointer to the CSI2 Driver initialization structure, copied by the call
+ *
+ * @return \ref rsdkStatus_t - success or error status information.
+ * @retval RSDK_SUCCESS - the initialization was queued
+ * @retval RSDK_CSI2_DRV_WRG_UNIT_ID - wrong unit ID specified
+ * @retval RSDK_CSI2_DRV_NULL_PARAM_PTR - NULL pointer for the parameters
+ * @retval RSDK_CSI2_DRV_WRG_STATE - an initialization is already pending for the unit
+ *
+ */
+rsdkStatus_t RsdkCsi2InitAsync(const rsdkCsi2UnitId_t unitId, const rsdkCsi2InitParams_t *pCsi2InitParam);
+
+
+/**
+ * @brief          Wait for the end of an asynchronous CSI2 unit initialization (Linux only).
+ * @details        The result is kept until the next initialization request, so the call can be repeated. The wait
+ *                 is done on the unit device (RSDK_CSI2_IOC_INIT_WAIT), not by the driver RPC server, so it doesn't
+ *                 delay the calls for the other units. \ref RsdkCsi2Init and \ref RsdkCsi2PowerOn stay synchronous.
+ *
+ * @param[in] unitId            - unit : rsdkCsi2UnitID_t &isin; [ \ref RSDK_CSI2_UNIT_0 , \ref RSDK_CSI2_MAX_UNITS )
+ * @param[in] timeoutUs         - maximum waiting time, in microseconds
+ *
+ * @return \ref rsdkStatus_t - the initialization result, see \ref RsdkCsi2Init, or the wait error.
+ * @retval RSDK_CSI2_DRV_NOT_INIT - no asynchronous initialization requested for the unit
+ * @retval RSDK_CSI2_DRV_TIMER_ERROR - the initialization didn't end in timeoutUs
+ *
+ */
+rsdkStatus_t RsdkCsi2InitWait(const rsdkCsi2UnitId_t unitId, const uint32_t timeoutUs);
+
+
+/**
+ * @brief          The function reconfigure the Virtual Channels of an initialized CSI2 unit.
+ * @details        Only the Virtual Channels data path is programmed again : buffers, lines, data types, statistics,
+ *                 auxiliary and metadata buffers, triggers and VC interrupts. The interface is not reset and
+ *                 the D-PHY is not calibrated again, so a mode switch is much faster than a new \ref RsdkCsi2Init.
+ *                 The frames counters, the telemetry and the lines watermarks are reset.
+ *
+ * @param[in] unitId            - unit : rsdkCsi2UnitID_t &isin; [ \if (S32R45_DOCS || S32R294_DOCS)
+                                                            \ref RSDK_CSI2_UNIT_1 , \endif \ref RSDK_CSI2_MAX_UNITS )
+ * @param[in] pCsi2InitParam    - pointer to the CSI2 Driver initialization structure, with the new VCs; the lanes
+ *                                number, the lanes mapping and the Rx frequency range must be unchanged
+ *
+ * @return \ref rsdkStatus_t - success or error status information.
+ * @retval RSDK_SUCCESS - execution was successful
+ * @retval RSDK_CSI2_DRV_NOT_INIT - the unit was not initialized before
+ * @retval RSDK_CSI2_DRV_INVALID_LANES_NR - the lanes number is not the one in use
+ * @retval RSDK_CSI2_DRV_INVALID_RX_SWAP - the lanes mapping is not the one in use
+ * @retval RSDK_CSI2_DRV_INVALID_CLOCK_FREQ - the Rx frequency needs a new D-PHY programming
+ * @retval RSDK_CSI2_DRV_TOO_SMALL_BUFFER - a VC buffer is too small for the requested data
+ *
+ * @pre     The unit must be initialized and powered on. The call must be done between frames, e.g. after a
+ *          FrameEnd event or with the reception stopped; a frame in progress is lost.
+ *
+ */
+rsdkStatus_t RsdkCsi2ReconfigVC(const rsdkCsi2UnitId_t unitId, const rsdkCsi2InitParams_t *pCsi2InitParam);
+
+
 /**
  * @brief          The function stop the CSI2 receive module.
  * @details        The receive module of the CSI2 interface is stopped.
@@ -884,6 +1296,210 @@ rsdkStatus_t    RsdkCsi2SetCallback(const rsdkCsi2UnitId_t unitId, const rsdkCsi
         rsdkCsi2IsrCb_t pCallback);
 
 
+/**
+ * @brief       Procedure to give back a frame ring buffer to the driver.
+ * @details     The buffer was handed to the application by a \ref RSDK_CSI2_EVT_FRAME_READY event and, after this
+ *              call, it can be used again by the interface. Until released, the buffer is never written.
+ *
+ * @param[in] unitId    - unit : rsdkCsi2UnitID_t &isin; [ \if (S32R45_DOCS || S32R294_DOCS) \ref RSDK_CSI2_UNIT_1 ,
+                                                                    \endif \ref RSDK_CSI2_MAX_UNITS )
+ * @param[in] vcId      - Virtual Channel &isin; [ \ref RSDK_CSI2_VC_0 , \ref RSDK_CSI2_MAX_VC )
+ * @param[in] bufIdx    - the buffer index, as reported in rsdkCsi2Report_t::readyFrameBuf
+ *
+ * @return \ref rsdkStatus_t - success or error status information.
+ * @retval RSDK_SUCCESS - execution was successful
+ * @retval RSDK_CSI2_DRV_WRG_UNIT_ID - if a wrong unit or VC was specified
+ * @retval RSDK_CSI2_DRV_NOT_INIT - the VC is not initialized in frame ring mode
+ * @retval RSDK_CSI2_DRV_WRG_STATE - the buffer is not held by the application
+ *
+ */
+rsdkStatus_t    RsdkCsi2ReleaseFrameBuf(const rsdkCsi2UnitId_t unitId, const rsdkCsi2VirtChnlId_t vcId,
+        const uint8_t bufIdx);
+
+
+/**
+ * @brief       Procedure to get the unit throughput and jitter telemetry.
+ * @details     The telemetry is reset at each unit initialization. In Linux the same data is available as text in
+ *              /sys/class/rsdk_csi2/rsdk_csi2_N/telemetry.
+ *
+ * @param[in] unitId        - unit : rsdkCsi2UnitID_t &isin; [ \if (S32R45_DOCS || S32R294_DOCS) \ref RSDK_CSI2_UNIT_1 ,
+                                                                    \endif \ref RSDK_CSI2_MAX_UNITS )
+ * @param[out] pTelemetry   - pointer to the telemetry structure to be filled
+ *
+ * @return \ref rsdkStatus_t - success or error status information.
+ * @retval RSDK_SUCCESS - execution was successful
+ * @retval RSDK_CSI2_DRV_WRG_UNIT_ID - if a wrong unit was specified
+ * @retval RSDK_CSI2_DRV_NULL_PARAM_PTR - NULL pointer for the telemetry structure
+ *
+ */
+rsdkStatus_t    RsdkCsi2GetTelemetry(const rsdkCsi2UnitId_t unitId, rsdkCsi2Telemetry_t *pTelemetry);
+
+
+/**
+ * @brief       Procedure to get the lines committed watermark of a Virtual Channel.
+ * @details     The watermark is updated by the driver while the frame is received, see rsdkCsi2LineWatermark_t.
+ *              In Linux the pointer is inside the unit event ring mapped by the library in the user-space.
+ *
+ * @param[in] unitId    - unit : rsdkCsi2UnitID_t &isin; [ \if (S32R45_DOCS || S32R294_DOCS) \ref RSDK_CSI2_UNIT_1 ,
+                                                                    \endif \ref RSDK_CSI2_MAX_UNITS )
+ * @param[in] vcId      - Virtual Channel &isin; [ \ref RSDK_CSI2_VC_0 , \ref RSDK_CSI2_MAX_VC )
+ *
+ * @return      pointer to the VC watermark, NULL for a wrong unit/VC or a not initialized unit
+ *
+ */
+rsdkCsi2LineWatermark_t *RsdkCsi2GetLineWatermark(const rsdkCsi2UnitId_t unitId, const rsdkCsi2VirtChnlId_t vcId);
+
+
+/**
+ * @brief       Procedure to wait until a line is committed in the Virtual Channel buffer.
+ * @details     The line is a value of the free running lines counter, so the chirp n (1 ... expectedNumLines) of
+ *              the current frame is (rsdkCsi2LineWatermark_t::frameFirstLine + n). The watermark is updated at
+ *              LINEDONE, so the VC must have a not null bufNumLinesTrigger. In Linux the wait is done on the unit
+ *              device (RSDK_CSI2_IOC_WAIT_LINE), so it doesn't delay the other driver calls, as the frame release.
+ *
+ * @param[in] unitId    - unit : rsdkCsi2UnitID_t &isin; [ \if (S32R45_DOCS || S32R294_DOCS) \ref RSDK_CSI2_UNIT_1 ,
+                                                                    \endif \ref RSDK_CSI2_MAX_UNITS )
+ * @param[in] vcId      - Virtual Channel &isin; [ \ref RSDK_CSI2_VC_0 , \ref RSDK_CSI2_MAX_VC )
+ * @param[in] line      - the line counter value to wait for
+ * @param[in] timeoutUs - maximum waiting time, in microseconds
+ *
+ * @return \ref rsdkStatus_t - success or error status information.
+ * @retval RSDK_SUCCESS - the line was committed
+ * @retval RSDK_CSI2_DRV_WRG_UNIT_ID - if a wrong unit or VC was specified
+ * @retval RSDK_CSI2_DRV_NOT_INIT - the VC is not initialized or has no LINEDONE trigger
+ * @retval RSDK_CSI2_DRV_TIMER_ERROR - the line was not committed in timeoutUs
+ *
+ */
+rsdkStatus_t    RsdkCsi2WaitForLine(const rsdkCsi2UnitId_t unitId, const rsdkCsi2VirtChnlId_t vcId,
+        const uint32_t line, const uint32_t timeoutUs);
+
+
+/**
+ * @brief       Procedure to get a consistent copy of the unit status page.
+ * @details     The copy is taken without any driver call : in Linux the library maps the unit status page in the
+ *              user-space, so frequent status polls (interface/lane status, frames counters, errors) cost only some
+ *              memory loads. The copy is retried while the driver is updating the page.
+ *
+ * @param[in] unitId    - unit : rsdkCsi2UnitID_t &isin; [ \if (S32R45_DOCS || S32R294_DOCS) \ref RSDK_CSI2_UNIT_1 ,
+                                                                    \endif \ref RSDK_CSI2_MAX_UNITS )
+ * @param[out] pStatus  - pointer to the status structure to be filled
+ *
+ * @return \ref rsdkStatus_t - success or error status information.
+ * @retval RSDK_SUCCESS - execution was successful
+ * @retval RSDK_CSI2_DRV_WRG_UNIT_ID - if a wrong unit was specified
+ * @retval RSDK_CSI2_DRV_NULL_PARAM_PTR - NULL pointer for the status structure
+ * @retval RSDK_CSI2_DRV_NOT_INIT - the unit was never initialized
+ *
+ */
+rsdkStatus_t    RsdkCsi2ReadStatusPage(const rsdkCsi2UnitId_t unitId, rsdkCsi2StatusPage_t *pStatus);
+
+
+/**
+ * @brief       Procedure to configure the multi-unit frame synchronizer.
+ * @details     The FrameEnds of the member (unit, VC) pairs are grouped in cycles, so a single notification is
+ *              received for all the members of a cycle. A new configuration drops the cycle being collected, but
+ *              the cycles counter goes on.
+ *
+ * @param[in] pParams   - pointer to the synchronizer parameters
+ *
+ * @return \ref rsdkStatus_t - success or error status information.
+ * @retval RSDK_SUCCESS - execution was successful
+ * @retval RSDK_CSI2_DRV_NULL_PARAM_PTR - NULL pointer for the parameters
+ * @retval RSDK_CSI2_DRV_WRG_UNIT_ID - a member of a not existing unit or VC was specified
+ *
+ */
+rsdkStatus_t    RsdkCsi2SyncConfig(const rsdkCsi2SyncParams_t *pParams);
+
+
+/**
+ * @brief       Procedure to wait for the next cycle of the frame synchronizer.
+ * @details     The cycle next to lastCycleId is returned; if it was already dropped (only the last cycles are
+ *              kept), the oldest kept cycle is returned and rsdkCsi2SyncCycle_t::lostCycles is not 0. In Linux the
+ *              wait is done on a unit device (RSDK_CSI2_IOC_SYNC_WAIT), so it doesn't delay the other driver calls.
+ *
+ * @param[in] lastCycleId   - the last cycle received, 0 for the first call
+ * @param[in] timeoutUs     - maximum waiting time, in microseconds
+ * @param[out] pCycle       - pointer to the cycle structure to be filled
+ *
+ * @return \ref rsdkStatus_t - success or error status information.
+ * @retval RSDK_SUCCESS - a cycle was returned
+ * @retval RSDK_CSI2_DRV_NULL_PARAM_PTR - NULL pointer for the cycle structure
+ * @retval RSDK_CSI2_DRV_NOT_INIT - the synchronizer is not configured
+ * @retval RSDK_CSI2_DRV_TIMER_ERROR - no cycle closed in timeoutUs
+ *
+ */
+rsdkStatus_t    RsdkCsi2SyncWait(const uint32_t lastCycleId, const uint32_t timeoutUs, rsdkCsi2SyncCycle_t *pCycle);
+
+
+/**
+ * @brief       Procedure to start the raw capture recorder (Linux user-space only).
+ * @details     The recorder writes the frames given by \ref RsdkCsi2CapFrame to the capture file, from a writer
+ *              thread, so the processing is not delayed by the file writes. The file is a raw frames capture, see
+ *              rsdkCsi2CapFileHdr_t. Only one capture can run at a time.
+ *
+ * @param[in] pParams   - pointer to the recorder parameters
+ *
+ * @return \ref rsdkStatus_t - success or error status information.
+ * @retval RSDK_SUCCESS - execution was successful
+ * @retval RSDK_CSI2_DRV_NULL_PARAM_PTR - NULL pointer for the parameters or the file name
+ * @retval RSDK_CSI2_DRV_INVALID_VC_PARAMS - wrong queue length or no data region
+ * @retval RSDK_CSI2_DRV_WRG_STATE - a capture is already running
+ * @retval RSDK_CSI2_DRV_ERR_INVALID_REQ - the file or the single buffer VCs copies can't be created, or the writer
+ *                                         thread can't be started
+ *
+ */
+rsdkStatus_t    RsdkCsi2CapStart(const rsdkCsi2CapParams_t *pParams);
+
+
+/**
+ * @brief       Procedure to give the frames of an events report to the raw capture recorder.
+ * @details     To be called from the events callback. A recorded VC frame is queued to the writer at
+ *              \ref RSDK_CSI2_EVT_FRAME_READY (frame ring VC) or at \ref RSDK_CSI2_EVT_FRAME_END (single buffer VC).
+ *              A frame ring buffer is not copied, so it must not be written until rsdkCsi2CapParams_t::pDone is
+ *              called for it. A single buffer VC frame is copied here, so the call must end before the next frame
+ *              of the VC starts; only one such copy waits for the writer. A frame found the writer queue full, or
+ *              the copy of its VC still waiting, is dropped.
+ *
+ * @param[in] pReport   - pointer to the events report
+ *
+ * @return \ref rsdkStatus_t - success or error status information.
+ * @retval RSDK_SUCCESS - all the recorded frames of the report were queued
+ * @retval RSDK_CSI2_DRV_NULL_PARAM_PTR - NULL pointer for the report
+ * @retval RSDK_CSI2_DRV_NOT_INIT - no capture running
+ * @retval RSDK_CSI2_DRV_TOO_SMALL_BUFFER - at least one frame was dropped
+ *
+ */
+rsdkStatus_t    RsdkCsi2CapFrame(const rsdkCsi2Report_t *pReport);
+
+
+/**
+ * @brief       Procedure to get the raw capture recorder statistics.
+ *
+ * @param[out] pStats   - pointer to the statistics to be filled
+ *
+ * @return \ref rsdkStatus_t - success or error status information.
+ * @retval RSDK_SUCCESS - execution was successful
+ * @retval RSDK_CSI2_DRV_NULL_PARAM_PTR - NULL pointer for the statistics
+ * @retval RSDK_CSI2_DRV_NOT_INIT - no capture running
+ *
+ */
+rsdkStatus_t    RsdkCsi2CapGetStats(rsdkCsi2CapStats_t *pStats);
+
+
+/**
+ * @brief       Procedure to stop the raw capture recorder.
+ * @details     The frames already queued are written, then the file header is completed and the file closed.
+ *
+ * @param[out] pStats   - pointer to the final statistics to be filled, can be NULL
+ *
+ * @return \ref rsdkStatus_t - success or error status information.
+ * @retval RSDK_SUCCESS - execution was successful
+ * @retval RSDK_CSI2_DRV_NOT_INIT - no capture running
+ *
+ */
+rsdkStatus_t    RsdkCsi2CapStop(rsdkCsi2CapStats_t *pStats);
+
+
 #ifdef __cplusplus
 }
 #endif
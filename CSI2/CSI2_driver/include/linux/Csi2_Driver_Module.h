@@ -13,11 +13,16 @@
 #ifdef __KERNEL__
     #include <linux/cdev.h>
     #include <linux/interrupt.h>
+    #include <linux/workqueue.h>
+    #include <linux/mutex.h>
+    #include <linux/hrtimer.h>
 #endif
 #include "Csi2_Linux_Def.h"
 #include "rsdk_csi2_driver_api.h"
 #include "os_oal_waitqueue.h"
 #include "oal_comm_kernel.h"
+#include "oal_spinlock.h"
+#include "oal_bottom_half.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -26,6 +31,10 @@ extern "C" {
 /*==================================================================================================
 *                                      DEFINES AND MACROS
 ==================================================================================================*/
+// states of the unit asynchronous initialization (rsdkCsi2Device_t::initState)
+#define RSDK_CSI2_INIT_IDLE     0           // no asynchronous initialization requested
+#define RSDK_CSI2_INIT_PENDING  1           // initialization queued or running, the unit calls are rejected
+#define RSDK_CSI2_INIT_DONE     2           // initialization finished, the result is in initRez
 
 /*==================================================================================================
 *                                STRUCTURES AND OTHER TYPEDEFS
@@ -53,10 +62,35 @@ typedef struct
     volatile uint32_t   *pMemMapVirtDfs;          // base virtual address of the DFS registry
 
     OAL_RPCService_t    gspRpcServW, gspRpcServE;  // RPC servers for work & errors
-    // waitqueues, pipe & pipe indexes for reporting errors on CSI2
+    // waitqueue & event ring for reporting errors/events on CSI2; the waitqueue is also the poll() doorbell
     OAL_waitqueue_t     irqWaitQ;
-    volatile uint8_t    irqReadP, irqWriteP;
-    rsdkCsi2KernelErr_t irqErrorPipe[RSDK_CSI2_ERROR_QUEUE_LEN];
+    rsdkCsi2EvtRing_t   *pEvtRing;                 // vmalloc_user() memory, mmap-able by the user-space
+    uint32_t            evtRingSize;               // the ring records bytes, kernel copy (the ring is user writable)
+    uint32_t            evtReserveIdx;             // next byte index to be reserved by a producer
+    uint32_t            evtPubIdx;                 // published byte index, the kernel copy of the ring writeIdx
+    uint16_t            *pEvtRecLen;               // per ring slot (RSDK_CSI2_EVT_REC_ALIGN), the complete records
+                                                   // length until published, 0 otherwise; kernel private
+    atomic_t            evtDropPending;            // events dropped since the last recorded one
+    atomic_t            evtLost;                   // lostEvents & lostIrq kernel copies, mirrored in the ring
+    atomic_t            evtLostIrq[RSDK_CSI2_MAX_IRQ_ID];
+    OAL_waitqueue_t     lineWaitQ;                 // line waiters, woken by the events irq
+
+    // bottom half for the channels statistics & DC offsets, and its lock against the events irq
+    struct OAL_BottomHalf   statBh;
+    OAL_irqspinlock_t   statLock;
+
+    // flush timer for the LINEDONE ranges held by the moderation, and the lock of the held ranges
+    struct hrtimer      lineEvtTimer;
+    OAL_irqspinlock_t   lineEvtLock;
+
+    rsdkCsi2StatusPage_t    *pStatusPage;       // vmalloc_user() memory, mmap-able read-only by the user-space
+    OAL_irqspinlock_t   statusLock;             // serializes the status page writers (irq handlers & API calls)
+
+    // asynchronous unit initialization, executed by a work item out of the RPC server lock
+    struct work_struct  initWork;
+    uint8_t             *pInitData;             // kmalloc() copy of the request data, owned by the work item
+    atomic_t            initState;              // RSDK_CSI2_INIT_...
+    uint32_t            initRez;                // the initialization result, valid for RSDK_CSI2_INIT_DONE
 
 } rsdkCsi2Device_t;
 
@@ -65,12 +99,20 @@ typedef struct
 *                                GLOBAL VARIABLE DECLARATIONS
 ==================================================================================================*/
 extern rsdkCsi2Device_t *gpRsdkCsi2Device[RSDK_MIPICSI2_INTERFACES];
+// the frame synchronizer groups the units, so its lock and its waiters are not per unit
+extern OAL_irqspinlock_t gRsdkCsi2SyncLock;
+extern OAL_waitqueue_t   gRsdkCsi2SyncWaitQ;
+// the asynchronous initializations completion waiters, for all units, and the DFS lock (the DFS is shared)
+extern OAL_waitqueue_t   gRsdkCsi2InitWaitQ;
+extern struct mutex      gRsdkCsi2DfsLock;
 
 /*==================================================================================================
 *                                    FUNCTION PROTOTYPES
 ==================================================================================================*/
 int32_t RsdkCsi2RpcSrvInit(uint32_t unitId);
 int32_t RsdkCsi2RpcSrvExit(uint32_t unitId);
+void    RsdkCsi2InitWorkLinux(struct work_struct *pWork);
+long    RsdkCsi2IoctlWait(rsdkCsi2Device_t *pDev, uint32_t cmd, unsigned long arg);
 
 #ifdef __cplusplus
 }
@@ -12,6 +12,7 @@
 ==================================================================================================*/
 #include <linux/cdev.h>
 #include <linux/interrupt.h>
+#include <linux/hrtimer.h>
 #include "oal_comm_kernel.h"
 #include "oal_waitqueue.h"
 #include "CDD_Csi2.h"
@@ -40,6 +41,10 @@ extern "C" {
 extern irqreturn_t RsdkCsi2PhyIrqHandlerLinux(int32_t iIrq, void *pParams);
 extern irqreturn_t RsdkCsi2RxIrqHandlerLinux(int32_t iIrq, void *pParams);
 extern irqreturn_t RsdkCsi2EventsIrqHandlerLinux(int32_t iIrq, void *pParams);
+// Linux bottom half for the deferred channels statistics
+extern void RsdkCsi2StatBottomHalfLinux(uintptr_t devData);
+// Linux flush timer for the LINEDONE ranges held by the moderation
+extern enum hrtimer_restart RsdkCsi2LineEvtTimerLinux(struct hrtimer *pTimer);
 
 
 
@@ -12,6 +12,7 @@
 /*==================================================================================================
 *                                        INCLUDE FILES
 ==================================================================================================*/
+#include <linux/ioctl.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -23,8 +24,44 @@ extern "C" {
 #define RSDK_MIPICSI2_INTERFACES    4u
 #define RSDK_CSI2_RPC_WORK          "RsdkCsi2RpcW"  // RPC channel name for normal working
 #define RSDK_CSI2_RPC_ERROR         "RsdkCsi2RpcE"  // RPC channel name for error messages
-#define RSDK_CSI2_ERROR_QUEUE_LEN   4u              // the length of the error queue for each unit
 #define RSDK_CSI2_ERROR_TO_EXIT     0xfffffff0u     // fake error mask to signal closing user-space to kernel connection
+#define RSDK_CSI2_EVT_RING_SIZE     16384u          // default bytes of records in the per unit event ring
+#define RSDK_CSI2_EVT_RING_MIN_SIZE 1024u           // limits for the evt_ring_size module parameter (a power of 2)
+#define RSDK_CSI2_EVT_RING_MAX_SIZE 262144u
+#define RSDK_CSI2_EVT_RING_VERSION  5u              // layout version of the mmap-able event ring
+// size of the event ring with size bytes of records, to be used for the mmap() length
+#define RSDK_CSI2_EVT_RING_MAP_SIZE(size)   (sizeof(rsdkCsi2EvtRing_t) + (size))
+
+// event record types (rsdkCsi2EvtRecHdr_t::recType), besides the rsdkCsi2IrqId_t values
+#define RSDK_CSI2_EVT_REC_PAD       0xfeu           // padding up to the ring end, to be skipped
+#define RSDK_CSI2_EVT_REC_EXIT      0xffu           // the exit request, to close the user-space connection
+#define RSDK_CSI2_EVT_REC_ALIGN     8u              // records length & alignment in the ring
+// event record flags (rsdkCsi2EvtRecHdr_t::recFlags)
+#define RSDK_CSI2_EVT_REC_TOGGLE    0x01u           // the notToggledBits array follows the VC blocks
+#define RSDK_CSI2_EVT_REC_CH_STAT   0x02u           // the chStat arrays of the VCs with RSDK_CSI2_EVT_CHANNEL_STAT
+                                                    // follow, in VC order
+// VC block sub-records (rsdkCsi2EvtRecVc_t::subMask), in the order they follow the VC block, 8 bytes each
+#define RSDK_CSI2_EVT_SUB_FRAME     0x01u           // frameCounter (uint32_t), readyFrameBuf (uint8_t)
+#define RSDK_CSI2_EVT_SUB_TIME_FS   0x02u           // timeFrameStart (uint64_t)
+#define RSDK_CSI2_EVT_SUB_TIME_FE   0x04u           // timeFrameEnd (uint64_t)
+#define RSDK_CSI2_EVT_SUB_TIME_LD   0x08u           // timeLineDone (uint64_t)
+#define RSDK_CSI2_EVT_SUB_LINES     0x10u           // lineFirst, lineLast, expectedCRC, receivedCRC (uint16_t)
+#define RSDK_CSI2_EVT_SUB_PACKET    0x20u           // invalidPacketID, eccOneBitErrPos, lastDroppedData (uint8_t)
+#define RSDK_CSI2_EVT_SUB_LINE_LEN  0x40u           // lineLengthErr (rsdkCsi2LineLenErr_t)
+#define RSDK_CSI2_EVT_SUB_SHORT_PKT 0x80u           // shortPackets (rsdkCsi2ShortPacket_t)
+#define RSDK_CSI2_EVT_SUB_LEN       8u              // length of each VC sub-record
+// maximum length of an event record
+#define RSDK_CSI2_EVT_REC_MAX_LEN   (sizeof(rsdkCsi2EvtRecHdr_t) +                                                  \
+            (RSDK_CSI2_MAX_VC * (sizeof(rsdkCsi2EvtRecVc_t) + (8u * RSDK_CSI2_EVT_SUB_LEN))) +                      \
+            (RSDK_CSI2_MAX_CHANNEL * sizeof(uint16_t)) +                                                            \
+            (RSDK_CSI2_MAX_VC * RSDK_CSI2_MAX_CHANNEL * sizeof(rsdkCsi2ChStat_t)))
+#define RSDK_CSI2_STATUS_PAGE_PGOFF 1u              // mmap() page offset of the unit status page (read-only)
+// the blocking calls are done by ioctl() on the unit device (/dev/rsdk_csi2_N), not by the work RPC server : its
+// lock is taken for all the units, so a sleeping call would delay the calls of all the units
+#define RSDK_CSI2_IOC_MAGIC         'C'
+#define RSDK_CSI2_IOC_INIT_WAIT     _IOWR(RSDK_CSI2_IOC_MAGIC, 1, rsdkCsi2IocInitWait_t)
+#define RSDK_CSI2_IOC_WAIT_LINE     _IOWR(RSDK_CSI2_IOC_MAGIC, 2, rsdkCsi2IocWaitLine_t)
+#define RSDK_CSI2_IOC_SYNC_WAIT     _IOWR(RSDK_CSI2_IOC_MAGIC, 3, rsdkCsi2IocSyncWait_t)
 
 
 /*==================================================================================================
@@ -33,7 +70,7 @@ extern "C" {
 // calls identifiers for CSI2 work Linux RPC
 typedef enum
 {
-    RSDK_CSI2_LX_CALL_INIT = 0,       // unit initialization
+    RSDK_CSI2_LX_CALL_INIT = 0,       // unit initialization, synchronous
     RSDK_CSI2_LX_RX_STOP,             // unit Rx stop
     RSDK_CSI2_LX_RX_START,            // unit Rx start
     RSDK_CSI2_LX_POWER_OFF,           // unit power off
@@ -43,17 +80,117 @@ typedef enum
     RSDK_CSI2_LX_GET_CHIRP_LEN,       // get normal chirp length
     RSDK_CSI2_LX_GET_FRAMES,          // get number of received frames
     RSDK_CSI2_LX_GET_ERRORS,          // get errors
+    RSDK_CSI2_LX_RELEASE_FRAME,       // give back a frame ring buffer
+    RSDK_CSI2_LX_GET_TELEMETRY,       // get the unit telemetry
+    RSDK_CSI2_LX_WAIT_LINE,           // not served, replaced by RSDK_CSI2_IOC_WAIT_LINE
+    RSDK_CSI2_LX_RECONFIG_VC,         // unit VCs reconfiguration, D-PHY kept; request as for CALL_INIT_ASYNC
+    RSDK_CSI2_LX_SYNC_CONFIG,         // frame synchronizer configuration, for all units
+    RSDK_CSI2_LX_SYNC_WAIT,           // not served, replaced by RSDK_CSI2_IOC_SYNC_WAIT
+    RSDK_CSI2_LX_CALL_INIT_ASYNC,     // unit initialization queued, not waited; see RSDK_CSI2_IOC_INIT_WAIT; the
+                                      // VC, auxiliary and metadata configurations follow the parameters in the
+                                      // request, their pointers set to the configuration offset in the request
+    RSDK_CSI2_LX_INIT_WAIT,           // not served, replaced by RSDK_CSI2_IOC_INIT_WAIT
 } rsdkCsi2RpcCalls_t;
 
+// RSDK_CSI2_IOC_INIT_WAIT data : wait for the end of the queued initialization of the device unit
+typedef struct
+{
+    uint32_t            timeoutUs;          // maximum waiting time, in microseconds
+    uint32_t            rez;                // the initialization result (rsdkStatus_t) or the wait error, returned
+} rsdkCsi2IocInitWait_t;
+
+// RSDK_CSI2_IOC_WAIT_LINE data : wait for a line committed in a VC buffer of the device unit
+typedef struct
+{
+    uint32_t            vcId;               // the VC (rsdkCsi2VCId_t)
+    uint32_t            line;               // the line to wait for, counted from the frame start
+    uint32_t            timeoutUs;          // maximum waiting time, in microseconds
+    uint32_t            rez;                // the wait result (rsdkStatus_t), returned
+} rsdkCsi2IocWaitLine_t;
+
+// RSDK_CSI2_IOC_SYNC_WAIT data : wait for a frame synchronizer cycle; the synchronizer is for all the units, so the
+// call can be done on any unit device
+typedef struct
+{
+    uint32_t            lastCycleId;        // the last cycle received, 0 for the first call
+    uint32_t            timeoutUs;          // maximum waiting time, in microseconds
+    uint32_t            rez;                // the wait result (rsdkStatus_t), returned
+    uint32_t            reserved;           // keeps the cycle 64 bits aligned
+    rsdkCsi2SyncCycle_t cycle;              // the cycle, returned if rez is RSDK_SUCCESS
+} rsdkCsi2IocSyncWait_t;
+
 /*==================================================================================================
 *                                GLOBAL VARIABLE DECLARATIONS
 ==================================================================================================*/
-// structure for recording CSI2 errors in kernel
+/*  Compact event record, as written in the event ring.
+ *
+ *  A report (rsdkCsi2Report_t) is recorded as a header, then one block for each VC set in vcMask (in VC order),
+ *  each block followed by its sub-records (in the RSDK_CSI2_EVT_SUB_x bits order), then the unit level arrays
+ *  signaled by recFlags (notToggledBits, then the per frame channels statistics). Only the VCs with events or errors get a block and only the not null fields get a
+ *  sub-record, so a FrameStart/FrameEnd record is a few tens of bytes instead of a full report. The not recorded
+ *  fields are decoded as 0 (see Csi2_EvtDecodeLinuxUs).
+ *  The first 8 bytes (recLen, recType, unitId, seq) are the only ones valid for a RSDK_CSI2_EVT_REC_PAD record.
+ */
 typedef struct
 {
-    uint32_t            errType;
-    rsdkCsi2Report_t    errReport;
-} rsdkCsi2KernelErr_t;
+    uint16_t            recLen;             // record length in bytes, header included, RSDK_CSI2_EVT_REC_ALIGN multiple
+    uint8_t             recType;            // the reporting irq (rsdkCsi2IrqId_t) or RSDK_CSI2_EVT_REC_PAD/EXIT
+    uint8_t             unitId;             // the reporting unit
+    uint32_t            seq;                // (ring byte index + 1) of the record, informative only
+    uint32_t            dropped;            // events dropped (ring full) just before this one
+    uint32_t            errMaskU;           // rsdkCsi2Report_t::errMaskU
+    uint8_t             vcMask;             // VCs with a block in the record
+    uint8_t             recFlags;           // RSDK_CSI2_EVT_REC_x flags
+    uint16_t            reserved;
+    uint32_t            reserved2;
+    uint64_t            timestamp;          // the most recent of the recorded VCs timestamps, 0 if none
+} rsdkCsi2EvtRecHdr_t;
+
+// VC block of an event record
+typedef struct
+{
+    uint32_t            errMaskVC;          // rsdkCsi2Report_t::errMaskVC[vc]
+    uint8_t             evtMaskVC;          // rsdkCsi2Report_t::evtMaskVC[vc]
+    uint8_t             subMask;            // RSDK_CSI2_EVT_SUB_x sub-records following the block
+    uint16_t            reserved;
+} rsdkCsi2EvtRecVc_t;
+
+/*  Per unit event ring, shared between kernel and user-space.
+ *
+ *  The ring is allocated by the driver for each unit and can be mapped read/write by the user-space error thread
+ *  using mmap() on the unit device (/dev/rsdk_csi2_N), offset 0, size RSDK_CSI2_EVT_RING_MAP_SIZE(ringSize).
+ *  The records area size ringSize is set by the evt_ring_size module parameter (RSDK_CSI2_EVT_RING_SIZE by
+ *  default); it holds variable length records (rsdkCsi2EvtRecHdr_t), never wrapped around the area end.
+ *  It is a multiple producers (interrupt handlers & bottom half) / single consumer lock-free ring :
+ *      - the kernel producers reserve the space with an atomic index, so they never wait each other; a record
+ *        not fitting before the area end is preceded by a RSDK_CSI2_EVT_REC_PAD record filling the end
+ *      - writeIdx is written only by the kernel; it is advanced in order, only over complete records. It is a
+ *        mirror of the kernel private publication state: the kernel never reads back writeIdx, recLen or seq,
+ *        so a corrupted ring can only lose the consumer events
+ *      - readIdx is written only by the consumer, advanced by recLen after the record was used
+ *      - both indexes are free running byte indexes, the record is at evtData + (index & (ringSize - 1))
+ *      - the ring is empty when readIdx == writeIdx
+ *  The last header size is reserved for the exit request, so a full ring can still be closed.
+ *  When no space is available the event is dropped and accounted in lostEvents and lostIrq[irqId]; the next
+ *  recorded event reports in its dropped field the number of events lost just before it, so the consumer knows
+ *  where the gap is.
+ *  poll() on the unit device returns POLLIN while the ring is not empty, so many events can be drained per wakeup.
+ *  The same ring is drained by the RSDK_CSI2_LX_GET_ERRORS RPC (one record per call, pads skipped), so only one
+ *  consumer type must be used per unit.
+ *  The same mapping holds the VCs lines committed watermarks (see rsdkCsi2LineWatermark_t), so a line-granular
+ *  consumer can follow the reception without any system call.
+ */
+typedef struct
+{
+    volatile uint32_t   writeIdx;           // producer index, updated by kernel
+    volatile uint32_t   readIdx;            // consumer index, updated by user-space
+    uint32_t            version;            // RSDK_CSI2_EVT_RING_VERSION
+    uint32_t            ringSize;           // records area bytes, a power of 2
+    volatile uint32_t   lostEvents;         // events dropped because the ring was full
+    volatile uint32_t   lostIrq[RSDK_CSI2_MAX_IRQ_ID];      // the same, per interrupt
+    rsdkCsi2LineWatermark_t lineWm[RSDK_CSI2_MAX_VC];   // lines committed watermarks, updated by the events irq
+    uint64_t            evtData[];          // ringSize bytes of records
+} rsdkCsi2EvtRing_t;
 
 
 /*==================================================================================================
@@ -77,6 +214,29 @@ uint32_t     Csi2_GetBufferRealLineLenLinuxUs(const rsdkCsi2DataStreamType_t dat
 uint32_t     Csi2_GetFramesCounterLinuxUs(const rsdkCsi2UnitId_t unitId, const rsdkCsi2VirtChnlId_t vcId);
 rsdkStatus_t    Csi2_SetCallbackLinuxUs(const rsdkCsi2UnitId_t unitId, const rsdkCsi2IrqId_t irqId,
                                                             rsdkCsi2IsrCb_t pCallback);
+rsdkStatus_t    Csi2_ReleaseFrameBufLinuxUs(const rsdkCsi2UnitId_t unitId, const rsdkCsi2VirtChnlId_t vcId,
+                                                            const uint8_t bufIdx);
+rsdkStatus_t    Csi2_GetTelemetryLinuxUs(const rsdkCsi2UnitId_t unitId, rsdkCsi2Telemetry_t *pTelemetry);
+rsdkCsi2LineWatermark_t *Csi2_GetLineWatermarkLinuxUs(const rsdkCsi2UnitId_t unitId,
+                                                            const rsdkCsi2VirtChnlId_t vcId);
+rsdkStatus_t    Csi2_WaitForLineLinuxUs(const rsdkCsi2UnitId_t unitId, const rsdkCsi2VirtChnlId_t vcId,
+                                                            const uint32_t line, const uint32_t timeoutUs);
+rsdkStatus_t    Csi2_ModuleInitAsyncLinuxUs(const rsdkCsi2UnitId_t      unitId,
+                                                  const rsdkCsi2InitParams_t *pCsi2InitParam);
+rsdkStatus_t    Csi2_ModuleInitWaitLinuxUs(const rsdkCsi2UnitId_t unitId, const uint32_t timeoutUs);
+rsdkStatus_t    Csi2_ReconfigVCLinuxUs(const rsdkCsi2UnitId_t      unitId,
+                                                  const rsdkCsi2InitParams_t *pCsi2InitParam);
+rsdkStatus_t    Csi2_ReadStatusPageLinuxUs(const rsdkCsi2UnitId_t unitId, rsdkCsi2StatusPage_t *pStatus);
+uint32_t        Csi2_EvtDecodeLinuxUs(const void *pRec, const uint32_t recLen, rsdkCsi2Report_t *pReport);
+rsdkStatus_t    Csi2_SyncConfigLinuxUs(const rsdkCsi2SyncParams_t *pParams);
+rsdkStatus_t    Csi2_SyncWaitLinuxUs(const uint32_t lastCycleId, const uint32_t timeoutUs, rsdkCsi2SyncCycle_t *pCycle);
+rsdkStatus_t    Csi2_CapStartLinuxUs(const rsdkCsi2CapParams_t *pParams);
+rsdkStatus_t    Csi2_CapFrameLinuxUs(const rsdkCsi2Report_t *pReport);
+rsdkStatus_t    Csi2_CapGetStatsLinuxUs(rsdkCsi2CapStats_t *pStats);
+rsdkStatus_t    Csi2_CapStopLinuxUs(rsdkCsi2CapStats_t *pStats);
+
+// kernel-space encoder of the event records, the Csi2_EvtDecodeLinuxUs counterpart
+uint32_t        RsdkCsi2EvtRecEncodeLinux(const rsdkCsi2Report_t *pRep, uint8_t *pRec);
 
 
 #ifdef __cplusplus
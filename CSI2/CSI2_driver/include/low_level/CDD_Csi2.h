@@ -69,6 +69,12 @@ extern "C"{
 #define CSI2_SET_REGISTRY8(registryPtr, alignedMask, alignedValue) \
                 *(registryPtr) = (((*(registryPtr)) & (~((uint8)alignedMask))) | ((uint8)alignedValue))
 
+#if (CSI2_STATUS_PAGE_USAGE == STD_ON)
+/* Csi2_StatusPageUpdate irqId values, for the updates not done by an interrupt handler             */
+#define CSI2_STATUS_STATE_CHANGE    0xFFFFFFFFu     /* the unit state was changed                       */
+#define CSI2_STATUS_NEW_SETUP       0xFFFFFFFEu     /* new unit setup, the page counters are cleared    */
+#endif
+
 
 /*==================================================================================================
 *                                              ENUMS
@@ -84,6 +90,13 @@ extern "C"{
     extern Csi2_DriverParamsType gCsi2Settings[CSI2_MAX_UNITS];
     extern volatile GENERIC_CSI2_Type *gMipiCsi2RegsPtr[CSI2_MAX_UNITS];
     extern volatile uint32 gsCsi2FramesCounter[CSI2_MAX_UNITS][CSI2_MAX_VC];
+#if (CSI2_TELEMETRY_USAGE == STD_ON)
+    extern Csi2_TelemetryType gCsi2Telemetry[CSI2_MAX_UNITS];
+    extern volatile uint32 gCsi2TelemetrySeq[CSI2_MAX_UNITS][RSDK_CSI2_MAX_IRQ_ID];
+#endif
+#if (CSI2_REGS_MODEL_USED == STD_ON)
+    extern volatile GENERIC_CSI2_Type gCsi2RegsModel[CSI2_MAX_UNITS];
+#endif
 
 
 /*==================================================================================================
@@ -121,6 +134,29 @@ extern "C"{
  */
 Std_ReturnType Csi2_Setup(const Csi2_UnitIdType unitId, const Csi2_SetupParamsType *setupParamPtr);
 
+
+#if (CSI2_VC_RECONFIG_USAGE == STD_ON)
+/**
+ * @brief       This function reconfigure the Virtual Channels of a CSI2 unit, keeping the D-PHY locked.
+ * @details     Only the VCs, auxiliary and metadata buffers, the statistics management, the GPIO/SDMA triggers and
+ *              the VCs interrupts enablement are programmed again, without the interface reset, the D-PHY
+ *              calibration and the wait for the lanes stop state done by Csi2_Setup.
+ *              The lanes number, the lanes swap and the Rx frequency range must be the ones of the last Csi2_Setup.
+ *              The frames counters, the telemetry and the lines watermarks are reset.
+ *              If the VCs programming fails, the interface status is NOT_INITIALIZED.
+ *
+ * @param[in]   unitId          - the unit id to be used
+ * @param[in]   setupParamPtr   - pointer to the CSI2 Driver setup structure, with the new VCs configuration
+ *
+ * @return      Std_ReturnType  - success or error, detailed status information reported on Det.
+ *
+ * @pre         The unit must be ON or STOP (after a successful Csi2_Setup) and the call must be done between
+ *              frames, e.g. after a FrameEnd or with the reception stopped.
+ *
+ */
+Std_ReturnType Csi2_ReconfigVC(const Csi2_UnitIdType unitId, const Csi2_SetupParamsType *setupParamPtr);
+#endif
+
 #if (CSI2_RX_START_STOP_USAGE == STD_ON)
 /**
  * @brief       The function stop the CSI2 receive module.
@@ -264,6 +300,191 @@ uint32 Csi2_GetFramesCounter(const Csi2_UnitIdType unitId, const Csi2_VirtChnlId
 #endif
 
 
+#if (CSI2_FRAME_RING_USAGE == STD_ON)
+
+/**
+ * @brief       The function give back to the driver a buffer of the VC frame ring.
+ * @details     The buffer index is the one reported by the CSI2_EVT_FRAME_READY event. After this call the buffer
+ *              can be filled again by the interface, so the application must not use it anymore.
+ *
+ * @param[in]   unitId    - unit identifier
+ * @param[in]   vcId      - Virtual Channel identifier
+ * @param[in]   bufIdx    - the index of the buffer in the ring
+ *
+ * @return      Std_ReturnType - success or error, detailed status information reported on Det.
+ *
+ */
+Std_ReturnType Csi2_ReleaseFrameBuf(const Csi2_UnitIdType unitId, const Csi2_VirtChnlIdType vcId, const uint8 bufIdx);
+#endif
+
+
+#if (CSI2_TELEMETRY_USAGE == STD_ON)
+
+/**
+ * @brief       The function gets a consistent copy of the unit throughput and jitter telemetry.
+ * @details     The telemetry is updated lock-free by the interrupt handlers, each part having only one writer
+ *              which marks its updates in a sequence counter, so the copy is retried until no update overlaps it.
+ *              It is reset by Csi2_Setup.
+ *
+ * @param[in]   unitId      - unit identifier
+ * @param[out]  pTelemetry  - pointer to the structure to be filled
+ *
+ * @return      Std_ReturnType - success or error, detailed status information reported on Det.
+ *
+ */
+Std_ReturnType Csi2_GetTelemetry(const Csi2_UnitIdType unitId, Csi2_TelemetryType *pTelemetry);
+#endif
+
+
+#if (CSI2_LINE_WATERMARK_USAGE == STD_ON)
+
+/**
+ * @brief       The function return the lines committed watermark of a VC.
+ * @details     The watermark is updated by the events irq at each LINEDONE, so the application can read it at any
+ *              time; the consumer owns the linesConsumed and consumerOn fields. It is reset by Csi2_Setup.
+ *
+ * @param[in]   unitId    - unit identifier
+ * @param[in]   vcId      - Virtual Channel identifier
+ *
+ * @return      pointer to the VC watermark, NULL_PTR for a wrong unitId/vcId or a not initialized unit
+ *
+ */
+Csi2_LineWatermarkType *Csi2_GetLineWatermark(const Csi2_UnitIdType unitId, const Csi2_VirtChnlIdType vcId);
+
+/**
+ * @brief       The function wait until a line is committed in the VC buffer.
+ * @details     The line is a value of the free running lines counter, see Csi2_LineWatermarkType.
+ *
+ * @param[in]   unitId      - unit identifier
+ * @param[in]   vcId        - Virtual Channel identifier
+ * @param[in]   line        - the line counter value to wait for
+ * @param[in]   timeoutUs   - maximum waiting time, in microseconds
+ *
+ * @return      Std_ReturnType - E_OK if the line was committed, RSDK_CSI2_DRV_TIMER_ERROR for timeout, other
+ *              detailed status information reported on Det.
+ *
+ */
+Std_ReturnType Csi2_WaitForLine(const Csi2_UnitIdType unitId, const Csi2_VirtChnlIdType vcId, const uint32 line,
+                                const uint32 timeoutUs);
+#endif
+
+
+#if (CSI2_STATUS_PAGE_USAGE == STD_ON)
+
+/**
+ * @brief       The function update the unit status page.
+ * @details     Called at each interrupt handler end and at each unit state change. The update is done between
+ *              two increments of the page sequence counter, so the readers can detect a torn copy.
+ *
+ * @param[in]   unitId    - unit identifier
+ * @param[in]   irqId     - the handler irq ID, CSI2_STATUS_STATE_CHANGE or CSI2_STATUS_NEW_SETUP
+ * @param[in]   pErrorS   - pointer to the handler report, NULL_PTR if not called by a handler
+ *
+ */
+void Csi2_StatusPageUpdate(const Csi2_UnitIdType unitId, const uint32 irqId, const Csi2_ErrorReportType *pErrorS);
+
+/**
+ * @brief       The function return the unit status page.
+ * @details     The page can be read at any time, but only a copy taken as Csi2_ReadStatusPage does is consistent.
+ *
+ * @param[in]   unitId    - unit identifier
+ *
+ * @return      pointer to the unit status page, NULL_PTR for a wrong unitId or a unit never initialized
+ *
+ */
+const Csi2_StatusPageType *Csi2_GetStatusPage(const Csi2_UnitIdType unitId);
+
+/**
+ * @brief       The function take a consistent copy of the unit status page.
+ * @details     The copy is retried while the driver is updating the page; no lock is taken, so the call can be done
+ *              at any time, also from an interrupt handler.
+ *
+ * @param[in]   unitId    - unit identifier
+ * @param[out]  pStatus   - pointer to the structure to be filled
+ *
+ * @return      Std_ReturnType - success or error, detailed status information reported on Det.
+ *
+ */
+Std_ReturnType Csi2_ReadStatusPage(const Csi2_UnitIdType unitId, Csi2_StatusPageType *pStatus);
+#endif
+
+
+#if (CSI2_FRAME_SYNC_USAGE == STD_ON)
+
+/**
+ * @brief       The function configure the multi-unit frame synchronizer.
+ * @details     The FrameEnds of the members (unit, VC) are grouped in cycles, see Csi2_SyncCycleType. A new
+ *              configuration drops the cycle being collected; the cycles counter is not reset.
+ *
+ * @param[in]   pParams   - pointer to the synchronizer parameters
+ *
+ * @return      Std_ReturnType - success or error, detailed status information reported on Det.
+ *
+ */
+Std_ReturnType Csi2_SyncConfig(const Csi2_SyncParamsType *pParams);
+
+/**
+ * @brief       The function account a FrameEnd in the frame synchronizer.
+ * @details     Called by the events irq for each VC FrameEnd.
+ *
+ * @param[in]   unitId    - unit identifier
+ * @param[in]   vcId      - Virtual Channel identifier
+ * @param[in]   timeFe    - the FrameEnd timestamp
+ *
+ */
+void Csi2_SyncFrameEnd(const Csi2_UnitIdType unitId, const uint32 vcId, const uint64 timeFe);
+
+/**
+ * @brief       The function wait for the cycle next to lastCycleId.
+ * @details     If the next cycle was already dropped, the oldest kept cycle is returned, with the dropped cycles
+ *              number in lostCycles.
+ *
+ * @param[in]   lastCycleId - the last cycle already received, 0 for none
+ * @param[in]   timeoutUs   - maximum waiting time, in microseconds
+ * @param[out]  pCycle      - pointer to the cycle to be filled
+ *
+ * @return      Std_ReturnType - E_OK if a cycle was returned, RSDK_CSI2_DRV_TIMER_ERROR for timeout, other
+ *              detailed status information reported on Det.
+ *
+ */
+Std_ReturnType Csi2_SyncWait(const uint32 lastCycleId, const uint32 timeoutUs, Csi2_SyncCycleType *pCycle);
+#endif
+
+#if (CSI2_REPLAY_USAGE == STD_ON)
+
+/**
+ * @brief       The function replay a raw frames capture, read by a capture reader.
+ * @details     The frames are written in the buffers of the recorded unit/VC, set up before, and the unit registers
+ *              model is driven with the same FrameStart/LINEDONE/FrameEnd sequence as a real reception; the events
+ *              irq handler is called for each enabled event. See rsdkCsi2CapFileHdr_t for the capture format.
+ *
+ * @param[in]   pRead       - the capture reader
+ * @param[in]   pCtx        - the reader context, passed back to the reader
+ * @param[in]   pace        - the replay pacing
+ * @param[out]  pFramesNum  - the number of frames replayed; can be NULL
+ *
+ * @return      Std_ReturnType - success or error, detailed status information reported on Det.
+ *
+ */
+Std_ReturnType Csi2_ReplayStream(const Csi2_ReplayReadType pRead, void *pCtx, const Csi2_ReplayPaceType pace,
+                                 uint32 *pFramesNum);
+
+/**
+ * @brief       The function replay a raw frames capture from memory, for example a memory-mapped capture file.
+ *
+ * @param[in]   pCap        - the capture start address
+ * @param[in]   capLen      - the capture length, in bytes
+ * @param[in]   pace        - the replay pacing
+ * @param[out]  pFramesNum  - the number of frames replayed; can be NULL
+ *
+ * @return      Std_ReturnType - success or error, detailed status information reported on Det.
+ *
+ */
+Std_ReturnType Csi2_ReplayCapture(const void *pCap, const uint64 capLen, const Csi2_ReplayPaceType pace,
+                                  uint32 *pFramesNum);
+#endif
+
+
 /**
  * @brief       Get the real channels number of the VC..
  *
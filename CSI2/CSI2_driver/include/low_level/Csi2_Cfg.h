@@ -60,9 +60,98 @@ extern "C"{
     #define CSI2_FRAMES_COUNTER_USED                STD_ON
     #define CSI2_GPIO_USED                          STD_ON
     #define CSI2_SDMA_USED                          STD_ON
+    #define CSI2_FRAME_RING_USAGE                   STD_ON
+/* Pre-processor switch for the events timestamps; Linux uses the arch counter, a bare-metal build has a counter only
+ * if the platform defines CSI2_GET_TIMESTAMP & CSI2_GET_TIMESTAMP_FREQ, otherwise the timestamps are not used      */
+#ifndef CSI2_TIMESTAMP_USAGE
+#if defined(linux) || defined(CSI2_GET_TIMESTAMP)
+    #define CSI2_TIMESTAMP_USAGE                    STD_ON
+#else
+    #define CSI2_TIMESTAMP_USAGE                    STD_OFF
+#endif
+#endif
+/* Pre-processor switch for the per unit throughput and jitter telemetry, it needs the events timestamps    */
+#if (CSI2_TIMESTAMP_USAGE == STD_ON)
+    #define CSI2_TELEMETRY_USAGE                    STD_ON
+#else
+    #define CSI2_TELEMETRY_USAGE                    STD_OFF
+#endif
+/* Pre-processor switch for the lines committed watermark, shared with the line-granular consumers        */
+    #define CSI2_LINE_WATERMARK_USAGE               STD_ON
+/* Pre-processor switch for the LINEDONE events moderation, the time budget needs the events timestamps     */
+#if (CSI2_TIMESTAMP_USAGE == STD_ON)
+    #define CSI2_LINE_EVT_MODERATION                STD_ON
+#else
+    #define CSI2_LINE_EVT_MODERATION                STD_OFF
+#endif
+/* Pre-processor switch for the VCs reconfiguration with the D-PHY kept locked (no reset, no calibration)   */
+    #define CSI2_VC_RECONFIG_USAGE                  STD_ON
+/* Pre-processor switch for the unit status page, readable without a driver call (seqlock protected)        */
+    #define CSI2_STATUS_PAGE_USAGE                  STD_ON
+/* Pre-processor switch for the multi-unit frame synchronizer (one notification per cycle of FrameEnds on
+ * several units/VCs); the skew tolerance needs the events timestamps                                      */
+#if (CSI2_TIMESTAMP_USAGE == STD_ON)
+    #define CSI2_FRAME_SYNC_USAGE                   STD_ON
+#else
+    #define CSI2_FRAME_SYNC_USAGE                   STD_OFF
+#endif
+    #define CSI2_SYNC_CYCLES_NR                     8u      /* closed cycles kept for the waiters           */
+/* Pre-processor switch to move the channels statistics and the DC offsets update from the events interrupt
+ * to a bottom half; the bottom half is available only for Linux                                    */
+#if defined(linux) && (CSI2_STATISTIC_DATA_USAGE == STD_ON)
+    #define CSI2_DEFERRED_STATISTICS                STD_ON
+#else
+    #define CSI2_DEFERRED_STATISTICS                STD_OFF
+#endif
+/* Pre-processor switch for the NEON batch of the chirp statistics, used when all the channels are in use; only for
+ * bare-metal AArch64, the build can force the scalar batch with CSI2_STAT_NEON_USAGE=STD_OFF (test/host builds both).
+ * Linux always uses the scalar batch : the kernel code is built without the FP/SIMD registers
+ * (-mgeneral-regs-only) and a kernel_neon_begin/kernel_neon_end section in the statistics bottom half would save
+ * and restore the FP/SIMD state for each batch, more than the 4 channels batch saves                           */
+#ifndef CSI2_STAT_NEON_USAGE
+#if !defined(linux) && defined(__aarch64__) && defined(__ARM_NEON) && (CSI2_STATISTIC_DATA_USAGE == STD_ON) && \
+    (CSI2_AUTO_DC_COMPENSATION == STD_ON)
+    #define CSI2_STAT_NEON_USAGE                    STD_ON
+#else
+    #define CSI2_STAT_NEON_USAGE                    STD_OFF
+#endif
+#endif
+#if (CSI2_STAT_NEON_USAGE == STD_ON) && \
+    (defined(linux) || !defined(__aarch64__) || !defined(__ARM_NEON) || (CSI2_AUTO_DC_COMPENSATION == STD_OFF))
+    #error "CSI2 : the statistics NEON batch needs a bare-metal AArch64 build with NEON and the auto DC"
+#endif
+/* Pre-processor switch for the selectable DC offset estimators (moving average, last frames window); the
+ * estimators state is kept for each channel                                                        */
+#if (CSI2_AUTO_DC_COMPENSATION == STD_ON)
+    #define CSI2_DC_ESTIMATOR_USAGE                 STD_ON
+#else
+    #define CSI2_DC_ESTIMATOR_USAGE                 STD_OFF
+#endif
 
     #define CSI2_US_DELAY   1000u
 
+/* Pre-processor switch for a non-Linux host build, with the unit registers in an in-memory model
+ * (gCsi2RegsModel, defined by the build); such a build must also use CSI2_DFS_NOT_USED and can define
+ * CSI2_GET_TIMESTAMP/CSI2_GET_TIMESTAMP_FREQ for the host clock. The driver selects its Linux paths on the
+ * "linux" macro, which the GNU C modes (the gcc default, -std=gnu99/gnu11) predefine on a Linux host: such a build
+ * must use a strict ISO mode (-std=c99/c11) or -Ulinux. See test/host, built by "make test"/"make bench"    */
+#ifndef CSI2_REGS_MODEL_USED
+    #define CSI2_REGS_MODEL_USED                    STD_OFF
+#endif
+#if (CSI2_REGS_MODEL_USED == STD_ON) && (CSI2_DFS_USAGE != CSI2_DFS_NOT_USED)
+    #error "CSI2 : the registers model can't be used with the DFS reset"
+#endif
+#if (CSI2_REGS_MODEL_USED == STD_ON) && defined(linux)
+    #error "CSI2 : the registers model build must not define linux, use -std=c99/c11 or -Ulinux"
+#endif
+/* Pre-processor switch for the replay of recorded frames on a unit of the registers model; the replay uses the
+ * setup parameters copies, for the auxiliary data and metadata buffers                             */
+#if (CSI2_REGS_MODEL_USED == STD_ON) && !defined(linux) && (CSI2_POWER_ON_OFF_USAGE == STD_ON)
+    #define CSI2_REPLAY_USAGE                       STD_ON
+#else
+    #define CSI2_REPLAY_USAGE                       STD_OFF
+#endif
+
 
 /** @} */
 
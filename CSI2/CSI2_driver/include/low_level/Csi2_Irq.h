@@ -36,6 +36,11 @@ extern "C"{
 ==================================================================================================*/
 #include "Csi2_Cfg.h"
 #include "Csi2_Types.h"
+#if defined(linux) && (CSI2_TIMESTAMP_USAGE == STD_ON)
+    #include <linux/timex.h>
+    #include <asm/arch_timer.h>
+    #include <asm/barrier.h>
+#endif
 
 /*==================================================================================================
 *                                 SOURCE FILE VERSION INFORMATION
@@ -52,6 +57,32 @@ extern "C"{
 /*==================================================================================================
 *                                       DEFINES AND MACROS
 ==================================================================================================*/
+#if (CSI2_TIMESTAMP_USAGE == STD_ON) && !defined(CSI2_GET_TIMESTAMP)
+    #if defined(linux)
+        /* the arch (system) counter, monotonic and the same for all cores                                          */
+        #define CSI2_GET_TIMESTAMP()        ((uint64)get_cycles())
+        #define CSI2_GET_TIMESTAMP_FREQ()   ((uint64)arch_timer_get_cntfrq())
+    #else
+        /* no generic counter access for bare-metal, a null counter would silently break the time budgets          */
+        #error "CSI2 : CSI2_TIMESTAMP_USAGE needs CSI2_GET_TIMESTAMP & CSI2_GET_TIMESTAMP_FREQ defined by the platform"
+    #endif
+#endif
+#if defined(CSI2_GET_TIMESTAMP) != defined(CSI2_GET_TIMESTAMP_FREQ)
+    #error "CSI2 : CSI2_GET_TIMESTAMP & CSI2_GET_TIMESTAMP_FREQ must be defined together"
+#endif
+
+#if ((CSI2_STATUS_PAGE_USAGE == STD_ON) || (CSI2_FRAME_SYNC_USAGE == STD_ON) || (CSI2_TELEMETRY_USAGE == STD_ON)) \
+                                                                                    && !defined(CSI2_WRITE_BARRIER)
+    #if defined(linux)
+        /* the status page, the sync cycles & the telemetry are read by other cores, so a SMP barrier is required    */
+        #define CSI2_WRITE_BARRIER()        smp_wmb()
+        #define CSI2_READ_BARRIER()         smp_rmb()
+    #else
+        /* single core reader/writer by default (application & irq); for SMP the platform must define a DMB         */
+        #define CSI2_WRITE_BARRIER()        __asm__ volatile ("" ::: "memory")
+        #define CSI2_READ_BARRIER()         __asm__ volatile ("" ::: "memory")
+    #endif
+#endif
 
 /*==================================================================================================
 *                                              ENUMS
@@ -81,6 +112,19 @@ rsdkStatus_t
 Csi2_SetupUIrq(const Csi2_UnitIdType iUnit, volatile GENERIC_CSI2_Type *regsPtr,
                           const Csi2_SetupParamsType *initParamsPtr);
 
+#if (CSI2_VC_RECONFIG_USAGE == STD_ON)
+/*
+ * @brief       Update the VCs interrupts enablement, after a VCs reconfiguration
+ *
+ * @param[in]   iUnit   - unit ID, CSI2_UNIT_0 ... MAX
+ * @param[in]   pRegs   - pointer to unit registry
+ * @param[in]   pParams - pointer to CSI2 unit new parameters
+ *
+ */
+void Csi2_ReconfigUIrq(const Csi2_UnitIdType iUnit, volatile GENERIC_CSI2_Type *regsPtr,
+                          const Csi2_SetupParamsType *paramsPtr);
+#endif
+
 /*
  * @brief       Interrupt handlers prototypes
  *
@@ -90,6 +134,20 @@ Csi2_SetupUIrq(const Csi2_UnitIdType iUnit, volatile GENERIC_CSI2_Type *regsPtr,
 void Csi2_IrqHandlerEvents(const Csi2_UnitIdType iUnit);
 void Csi2_IrqHandlerPathErr(const Csi2_UnitIdType iUnit);
 void Csi2_IrqHandlerRxErr(const Csi2_UnitIdType iUnit);
+#if (CSI2_DEFERRED_STATISTICS == STD_ON)
+void Csi2_IrqDeferredStatistics(const Csi2_UnitIdType iUnit);
+#endif
+#if (CSI2_LINE_EVT_MODERATION == STD_ON)
+/*
+ * @brief       Report the held LINEDONE ranges which reached their latency deadline (the moderation flush timer)
+ *
+ * @param[in]   iUnit   - unit ID, CSI2_UNIT_0 ... MAX
+ *
+ * @return      the microseconds to the next deadline, 0 if nothing is held
+ *
+ */
+uint32 Csi2_LineEvtFlush(const Csi2_UnitIdType iUnit);
+#endif
 
 
 #ifdef __cplusplus
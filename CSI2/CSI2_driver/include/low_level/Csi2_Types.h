@@ -88,6 +88,12 @@ extern "C"{
 #define CSI2_ERR_SPURIOUS_PHY   (1UL << 22u)    /**< Spurious error at PHY level.                                   */
 #define CSI2_ERR_SPURIOUS_PKT   (1UL << 23u)    /**< Spurious error at Packet level.                                */
 #define CSI2_ERR_SPURIOUS_EVT   (1UL << 24u)    /**< Spurious error at Data level.                                  */
+/*<!-- frame ring errors ------------- -->                                                                          */
+#define CSI2_ERR_FRAME_OVERRUN  (1UL << 25u)    /**< Frame ring overrun, all other buffers still held by the
+                                                 * application, so the frame was dropped                            */
+/*<!-- line consumer errors ------------- -->                                                                       */
+#define CSI2_ERR_CONSUMER_OVERRUN (1UL << 26u)  /**< A buffer line was overwritten before the line consumer used
+                                                 * it, see Csi2_LineWatermarkType                                   */
 
 
 /**
@@ -99,10 +105,15 @@ extern "C"{
 #define CSI2_EVT_FRAME_END          (1UL << 1u) /**< Frame end event (FE)                                           */
 #define CSI2_EVT_SHORT_PACKET       (1UL << 2u) /**< Generic short packet received (GNSP)                           */
 #define CSI2_EVT_LINE_END           (1UL << 3u) /**< Line end event (LINEDONE)                                      */
+#define CSI2_EVT_CHANNEL_STAT       (1UL << 4u) /**< Channels statistics of the frame, reported at FrameEnd in
+                                                 * Csi2_ErrorReportType::chStat; needs the channels statistics
+                                                 * (statManagement not CSI2_AUTODC_NO)                               */
 #define CSI2_EVT_BIT_NOT_TOGGLE     (1UL << 5u) /**< Bit not toggled on a channel,
                                                  * reported in rsdkCsi2Report_t::notToggledBits.                    */
 #define CSI2_EVT_NEXT_START_NOT_0   (1UL << 6u) /**< Bit signaling that the next frame start will not be at
                                                  * the beginning of the buffer                                      */
+#define CSI2_EVT_FRAME_READY        (1UL << 7u) /**< Frame ring buffer ready, the buffer index is reported in
+                                                 * Csi2_ErrorReportType::readyFrameBuf                              */
 
 
 /*<!-- Specific min/max API working parameters. -------------- -->                                              */
@@ -113,6 +124,8 @@ extern "C"{
 #define CSI2_MIN_VAL_SIGNED            0xc000      /**< Definition for minimum signed sample value              */
 #define CSI2_MAX_VAL_UNSIGNED          0xffffu     /**< Definition for maximum unsigned sample value            */
 #define CSI2_MAX_VAL_SIGNED            0x7ff8      /**< Definition for maximum signed sample value              */
+#define CSI2_MAX_FRAME_BUFS            4u          /**< Maximum number of buffers in a VC frame ring            */
+#define CSI2_TELEMETRY_ERR_BITS        32u         /**< Number of error classes counted by the telemetry        */
 
 /*<!-- Frequency limits for each platform   ------------------ -->                                              */
 #define CSI2_MAX_RX_FREQ               2500u       /**< Max. 2.5Gbps input data for \b S32R45/S32R294           */
@@ -120,6 +133,10 @@ extern "C"{
 
 /*<!-- Some specific statistics definitions ------------------ -->                                              */
 #define CSI2_OFFSET_AUTOCOMPUTE       0x7fff       /**< Definition for auto computing offset for incoming data  */
+#define CSI2_DC_EMA_MAX_SHIFT          8u          /**< Maximum shift of the CSI2_DC_EST_EMA estimator          */
+#define CSI2_DC_WINDOW_MAX             16u         /**< Maximum frames of the CSI2_DC_EST_WINDOW estimator      */
+#define CSI2_DC_RECIP_SHIFT            47u         /**< Fixed point of the DC reciprocals; a frame sum is less
+                                                    * than 2^15 x samples, so sum x reciprocal fits in 63 bits  */
 #define CSI2_LINE_STAT_LENGTH          80U         /**< the length of statistic data                            */
 
 #define CSI2_5TH_CHANNEL_ON         0x400u         /**< bit to enable the fifth channel                         */
@@ -293,6 +310,21 @@ typedef enum {
     CSI2_AUTODC_MAX                  /**< Statistics max limit, to not be used in application                   */
 } Csi2_AutoDCComputeTimeType;
 
+/**
+ * @brief       Auto DC offset estimator type enum.
+ * @details     How the auto computed DC offset follows the frame mean given by the statistics. Mirror of
+ *              rsdkCsi2DCEstimator_t.
+ *
+ */
+typedef enum {
+    CSI2_DC_EST_FRAME = 0u,          /**< The offset is the mean of the last frame                              */
+    CSI2_DC_EST_EMA,                 /**< Exponential moving average of the frames means, the new mean weighted
+                                         * by 1 / 2^dcEstParam (dcEstParam = 1 ... CSI2_DC_EMA_MAX_SHIFT)       */
+    CSI2_DC_EST_WINDOW,              /**< Mean of the last dcEstParam frames means
+                                         * (dcEstParam = 2 ... CSI2_DC_WINDOW_MAX)                              */
+    CSI2_DC_EST_MAX                  /**< Estimators max limit, to not be used in application                   */
+} Csi2_DCEstimatorType;
+
 
 /**
  * @brief       Auto DC offset calculation (statistics management) type enum.
@@ -428,6 +460,14 @@ typedef enum {
     CSI2_API_ID_GET_BUFFER_LEN,     /** The ID for Csi2_GetBufferRealLineLen function                           */
     CSI2_API_ID_GET_FRAMES,         /** The ID for Csi2_GetFramesCounter function                               */
     CSI2_API_ID_GET_CHANNEL_NUM,    /** The ID for Csi2_GetChannelNum function                                  */
+    CSI2_API_ID_RELEASE_FRAME,      /** The ID for Csi2_ReleaseFrameBuf function                                */
+    CSI2_API_ID_WAIT_FOR_LINE,      /** The ID for Csi2_WaitForLine function                                    */
+    CSI2_API_ID_RECONFIG_VC,        /** The ID for Csi2_ReconfigVC function                                     */
+    CSI2_API_ID_READ_STATUS,        /** The ID for Csi2_ReadStatusPage function                                 */
+    CSI2_API_ID_SYNC_CONFIG,        /** The ID for Csi2_SyncConfig function                                     */
+    CSI2_API_ID_SYNC_WAIT,          /** The ID for Csi2_SyncWait function                                       */
+    CSI2_API_ID_GET_TELEMETRY,      /** The ID for Csi2_GetTelemetry function                                   */
+    CSI2_API_ID_REPLAY,             /** The ID for Csi2_ReplayStream/Csi2_ReplayCapture functions               */
     CSI2_API_ID_VERSION_INFO_CHECK  /** The ID for Csi2_GetVersionInfo function                                 */
 }Csi2_ApiFunctionIdType;
 
@@ -556,6 +596,10 @@ typedef struct {
     sint64   channelSum;            /* chirp channel sum                */
     sint16   channelDC;             /* current channel DC offset        */
     sint16   reqChannelDC;          /* current channel DC offset        */
+#endif
+#if (CSI2_DC_ESTIMATOR_USAGE == STD_ON)
+    sint32   dcEst;                 /* EMA (Q8) or window sum state     */
+    sint16   dcWin[CSI2_DC_WINDOW_MAX]; /* last frames means, window   */
 #endif
     sint16   channelMin;            /* chirp channel min                */
     sint16   channelMax;            /* chirp channel max                */
@@ -628,6 +672,21 @@ typedef struct {
                                                  * to application, if the CSI2_EVT_LINE_END is required in
                                                  * vcEventsReq. It correspond to RM - Table 81-7 -
                                                  * LINEDONE field and cap. 81.8.41                                   */
+#if (CSI2_FRAME_RING_USAGE == STD_ON)
+    uint8       frameBufNum;                    /**< Number of buffers in the frame ring, 0 or 1 = single buffer.
+                                                 * The ring buffer 0 is bufDataPtr.                                  */
+    void        *nextBufDataPtr[CSI2_MAX_FRAME_BUFS - 1u];
+                                                /**< Pointers to the ring buffers 1 ... frameBufNum-1, same size and
+                                                 * alignment as bufDataPtr, physical addresses                       */
+#endif
+#if (CSI2_LINE_EVT_MODERATION == STD_ON)
+    uint16      lineEvtMaxLines;                /**< LINEDONE moderation : maximum lines covered by one
+                                                 * CSI2_EVT_LINE_END report; 0 = no moderation, one report for each
+                                                 * bufNumLinesTrigger lines                                          */
+    uint32      lineEvtMaxLatencyUs;            /**< LINEDONE moderation : maximum delay, in microseconds, of a
+                                                 * covered line; the lines budget is adapted at each frame end to
+                                                 * the observed line rate. 0 = only lineEvtMaxLines is used           */
+#endif
 } Csi2_VCParamsType;
 
 
@@ -656,6 +715,20 @@ typedef struct {
 } Csi2_MetaDataParamsType;
 
 
+/**
+ * @brief       Channel statistics for one received frame.
+ * @details     Reported for each channel of a VC with CSI2_EVT_CHANNEL_STAT requested, in
+ *              Csi2_ErrorReportType::chStat. Mirror of rsdkCsi2ChStat_t.
+ *
+ */
+typedef struct {
+    sint16      chMin;              /**< Minimum sample value in the frame                                      */
+    sint16      chMax;              /**< Maximum sample value in the frame                                      */
+    sint16      chMean;             /**< Mean sample value in the frame (the measured DC level), over the lines
+                                     * used for the statistics (see Csi2_AutoDCComputeTimeType)                 */
+    uint16      chToggle;           /**< Bits toggled in the frame, 1 = toggled                                 */
+} Csi2_ChStatType;
+
 /**
  * @brief       Structure which describe the errors/events signaled by an interrupt request.
  * @details     The cumulated errors/events are put in this structure.
@@ -699,6 +772,19 @@ typedef struct {
                                                      * are set                                                       */
     Csi2_ShortPacketType shortPackets[CSI2_MAX_VC];  /**< Specific data for short packet received,
                                                      * if CSI2_EVT_SHORT_PACKET bit is set.                          */
+    uint8       readyFrameBuf[CSI2_MAX_VC];         /**< The frame ring buffer handed to the application, if
+                                                     * CSI2_EVT_FRAME_READY bit is set                               */
+    uint32      frameCounter[CSI2_MAX_VC];          /**< The VC frames counter at report time, the same value as
+                                                     * returned by Csi2_GetFramesCounter                             */
+    uint64      timeFrameStart[CSI2_MAX_VC];        /**< Timestamp (system counter ticks) of the last FrameStart     */
+    uint64      timeFrameEnd[CSI2_MAX_VC];          /**< Timestamp of the last FrameEnd; while a frame is received
+                                                     * it is older than timeFrameStart                               */
+    uint64      timeLineDone[CSI2_MAX_VC];          /**< Timestamp of the last LINEDONE                              */
+    uint16      lineFirst[CSI2_MAX_VC];             /**< First line (1 ... expectedNumLines) covered by the
+                                                     * CSI2_EVT_LINE_END report                                      */
+    uint16      lineLast[CSI2_MAX_VC];              /**< Last line covered by the CSI2_EVT_LINE_END report           */
+    Csi2_ChStatType chStat[CSI2_MAX_VC][CSI2_MAX_CHANNEL];  /**< Channels statistics of the frame, if
+                                                     * CSI2_EVT_CHANNEL_STAT is set for the VC                       */
 } Csi2_ErrorReportType;
 
 /**
@@ -714,6 +800,143 @@ typedef struct {
 typedef void (*Csi2_IsrCbType)(Csi2_ErrorReportType *pReportingStruct);
 
 
+#if (CSI2_TELEMETRY_USAGE == STD_ON)
+/**
+ * @brief   Throughput and jitter telemetry for one Virtual Channel, updated only by the events irq.
+ * @details All times are in system counter ticks. Mirror of rsdkCsi2VCTelemetry_t.
+ *
+ */
+typedef struct {
+    uint32      framesNum;                      /**< Frames received, FrameStart followed by FrameEnd           */
+    uint32      periodsNum;                     /**< FrameStart to FrameStart periods measured                  */
+    uint64      periodMin;                      /**< Minimum frame period                                       */
+    uint64      periodMax;                      /**< Maximum frame period                                       */
+    uint64      periodSum;                      /**< Sum of all the frame periods                               */
+    uint64      frameTimeMin;                   /**< Minimum FrameStart to FrameEnd duration                    */
+    uint64      frameTimeMax;                   /**< Maximum FrameStart to FrameEnd duration                    */
+    uint64      frameTimeSum;                   /**< Sum of all the FrameStart to FrameEnd durations            */
+    uint64      linesNum;                       /**< Lines (LINEDONE) received                                  */
+    uint64      timeFirstLine;                  /**< Timestamp of the first line                                */
+    uint64      timeLastLine;                   /**< Timestamp of the last line                                 */
+} Csi2_VCTelemetryType;
+
+/**
+ * @brief   Telemetry for one interrupt handler, updated only by that handler.
+ * @details Mirror of rsdkCsi2IrqTelemetry_t.
+ *
+ */
+typedef struct {
+    uint32      callsNum;                       /**< Number of handler executions                               */
+    uint32      reserved;
+    uint64      timeMax;                        /**< Maximum handler execution time                             */
+    uint64      timeSum;                        /**< Sum of the handler execution times                         */
+    uint32      errCount[CSI2_TELEMETRY_ERR_BITS];  /**< Reports of each error class (bit of errMaskU)          */
+} Csi2_IrqTelemetryType;
+
+/**
+ * @brief   Unit telemetry. Mirror of rsdkCsi2Telemetry_t.
+ *
+ */
+typedef struct {
+    uint64                  counterFreq;                /**< System counter frequency, 0 if unknown             */
+    Csi2_IrqTelemetryType   irq[RSDK_CSI2_MAX_IRQ_ID];  /**< Per interrupt handler                              */
+    Csi2_VCTelemetryType    vc[CSI2_MAX_VC];            /**< Per Virtual Channel                                */
+} Csi2_TelemetryType;
+#endif
+
+#if (CSI2_LINE_WATERMARK_USAGE == STD_ON)
+/**
+ * @brief   Lines committed watermark of a Virtual Channel, shared with the line consumer.
+ * @details Mirror of rsdkCsi2LineWatermark_t. All line counters are free running since the unit setup, so the
+ *          counter value L is the chirp (L - frameFirstLine) of the frame, in the buffer line
+ *          ((L - frameFirstLine - 1) % bufNumLines). The watermark is updated at each LINEDONE interrupt,
+ *          enabled for the VC by a not null bufNumLinesTrigger.
+ *
+ */
+typedef struct {
+    volatile uint32 frameSeq;                   /**< Frames started on the VC                                   */
+    volatile uint32 frameFirstLine;             /**< Line counter value at the current FrameStart               */
+    volatile uint32 linesCommitted;             /**< Lines completely written in the buffer                     */
+    volatile uint32 linesConsumed;              /**< Lines already used, written only by the consumer           */
+    volatile uint32 consumerOn;                 /**< Written by the consumer, not 0 to check for overrun        */
+    volatile uint32 overruns;                   /**< Consumer overruns detected (CSI2_ERR_CONSUMER_OVERRUN)     */
+} Csi2_LineWatermarkType;
+#endif
+
+#if (CSI2_STATUS_PAGE_USAGE == STD_ON)
+/**
+ * @brief   Unit status page, the unit status readable with plain memory loads.
+ * @details Mirror of rsdkCsi2StatusPage_t. The page is updated by the driver at each interrupt handler end and at
+ *          each unit state change. The writer increments seq before and after the update, so seq is odd while the
+ *          page is written; a reader copies the page between two reads of seq and retries if seq was odd or was
+ *          changed (see Csi2_ReadStatusPage).
+ *
+ */
+typedef struct {
+    volatile uint32 seq;                        /**< Sequence counter, odd while the page is updated            */
+    volatile uint32 ifaceStatus;                /**< Interface status, as Csi2_GetInterfaceStatus               */
+    volatile uint32 laneStatus[CSI2_MAX_LANE];  /**< Lanes status at the last state change or error report, as
+                                                 *  Csi2_GetLaneStatus                                          */
+    volatile uint32 framesCounter[CSI2_MAX_VC]; /**< Received frames, as Csi2_GetFramesCounter                  */
+    volatile uint32 irqCount[RSDK_CSI2_MAX_IRQ_ID];     /**< Executions of each interrupt handler               */
+    volatile uint32 errCount[RSDK_CSI2_MAX_IRQ_ID];     /**< Reports with errors, for each interrupt handler    */
+    volatile uint32 lastErrMask[RSDK_CSI2_MAX_IRQ_ID];  /**< The last not null errMaskU, for each handler       */
+    volatile uint32 reserved;
+    volatile uint64 timeUpdate;                 /**< Timestamp of the last update, 0 if timestamps not used     */
+} Csi2_StatusPageType;
+#endif
+
+#if (CSI2_FRAME_SYNC_USAGE == STD_ON)
+/**
+ * @brief   Multi-unit frame synchronizer parameters. Mirror of rsdkCsi2SyncParams_t.
+ * @details The members are (unit, VC) pairs; the member bit is (unit * CSI2_MAX_VC + VC).
+ *
+ */
+typedef struct {
+    uint32          memberMask;                 /**< The members of a cycle; 0 to stop the synchronizer         */
+    uint32          skewUs;                     /**< Maximum time between the first and the last member FrameEnd
+                                                 *  of a cycle, in microseconds                                 */
+} Csi2_SyncParamsType;
+
+/**
+ * @brief   A cycle closed by the frame synchronizer. Mirror of rsdkCsi2SyncCycle_t.
+ * @details A cycle is closed when all the members reported FrameEnd (complete cycle) or, with the missing members,
+ *          when a member reports FrameEnd again or out of the skew window.
+ *
+ */
+typedef struct {
+    uint32          cycleId;                    /**< Closed cycles counter, the first cycle is 1                */
+    uint32          presentMask;                /**< The members with FrameEnd in the cycle                     */
+    uint32          missingMask;                /**< The members without FrameEnd, 0 for a complete cycle       */
+    uint32          lostCycles;                 /**< Cycles closed after the requested one and already dropped  */
+    uint64          timeFirst;                  /**< Timestamp of the first member FrameEnd                     */
+    uint64          timeLast;                   /**< Timestamp of the last member FrameEnd                      */
+    uint32          frameCounter[CSI2_MAX_UNITS * CSI2_MAX_VC]; /**< Frames counter of each present member, at its
+                                                 *  FrameEnd (the FrameEnd frame included), by member bit       */
+} Csi2_SyncCycleType;
+#endif
+
+#if (CSI2_REPLAY_USAGE == STD_ON)
+/**
+ * @brief   Replay pacing.
+ *
+ */
+typedef enum {
+    CSI2_REPLAY_FAST = 0u,                      /**< The frames are replayed as fast as possible                 */
+    CSI2_REPLAY_PACED                           /**< The events are replayed at the recorded times, relative to
+                                                 *  the first replayed event                                     */
+} Csi2_ReplayPaceType;
+
+/**
+ * @brief   Capture reader, used by the replay to get the capture bytes in order.
+ * @details The reader must copy the next len bytes of the capture to pDst and return the number of bytes copied;
+ *          less than len only at the capture end. A file can be replayed with a reader based on fread.
+ *
+ */
+typedef uint32 (*Csi2_ReplayReadType)(void *pCtx, void *pDst, const uint32 len);
+#endif
+
+
 /**
  * @brief       Structure for unit configuration.
  * @details     The structure accepts setup of all available Virtual Channels (VC), but using only one data
@@ -738,6 +961,9 @@ typedef struct {
                                                      * CSI2_OFFSET_AUTOCOMPUTE DC offset specified will be
                                                      * managed. Use one of CSI2_STAT_... definitions.
                                                      * Use Csi2_AutoDCComputeTimeType to set this field.             */
+    uint8           dcEstimator;                    /**< The auto DC offset estimator, see Csi2_DCEstimatorType     */
+    uint8           dcEstParam;                     /**< The estimator parameter : smoothing shift for
+                                                     * CSI2_DC_EST_EMA, frames number for CSI2_DC_EST_WINDOW         */
 #endif
     uint32          rxClkFreq;                      /**< Receiving (Rx) frequency (between CSI2_MIN_RX_FREQ
                                                      * and CSI2_MAX_RX_FREQ), in Mbps.                               */
@@ -803,6 +1029,52 @@ typedef struct {
 #if (CSI2_STATISTIC_DATA_USAGE == STD_ON)
     Csi2_ChFrameStatType    statDC[CSI2_MAX_CHANNEL];      /* statistics for DC computation for all channels        */
 #endif
+#if (CSI2_AUTO_DC_COMPENSATION == STD_ON)
+    uint64      dcRecip;                        /* reciprocal of the samples number of the frame mean, Q47          */
+    uint64      dcDiv;                          /* the samples number of the frame mean, for the exact quotient     */
+#endif
+#if (CSI2_DC_ESTIMATOR_USAGE == STD_ON)
+    uint64      dcWinRecip;                     /* reciprocal of the window frames number, Q47                      */
+    uint8       dcEstimator;                    /* the DC estimator, Csi2_DCEstimatorType                           */
+    uint8       dcEstParam;                     /* the DC estimator parameter                                       */
+    uint8       dcWinPos;                       /* the oldest frame in the window                                   */
+    uint8       dcEstInit;                      /* 0 = the next frame mean initializes the estimator                */
+#endif
+#if (CSI2_DEFERRED_STATISTICS == STD_ON)
+    volatile uint16 statLineHead;               /* buffer line latched by the irq, the buffer index wraps           */
+    uint16      statLineTail;                   /* buffer line to be processed next by the bottom half              */
+    volatile uint16 statFeLines;                /* lines to be processed at FrameEnd, 0 = no FrameEnd pending       */
+#if (CSI2_AUTO_DC_COMPENSATION == STD_ON)
+    volatile uint8  dcPending;                  /* new DC offsets computed, written at the next FrameStart          */
+#endif
+#endif
+#if (CSI2_FRAME_RING_USAGE == STD_ON)
+    uint8       frameBufCrt;                    /* the ring buffer currently written by the interface               */
+    uint8       frameBufStat;                   /* the ring buffer used for the channels statistics                 */
+    volatile uint8  frameBufOut[CSI2_MAX_FRAME_BUFS];   /* ready tokens handed to the application, per buffer       */
+    volatile uint8  frameBufBack[CSI2_MAX_FRAME_BUFS];  /* tokens released by the application, per buffer           */
+#ifdef linux
+    void        *pFrameVirtData[CSI2_MAX_FRAME_BUFS];   // virtual memory pointers to the ring buffers, from kernel
+#endif
+#endif
+#if (CSI2_TIMESTAMP_USAGE == STD_ON)
+    uint64      timeFrameStart;                 /* timestamp of the last FrameStart                                 */
+    uint64      timeFrameEnd;                   /* timestamp of the last FrameEnd                                   */
+    uint64      timeLineDone;                   /* timestamp of the last LINEDONE                                   */
+#endif
+#if (CSI2_LINE_WATERMARK_USAGE == STD_ON)
+    volatile uint32 lineWaitFor;                /* the lowest line counter value waited for, 0 = no waiter          */
+    uint8       lineWmOverrun;                  /* consumer overrun already reported                                */
+#endif
+#if (CSI2_LINE_EVT_MODERATION == STD_ON)
+    uint16      lineEvtFirst;                   /* first line of the pending LINEDONE range, 0 = nothing pending    */
+    uint16      lineEvtLast;                    /* last line of the pending LINEDONE range                          */
+    uint16      lineEvtBudget;                  /* adaptive lines budget for one LINEDONE report                    */
+    uint32      lineEvtPeriod;                  /* filtered LINEDONE trigger period, in counter ticks               */
+    uint64      lineEvtLatency;                 /* latency budget, in counter ticks                                 */
+    uint64      lineEvtTimeFirst;               /* timestamp of the first pending LINEDONE trigger                  */
+    uint64      lineEvtTimeLast;                /* timestamp of the last LINEDONE trigger, 0 = none in this frame   */
+#endif
 #if (CSI2_METADATA_DATA_USAGE == STD_ON)
     uint8       metaDataUsage;                  /* mask for metadata usage                                          */
 #endif
@@ -824,6 +1096,20 @@ typedef struct {
                                                     // - errors in datapath level
                                                     // - events
                                                     // - turnaround and tx errors/events
+#if (CSI2_TIMESTAMP_USAGE == STD_ON)
+    uint64                      timeIrq;            /* timestamp taken at the events irq entry          */
+#endif
+#if (CSI2_LINE_WATERMARK_USAGE == STD_ON)
+    Csi2_LineWatermarkType      *pLineWm;           /* the VCs lines watermarks, shared memory          */
+#endif
+#if (CSI2_STATUS_PAGE_USAGE == STD_ON)
+    Csi2_StatusPageType         *pStatusPage;       /* the unit status page, shared memory              */
+#endif
+#if (CSI2_VC_RECONFIG_USAGE == STD_ON)
+    uint32                      rxClkFreq;          /* the Rx frequency the D-PHY is locked at, in Mbps */
+    uint8                       numLanesRx;         /* the number of data lanes in use                  */
+    uint8                       lanesSwap;          /* the lanes swap programmed in RX_RXLANESWAP       */
+#endif
     /* VC level working params                                                                          */
     Csi2_VCDriverStateType      workingParamVC[CSI2_MAX_VC];
 } Csi2_DriverParamsType;
@@ -16,10 +16,18 @@
 #include <linux/of.h>
 #include <linux/of_address.h>
 #include <linux/of_irq.h>
+#include <linux/slab.h>
 #include <linux/device.h>
 #include <linux/platform_device.h>
 #include <linux/uaccess.h>
 #include <linux/clk.h>
+#include <linux/mm.h>
+#include <linux/vmalloc.h>
+#include <linux/poll.h>
+#include <linux/math64.h>
+#include <linux/version.h>
+#include <linux/moduleparam.h>
+#include <linux/log2.h>
 
 #include "Csi2_Driver_Module.h"
 #include "Csi2_Interrupts.h"
@@ -51,6 +59,11 @@ MODULE_AUTHOR("NXP Semiconductors");
 MODULE_DESCRIPTION("NXP MIPICSI2 Driver");
 MODULE_VERSION("4.1");
 
+// event ring records bytes per unit, a power of 2 in [RSDK_CSI2_EVT_RING_MIN_SIZE, RSDK_CSI2_EVT_RING_MAX_SIZE]
+static uint evt_ring_size = RSDK_CSI2_EVT_RING_SIZE;
+module_param(evt_ring_size, uint, 0444);
+MODULE_PARM_DESC(evt_ring_size, "CSI2 event ring bytes per unit, a power of 2 (default 16384)");
+
 
 /*==================================================================================================
 *                                             ENUMS
@@ -75,6 +88,10 @@ static const struct of_device_id gsRsdkCsi2Match[] = {
 };
 
 rsdkCsi2Device_t *gpRsdkCsi2Device[RSDK_MIPICSI2_INTERFACES] = {NULL, NULL, NULL, NULL};
+OAL_irqspinlock_t gRsdkCsi2SyncLock;            // frame synchronizer lock, for all units
+OAL_waitqueue_t   gRsdkCsi2SyncWaitQ;           // frame synchronizer cycles waiters
+OAL_waitqueue_t   gRsdkCsi2InitWaitQ;           // asynchronous initializations completion waiters
+DEFINE_MUTEX(gRsdkCsi2DfsLock);                 // DFS reset lock, the DFS is shared by the units
 
 /*==================================================================================================
 *                                       FUNCTIONS
@@ -129,6 +146,177 @@ static int RsdkCsi2Release(struct inode *pInode, struct file *pFile)
     return err;
 }
 
+/******************************************************************************/
+/**
+ * @brief   Map the unit event ring or the unit status page into the user-space
+ * @details The ring is mapped with offset 0; the status page with offset RSDK_CSI2_STATUS_PAGE_PGOFF pages,
+ *          read-only.
+ */
+static int RsdkCsi2Mmap(struct file *pFile, struct vm_area_struct *pVma)
+{
+    rsdkCsi2Device_t *pRsdkCsi2Device = (rsdkCsi2Device_t *)pFile->private_data;
+    int32_t           err = 0;
+
+    if ((pRsdkCsi2Device == NULL) || (pRsdkCsi2Device->pEvtRing == NULL) || (pRsdkCsi2Device->pStatusPage == NULL))
+    {
+        err = -ENODEV;
+    }
+    else if (pVma->vm_pgoff == RSDK_CSI2_STATUS_PAGE_PGOFF)
+    {
+        if ((pVma->vm_end - pVma->vm_start) > PAGE_ALIGN(sizeof(rsdkCsi2StatusPage_t)))
+        {
+            (void)pr_err("RsdkCsi2Mmap: wrong size for the status page.\n");
+            err = -EINVAL;
+        }
+        else if ((pVma->vm_flags & VM_WRITE) != 0u)
+        {
+            err = -EPERM;                                   // the status page is written only by the driver
+        }
+        else
+        {
+            // no later mprotect() to writable
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(6, 3, 0)
+            vm_flags_clear(pVma, VM_MAYWRITE);
+#else
+            pVma->vm_flags &= ~VM_MAYWRITE;
+#endif
+            err = remap_vmalloc_range(pVma, pRsdkCsi2Device->pStatusPage, 0);
+        }
+    }
+    else if ((pVma->vm_pgoff != 0u) || 
+            ((pVma->vm_end - pVma->vm_start) > PAGE_ALIGN(RSDK_CSI2_EVT_RING_MAP_SIZE(pRsdkCsi2Device->evtRingSize))))
+    {
+        (void)pr_err("RsdkCsi2Mmap: wrong offset/size for the event ring.\n");
+        err = -EINVAL;
+    }
+    else
+    {
+        err = remap_vmalloc_range(pVma, pRsdkCsi2Device->pEvtRing, 0);
+    }
+    return err;
+}
+
+/******************************************************************************/
+/**
+ * @brief   Poll the unit event ring
+ * @details The device is readable while the event ring is not empty.
+ */
+static __poll_t RsdkCsi2Poll(struct file *pFile, struct poll_table_struct *pWait)
+{
+    rsdkCsi2Device_t *pRsdkCsi2Device = (rsdkCsi2Device_t *)pFile->private_data;
+    __poll_t          mask = 0;
+
+    if ((pRsdkCsi2Device == NULL) || (pRsdkCsi2Device->pEvtRing == NULL))
+    {
+        mask = EPOLLERR;
+    }
+    else
+    {
+        poll_wait(pFile, &pRsdkCsi2Device->irqWaitQ, pWait);
+        if (READ_ONCE(pRsdkCsi2Device->pEvtRing->readIdx) != smp_load_acquire(&pRsdkCsi2Device->evtPubIdx))
+        {
+            mask = EPOLLIN | EPOLLRDNORM;
+        }
+    }
+    return mask;
+}
+
+/******************************************************************************/
+/**
+ * @brief   Blocking calls of the unit, see RSDK_CSI2_IOC_x
+ * @details No lock is taken here, so a sleeping call does not delay the RPC calls nor the other waiters.
+ */
+static long RsdkCsi2Ioctl(struct file *pFile, unsigned int cmd, unsigned long arg)
+{
+    rsdkCsi2Device_t *pRsdkCsi2Device = (rsdkCsi2Device_t *)pFile->private_data;
+    long              err;
+
+    if (pRsdkCsi2Device == NULL)
+    {
+        err = -ENODEV;
+    }
+    else
+    {
+        err = RsdkCsi2IoctlWait(pRsdkCsi2Device, (uint32_t)cmd, arg);
+    }
+    return err;
+}
+
+#if (CSI2_TELEMETRY_USAGE == STD_ON)
+/******************************************************************************/
+/**
+ * @brief   Show the unit telemetry in sysfs
+ * @details /sys/class/rsdk_csi2/rsdk_csi2_N/telemetry, times in system counter ticks; the same data, binary, is
+ *          available by the RSDK_CSI2_LX_GET_TELEMETRY RPC.
+ */
+static ssize_t RsdkCsi2TelemetryShow(struct device *pDev, struct device_attribute *pAttr, char *pBuf)
+{
+    static const char *const irqNames[RSDK_CSI2_MAX_IRQ_ID] = {"rx_err", "path_err", "events"};
+    rsdkCsi2Device_t         *pRsdkCsi2Dev = (rsdkCsi2Device_t *)dev_get_drvdata(pDev);
+    Csi2_TelemetryType       *pTel;
+    const Csi2_VCTelemetryType *pVc;
+    uint64_t                 linesPerSec, lineTime;
+    uint32_t                 i, j;
+    int                      len = 0;
+
+    (void)pAttr;
+    // a consistent snapshot, the counters are updated by the irq handlers
+    pTel = (Csi2_TelemetryType *)kmalloc(sizeof(Csi2_TelemetryType), GFP_KERNEL);
+    if ((pTel != NULL) && (Csi2_GetTelemetry((Csi2_UnitIdType)pRsdkCsi2Dev->dtsInfo.devId, pTel) == (Std_ReturnType)E_OK))
+    {
+        len += scnprintf(&pBuf[len], PAGE_SIZE - len, "counter_freq %llu\n", pTel->counterFreq);
+        len += scnprintf(&pBuf[len], PAGE_SIZE - len, "irq calls time_mean time_max errors(bit:count)\n");
+        for (i = 0u; i < (uint32_t)RSDK_CSI2_MAX_IRQ_ID; i++)
+        {
+            len += scnprintf(&pBuf[len], PAGE_SIZE - len, "%s %u %llu %llu", irqNames[i], pTel->irq[i].callsNum,
+                             (pTel->irq[i].callsNum == 0u) ? 0ULL :
+                                            div64_u64(pTel->irq[i].timeSum, pTel->irq[i].callsNum),
+                             pTel->irq[i].timeMax);
+            for (j = 0u; j < (uint32_t)CSI2_TELEMETRY_ERR_BITS; j++)
+            {   // only the reported error classes
+                if (pTel->irq[i].errCount[j] != 0u)
+                {
+                    len += scnprintf(&pBuf[len], PAGE_SIZE - len, " %u:%u", j, pTel->irq[i].errCount[j]);
+                }
+            }
+            len += scnprintf(&pBuf[len], PAGE_SIZE - len, "\n");
+        }
+        len += scnprintf(&pBuf[len], PAGE_SIZE - len, "vc frames period_min period_mean period_max "
+                                    "frame_min frame_mean frame_max lines lines_per_s\n");
+        for (i = 0u; i < (uint32_t)RSDK_CSI2_MAX_VC; i++)
+        {
+            pVc = &pTel->vc[i];
+            lineTime = pVc->timeLastLine - pVc->timeFirstLine;
+            linesPerSec = (lineTime == 0u) ? 0ULL : div64_u64(pVc->linesNum * pTel->counterFreq, lineTime);
+            len += scnprintf(&pBuf[len], PAGE_SIZE - len, "%u %u %llu %llu %llu %llu %llu %llu %llu %llu\n", i,
+                             pVc->framesNum, pVc->periodMin,
+                             (pVc->periodsNum == 0u) ? 0ULL : div64_u64(pVc->periodSum, pVc->periodsNum),
+                             pVc->periodMax, pVc->frameTimeMin,
+                             (pVc->framesNum == 0u) ? 0ULL : div64_u64(pVc->frameTimeSum, pVc->framesNum),
+                             pVc->frameTimeMax, pVc->linesNum, linesPerSec);
+        }
+    }
+    kfree(pTel);
+    return (ssize_t)len;
+}
+
+static DEVICE_ATTR(telemetry, 0444, RsdkCsi2TelemetryShow, NULL);
+
+static struct attribute *gsRsdkCsi2Attrs[] = {
+    &dev_attr_telemetry.attr,
+    NULL,
+};
+
+static const struct attribute_group gsRsdkCsi2AttrGroup = {
+    .attrs = gsRsdkCsi2Attrs,
+};
+
+static const struct attribute_group *gsRsdkCsi2AttrGroups[] = {
+    &gsRsdkCsi2AttrGroup,
+    NULL,
+};
+#endif  // #if (CSI2_TELEMETRY_USAGE == STD_ON)
+
 /******************************************************************************/
 /**
  * @brief   Get dts properties
@@ -219,6 +407,9 @@ static int RsdkCsi2Probe(struct platform_device *pPlatDev)
         .owner = THIS_MODULE,
         .open = RsdkCsi2Open,
         .release = RsdkCsi2Release,
+        .mmap = RsdkCsi2Mmap,
+        .poll = RsdkCsi2Poll,
+        .unlocked_ioctl = RsdkCsi2Ioctl,
     };
     
     int32_t             err = 0;
@@ -303,7 +494,13 @@ static int RsdkCsi2Probe(struct platform_device *pPlatDev)
 #ifdef DEBUG_MODE
             (void)pr_alert("RsdkCsi2Probe: cdev_add() OK.\n");
 #endif
+#if (CSI2_TELEMETRY_USAGE == STD_ON)
+            // the device attributes (telemetry) are created together with the device
+            pSysFsDev = device_create_with_groups(gspRsdkCsi2Class, pDevice, devNo, pRsdkCsi2Dev, gsRsdkCsi2AttrGroups,
+                                                  deviceName[pRsdkCsi2Dev->dtsInfo.devId]);
+#else
             pSysFsDev = device_create(gspRsdkCsi2Class, pDevice, devNo, NULL, deviceName[pRsdkCsi2Dev->dtsInfo.devId]);
+#endif
             if (IS_ERR(pSysFsDev))
             {
                 err = (int32_t)PTR_ERR(pSysFsDev);
@@ -391,6 +588,15 @@ static int RsdkCsi2Probe(struct platform_device *pPlatDev)
 
     if (err == 0)
     {
+        // the irq handlers can use the locks and the statistics bottom half as soon as they are registered
+        (void)OAL_InitIRQSpinLock(&pRsdkCsi2Dev->statLock);
+        (void)OAL_InitIRQSpinLock(&pRsdkCsi2Dev->statusLock);
+        (void)OAL_InitIRQSpinLock(&pRsdkCsi2Dev->lineEvtLock);
+        hrtimer_init(&pRsdkCsi2Dev->lineEvtTimer, CLOCK_MONOTONIC, HRTIMER_MODE_REL);
+        pRsdkCsi2Dev->lineEvtTimer.function = RsdkCsi2LineEvtTimerLinux;
+        (void)OAL_InitializeBottomHalf(&pRsdkCsi2Dev->statBh, RsdkCsi2StatBottomHalfLinux, (uintptr_t)pRsdkCsi2Dev);
+        INIT_WORK(&pRsdkCsi2Dev->initWork, RsdkCsi2InitWorkLinux);
+        atomic_set(&pRsdkCsi2Dev->initState, RSDK_CSI2_INIT_IDLE);
         val = 0u;  // installed irq handlers mask
                    //register the interrupt handlers
         err = request_irq(pRsdkCsi2Dev->dtsInfo.irqId[0], RsdkCsi2RxIrqHandlerLinux, 0, 
@@ -432,6 +638,15 @@ static int RsdkCsi2Probe(struct platform_device *pPlatDev)
 #endif
             //initialize the wait queues for sending interrupt events into user space
             err = OAL_InitWaitQueue(&(pRsdkCsi2Dev->irqWaitQ));
+            if (err == 0)
+            {
+                // and for the line-granular consumers
+                err = OAL_InitWaitQueue(&(pRsdkCsi2Dev->lineWaitQ));
+                if (err < 0)
+                {
+                    (void)OAL_DestroyWaitQueue(&(pRsdkCsi2Dev->irqWaitQ));
+                }
+            }
             if (err < 0)
             {
                 (void)pr_err("RsdkCsi2Probe: OAL_InitWaitQueues failed!.\n");
@@ -455,6 +670,41 @@ static int RsdkCsi2Probe(struct platform_device *pPlatDev)
         }
     } // if (err == 0)
 
+    if (err == 0)
+    {
+        // allocate the event ring and the status page, page aligned and zeroed, to be mapped by the user-space
+        if ((evt_ring_size < RSDK_CSI2_EVT_RING_MIN_SIZE) || (evt_ring_size > RSDK_CSI2_EVT_RING_MAX_SIZE) ||
+                                                                                (!is_power_of_2(evt_ring_size)))
+        {
+            (void)pr_warn("RsdkCsi2Probe: wrong evt_ring_size %u, %u used.\n", evt_ring_size, RSDK_CSI2_EVT_RING_SIZE);
+            evt_ring_size = RSDK_CSI2_EVT_RING_SIZE;
+        }
+        pRsdkCsi2Dev->evtRingSize = evt_ring_size;
+        atomic_set(&pRsdkCsi2Dev->evtDropPending, 0);
+        pRsdkCsi2Dev->pEvtRing = (rsdkCsi2EvtRing_t *)vmalloc_user(RSDK_CSI2_EVT_RING_MAP_SIZE(evt_ring_size));
+        pRsdkCsi2Dev->pEvtRecLen = (uint16_t *)vzalloc((evt_ring_size / RSDK_CSI2_EVT_REC_ALIGN) * sizeof(uint16_t));
+        pRsdkCsi2Dev->pStatusPage = (rsdkCsi2StatusPage_t *)vmalloc_user(sizeof(rsdkCsi2StatusPage_t));
+        if ((pRsdkCsi2Dev->pEvtRing == NULL) || (pRsdkCsi2Dev->pEvtRecLen == NULL) ||
+                                                                            (pRsdkCsi2Dev->pStatusPage == NULL))
+        {
+            (void)pr_err("RsdkCsi2Probe: event ring/status page allocation failed!.\n");
+            err = -ENOMEM;
+            //revert previous actions:
+            vfree(pRsdkCsi2Dev->pEvtRing);
+            vfree(pRsdkCsi2Dev->pEvtRecLen);
+            vfree(pRsdkCsi2Dev->pStatusPage);
+            (void)OAL_DestroyWaitQueue(&(pRsdkCsi2Dev->irqWaitQ));
+            (void)OAL_DestroyWaitQueue(&(pRsdkCsi2Dev->lineWaitQ));
+            (void)free_irq(pRsdkCsi2Dev->dtsInfo.irqId[0], pRsdkCsi2Dev);
+            (void)free_irq(pRsdkCsi2Dev->dtsInfo.irqId[1], pRsdkCsi2Dev);
+            (void)free_irq(pRsdkCsi2Dev->dtsInfo.irqId[2], pRsdkCsi2Dev);
+            iounmap(pRsdkCsi2Dev->pMemMapVirtAddr);
+            device_destroy(gspRsdkCsi2Class, devNo);
+            cdev_del(&pRsdkCsi2Dev->cdevRef);
+            kvfree(pRsdkCsi2Dev);
+        }
+    }
+
     if (err == 0)
     {
        // init the RPC server, but only for first unit (only one RPC for all units)
@@ -487,11 +737,28 @@ static int RsdkCsi2Remove(struct platform_device *pOfpDev)
 
     dev_set_drvdata(&pOfpDev->dev, NULL);
 
+    // no more driver call, then no asynchronous initialization, before any teardown
     (void)RsdkCsi2RpcSrvExit((uint32_t)pRsdkCsi2Dev->dtsInfo.devId);
+    if (cancel_work_sync(&pRsdkCsi2Dev->initWork))
+    {   // a queued initialization was not started : release its data and its waiters (the PLL pair unit included)
+        kfree(pRsdkCsi2Dev->pInitData);
+        pRsdkCsi2Dev->pInitData = NULL;
+        pRsdkCsi2Dev->initRez = (uint32_t)RSDK_CSI2_DRV_POWERED_OFF;
+        atomic_set_release(&pRsdkCsi2Dev->initState, RSDK_CSI2_INIT_DONE);
+        (void)OAL_WakeUpInterruptible(&gRsdkCsi2InitWaitQ);
+    }
     (void)OAL_DestroyWaitQueue(&(pRsdkCsi2Dev->irqWaitQ));
+    (void)OAL_DestroyWaitQueue(&(pRsdkCsi2Dev->lineWaitQ));
     (void)free_irq(pRsdkCsi2Dev->dtsInfo.irqId[0], pRsdkCsi2Dev);
     (void)free_irq(pRsdkCsi2Dev->dtsInfo.irqId[1], pRsdkCsi2Dev);
     (void)free_irq(pRsdkCsi2Dev->dtsInfo.irqId[2], pRsdkCsi2Dev);
+    // no more irq, so no more scheduling; wait for a bottom half or a flush timer still running
+    tasklet_kill(&pRsdkCsi2Dev->statBh.mTasklet);
+    (void)hrtimer_cancel(&pRsdkCsi2Dev->lineEvtTimer);
+    (void)OAL_DestroyBottomHalf(&pRsdkCsi2Dev->statBh);
+    vfree(pRsdkCsi2Dev->pEvtRing);
+    vfree(pRsdkCsi2Dev->pEvtRecLen);
+    vfree(pRsdkCsi2Dev->pStatusPage);
     iounmap(pRsdkCsi2Dev->pMemMapVirtAddr);
     device_destroy(gspRsdkCsi2Class, MKDEV(gsNumRsdkCsi2Major, gsNumRsdkCsi2Minor + pRsdkCsi2Dev->dtsInfo.devId));
     cdev_del(&pRsdkCsi2Dev->cdevRef);
@@ -543,7 +810,27 @@ static int __init RsdkCsi2ModInit(void)
 #ifdef DEBUG_MODE
             (void)pr_alert("RsdkCsi2ModInit: class_create() OK.\n");
 #endif
-            err = platform_driver_register(&gsRsdkCsi2Driver);
+            // the frame synchronizer is used by the units events irqs, so it is ready before any unit probe
+            (void)OAL_InitIRQSpinLock(&gRsdkCsi2SyncLock);
+            err = OAL_InitWaitQueue(&gRsdkCsi2SyncWaitQ);
+            if (err == 0)
+            {
+                // the asynchronous initializations waiters are also common to all units
+                err = OAL_InitWaitQueue(&gRsdkCsi2InitWaitQ);
+                if (err != 0)
+                {
+                    (void)OAL_DestroyWaitQueue(&gRsdkCsi2SyncWaitQ);
+                }
+            }
+            if (err == 0)
+            {
+                err = platform_driver_register(&gsRsdkCsi2Driver);
+                if (err != 0)
+                {
+                    (void)OAL_DestroyWaitQueue(&gRsdkCsi2SyncWaitQ);
+                    (void)OAL_DestroyWaitQueue(&gRsdkCsi2InitWaitQ);
+                }
+            }
             if (err != 0)
             {
                 (void)pr_err("RsdkCsi2ModInit: platform_driver_register() failed = %d\n", err);
@@ -581,6 +868,8 @@ static void __exit RsdkCsi2ModExit(void)
     platform_driver_unregister(&gsRsdkCsi2Driver);
     class_destroy(gspRsdkCsi2Class);
     unregister_chrdev_region(gsDevNum, 1);
+    (void)OAL_DestroyWaitQueue(&gRsdkCsi2SyncWaitQ);
+    (void)OAL_DestroyWaitQueue(&gRsdkCsi2InitWaitQ);
     (void)pr_alert("RsdkCsi2ModExit: CSI2 driver exit done. \n");
 }
 
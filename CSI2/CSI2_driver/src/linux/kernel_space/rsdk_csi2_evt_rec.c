@@ -0,0 +1,120 @@
+/*
+ * Copyright 2023 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <linux/kernel.h>
+#include <linux/string.h>
+
+#include "Csi2_Linux_Def.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                       FUNCTIONS
+==================================================================================================*/
+
+/*******************************************************************************/
+/**
+ * @brief       Append a VC sub-record to the VC block of an event record, if not null.
+ *
+ */
+static uint8_t *EvtRecSub(uint8_t *pDst, rsdkCsi2EvtRecVc_t *pVcBlk, uint8_t subBit, const void *pData,
+                          uint32_t len)
+{
+    if(memchr_inv(pData, 0, len) != NULL)
+    {
+        (void)memset(pDst, 0, RSDK_CSI2_EVT_SUB_LEN);
+        (void)memcpy(pDst, pData, len);
+        pVcBlk->subMask |= subBit;
+        pDst += RSDK_CSI2_EVT_SUB_LEN;
+    }
+    return pDst;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Encode a report as a compact event record.
+ * @details     Only the VCs with events or errors and, for them, only the not null fields are recorded, see
+ *              rsdkCsi2EvtRecHdr_t. The seq and dropped fields are left 0, to be set by the ring producer.
+ *
+ * @return      the record length, in bytes
+ *
+ */
+uint32_t RsdkCsi2EvtRecEncodeLinux(const rsdkCsi2Report_t *pRep, uint8_t *pRec)
+{
+    rsdkCsi2EvtRecHdr_t *pHdr = (rsdkCsi2EvtRecHdr_t *)(void *)pRec;
+    rsdkCsi2EvtRecVc_t  *pVcBlk;
+    uint8_t             *pDst;
+    uint32_t            vc;
+    uint16_t            lines[4];
+    uint8_t             frame[5], packet[3];
+
+    (void)memset(pHdr, 0, sizeof(rsdkCsi2EvtRecHdr_t));
+    pHdr->unitId = pRep->unitId;
+    pHdr->errMaskU = pRep->errMaskU;
+    pDst = pRec + sizeof(rsdkCsi2EvtRecHdr_t);
+    for(vc = 0u; vc < (uint32_t)RSDK_CSI2_MAX_VC; vc++)
+    {
+        if((pRep->evtMaskVC[vc] != 0u) || (pRep->errMaskVC[vc] != 0u))
+        {
+            pHdr->vcMask |= (uint8_t)(1u << vc);
+            pVcBlk = (rsdkCsi2EvtRecVc_t *)(void *)pDst;
+            pVcBlk->errMaskVC = pRep->errMaskVC[vc];
+            pVcBlk->evtMaskVC = pRep->evtMaskVC[vc];
+            pVcBlk->subMask = 0u;
+            pVcBlk->reserved = 0u;
+            pDst += sizeof(rsdkCsi2EvtRecVc_t);
+            // the sub-records, in the RSDK_CSI2_EVT_SUB_x order
+            (void)memcpy(frame, &pRep->frameCounter[vc], sizeof(uint32_t));
+            frame[4] = pRep->readyFrameBuf[vc];
+            pDst = EvtRecSub(pDst, pVcBlk, RSDK_CSI2_EVT_SUB_FRAME, frame, sizeof(frame));
+            pDst = EvtRecSub(pDst, pVcBlk, RSDK_CSI2_EVT_SUB_TIME_FS, &pRep->timeFrameStart[vc], sizeof(uint64_t));
+            pDst = EvtRecSub(pDst, pVcBlk, RSDK_CSI2_EVT_SUB_TIME_FE, &pRep->timeFrameEnd[vc], sizeof(uint64_t));
+            pDst = EvtRecSub(pDst, pVcBlk, RSDK_CSI2_EVT_SUB_TIME_LD, &pRep->timeLineDone[vc], sizeof(uint64_t));
+            lines[0] = pRep->lineFirst[vc];
+            lines[1] = pRep->lineLast[vc];
+            lines[2] = pRep->expectedCRC[vc];
+            lines[3] = pRep->receivedCRC[vc];
+            pDst = EvtRecSub(pDst, pVcBlk, RSDK_CSI2_EVT_SUB_LINES, lines, sizeof(lines));
+            packet[0] = pRep->invalidPacketID[vc];
+            packet[1] = pRep->eccOneBitErrPos[vc];
+            packet[2] = pRep->lastDroppedData[vc];
+            pDst = EvtRecSub(pDst, pVcBlk, RSDK_CSI2_EVT_SUB_PACKET, packet, sizeof(packet));
+            pDst = EvtRecSub(pDst, pVcBlk, RSDK_CSI2_EVT_SUB_LINE_LEN, &pRep->lineLengthErr[vc],
+                                                                                    sizeof(rsdkCsi2LineLenErr_t));
+            pDst = EvtRecSub(pDst, pVcBlk, RSDK_CSI2_EVT_SUB_SHORT_PKT, &pRep->shortPackets[vc],
+                                                                                    sizeof(rsdkCsi2ShortPacket_t));
+            pHdr->timestamp = max3(pHdr->timestamp, max(pRep->timeFrameStart[vc], pRep->timeFrameEnd[vc]),
+                                                                                    pRep->timeLineDone[vc]);
+        }
+    }
+    if(memchr_inv(pRep->notToggledBits, 0, sizeof(pRep->notToggledBits)) != NULL)
+    {
+        pHdr->recFlags |= RSDK_CSI2_EVT_REC_TOGGLE;
+        (void)memcpy(pDst, pRep->notToggledBits, sizeof(pRep->notToggledBits));
+        pDst += ALIGN(sizeof(pRep->notToggledBits), RSDK_CSI2_EVT_REC_ALIGN);
+    }
+    for(vc = 0u; vc < (uint32_t)RSDK_CSI2_MAX_VC; vc++)
+    {
+        if((pRep->evtMaskVC[vc] & (uint8_t)RSDK_CSI2_EVT_CHANNEL_STAT) != 0u)
+        {
+            pHdr->recFlags |= RSDK_CSI2_EVT_REC_CH_STAT;
+            (void)memcpy(pDst, pRep->chStat[vc], sizeof(pRep->chStat[vc]));
+            pDst += sizeof(pRep->chStat[vc]);
+        }
+    }
+    pHdr->recLen = (uint16_t)(pDst - pRec);
+    return (uint32_t)pHdr->recLen;
+}
+
+
+#ifdef __cplusplus
+}
+#endif
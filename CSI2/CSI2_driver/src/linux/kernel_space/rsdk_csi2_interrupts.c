@@ -78,6 +78,43 @@ irqreturn_t RsdkCsi2EventsIrqHandlerLinux(int32_t iIrq, void *pParams)
     return IRQ_HANDLED;
 }
 
+/******************************************************************************/
+/**
+ * @brief   CSI2 statistics bottom half, scheduled by the events interrupt handler
+ */
+void RsdkCsi2StatBottomHalfLinux(uintptr_t devData)
+{
+#if (CSI2_DEFERRED_STATISTICS == STD_ON)
+    Csi2_IrqDeferredStatistics((Csi2_UnitIdType)GetUnitId(((rsdkCsi2Device_t *)devData)->dtsInfo.devId));
+#else
+    (void)devData;
+#endif
+}
+
+/******************************************************************************/
+/**
+ * @brief   CSI2 LINEDONE moderation flush timer, restarted while a held range waits for its deadline
+ */
+enum hrtimer_restart RsdkCsi2LineEvtTimerLinux(struct hrtimer *pTimer)
+{
+    enum hrtimer_restart    rez = HRTIMER_NORESTART;
+#if (CSI2_LINE_EVT_MODERATION == STD_ON)
+    rsdkCsi2Device_t        *pDev;
+    uint32_t                nextUs;
+
+    pDev = container_of(pTimer, rsdkCsi2Device_t, lineEvtTimer);
+    nextUs = Csi2_LineEvtFlush((Csi2_UnitIdType)GetUnitId(pDev->dtsInfo.devId));
+    if (nextUs != 0u)
+    {
+        (void)hrtimer_forward_now(pTimer, us_to_ktime(nextUs));
+        rez = HRTIMER_RESTART;
+    }
+#else
+    (void)pTimer;
+#endif
+    return rez;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -21,6 +21,8 @@
 #include <linux/platform_device.h>
 #include <linux/uaccess.h>
 #include <linux/fs.h>
+#include <linux/string.h>
+#include <linux/atomic.h>
 
 #include "Csi2_Driver_Module.h"
 #include "rsdk_csi2_driver_api.h"
@@ -80,39 +82,119 @@ static inline Csi2_VirtChnlIdType GetVirtChnlId(uint32_t chnl)
 
 /*******************************************************************************/
 /**
- * @brief       Function to save the reported errors to pipe.
- * @details     The function is called at the end of a callback in kernel space
+ * @brief       Function to save the reported errors to the unit event ring.
+ * @details     The function is called at the end of a callback in kernel space.
+ *              The report is encoded as a compact record (see rsdkCsi2EvtRecHdr_t), so only the populated fields
+ *              are copied into the ring.
+ *              The three unit interrupts and the statistics bottom half can produce concurrently, without any lock:
+ *                  - the record space is reserved by an atomic increment of the reservation index, if the ring is
+ *                    not full; a record not fitting before the ring end is preceded by a pad record. The last
+ *                    header size is kept for the exit request
+ *                  - the record is written into the ring, then marked complete in the kernel private pEvtRecLen
+ *                  - evtPubIdx is advanced over all the complete records, in order, by any of the producers: the
+ *                    producer clearing the length of the record at evtPubIdx owns its publication, then the ring
+ *                    writeIdx is written (never read) from it
+ *              The ring is writable by the user-space, so nothing is read back from it but readIdx, which only
+ *              bounds the free space: a wrong readIdx drops the events, it can never make a producer overwrite a
+ *              not published record nor loop.
+ *              A dropped event is accounted in the ring and reported in the next recorded one; the log message
+ *              is rate limited, as it is done from interrupt context.
  *
  */
  static void RecordErrorAndWakeup(uint32_t irqId, rsdkCsi2Report_t *pErrors)
  {
-    uint32_t unitId;
-    uint8_t  pWrite, pRead;
+    uint64_t            recBuf[RSDK_CSI2_EVT_REC_MAX_LEN / sizeof(uint64_t)];
+    uint32_t            unitId;
+    uint32_t            pWrite, pPub, maxUsed, mask, recLen, padLen, lost;
+    rsdkCsi2Device_t    *pDev;
+    rsdkCsi2EvtRing_t   *pRing;
+    rsdkCsi2EvtRecHdr_t *pRec, *pHdr;
+    uint8_t             *pData;
     
+    pRec = (rsdkCsi2EvtRecHdr_t *)(void *)recBuf;
     if(irqId >= RSDK_CSI2_ERROR_TO_EXIT)
     {
         unitId = irqId ^ RSDK_CSI2_ERROR_TO_EXIT;
+        (void)memset(pRec, 0, sizeof(rsdkCsi2EvtRecHdr_t));
+        pRec->recLen = (uint16_t)sizeof(rsdkCsi2EvtRecHdr_t);
+        pRec->recType = RSDK_CSI2_EVT_REC_EXIT;
+        pRec->unitId = (uint8_t)unitId;
+        maxUsed = gpRsdkCsi2Device[unitId]->evtRingSize;        // the exit request can use the reserved space
     }
     else
     {
         unitId = pErrors->unitId;
+        (void)RsdkCsi2EvtRecEncodeLinux(pErrors, (uint8_t *)recBuf);
+        pRec->recType = (uint8_t)irqId;
+        maxUsed = gpRsdkCsi2Device[unitId]->evtRingSize - (uint32_t)sizeof(rsdkCsi2EvtRecHdr_t);
     }
-    pWrite = gpRsdkCsi2Device[unitId]->irqWriteP;
-    gpRsdkCsi2Device[unitId]->irqErrorPipe[pWrite].errType = irqId;
-    if(pErrors != NULL)
+    recLen = pRec->recLen;
+    pDev = gpRsdkCsi2Device[unitId];
+    pRing = pDev->pEvtRing;
+    pData = (uint8_t *)pRing->evtData;
+    mask = pDev->evtRingSize - 1u;
+    // reserve the record space, with the pad up to the ring end if the record does not fit before
+    do
     {
-        gpRsdkCsi2Device[unitId]->irqErrorPipe[pWrite].errReport = *pErrors;
+        pPub = smp_load_acquire(&pDev->evtPubIdx);              // before evtReserveIdx, so never after it
+        pWrite = READ_ONCE(pDev->evtReserveIdx);
+        padLen = (((pWrite & mask) + recLen) > pDev->evtRingSize) ? (pDev->evtRingSize - (pWrite & mask)) : 0u;
+        if((((pWrite + padLen + recLen) - READ_ONCE(pRing->readIdx)) > maxUsed) ||
+                        (((pWrite + padLen + recLen) - pPub) > pDev->evtRingSize))
+        {
+            recLen = 0u;                                        // no free space, or a wrong readIdx
+            break;
+        }
+    } while(cmpxchg(&pDev->evtReserveIdx, pWrite, pWrite + padLen + recLen) != pWrite);
+    if(recLen == 0u)
+    {       // the event is dropped and accounted
+        lost = (uint32_t)atomic_inc_return(&pDev->evtLost);
+        WRITE_ONCE(pRing->lostEvents, lost);
+        if(irqId < (uint32_t)RSDK_CSI2_MAX_IRQ_ID)
+        {
+            WRITE_ONCE(pRing->lostIrq[irqId], (uint32_t)atomic_inc_return(&pDev->evtLostIrq[irqId]));
+        }
+        (void)atomic_inc(&pDev->evtDropPending);
+        (void)pr_err_ratelimited("RecordErrorAndWakeup: CSI2 event ring full - unit %u, %u events lost.\n", 
+                                                                unitId, lost);
     }
-    pWrite = (pWrite + 1u) % RSDK_CSI2_ERROR_QUEUE_LEN;
-    pRead = gpRsdkCsi2Device[unitId]->irqReadP;
-    // only if the signal to stop is not set
-    if(pWrite == pRead)
-    {       // the oldest error was overwritten, move the read pointer too
-        gpRsdkCsi2Device[unitId]->irqReadP = (uint8_t)((pRead + 1u) % RSDK_CSI2_ERROR_QUEUE_LEN);
-        (void)pr_err("RecordErrorAndWakeup: CSI2 error lost - unit %d.\n", unitId);
+    else
+    {
+        if(padLen != 0u)
+        {       // only the first 8 bytes of the pad header are used
+            pHdr = (rsdkCsi2EvtRecHdr_t *)(void *)&pData[pWrite & mask];
+            pHdr->recLen = (uint16_t)padLen;
+            pHdr->recType = RSDK_CSI2_EVT_REC_PAD;
+            pHdr->unitId = (uint8_t)unitId;
+            pHdr->seq = pWrite + 1u;
+            smp_store_release(&pDev->pEvtRecLen[(pWrite & mask) / RSDK_CSI2_EVT_REC_ALIGN], (uint16_t)padLen);
+            pWrite += padLen;
+        }
+        pRec->dropped = (uint32_t)atomic_xchg(&pDev->evtDropPending, 0);
+        pRec->seq = pWrite + 1u;
+        pHdr = (rsdkCsi2EvtRecHdr_t *)(void *)&pData[pWrite & mask];
+        (void)memcpy(pHdr, pRec, recLen);
+        smp_store_release(&pDev->pEvtRecLen[(pWrite & mask) / RSDK_CSI2_EVT_REC_ALIGN], (uint16_t)recLen);
+        smp_mb();                                               // the length visible before the evtPubIdx check
+        // publish to the consumer all the complete records, in order
+        pPub = READ_ONCE(pDev->evtPubIdx);
+        while(pPub != READ_ONCE(pDev->evtReserveIdx))
+        {
+            recLen = READ_ONCE(pDev->pEvtRecLen[(pPub & mask) / RSDK_CSI2_EVT_REC_ALIGN]);
+            if((recLen == 0u) ||
+                        (cmpxchg(&pDev->pEvtRecLen[(pPub & mask) / RSDK_CSI2_EVT_REC_ALIGN], (uint16_t)recLen, 0u)
+                                                                                    != (uint16_t)recLen))
+            {
+                break;                      // not complete, or published by another producer, which goes on
+            }
+            // this producer owns the record publication: writeIdx first, so it never goes backward
+            smp_store_release(&pRing->writeIdx, pPub + recLen);
+            smp_store_release(&pDev->evtPubIdx, pPub + recLen);
+            smp_mb();                                           // evtPubIdx visible before the next length check
+            pPub += recLen;
+        }
     }
-    gpRsdkCsi2Device[unitId]->irqWriteP = pWrite;
-    (void)OAL_WakeUpInterruptible(&(gpRsdkCsi2Device[unitId]->irqWaitQ));
+    (void)OAL_WakeUpInterruptible(&(pDev->irqWaitQ));
 }
 
 /*******************************************************************************/
@@ -165,6 +247,193 @@ static void UpdateCallbacks(rsdkCsi2InitParams_t *pParam)
     pParam->pCallback[RSDK_CSI2_EVENTS_IRQ_ID] = (rsdkCsi2IsrCb_t)Callback3;
 }
 
+/*******************************************************************************/
+/**
+ * @brief       The D-PHY PLL unit of a unit : unit_0 for unit_1 and unit_2 for unit_3; it must be initialized first.
+ *
+ */
+static inline uint32_t InitPllUnit(uint32_t unitId)
+{
+    return unitId & ~1u;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Check for a pending asynchronous initialization of a unit.
+ *
+ * @return      1 if pending, 0 if not or if the unit is not present
+ *
+ */
+static uint32_t InitIsPending(uint32_t unitId)
+{
+    uint32_t    rez = 0u;
+
+    if ((unitId < (uint32_t)RSDK_MIPICSI2_INTERFACES) && (gpRsdkCsi2Device[unitId] != NULL))
+    {
+        if (atomic_read_acquire(&gpRsdkCsi2Device[unitId]->initState) == RSDK_CSI2_INIT_PENDING)
+        {
+            rez = 1u;
+        }
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Check if a call must be rejected, because of a pending asynchronous initialization.
+ * @details     The calls not for a unit are always executed. The asynchronous initialization of a PLL pair second
+ *              unit is not rejected for a pending initialization of its PLL unit, the work item waits for it; the
+ *              synchronous initialization is.
+ *
+ * @return      1 if the call is rejected, 0 if not
+ *
+ */
+static uint32_t InitBlocksCall(uint32_t unitId, uint32_t func)
+{
+    uint32_t    rez = 0u;
+
+    if ((func != (uint32_t)RSDK_CSI2_LX_GET_CHIRP_LEN) && (func != (uint32_t)RSDK_CSI2_LX_SYNC_CONFIG))
+    {
+        rez = InitIsPending(unitId);
+        if ((func == (uint32_t)RSDK_CSI2_LX_CALL_INIT) && (unitId < (uint32_t)RSDK_MIPICSI2_INTERFACES))
+        {
+            rez |= InitIsPending(InitPllUnit(unitId));
+        }
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Move a configuration pointer of the request to the configuration in the request copy.
+ * @details     The configurations carried by the request follow the initialization parameters, each pointer being
+ *              set by the library to the configuration byte offset in the request. Other values are kept.
+ *
+ */
+static void *InitDataRebase(void *pData, size_t size, int32_t len, uint8_t *pCopy)
+{
+    uintptr_t   offset = (uintptr_t)pData;
+
+    if ((offset >= (sizeof(int32_t) + sizeof(rsdkCsi2InitParams_t))) && (offset <= (uintptr_t)len) &&
+            (size <= ((uintptr_t)len - offset)))
+    {
+        pData = (void *)&pCopy[offset];
+    }
+    return pData;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Queue an asynchronous unit initialization.
+ * @details     The unit setup is done by the unit work item, so it runs after the RPC call end and the request
+ *              data is copied (the VCs, auxiliary and metadata configurations included, see InitDataRebase).
+ *
+ */
+static uint32_t InitAsyncStart(uint32_t unitId, uintptr_t in, int32_t len)
+{
+    rsdkCsi2Device_t        *pDev;
+    rsdkCsi2InitParams_t    *pParams;
+    uint8_t                 *pCopy;
+    uint32_t                vc, rez;
+
+    if ((unitId >= (uint32_t)RSDK_MIPICSI2_INTERFACES) || (gpRsdkCsi2Device[unitId] == NULL))
+    {
+        rez = (uint32_t)RSDK_CSI2_DRV_WRG_UNIT_ID;
+    }
+    else
+    {
+        pDev = gpRsdkCsi2Device[unitId];
+        rez = (uint32_t)RSDK_SUCCESS;
+        pCopy = (uint8_t *)kmemdup((void *)in, (size_t)len, GFP_KERNEL);
+        if (pCopy == NULL)
+        {
+            rez = (uint32_t)RSDK_CSI2_DRV_ERR_COPY_DATA_ERROR;
+        }
+        else
+        {
+            pParams = (rsdkCsi2InitParams_t *)(void *)&pCopy[sizeof(int32_t)];
+            for (vc = 0u; vc < (uint32_t)RSDK_CSI2_MAX_VC; vc++)
+            {
+                pParams->pVCconfig[vc] = InitDataRebase(pParams->pVCconfig[vc], sizeof(rsdkCsi2VCParams_t),
+                                                        len, pCopy);
+                pParams->pAuxConfig[vc] = InitDataRebase(pParams->pAuxConfig[vc], sizeof(rsdkCsi2VCParams_t),
+                                                        len, pCopy);
+                pParams->pMetaData[vc] = InitDataRebase(pParams->pMetaData[vc], sizeof(rsdkCsi2MetaDataParams_t),
+                                                        len, pCopy);
+            }
+            UpdateCallbacks(pParams);           // switch the irq callbacks to kernel space
+            pDev->pInitData = pCopy;
+            atomic_set(&pDev->initState, RSDK_CSI2_INIT_PENDING);
+            (void)queue_work(system_unbound_wq, &pDev->initWork);
+        }
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Wait for the end of an asynchronous unit initialization.
+ * @details     Called by the RSDK_CSI2_IOC_INIT_WAIT ioctl, so out of any RPC server lock : the units waits
+ *              overlap and the other driver calls are not delayed.
+ *
+ * @return      the initialization result or the wait error
+ *
+ */
+static uint32_t InitAsyncWait(uint32_t unitId, uint32_t timeoutUs)
+{
+    rsdkCsi2Device_t    *pDev;
+    uint32_t            rez;
+
+    if ((unitId >= (uint32_t)RSDK_MIPICSI2_INTERFACES) || (gpRsdkCsi2Device[unitId] == NULL))
+    {
+        rez = (uint32_t)RSDK_CSI2_DRV_WRG_UNIT_ID;
+    }
+    else
+    {
+        pDev = gpRsdkCsi2Device[unitId];
+        if (atomic_read(&pDev->initState) == RSDK_CSI2_INIT_IDLE)
+        {
+            rez = (uint32_t)RSDK_CSI2_DRV_NOT_INIT;     // nothing to wait for
+        }
+        else if (OAL_WaitEventInterruptibleTimeout(gRsdkCsi2InitWaitQ,
+                        (atomic_read_acquire(&pDev->initState) != RSDK_CSI2_INIT_PENDING),
+                        usecs_to_jiffies(timeoutUs)) <= 0)
+        {
+            rez = (uint32_t)RSDK_CSI2_DRV_TIMER_ERROR;  // timeout or signal
+        }
+        else
+        {
+            rez = pDev->initRez;
+        }
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Asynchronous unit initialization, executed by the unit work item.
+ * @details     The initialization runs out of the work RPC server lock, so the other units can be initialized in
+ *              parallel (the D-PHY waits sleep) and the driver calls for the other units are not delayed. The
+ *              initialization of a second unit of a PLL pair waits first for its PLL unit pending initialization.
+ *
+ */
+void RsdkCsi2InitWorkLinux(struct work_struct *pWork)
+{
+    rsdkCsi2Device_t    *pDev = container_of(pWork, rsdkCsi2Device_t, initWork);
+    uint32_t            unitId = (uint32_t)pDev->dtsInfo.devId;
+
+    if (InitPllUnit(unitId) != unitId)
+    {
+        (void)OAL_WaitEventInterruptible(gRsdkCsi2InitWaitQ, (InitIsPending(InitPllUnit(unitId)) == 0u));
+    }
+    pDev->initRez = (uint32_t)Csi2_Setup((Csi2_UnitIdType)unitId,
+                                        (Csi2_SetupParamsType *)(void *)&pDev->pInitData[sizeof(int32_t)]);
+    kfree(pDev->pInitData);
+    pDev->pInitData = NULL;
+    atomic_set_release(&pDev->initState, RSDK_CSI2_INIT_DONE);
+    (void)OAL_WakeUpInterruptible(&gRsdkCsi2InitWaitQ);
+}
+
 /*******************************************************************************/
 /**
  * @brief       RemoteProcedureCall server dispatcher for normal work.
@@ -178,6 +447,13 @@ static uint32_t RsdkCsi2RpcDispatcherW(oal_dispatcher_t *d, uint32_t func, uintp
     void                *pSecondParam;
     Csi2_UnitIdType     unitId;
     Csi2_VirtChnlIdType vcId;
+#if (CSI2_TELEMETRY_USAGE == STD_ON)
+    Csi2_TelemetryType  *pTelemetry;
+#endif
+#if (CSI2_VC_RECONFIG_USAGE == STD_ON)
+    rsdkCsi2InitParams_t *pParams;
+    uint32_t            vc;
+#endif
 
     (void)d;
     // the input data must have at least an integer
@@ -185,6 +461,10 @@ static uint32_t RsdkCsi2RpcDispatcherW(oal_dispatcher_t *d, uint32_t func, uintp
     {
         rez = (uint32_t)RSDK_CSI2_DRV_NULL_PARAM_PTR;
     }
+    else if (InitBlocksCall(*(uint32_t *)in, func) != 0u)
+    {
+        rez = (uint32_t)RSDK_CSI2_DRV_WRG_STATE;  // the unit asynchronous initialization is not finished
+    }
     else
     {
         pUnitId = (int32_t *)in;  // initialize the pointer to received data
@@ -205,6 +485,17 @@ static uint32_t RsdkCsi2RpcDispatcherW(oal_dispatcher_t *d, uint32_t func, uintp
                     rez = (uint32_t)Csi2_Setup(unitId, (Csi2_SetupParamsType*)pSecondParam);
                 }
                 break;
+            case (uint32_t)RSDK_CSI2_LX_CALL_INIT_ASYNC:    // unit initialization, only queued; the result is
+                                                            // given by RSDK_CSI2_IOC_INIT_WAIT
+                if ((uint32_t)len < (sizeof(int32_t) + sizeof(rsdkCsi2InitParams_t)))
+                {
+                    rez = (uint32_t)RSDK_CSI2_DRV_NULL_PARAM_PTR;  // not enough data
+                }
+                else
+                {
+                    rez = InitAsyncStart((uint32_t)unitId, in, len);
+                }
+                break;
             case (uint32_t)RSDK_CSI2_LX_RX_STOP:  // Rx unit stop request
                 rez = (uint32_t)Csi2_RxStop(unitId);
                 break;
@@ -257,6 +548,75 @@ static uint32_t RsdkCsi2RpcDispatcherW(oal_dispatcher_t *d, uint32_t func, uintp
                     rez = (uint32_t)Csi2_GetFramesCounter(unitId, vcId);
                 }
                 break;
+#if (CSI2_FRAME_RING_USAGE == STD_ON)
+            case (uint32_t)RSDK_CSI2_LX_RELEASE_FRAME:  // frame ring buffer given back by the application
+                if ((uint32_t)len < (3u * sizeof(int32_t)))
+                {
+                    rez = (uint32_t)RSDK_CSI2_DRV_NULL_PARAM_PTR;
+                }
+                else
+                {
+                    vcId = GetVirtChnlId((uint32_t)pUnitId[1]);
+                    rez = (uint32_t)Csi2_ReleaseFrameBuf(unitId, vcId, (uint8_t)pUnitId[2]);
+                }
+                break;
+#endif
+#if (CSI2_TELEMETRY_USAGE == STD_ON)
+            case (uint32_t)RSDK_CSI2_LX_GET_TELEMETRY:  // unit telemetry request, a snapshot is in the reply
+                pTelemetry = (Csi2_TelemetryType *)kmalloc(sizeof(Csi2_TelemetryType), GFP_KERNEL);
+                if (pTelemetry == NULL)
+                {
+                    rez = (uint32_t)RSDK_CSI2_DRV_ERR_COPY_DATA_ERROR;
+                }
+                else
+                {
+                    rez = (uint32_t)Csi2_GetTelemetry(unitId, pTelemetry);
+                    if ((rez == (uint32_t)RSDK_SUCCESS) &&
+                            (OAL_RPCAppendReply(d, (uint8_t *)pTelemetry, sizeof(rsdkCsi2Telemetry_t)) != 0))
+                    {
+                        rez = (uint32_t)RSDK_CSI2_DRV_ERR_COPY_DATA_ERROR;
+                    }
+                    kfree(pTelemetry);
+                }
+                break;
+#endif
+#if (CSI2_VC_RECONFIG_USAGE == STD_ON)
+            case (uint32_t)RSDK_CSI2_LX_RECONFIG_VC:    // VCs reconfiguration, same data as for initialization
+                if ((uint32_t)len < (sizeof(int32_t) + sizeof(rsdkCsi2InitParams_t)))
+                {
+                    rez = (uint32_t)RSDK_CSI2_DRV_NULL_PARAM_PTR;  // not enough data
+                }
+                else
+                {
+                    pSecondParam = (void *)(((char *)(in)) + sizeof(int32_t));  // the pointer to the new parameters
+                    pParams = (rsdkCsi2InitParams_t *)pSecondParam;
+                    for (vc = 0u; vc < (uint32_t)RSDK_CSI2_MAX_VC; vc++)
+                    {   // the configurations carried by the request, as for RSDK_CSI2_LX_CALL_INIT_ASYNC
+                        pParams->pVCconfig[vc] = InitDataRebase(pParams->pVCconfig[vc], sizeof(rsdkCsi2VCParams_t),
+                                                                len, (uint8_t *)in);
+                        pParams->pAuxConfig[vc] = InitDataRebase(pParams->pAuxConfig[vc],
+                                                                sizeof(rsdkCsi2VCParams_t), len, (uint8_t *)in);
+                        pParams->pMetaData[vc] = InitDataRebase(pParams->pMetaData[vc],
+                                                                sizeof(rsdkCsi2MetaDataParams_t), len, (uint8_t *)in);
+                    }
+                    UpdateCallbacks(pSecondParam);      // keep the kernel space irq callbacks
+                    rez = (uint32_t)Csi2_ReconfigVC(unitId, (Csi2_SetupParamsType*)pSecondParam);
+                }
+                break;
+#endif
+#if (CSI2_FRAME_SYNC_USAGE == STD_ON)
+            case (uint32_t)RSDK_CSI2_LX_SYNC_CONFIG:    // synchronizer configuration, the unitId is not used
+                if ((uint32_t)len < (sizeof(int32_t) + sizeof(rsdkCsi2SyncParams_t)))
+                {
+                    rez = (uint32_t)RSDK_CSI2_DRV_NULL_PARAM_PTR;  // not enough data
+                }
+                else
+                {
+                    pSecondParam = (void *)(((char *)(in)) + sizeof(int32_t));  // the pointer to the parameters
+                    rez = (uint32_t)Csi2_SyncConfig((Csi2_SyncParamsType*)pSecondParam);
+                }
+                break;
+#endif
             default:
                 rez = (uint32_t)RSDK_CSI2_DRV_ERR_INVALID_REQ;  // unknown request
                 break;
@@ -265,6 +625,98 @@ static uint32_t RsdkCsi2RpcDispatcherW(oal_dispatcher_t *d, uint32_t func, uintp
     return rez;
 }
 
+/*******************************************************************************/
+/**
+ * @brief       Blocking calls for a unit, done by ioctl() on the unit device.
+ * @details     The calls sleep, so they are not served by the work RPC server, which is serialized for all the
+ *              units. The ioctl() is not serialized : the waiters of all the units sleep concurrently and the work
+ *              RPC calls go on meanwhile.
+ *
+ * @return      0, -EFAULT for a wrong data pointer, -ENOMEM or -ENOTTY for an unknown call; the call result is in
+ *              the data
+ *
+ */
+long RsdkCsi2IoctlWait(rsdkCsi2Device_t *pDev, uint32_t cmd, unsigned long arg)
+{
+    long                    err = 0;
+    rsdkCsi2IocInitWait_t   initWait;
+#if (CSI2_LINE_WATERMARK_USAGE == STD_ON)
+    rsdkCsi2IocWaitLine_t   waitLine;
+#endif
+#if (CSI2_FRAME_SYNC_USAGE == STD_ON)
+    rsdkCsi2IocSyncWait_t   *pSyncWait;
+#endif
+
+    switch (cmd)
+    {
+        case RSDK_CSI2_IOC_INIT_WAIT:       // sleep until the unit initialization/power-on end, or timeout
+            if (copy_from_user(&initWait, (void __user *)arg, sizeof(initWait)) != 0u)
+            {
+                err = -EFAULT;
+            }
+            else
+            {
+                initWait.rez = InitAsyncWait((uint32_t)pDev->dtsInfo.devId, initWait.timeoutUs);
+                if (copy_to_user((void __user *)arg, &initWait, sizeof(initWait)) != 0u)
+                {
+                    err = -EFAULT;
+                }
+            }
+            break;
+#if (CSI2_LINE_WATERMARK_USAGE == STD_ON)
+        case RSDK_CSI2_IOC_WAIT_LINE:       // sleep until a line is committed, or timeout
+            if (copy_from_user(&waitLine, (void __user *)arg, sizeof(waitLine)) != 0u)
+            {
+                err = -EFAULT;
+            }
+            else
+            {
+                if (InitIsPending((uint32_t)pDev->dtsInfo.devId) != 0u)
+                {
+                    waitLine.rez = (uint32_t)RSDK_CSI2_DRV_WRG_STATE;
+                }
+                else
+                {
+                    waitLine.rez = (uint32_t)Csi2_WaitForLine((Csi2_UnitIdType)pDev->dtsInfo.devId,
+                                                GetVirtChnlId(waitLine.vcId), waitLine.line, waitLine.timeoutUs);
+                }
+                if (copy_to_user((void __user *)arg, &waitLine, sizeof(waitLine)) != 0u)
+                {
+                    err = -EFAULT;
+                }
+            }
+            break;
+#endif
+#if (CSI2_FRAME_SYNC_USAGE == STD_ON)
+        case RSDK_CSI2_IOC_SYNC_WAIT:       // sleep until a synchronizer cycle is closed, or timeout
+            pSyncWait = (rsdkCsi2IocSyncWait_t *)kmalloc(sizeof(rsdkCsi2IocSyncWait_t), GFP_KERNEL);
+            if (pSyncWait == NULL)
+            {
+                err = -ENOMEM;
+            }
+            else if (copy_from_user(pSyncWait, (void __user *)arg, sizeof(rsdkCsi2IocSyncWait_t)) != 0u)
+            {
+                err = -EFAULT;
+            }
+            else
+            {
+                pSyncWait->rez = (uint32_t)Csi2_SyncWait(pSyncWait->lastCycleId, pSyncWait->timeoutUs,
+                                                        (Csi2_SyncCycleType *)(void *)&pSyncWait->cycle);
+                if (copy_to_user((void __user *)arg, pSyncWait, sizeof(rsdkCsi2IocSyncWait_t)) != 0u)
+                {
+                    err = -EFAULT;
+                }
+            }
+            kfree(pSyncWait);
+            break;
+#endif
+        default:
+            err = -ENOTTY;                  // unknown request
+            break;
+    }
+    return err;
+}
+
 /*******************************************************************************/
 /**
  * @brief       RemoteProcedureCall server dispatcher for error return.
@@ -274,26 +726,43 @@ static uint32_t RsdkCsi2RpcDispatcherW(oal_dispatcher_t *d, uint32_t func, uintp
 static uint32_t RsdkCsi2RpcDispatcherE(oal_dispatcher_t *d, uint32_t func, uintptr_t in, int32_t len, uint32_t unitId)
 {
     uint32_t            rez = (uint32_t)RSDK_SUCCESS;
-    uint32_t            pRead;
+    uint32_t            pRead, pWrite, offset, recLen;
+    rsdkCsi2EvtRing_t   *pRing;
+    rsdkCsi2EvtRecHdr_t *pRec;
     
     (void)len;
     (void)in;
+    pRing = gpRsdkCsi2Device[unitId]->pEvtRing;
     while(func == (uint32_t)RSDK_CSI2_LX_GET_ERRORS)
     {
-        pRead = gpRsdkCsi2Device[unitId]->irqReadP;             // the current read popinter
-        if(pRead != gpRsdkCsi2Device[unitId]->irqWriteP)        // if read != write, process it
+        pRead = pRing->readIdx;                                     // the current read pointer
+        pWrite = smp_load_acquire(&gpRsdkCsi2Device[unitId]->evtPubIdx);
+        if(pRead != pWrite)                                         // if read != write, process it
         {
-            if(gpRsdkCsi2Device[unitId]->irqErrorPipe[pRead].errType >= RSDK_CSI2_ERROR_TO_EXIT)
+            offset = pRead & (gpRsdkCsi2Device[unitId]->evtRingSize - 1u);
+            pRec = (rsdkCsi2EvtRecHdr_t *)(void *)&((uint8_t *)pRing->evtData)[offset];
+            recLen = pRec->recLen;
+            if((recLen < RSDK_CSI2_EVT_REC_ALIGN) || (recLen > (pWrite - pRead)) ||
+                                            (recLen > (gpRsdkCsi2Device[unitId]->evtRingSize - offset)))
+            {                   // the ring is writable by the user-space, so do not trust a wrong length
+                smp_store_release(&pRing->readIdx, pWrite);         // drop the ring content
+                rez = (uint32_t)RSDK_CSI2_DRV_ERR_COPY_DATA_ERROR;
+                break;
+            }
+            if(pRec->recType == RSDK_CSI2_EVT_REC_PAD)
+            {
+                smp_store_release(&pRing->readIdx, pRead + recLen);    // skip the ring end
+                continue;
+            }
+            if(pRec->recType == RSDK_CSI2_EVT_REC_EXIT)
             {                   // close request
-                gpRsdkCsi2Device[unitId]->irqReadP = 
-                                    (uint8_t)((pRead + 1u) % RSDK_CSI2_ERROR_QUEUE_LEN);    // skip this "error"
+                smp_store_release(&pRing->readIdx, pRead + recLen);    // skip this "error"
                 rez = (uint32_t)RSDK_CSI2_DRV_POWERED_OFF;
                 break;
             }
-            // copy the error to the response
-            rez = (uint32_t)OAL_RPCAppendReply(d, 
-                            (char *)&(gpRsdkCsi2Device[unitId]->irqErrorPipe[pRead]), sizeof(rsdkCsi2KernelErr_t));
-            gpRsdkCsi2Device[unitId]->irqReadP = (uint8_t)((pRead + 1u) % RSDK_CSI2_ERROR_QUEUE_LEN); // error processed
+            // copy the compact record to the response, to be decoded by the library
+            rez = (uint32_t)OAL_RPCAppendReply(d, (char *)pRec, (int32_t)recLen);
+            smp_store_release(&pRing->readIdx, pRead + recLen);        // error processed
             if(rez != 0u)
             {
                 rez = (uint32_t)RSDK_CSI2_DRV_ERR_COPY_DATA_ERROR;        // signal the copy error
@@ -302,7 +771,7 @@ static uint32_t RsdkCsi2RpcDispatcherE(oal_dispatcher_t *d, uint32_t func, uintp
         }
         // nothing to report, so wait for wakeup
         if(OAL_WaitEventInterruptible((gpRsdkCsi2Device[unitId]->irqWaitQ), 
-                                ((gpRsdkCsi2Device[unitId]->irqReadP) != (gpRsdkCsi2Device[unitId]->irqWriteP))) != 0)
+                        (READ_ONCE(pRing->readIdx) != READ_ONCE(gpRsdkCsi2Device[unitId]->evtPubIdx))) != 0)
         {
             // a signal was received, so we'll stop the thread, as the driver is not able to manage this
             rez = (uint32_t)RSDK_CSI2_DRV_POWERED_OFF;
@@ -401,6 +870,8 @@ int32_t RsdkCsi2RpcSrvInit(uint32_t unitId)
 {
     static char eServerName[RSDK_MIPICSI2_INTERFACES][sizeof(RSDK_CSI2_RPC_ERROR) + 3u];
     int32_t rc;
+    uint32_t irqId;
+    rsdkCsi2EvtRing_t *pRing;
 
     rc = 0;
 
@@ -450,9 +921,25 @@ int32_t RsdkCsi2RpcSrvInit(uint32_t unitId)
         }
         else
         {
-            // reset the pipe pointers
-            gpRsdkCsi2Device[unitId]->irqReadP  = 0u;
-            gpRsdkCsi2Device[unitId]->irqWriteP = 0u;
+            // reset the event ring and its kernel private state (no old record must look complete)
+            pRing = gpRsdkCsi2Device[unitId]->pEvtRing;
+            (void)memset(pRing->evtData, 0, gpRsdkCsi2Device[unitId]->evtRingSize);
+            (void)memset(gpRsdkCsi2Device[unitId]->pEvtRecLen, 0,
+                        (gpRsdkCsi2Device[unitId]->evtRingSize / RSDK_CSI2_EVT_REC_ALIGN) * sizeof(uint16_t));
+            (void)memset((void *)pRing->lostIrq, 0, sizeof(pRing->lostIrq));
+            pRing->readIdx = 0u;
+            pRing->writeIdx = 0u;
+            pRing->lostEvents = 0u;
+            pRing->version = RSDK_CSI2_EVT_RING_VERSION;
+            pRing->ringSize = gpRsdkCsi2Device[unitId]->evtRingSize;
+            gpRsdkCsi2Device[unitId]->evtReserveIdx = 0u;
+            gpRsdkCsi2Device[unitId]->evtPubIdx = 0u;
+            atomic_set(&gpRsdkCsi2Device[unitId]->evtDropPending, 0);
+            atomic_set(&gpRsdkCsi2Device[unitId]->evtLost, 0);
+            for(irqId = 0u; irqId < (uint32_t)RSDK_CSI2_MAX_IRQ_ID; irqId++)
+            {
+                atomic_set(&gpRsdkCsi2Device[unitId]->evtLostIrq[irqId], 0);
+            }
         }
     }
     return rc;
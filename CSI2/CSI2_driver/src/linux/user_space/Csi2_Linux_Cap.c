@@ -0,0 +1,710 @@
+/*
+ * Copyright 2023 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE                     // O_DIRECT
+#endif
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/uio.h>
+
+#include "Csi2_Linux_Def.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                      DEFINES AND MACROS
+==================================================================================================*/
+#define CSI2_CAP_LEN_MAX        0xffffu     // maximum line length and lines number of a region (record header)
+#define CSI2_CAP_IOV_NR         5u          // header, data, auxiliary data, metadata, padding
+// round up to an alignment, a power of 2
+#define CSI2_CAP_ROUND_UP(len, align)   (((len) + (uint64_t)(align) - 1u) & ~((uint64_t)(align) - 1u))
+
+/*==================================================================================================
+*                                STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+// recorder state
+typedef enum
+{
+    CSI2_CAP_IDLE = 0,                      // no capture
+    CSI2_CAP_STARTING,                      // the capture file and the writer are prepared
+    CSI2_CAP_RUNNING,                       // the frames are recorded
+    CSI2_CAP_STOPPING,                      // the writer drains the queue
+} Csi2_CapState_t;
+
+// a frame queued to the writer
+typedef struct
+{
+    uint8_t             unitId;
+    uint8_t             vcId;
+    uint8_t             bufIdx;             // the frame ring buffer, 0 for a single buffer VC
+    uint32_t            frameSeq;           // the VC frames counter at the frame end
+    uint64_t            timeFrameStart;
+    uint64_t            timeFrameEnd;
+} Csi2_CapItem_t;
+
+// recorder data; the queue, the state and the statistics are protected by gsCsi2CapLock
+typedef struct
+{
+    Csi2_CapState_t     state;
+    rsdkCsi2CapParams_t params;             // copy of the start parameters
+    int                 fd;                 // the capture file
+    uint32_t            align;              // records alignment : RSDK_CSI2_CAP_DIO_ALIGN for O_DIRECT
+    uint8_t             direct;             // the file is written with O_DIRECT, writer only after the start
+    uint8_t             *pBlock;            // header block, then a zeros block for the padding, DIO aligned
+    uint64_t            counterFreq;        // rsdkCsi2CapFileHdr_t::counterFreq
+    pthread_t           writer;
+    Csi2_CapItem_t      queue[RSDK_CSI2_CAP_QUEUE_LEN];
+    uint32_t            head, tail;         // free running queue indexes, written by the producers / the writer
+    // single buffer VCs : the frame regions are copied at the FrameEnd report, as the next frame overwrites the
+    // buffer; one copy for each VC, NULL for a frame ring VC
+    uint8_t             *pStage[RSDK_CSI2_MAX_UNITS][RSDK_CSI2_MAX_VC];
+    uint8_t             stageBusy[RSDK_CSI2_MAX_UNITS][RSDK_CSI2_MAX_VC];    // the copy is queued, not written yet
+    rsdkCsi2CapStats_t  stats;
+    struct timespec     timeStart;          // the capture start, CLOCK_MONOTONIC
+    // writer only
+    uint64_t            offset;             // the next record offset in the file
+    uint64_t            timeFirst;          // the first recorded FrameStart, for rsdkCsi2CapFileHdr_t::timeStart
+    uint32_t            lastSeq[RSDK_CSI2_MAX_UNITS][RSDK_CSI2_MAX_VC];  // the last recorded frameSeq
+    uint8_t             seqValid[RSDK_CSI2_MAX_UNITS][RSDK_CSI2_MAX_VC]; // lastSeq is valid
+} Csi2_CapData_t;
+
+/*==================================================================================================
+*                                       LOCAL VARIABLES
+==================================================================================================*/
+static pthread_mutex_t  gsCsi2CapLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t   gsCsi2CapCond = PTHREAD_COND_INITIALIZER;  // a frame was queued or the stop requested
+static Csi2_CapData_t   gsCsi2Cap;
+
+/*==================================================================================================
+*                                       FUNCTIONS
+==================================================================================================*/
+
+/*******************************************************************************/
+/**
+ * @brief       Microseconds elapsed since a CLOCK_MONOTONIC time.
+ *
+ */
+static uint64_t CapElapsedUs(const struct timespec *pStart)
+{
+    struct timespec             now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)((((int64_t)now.tv_sec - (int64_t)pStart->tv_sec) * 1000000) +
+                      (((int64_t)now.tv_nsec - (int64_t)pStart->tv_nsec) / 1000));
+}
+
+/*******************************************************************************/
+/**
+ * @brief       The buffer of a region for a frame ring buffer; the single buffer if not a ring.
+ *
+ */
+static void *CapRegionBuf(const rsdkCsi2CapRegion_t *pReg, const uint8_t bufIdx)
+{
+    return ((bufIdx < RSDK_CSI2_MAX_FRAME_BUFS) && (pReg->pBuf[bufIdx] != NULL)) ? pReg->pBuf[bufIdx] :
+                                                                                  pReg->pBuf[0];
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Check a region : 0 if not used, 1 if usable, 2 if usable with the direct I/O, -1 if wrong.
+ *
+ */
+static int32_t CapRegionCheck(const rsdkCsi2CapRegion_t *pReg)
+{
+    int32_t                     rez;
+    uint32_t                    i;
+
+    if (pReg->pBuf[0] == NULL)
+    {
+        rez = 0;
+    }
+    else if ((pReg->lineLen == 0u) || (pReg->lineLen > CSI2_CAP_LEN_MAX) || (pReg->numLines == 0u) ||
+             (pReg->numLines > CSI2_CAP_LEN_MAX))
+    {
+        rez = -1;
+    }
+    else
+    {
+        rez = ((((uint64_t)pReg->lineLen * pReg->numLines) % RSDK_CSI2_CAP_DIO_ALIGN) == 0u) ? 2 : 1;
+        for (i = 0u; i < RSDK_CSI2_MAX_FRAME_BUFS; i++)
+        {
+            if (((uintptr_t)pReg->pBuf[i] % RSDK_CSI2_CAP_DIO_ALIGN) != 0u)
+            {
+                rez = 1;                                            // not aligned for the direct I/O
+            }
+        }
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       The recorded length of a region, 0 if not recorded.
+ *
+ */
+static uint64_t CapRegionLen(const rsdkCsi2CapRegion_t *pReg)
+{
+    return (pReg->pBuf[0] != NULL) ? ((uint64_t)pReg->lineLen * pReg->numLines) : 0u;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Copy a single buffer region to the VC staging copy, after the previous regions.
+ *
+ * @return      the next staging offset
+ *
+ */
+static uint64_t CapStageCopy(uint8_t *pStage, const uint64_t offset, const rsdkCsi2CapRegion_t *pReg)
+{
+    uint64_t                    len = CapRegionLen(pReg);
+
+    if (len != 0u)
+    {
+        (void)memcpy(pStage + offset, pReg->pBuf[0], (size_t)len);
+    }
+    return offset + len;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Free the staging copies of the single buffer VCs.
+ *
+ */
+static void CapStageFree(void)
+{
+    uint32_t                    u, vc;
+
+    for (u = 0u; u < (uint32_t)RSDK_CSI2_MAX_UNITS; u++)
+    {
+        for (vc = 0u; vc < (uint32_t)RSDK_CSI2_MAX_VC; vc++)
+        {
+            free(gsCsi2Cap.pStage[u][vc]);
+            gsCsi2Cap.pStage[u][vc] = NULL;
+        }
+    }
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Add a region to the record I/O vector, if recorded; from the staging copy, if any.
+ *
+ * @return      the region length, 0 if not recorded
+ *
+ */
+static uint64_t CapIovAdd(struct iovec *pIov, uint32_t *pIovNr, const rsdkCsi2CapRegion_t *pReg,
+                          const uint8_t bufIdx, uint8_t *pStage, uint16_t *pLineLen, uint16_t *pLines)
+{
+    uint64_t                    len = 0u;
+
+    *pLineLen = 0u;
+    *pLines = 0u;
+    if (pReg->pBuf[0] != NULL)
+    {
+        len = CapRegionLen(pReg);
+        pIov[*pIovNr].iov_base = (pStage != NULL) ? (void *)pStage : CapRegionBuf(pReg, bufIdx);
+        pIov[*pIovNr].iov_len = (size_t)len;
+        (*pIovNr)++;
+        *pLineLen = (uint16_t)pReg->lineLen;
+        *pLines = (uint16_t)pReg->numLines;
+    }
+    return len;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Write a frame record : the header from the header block, the regions straight from the frame
+ *              buffers (from the staging copy for a single buffer VC), then the padding from the zeros block.
+ *              If the direct I/O is refused at write time (buffers not usable by the direct I/O, as device memory
+ *              mappings), the file continues with the buffered I/O.
+ *
+ */
+static void CapWriteFrame(const Csi2_CapItem_t *pItem)
+{
+    rsdkCsi2CapFrameHdr_t       *pHdr = (rsdkCsi2CapFrameHdr_t *)(void *)gsCsi2Cap.pBlock;
+    struct iovec                iov[CSI2_CAP_IOV_NR];
+    struct timespec             timeWrite;
+    uint64_t                    recLen, regLen, writeUs;
+    uint32_t                    iovNr, hdrLen;
+    ssize_t                     written;
+    uint8_t                     *pStage;
+    int                         flags;
+
+    hdrLen = (uint32_t)CSI2_CAP_ROUND_UP(sizeof(rsdkCsi2CapFrameHdr_t), gsCsi2Cap.align);
+    (void)memset(pHdr, 0, hdrLen);
+    pHdr->magic = RSDK_CSI2_CAP_FRAME_MAGIC;
+    pHdr->hdrLen = (uint16_t)hdrLen;
+    pHdr->unitId = pItem->unitId;
+    pHdr->vcId = pItem->vcId;
+    pHdr->frameSeq = pItem->frameSeq;
+    pHdr->timeFrameStart = pItem->timeFrameStart;
+    pHdr->timeFrameEnd = pItem->timeFrameEnd;
+    if (gsCsi2Cap.seqValid[pItem->unitId][pItem->vcId] != 0u)
+    {   // frames dropped by the recorder or not reported
+        pHdr->framesLost = pItem->frameSeq - gsCsi2Cap.lastSeq[pItem->unitId][pItem->vcId] - 1u;
+    }
+    iov[0].iov_base = pHdr;
+    iov[0].iov_len = hdrLen;
+    iovNr = 1u;
+    recLen = hdrLen;
+    pStage = gsCsi2Cap.pStage[pItem->unitId][pItem->vcId];
+    regLen = CapIovAdd(iov, &iovNr, &gsCsi2Cap.params.data[pItem->unitId][pItem->vcId], pItem->bufIdx,
+                       pStage, &pHdr->dataLineLen, &pHdr->dataLines);
+    regLen += CapIovAdd(iov, &iovNr, &gsCsi2Cap.params.aux[pItem->unitId][pItem->vcId], pItem->bufIdx,
+                        (pStage != NULL) ? (pStage + regLen) : NULL, &pHdr->auxLineLen, &pHdr->auxLines);
+    regLen += CapIovAdd(iov, &iovNr, &gsCsi2Cap.params.meta[pItem->unitId][pItem->vcId], 0u,
+                        (pStage != NULL) ? (pStage + regLen) : NULL, &pHdr->metaLineLen, &pHdr->metaLines);
+    recLen += regLen;
+    iov[iovNr].iov_base = gsCsi2Cap.pBlock + RSDK_CSI2_CAP_DIO_ALIGN;
+    iov[iovNr].iov_len = (size_t)(CSI2_CAP_ROUND_UP(recLen, gsCsi2Cap.align) - recLen);
+    recLen += iov[iovNr].iov_len;
+    iovNr += (iov[iovNr].iov_len != 0u) ? 1u : 0u;
+    pHdr->recLen = (uint32_t)recLen;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &timeWrite);
+    written = pwritev(gsCsi2Cap.fd, iov, (int)iovNr, (off_t)gsCsi2Cap.offset);
+    if ((written < 0) && ((errno == EINVAL) || (errno == EFAULT)) && (gsCsi2Cap.direct != 0u))
+    {   // direct I/O refused for these buffers, the records alignment is kept
+        flags = fcntl(gsCsi2Cap.fd, F_GETFL);
+        if ((flags >= 0) && (fcntl(gsCsi2Cap.fd, F_SETFL, flags & ~O_DIRECT) == 0))
+        {
+            gsCsi2Cap.direct = 0u;
+            written = pwritev(gsCsi2Cap.fd, iov, (int)iovNr, (off_t)gsCsi2Cap.offset);
+        }
+    }
+    writeUs = CapElapsedUs(&timeWrite);
+
+    (void)pthread_mutex_lock(&gsCsi2CapLock);
+    gsCsi2Cap.stats.directIo = gsCsi2Cap.direct;
+    gsCsi2Cap.stageBusy[pItem->unitId][pItem->vcId] = 0u;          // the staging copy can be reused
+    if ((written >= 0) && ((uint64_t)written == recLen))
+    {
+        if (gsCsi2Cap.stats.framesWritten == 0u)
+        {
+            gsCsi2Cap.timeFirst = pItem->timeFrameStart;
+        }
+        gsCsi2Cap.offset += recLen;
+        gsCsi2Cap.lastSeq[pItem->unitId][pItem->vcId] = pItem->frameSeq;
+        gsCsi2Cap.seqValid[pItem->unitId][pItem->vcId] = 1u;
+        gsCsi2Cap.stats.framesWritten++;
+        gsCsi2Cap.stats.bytesWritten += recLen;
+        if (writeUs > gsCsi2Cap.stats.writeTimeMaxUs)
+        {
+            gsCsi2Cap.stats.writeTimeMaxUs = writeUs;
+        }
+    }
+    else
+    {   // the record is overwritten by the next one
+        gsCsi2Cap.stats.writeErrors++;
+    }
+    (void)pthread_mutex_unlock(&gsCsi2CapLock);
+}
+
+/*******************************************************************************/
+/**
+ * @brief       The capture writer thread : write the queued frames, until the stop request and the queue empty.
+ *
+ */
+static void *CapWriter(void *pArg)
+{
+    Csi2_CapItem_t              item;
+    uint8_t                     run = 1u;
+
+    (void)pArg;
+    while (run != 0u)
+    {
+        (void)pthread_mutex_lock(&gsCsi2CapLock);
+        while ((gsCsi2Cap.head == gsCsi2Cap.tail) && (gsCsi2Cap.state != CSI2_CAP_STOPPING))
+        {
+            (void)pthread_cond_wait(&gsCsi2CapCond, &gsCsi2CapLock);
+        }
+        if (gsCsi2Cap.head == gsCsi2Cap.tail)
+        {
+            run = 0u;                                               // stop requested and all written
+        }
+        else
+        {
+            item = gsCsi2Cap.queue[gsCsi2Cap.tail % gsCsi2Cap.params.queueLen];
+            gsCsi2Cap.tail++;
+        }
+        (void)pthread_mutex_unlock(&gsCsi2CapLock);
+        if (run != 0u)
+        {
+            CapWriteFrame(&item);
+            if (gsCsi2Cap.params.pDone != NULL)
+            {
+                gsCsi2Cap.params.pDone((rsdkCsi2UnitId_t)item.unitId, (rsdkCsi2VirtChnlId_t)item.vcId, item.bufIdx);
+            }
+        }
+    }
+    return NULL;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Write the capture file header, at the file start.
+ *
+ */
+static int32_t CapWriteFileHdr(const uint32_t framesNum, const uint64_t counterFreq, const uint64_t timeStart)
+{
+    rsdkCsi2CapFileHdr_t        *pHdr = (rsdkCsi2CapFileHdr_t *)(void *)gsCsi2Cap.pBlock;
+    uint32_t                    hdrLen;
+
+    hdrLen = (uint32_t)CSI2_CAP_ROUND_UP(sizeof(rsdkCsi2CapFileHdr_t), gsCsi2Cap.align);
+    (void)memset(pHdr, 0, hdrLen);
+    pHdr->magic = RSDK_CSI2_CAP_FILE_MAGIC;
+    pHdr->version = (uint16_t)RSDK_CSI2_CAP_VERSION;
+    pHdr->hdrLen = (uint16_t)hdrLen;
+    pHdr->framesNum = framesNum;
+    pHdr->counterFreq = counterFreq;
+    pHdr->timeStart = timeStart;
+    return (pwrite(gsCsi2Cap.fd, pHdr, hdrLen, 0) == (ssize_t)hdrLen) ? (int32_t)hdrLen : -1;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Start the raw capture recorder, see RsdkCsi2CapStart.
+ *
+ */
+rsdkStatus_t Csi2_CapStartLinuxUs(const rsdkCsi2CapParams_t *pParams)
+{
+    rsdkStatus_t                rez = RSDK_SUCCESS;
+    rsdkCsi2Telemetry_t         telemetry;
+    uint64_t                    counterFreq = 0u;
+    int32_t                     chk, hdrLen;
+    uint32_t                    u, vc, dataNr;
+    uint64_t                    stageLen;
+    uint8_t                     direct;
+
+    if ((pParams == NULL) || (pParams->pFileName == NULL))
+    {
+        rez = RSDK_CSI2_DRV_NULL_PARAM_PTR;
+    }
+    else if ((pParams->queueLen == 0u) || (pParams->queueLen > RSDK_CSI2_CAP_QUEUE_LEN))
+    {
+        rez = RSDK_CSI2_DRV_INVALID_VC_PARAMS;
+    }
+    else
+    {
+        (void)pthread_mutex_lock(&gsCsi2CapLock);
+        if (gsCsi2Cap.state != CSI2_CAP_IDLE)
+        {
+            rez = RSDK_CSI2_DRV_WRG_STATE;
+        }
+        else
+        {
+            gsCsi2Cap.state = CSI2_CAP_STARTING;
+        }
+        (void)pthread_mutex_unlock(&gsCsi2CapLock);
+    }
+    if (rez == RSDK_SUCCESS)
+    {
+        // check the regions; the direct I/O only if all are aligned
+        direct = pParams->directIo;
+        dataNr = 0u;
+        for (u = 0u; (u < (uint32_t)RSDK_CSI2_MAX_UNITS) && (rez == RSDK_SUCCESS); u++)
+        {
+            for (vc = 0u; (vc < (uint32_t)RSDK_CSI2_MAX_VC) && (rez == RSDK_SUCCESS); vc++)
+            {
+                chk = CapRegionCheck(&pParams->data[u][vc]);
+                dataNr += (chk > 0) ? 1u : 0u;
+                if ((chk > 0) && (counterFreq == 0u) &&
+                    (Csi2_GetTelemetryLinuxUs((rsdkCsi2UnitId_t)u, &telemetry) == RSDK_SUCCESS))
+                {
+                    counterFreq = telemetry.counterFreq;
+                }
+                if ((chk < 0) || (CapRegionCheck(&pParams->aux[u][vc]) < 0) ||
+                    (CapRegionCheck(&pParams->meta[u][vc]) < 0) ||
+                    ((chk == 0) && ((pParams->aux[u][vc].pBuf[0] != NULL) || (pParams->meta[u][vc].pBuf[0] != NULL))))
+                {   // wrong region, or auxiliary data/metadata without radar data
+                    rez = RSDK_CSI2_DRV_INVALID_VC_PARAMS;
+                }
+                if ((chk == 1) || (CapRegionCheck(&pParams->aux[u][vc]) == 1) ||
+                    (CapRegionCheck(&pParams->meta[u][vc]) == 1))
+                {
+                    direct = 0u;
+                }
+            }
+        }
+        if ((rez == RSDK_SUCCESS) && (dataNr == 0u))
+        {
+            rez = RSDK_CSI2_DRV_INVALID_VC_PARAMS;
+        }
+        if (rez == RSDK_SUCCESS)
+        {
+            gsCsi2Cap.params = *pParams;
+            gsCsi2Cap.fd = -1;
+            gsCsi2Cap.pBlock = NULL;
+            (void)memset(gsCsi2Cap.pStage, 0, sizeof(gsCsi2Cap.pStage));
+            (void)memset(gsCsi2Cap.stageBusy, 0, sizeof(gsCsi2Cap.stageBusy));
+            for (u = 0u; (u < (uint32_t)RSDK_CSI2_MAX_UNITS) && (rez == RSDK_SUCCESS); u++)
+            {
+                for (vc = 0u; (vc < (uint32_t)RSDK_CSI2_MAX_VC) && (rez == RSDK_SUCCESS); vc++)
+                {
+                    if ((pParams->data[u][vc].pBuf[0] != NULL) && (pParams->data[u][vc].pBuf[1] == NULL))
+                    {   // single buffer VC, a staging copy for all its regions
+                        stageLen = CapRegionLen(&pParams->data[u][vc]) + CapRegionLen(&pParams->aux[u][vc]) +
+                                   CapRegionLen(&pParams->meta[u][vc]);
+                        if (posix_memalign((void **)&gsCsi2Cap.pStage[u][vc], RSDK_CSI2_CAP_DIO_ALIGN,
+                                           (size_t)stageLen) != 0)
+                        {
+                            gsCsi2Cap.pStage[u][vc] = NULL;
+                            rez = RSDK_CSI2_DRV_ERR_INVALID_REQ;
+                        }
+                    }
+                }
+            }
+        }
+        if (rez == RSDK_SUCCESS)
+        {
+            if (direct != 0u)
+            {
+                gsCsi2Cap.fd = open(pParams->pFileName, O_WRONLY | O_CREAT | O_TRUNC | O_DIRECT, 0644);
+                if ((gsCsi2Cap.fd < 0) && (errno == EINVAL))
+                {   // no direct I/O on this file system
+                    direct = 0u;
+                }
+            }
+            if (direct == 0u)
+            {
+                gsCsi2Cap.fd = open(pParams->pFileName, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            }
+            gsCsi2Cap.align = (direct != 0u) ? RSDK_CSI2_CAP_DIO_ALIGN : RSDK_CSI2_CAP_ALIGN;
+            gsCsi2Cap.direct = direct;
+            if ((gsCsi2Cap.fd < 0) ||
+                (posix_memalign((void **)&gsCsi2Cap.pBlock, RSDK_CSI2_CAP_DIO_ALIGN, 2u * RSDK_CSI2_CAP_DIO_ALIGN) != 0))
+            {
+                rez = RSDK_CSI2_DRV_ERR_INVALID_REQ;
+            }
+        }
+        if (rez == RSDK_SUCCESS)
+        {
+            (void)memset(gsCsi2Cap.pBlock, 0, 2u * RSDK_CSI2_CAP_DIO_ALIGN);
+            gsCsi2Cap.counterFreq = counterFreq;
+            hdrLen = CapWriteFileHdr(0u, counterFreq, 0u);
+            (void)memset(&gsCsi2Cap.stats, 0, sizeof(gsCsi2Cap.stats));
+            (void)memset(gsCsi2Cap.seqValid, 0, sizeof(gsCsi2Cap.seqValid));
+            gsCsi2Cap.stats.directIo = direct;
+            gsCsi2Cap.offset = (uint64_t)hdrLen;
+            gsCsi2Cap.head = 0u;
+            gsCsi2Cap.tail = 0u;
+            gsCsi2Cap.timeFirst = 0u;
+            (void)clock_gettime(CLOCK_MONOTONIC, &gsCsi2Cap.timeStart);
+            if ((hdrLen < 0) || (pthread_create(&gsCsi2Cap.writer, NULL, CapWriter, NULL) != 0))
+            {
+                rez = RSDK_CSI2_DRV_ERR_INVALID_REQ;
+            }
+        }
+        (void)pthread_mutex_lock(&gsCsi2CapLock);
+        if (rez == RSDK_SUCCESS)
+        {
+            gsCsi2Cap.state = CSI2_CAP_RUNNING;
+        }
+        else
+        {
+            if (gsCsi2Cap.fd >= 0)
+            {
+                (void)close(gsCsi2Cap.fd);
+                (void)unlink(pParams->pFileName);
+            }
+            free(gsCsi2Cap.pBlock);
+            CapStageFree();
+            gsCsi2Cap.pBlock = NULL;
+            gsCsi2Cap.fd = -1;
+            gsCsi2Cap.state = CSI2_CAP_IDLE;
+        }
+        (void)pthread_mutex_unlock(&gsCsi2CapLock);
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Queue the recorded frames of an events report to the writer, see RsdkCsi2CapFrame.
+ *
+ */
+rsdkStatus_t Csi2_CapFrameLinuxUs(const rsdkCsi2Report_t *pReport)
+{
+    rsdkStatus_t                rez = RSDK_SUCCESS;
+    const rsdkCsi2CapRegion_t   *pReg;
+    Csi2_CapItem_t              *pItem;
+    rsdkCsi2CapDoneCb_t         pDone;
+    uint32_t                    vc, waiting;
+    uint64_t                    stageOff;
+    uint8_t                     *pStage;
+    uint8_t                     bufIdx, queued, dropBuf[RSDK_CSI2_MAX_VC], dropMask;
+
+    if (pReport == NULL)
+    {
+        rez = RSDK_CSI2_DRV_NULL_PARAM_PTR;
+    }
+    else if (pReport->unitId >= (uint8_t)RSDK_CSI2_MAX_UNITS)
+    {
+        rez = RSDK_CSI2_DRV_WRG_UNIT_ID;
+    }
+    else
+    {
+        dropMask = 0u;
+        (void)pthread_mutex_lock(&gsCsi2CapLock);
+        pDone = gsCsi2Cap.params.pDone;
+        if (gsCsi2Cap.state != CSI2_CAP_RUNNING)
+        {
+            rez = RSDK_CSI2_DRV_NOT_INIT;
+        }
+        for (vc = 0u; (vc < (uint32_t)RSDK_CSI2_MAX_VC) && (rez != RSDK_CSI2_DRV_NOT_INIT); vc++)
+        {
+            pReg = &gsCsi2Cap.params.data[pReport->unitId][vc];
+            queued = 0u;
+            bufIdx = 0u;
+            if ((pReport->evtMaskVC[vc] & (uint8_t)RSDK_CSI2_EVT_FRAME_READY) != 0u)
+            {   // frame ring VC, the buffer handed to the application
+                bufIdx = pReport->readyFrameBuf[vc];
+                queued = 1u;
+            }
+            else if (((pReport->evtMaskVC[vc] & (uint8_t)RSDK_CSI2_EVT_FRAME_END) != 0u) && (pReg->pBuf[1] == NULL))
+            {   // single buffer VC
+                bufIdx = 0u;
+                queued = 1u;
+            }
+            if ((queued != 0u) && (pReg->pBuf[0] != NULL))
+            {
+                waiting = gsCsi2Cap.head - gsCsi2Cap.tail;
+                pStage = gsCsi2Cap.pStage[pReport->unitId][vc];
+                if ((waiting >= gsCsi2Cap.params.queueLen) ||
+                    ((pStage != NULL) && (gsCsi2Cap.stageBusy[pReport->unitId][vc] != 0u)))
+                {   // queue full, or the previous frame of a single buffer VC not written yet
+                    gsCsi2Cap.stats.framesDropped++;
+                    rez = RSDK_CSI2_DRV_TOO_SMALL_BUFFER;
+                    dropMask |= (uint8_t)(1u << vc);
+                    dropBuf[vc] = bufIdx;
+                }
+                else
+                {
+                    if (pStage != NULL)
+                    {   // the next frame overwrites the single buffer, the record is written from a copy
+                        stageOff = CapStageCopy(pStage, 0u, pReg);
+                        stageOff = CapStageCopy(pStage, stageOff, &gsCsi2Cap.params.aux[pReport->unitId][vc]);
+                        (void)CapStageCopy(pStage, stageOff, &gsCsi2Cap.params.meta[pReport->unitId][vc]);
+                        gsCsi2Cap.stageBusy[pReport->unitId][vc] = 1u;
+                    }
+                    pItem = &gsCsi2Cap.queue[gsCsi2Cap.head % gsCsi2Cap.params.queueLen];
+                    pItem->unitId = pReport->unitId;
+                    pItem->vcId = (uint8_t)vc;
+                    pItem->bufIdx = bufIdx;
+                    pItem->frameSeq = pReport->frameCounter[vc];
+                    pItem->timeFrameStart = pReport->timeFrameStart[vc];
+                    pItem->timeFrameEnd = pReport->timeFrameEnd[vc];
+                    gsCsi2Cap.head++;
+                    if ((waiting + 1u) > gsCsi2Cap.stats.queueMax)
+                    {
+                        gsCsi2Cap.stats.queueMax = waiting + 1u;
+                    }
+                    (void)pthread_cond_signal(&gsCsi2CapCond);
+                }
+            }
+        }
+        (void)pthread_mutex_unlock(&gsCsi2CapLock);
+        for (vc = 0u; (vc < (uint32_t)RSDK_CSI2_MAX_VC) && (pDone != NULL); vc++)
+        {
+            if ((dropMask & (1u << vc)) != 0u)
+            {   // not recorded, the buffer is not used by the recorder
+                pDone((rsdkCsi2UnitId_t)pReport->unitId, (rsdkCsi2VirtChnlId_t)vc, dropBuf[vc]);
+            }
+        }
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Get the raw capture recorder statistics, see RsdkCsi2CapGetStats.
+ *
+ */
+rsdkStatus_t Csi2_CapGetStatsLinuxUs(rsdkCsi2CapStats_t *pStats)
+{
+    rsdkStatus_t                rez = RSDK_SUCCESS;
+
+    if (pStats == NULL)
+    {
+        rez = RSDK_CSI2_DRV_NULL_PARAM_PTR;
+    }
+    else
+    {
+        (void)pthread_mutex_lock(&gsCsi2CapLock);
+        if ((gsCsi2Cap.state != CSI2_CAP_RUNNING) && (gsCsi2Cap.state != CSI2_CAP_STOPPING))
+        {
+            rez = RSDK_CSI2_DRV_NOT_INIT;
+        }
+        else
+        {
+            *pStats = gsCsi2Cap.stats;
+            pStats->timeElapsedUs = CapElapsedUs(&gsCsi2Cap.timeStart);
+            // bytes per microsecond are MB/s
+            pStats->mbPerSec = (pStats->timeElapsedUs == 0u) ? 0u :
+                                            (uint32_t)(pStats->bytesWritten / pStats->timeElapsedUs);
+        }
+        (void)pthread_mutex_unlock(&gsCsi2CapLock);
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Stop the raw capture recorder, see RsdkCsi2CapStop.
+ *
+ */
+rsdkStatus_t Csi2_CapStopLinuxUs(rsdkCsi2CapStats_t *pStats)
+{
+    rsdkStatus_t                rez = RSDK_SUCCESS;
+
+    (void)pthread_mutex_lock(&gsCsi2CapLock);
+    if (gsCsi2Cap.state != CSI2_CAP_RUNNING)
+    {
+        rez = RSDK_CSI2_DRV_NOT_INIT;
+    }
+    else
+    {
+        gsCsi2Cap.state = CSI2_CAP_STOPPING;                        // no new frames, the writer drains the queue
+        (void)pthread_cond_signal(&gsCsi2CapCond);
+    }
+    (void)pthread_mutex_unlock(&gsCsi2CapLock);
+    if (rez == RSDK_SUCCESS)
+    {
+        (void)pthread_join(gsCsi2Cap.writer, NULL);
+        if (pStats != NULL)
+        {
+            (void)Csi2_CapGetStatsLinuxUs(pStats);
+        }
+        // complete the file header
+        (void)CapWriteFileHdr(gsCsi2Cap.stats.framesWritten, gsCsi2Cap.counterFreq, gsCsi2Cap.timeFirst);
+        (void)fdatasync(gsCsi2Cap.fd);
+        (void)close(gsCsi2Cap.fd);
+        free(gsCsi2Cap.pBlock);
+        CapStageFree();
+        (void)pthread_mutex_lock(&gsCsi2CapLock);
+        gsCsi2Cap.pBlock = NULL;
+        gsCsi2Cap.fd = -1;
+        gsCsi2Cap.state = CSI2_CAP_IDLE;
+        (void)pthread_mutex_unlock(&gsCsi2CapLock);
+    }
+    return rez;
+}
+
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,185 @@
+/*
+ * Copyright 2023 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <stdint.h>
+#include <string.h>
+
+#include "Csi2_Linux_Def.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                          CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      DEFINES AND MACROS
+==================================================================================================*/
+// value returned for a record which can't be decoded
+#define CSI2_EVT_REC_BAD        0xffffffffu
+// length rounded up to the records alignment
+#define CSI2_EVT_ALIGN(len)     (((len) + RSDK_CSI2_EVT_REC_ALIGN - 1u) & ~(RSDK_CSI2_EVT_REC_ALIGN - 1u))
+
+/*==================================================================================================
+*                                       FUNCTIONS
+==================================================================================================*/
+
+/*******************************************************************************/
+/**
+ * @brief       Take a VC sub-record from an event record, if it was recorded.
+ * @details     The sub-record data is copied to the report field; if not recorded the field is left 0.
+ *
+ * @return      pointer to the next sub-record, NULL if the record is too short
+ *
+ */
+static const uint8_t *EvtRecSubGet(const uint8_t *pSrc, const uint8_t *pEnd, const uint8_t subMask,
+                                   const uint8_t subBit, void *pDst, const uint32_t len)
+{
+    if ((pSrc != NULL) && ((subMask & subBit) != 0u))
+    {
+        if ((pSrc + RSDK_CSI2_EVT_SUB_LEN) > pEnd)
+        {
+            pSrc = NULL;                                            // truncated record
+        }
+        else
+        {
+            (void)memcpy(pDst, pSrc, len);
+            pSrc += RSDK_CSI2_EVT_SUB_LEN;
+        }
+    }
+    return pSrc;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Decode a compact event record, as written by the driver in the unit event ring.
+ * @details     The report is filled with the recorded fields, all the others are 0 (see rsdkCsi2EvtRecHdr_t).
+ *              The record can be taken from the mapped event ring or from the RSDK_CSI2_LX_GET_ERRORS reply.
+ *
+ * @param[in]   pRec      - pointer to the record
+ * @param[in]   recLen    - the available bytes at pRec
+ * @param[out]  pReport   - the decoded report, filled only for a rsdkCsi2IrqId_t record
+ *
+ * @return      the record type : rsdkCsi2IrqId_t, RSDK_CSI2_EVT_REC_PAD or RSDK_CSI2_EVT_REC_EXIT;
+ *              0xffffffff for a truncated or wrong record
+ *
+ */
+uint32_t Csi2_EvtDecodeLinuxUs(const void *pRec, const uint32_t recLen, rsdkCsi2Report_t *pReport)
+{
+    const rsdkCsi2EvtRecHdr_t   *pHdr = (const rsdkCsi2EvtRecHdr_t *)pRec;
+    const rsdkCsi2EvtRecVc_t    *pVcBlk;
+    const uint8_t               *pSrc, *pEnd;
+    uint32_t                    rez, vc;
+    uint16_t                    lines[4];
+    uint8_t                     frame[5], packet[3], subMask;
+
+    if ((pRec == NULL) || (pReport == NULL) || (recLen < RSDK_CSI2_EVT_REC_ALIGN) || (pHdr->recLen > recLen))
+    {
+        rez = CSI2_EVT_REC_BAD;
+    }
+    else if ((pHdr->recType == RSDK_CSI2_EVT_REC_PAD) || (pHdr->recType == RSDK_CSI2_EVT_REC_EXIT))
+    {
+        rez = pHdr->recType;                                        // no report for these records
+    }
+    else if ((pHdr->recLen < sizeof(rsdkCsi2EvtRecHdr_t)) || (pHdr->recType >= (uint8_t)RSDK_CSI2_MAX_IRQ_ID))
+    {
+        rez = CSI2_EVT_REC_BAD;
+    }
+    else
+    {
+        rez = pHdr->recType;
+        (void)memset(pReport, 0, sizeof(rsdkCsi2Report_t));
+        pReport->unitId = pHdr->unitId;
+        pReport->errMaskU = pHdr->errMaskU;
+        pSrc = (const uint8_t *)pRec + sizeof(rsdkCsi2EvtRecHdr_t);
+        pEnd = (const uint8_t *)pRec + pHdr->recLen;
+        for (vc = 0u; (vc < (uint32_t)RSDK_CSI2_MAX_VC) && (pSrc != NULL); vc++)
+        {
+            if ((pHdr->vcMask & (1u << vc)) != 0u)
+            {
+                if ((pSrc + sizeof(rsdkCsi2EvtRecVc_t)) > pEnd)
+                {
+                    pSrc = NULL;
+                    break;
+                }
+                pVcBlk = (const rsdkCsi2EvtRecVc_t *)(const void *)pSrc;
+                pReport->errMaskVC[vc] = pVcBlk->errMaskVC;
+                pReport->evtMaskVC[vc] = pVcBlk->evtMaskVC;
+                subMask = pVcBlk->subMask;
+                pSrc += sizeof(rsdkCsi2EvtRecVc_t);
+                // the sub-records, in the RSDK_CSI2_EVT_SUB_x order
+                (void)memset(frame, 0, sizeof(frame));
+                pSrc = EvtRecSubGet(pSrc, pEnd, subMask, RSDK_CSI2_EVT_SUB_FRAME, frame, sizeof(frame));
+                (void)memcpy(&pReport->frameCounter[vc], frame, sizeof(uint32_t));
+                pReport->readyFrameBuf[vc] = frame[4];
+                pSrc = EvtRecSubGet(pSrc, pEnd, subMask, RSDK_CSI2_EVT_SUB_TIME_FS, &pReport->timeFrameStart[vc],
+                                                                                    sizeof(uint64_t));
+                pSrc = EvtRecSubGet(pSrc, pEnd, subMask, RSDK_CSI2_EVT_SUB_TIME_FE, &pReport->timeFrameEnd[vc],
+                                                                                    sizeof(uint64_t));
+                pSrc = EvtRecSubGet(pSrc, pEnd, subMask, RSDK_CSI2_EVT_SUB_TIME_LD, &pReport->timeLineDone[vc],
+                                                                                    sizeof(uint64_t));
+                (void)memset(lines, 0, sizeof(lines));
+                pSrc = EvtRecSubGet(pSrc, pEnd, subMask, RSDK_CSI2_EVT_SUB_LINES, lines, sizeof(lines));
+                pReport->lineFirst[vc] = lines[0];
+                pReport->lineLast[vc] = lines[1];
+                pReport->expectedCRC[vc] = lines[2];
+                pReport->receivedCRC[vc] = lines[3];
+                (void)memset(packet, 0, sizeof(packet));
+                pSrc = EvtRecSubGet(pSrc, pEnd, subMask, RSDK_CSI2_EVT_SUB_PACKET, packet, sizeof(packet));
+                pReport->invalidPacketID[vc] = packet[0];
+                pReport->eccOneBitErrPos[vc] = packet[1];
+                pReport->lastDroppedData[vc] = packet[2];
+                pSrc = EvtRecSubGet(pSrc, pEnd, subMask, RSDK_CSI2_EVT_SUB_LINE_LEN, &pReport->lineLengthErr[vc],
+                                                                                    sizeof(rsdkCsi2LineLenErr_t));
+                pSrc = EvtRecSubGet(pSrc, pEnd, subMask, RSDK_CSI2_EVT_SUB_SHORT_PKT, &pReport->shortPackets[vc],
+                                                                                    sizeof(rsdkCsi2ShortPacket_t));
+            }
+        }
+        if ((pSrc != NULL) && ((pHdr->recFlags & RSDK_CSI2_EVT_REC_TOGGLE) != 0u))
+        {
+            if ((pSrc + sizeof(pReport->notToggledBits)) > pEnd)
+            {
+                pSrc = NULL;
+            }
+            else
+            {
+                (void)memcpy(pReport->notToggledBits, pSrc, sizeof(pReport->notToggledBits));
+                pSrc += CSI2_EVT_ALIGN(sizeof(pReport->notToggledBits));
+            }
+        }
+        for (vc = 0u; (vc < (uint32_t)RSDK_CSI2_MAX_VC) && (pSrc != NULL) &&
+                      ((pHdr->recFlags & RSDK_CSI2_EVT_REC_CH_STAT) != 0u); vc++)
+        {
+            if ((pReport->evtMaskVC[vc] & (uint8_t)RSDK_CSI2_EVT_CHANNEL_STAT) != 0u)
+            {
+                if ((pSrc + sizeof(pReport->chStat[vc])) > pEnd)
+                {
+                    pSrc = NULL;
+                }
+                else
+                {
+                    (void)memcpy(pReport->chStat[vc], pSrc, sizeof(pReport->chStat[vc]));
+                    pSrc += sizeof(pReport->chStat[vc]);
+                }
+            }
+        }
+        if (pSrc == NULL)
+        {
+            rez = CSI2_EVT_REC_BAD;                                 // truncated record
+        }
+    }
+    return rez;
+}
+
+
+#ifdef __cplusplus
+}
+#endif
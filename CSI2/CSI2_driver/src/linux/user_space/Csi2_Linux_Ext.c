@@ -0,0 +1,700 @@
+/*
+ * Copyright 2023 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+
+#include "Csi2_Linux_Def.h"
+#include "oal_comm.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                      DEFINES AND MACROS
+==================================================================================================*/
+#define CSI2_EXT_DEV_NAME       "/dev/rsdk_csi2_%u"     // the unit device
+#define CSI2_EXT_CFG_ALIGN      8u                      // alignment of the configurations in a request
+// round up to the configurations alignment
+#define CSI2_EXT_CFG_ROUND_UP(len)  (((len) + CSI2_EXT_CFG_ALIGN - 1u) & ~((size_t)CSI2_EXT_CFG_ALIGN - 1u))
+
+/*==================================================================================================
+*                                STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+// unit device data, kept open/mapped until the process end
+typedef struct
+{
+    int                 fd;                 // the unit device, valid if fdOpen
+    uint8_t             fdOpen;
+    rsdkCsi2EvtRing_t   *pRing;             // the event ring header mapping (watermarks), NULL if not mapped
+    const rsdkCsi2StatusPage_t  *pStatus;   // the status page mapping, read-only, NULL if not mapped
+    rsdkCsi2IsrCb_t     initCb[RSDK_CSI2_MAX_IRQ_ID];   // the callbacks of the pending asynchronous initialization
+    uint8_t             initCbSet;          // initCb is to be set at the initialization end
+} Csi2_ExtUnit_t;
+
+/*==================================================================================================
+*                                       LOCAL VARIABLES
+==================================================================================================*/
+// The extension calls use their own work RPC channel, opened at the first call; the serving kernel dispatcher is
+// the same as for the base library calls.
+static pthread_mutex_t      gsCsi2ExtLock = PTHREAD_MUTEX_INITIALIZER;
+static OAL_DriverHandle_t   gsCsi2ExtRpcW = NULL;
+static Csi2_ExtUnit_t       gsCsi2ExtUnit[RSDK_CSI2_MAX_UNITS];
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+/*******************************************************************************/
+/**
+ * @brief       Call the work RPC server, opening the channel at the first call.
+ *
+ * @return      the kernel call result, RSDK_CSI2_DRV_ERR_EVT_CONN if the channel can't be opened
+ *
+ */
+static rsdkStatus_t Csi2ExtRpcCall(const rsdkCsi2RpcCalls_t func, OAL_FuncArgs_t *pIn, const size_t inNr,
+                                   OAL_FuncArgs_t *pOut, const size_t outNr)
+{
+    rsdkStatus_t        rez;
+    OAL_DriverHandle_t  hRpc;
+
+    (void)pthread_mutex_lock(&gsCsi2ExtLock);
+    if (gsCsi2ExtRpcW == NULL)
+    {
+        gsCsi2ExtRpcW = OAL_OpenDriver(RSDK_CSI2_RPC_WORK);
+    }
+    hRpc = gsCsi2ExtRpcW;
+    (void)pthread_mutex_unlock(&gsCsi2ExtLock);
+    if (hRpc == NULL)
+    {
+        rez = RSDK_CSI2_DRV_ERR_EVT_CONN;
+    }
+    else
+    {
+        rez = (rsdkStatus_t)OAL_DriverCall(hRpc, (uint32_t)func, pIn, inNr, pOut, outNr);
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Get the unit device, opening it at the first call.
+ * @details     Must be called with gsCsi2ExtLock taken.
+ *
+ * @return      the device file descriptor, -1 for a wrong unit or if the device can't be opened
+ *
+ */
+static int Csi2ExtDevGetLocked(const rsdkCsi2UnitId_t unitId)
+{
+    char                name[32];
+    int                 fd = -1;
+
+    if ((uint32_t)unitId < (uint32_t)RSDK_CSI2_MAX_UNITS)
+    {
+        if (gsCsi2ExtUnit[unitId].fdOpen == 0u)
+        {
+            (void)snprintf(name, sizeof(name), CSI2_EXT_DEV_NAME, (uint32_t)unitId);
+            gsCsi2ExtUnit[unitId].fd = open(name, O_RDWR | O_CLOEXEC);
+            if (gsCsi2ExtUnit[unitId].fd >= 0)
+            {
+                gsCsi2ExtUnit[unitId].fdOpen = 1u;
+            }
+        }
+        if (gsCsi2ExtUnit[unitId].fdOpen != 0u)
+        {
+            fd = gsCsi2ExtUnit[unitId].fd;
+        }
+    }
+    return fd;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Do a blocking call by ioctl() on the unit device.
+ * @details     The call result is returned in the call data.
+ *
+ * @return      RSDK_SUCCESS if the call was done, an error if it couldn't be done
+ *
+ */
+static rsdkStatus_t Csi2ExtIoctl(const rsdkCsi2UnitId_t unitId, const unsigned long cmd, void *pData)
+{
+    rsdkStatus_t        rez = RSDK_SUCCESS;
+    int                 fd;
+
+    if ((uint32_t)unitId >= (uint32_t)RSDK_CSI2_MAX_UNITS)
+    {
+        rez = RSDK_CSI2_DRV_WRG_UNIT_ID;
+    }
+    else
+    {
+        (void)pthread_mutex_lock(&gsCsi2ExtLock);
+        fd = Csi2ExtDevGetLocked(unitId);
+        (void)pthread_mutex_unlock(&gsCsi2ExtLock);
+        if (fd < 0)
+        {
+            rez = RSDK_CSI2_DRV_ERR_EVT_CONN;
+        }
+        else if (ioctl(fd, cmd, pData) != 0)        // no lock kept, the waits of several threads overlap
+        {
+            rez = RSDK_CSI2_DRV_ERR_COPY_DATA_ERROR;
+        }
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Copy a configuration in the request and replace its pointer by its offset in the request.
+ *
+ */
+static void Csi2ExtCfgPut(uint8_t *pReq, size_t *pOffset, void **ppCfg, const size_t size)
+{
+    if (*ppCfg != NULL)
+    {
+        (void)memcpy(&pReq[*pOffset], *ppCfg, size);
+        *ppCfg = (void *)(uintptr_t)*pOffset;
+        *pOffset = CSI2_EXT_CFG_ROUND_UP(*pOffset + size);
+    }
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Build an initialization request carrying its configurations.
+ * @details     The request is the unit, the initialization parameters, then the VC, auxiliary and metadata
+ *              configurations, their pointers replaced by their byte offset in the request, so the driver can keep
+ *              a copy of the request (see RSDK_CSI2_LX_CALL_INIT_ASYNC).
+ *
+ * @return      the request, to be freed by the caller; NULL if it can't be allocated
+ *
+ */
+static uint8_t *Csi2ExtInitPack(const rsdkCsi2UnitId_t unitId, const rsdkCsi2InitParams_t *pParams, size_t *pLen)
+{
+    uint8_t                 *pReq;
+    rsdkCsi2InitParams_t    *pCopy;
+    int32_t                 unit = (int32_t)unitId;
+    size_t                  offset;
+    uint32_t                vc;
+
+    pReq = (uint8_t *)calloc(1u, CSI2_EXT_CFG_ROUND_UP(sizeof(int32_t) + sizeof(rsdkCsi2InitParams_t)) +
+                (RSDK_CSI2_MAX_VC * ((2u * CSI2_EXT_CFG_ROUND_UP(sizeof(rsdkCsi2VCParams_t))) +
+                                            CSI2_EXT_CFG_ROUND_UP(sizeof(rsdkCsi2MetaDataParams_t)))));
+    if (pReq != NULL)
+    {
+        (void)memcpy(pReq, &unit, sizeof(int32_t));
+        pCopy = (rsdkCsi2InitParams_t *)(void *)&pReq[sizeof(int32_t)];
+        (void)memcpy(pCopy, pParams, sizeof(rsdkCsi2InitParams_t));
+        offset = CSI2_EXT_CFG_ROUND_UP(sizeof(int32_t) + sizeof(rsdkCsi2InitParams_t));
+        for (vc = 0u; vc < (uint32_t)RSDK_CSI2_MAX_VC; vc++)
+        {
+            Csi2ExtCfgPut(pReq, &offset, (void **)&pCopy->pVCconfig[vc], sizeof(rsdkCsi2VCParams_t));
+            Csi2ExtCfgPut(pReq, &offset, (void **)&pCopy->pAuxConfig[vc], sizeof(rsdkCsi2VCParams_t));
+            Csi2ExtCfgPut(pReq, &offset, (void **)&pCopy->pMetaData[vc], sizeof(rsdkCsi2MetaDataParams_t));
+        }
+        *pLen = offset;
+    }
+    return pReq;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/*******************************************************************************/
+/**
+ * @brief       Give back a frame ring buffer, see RsdkCsi2ReleaseFrameBuf.
+ *
+ */
+rsdkStatus_t Csi2_ReleaseFrameBufLinuxUs(const rsdkCsi2UnitId_t unitId, const rsdkCsi2VirtChnlId_t vcId,
+                                         const uint8_t bufIdx)
+{
+    int32_t             data[3];
+    OAL_FuncArgs_t      inArgs;
+
+    data[0] = (int32_t)unitId;
+    data[1] = (int32_t)vcId;
+    data[2] = (int32_t)bufIdx;
+    inArgs.mpData = data;
+    inArgs.mSize = sizeof(data);
+    return Csi2ExtRpcCall(RSDK_CSI2_LX_RELEASE_FRAME, &inArgs, 1u, NULL, 0u);
+}
+
+/*******************************************************************************/
+/**
+ * @brief       API call, see the API header.
+ *
+ */
+rsdkStatus_t RsdkCsi2ReleaseFrameBuf(const rsdkCsi2UnitId_t unitId, const rsdkCsi2VirtChnlId_t vcId,
+                                     const uint8_t bufIdx)
+{
+    return Csi2_ReleaseFrameBufLinuxUs(unitId, vcId, bufIdx);
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Get a snapshot of the unit telemetry, see RsdkCsi2GetTelemetry.
+ *
+ */
+rsdkStatus_t Csi2_GetTelemetryLinuxUs(const rsdkCsi2UnitId_t unitId, rsdkCsi2Telemetry_t *pTelemetry)
+{
+    rsdkStatus_t        rez;
+    int32_t             data;
+    OAL_FuncArgs_t      inArgs, outArgs;
+
+    if (pTelemetry == NULL)
+    {
+        rez = RSDK_CSI2_DRV_NULL_PARAM_PTR;
+    }
+    else
+    {
+        data = (int32_t)unitId;
+        inArgs.mpData = &data;
+        inArgs.mSize = sizeof(data);
+        outArgs.mpData = pTelemetry;
+        outArgs.mSize = sizeof(rsdkCsi2Telemetry_t);
+        rez = Csi2ExtRpcCall(RSDK_CSI2_LX_GET_TELEMETRY, &inArgs, 1u, &outArgs, 1u);
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       API call, see the API header.
+ *
+ */
+rsdkStatus_t RsdkCsi2GetTelemetry(const rsdkCsi2UnitId_t unitId, rsdkCsi2Telemetry_t *pTelemetry)
+{
+    return Csi2_GetTelemetryLinuxUs(unitId, pTelemetry);
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Get the lines committed watermark of a VC, see RsdkCsi2GetLineWatermark.
+ * @details     The event ring header, holding the watermarks, is mapped at the first call for the unit.
+ *
+ */
+rsdkCsi2LineWatermark_t *Csi2_GetLineWatermarkLinuxUs(const rsdkCsi2UnitId_t unitId, const rsdkCsi2VirtChnlId_t vcId)
+{
+    rsdkCsi2LineWatermark_t *pWm = NULL;
+    void                    *pMap;
+    int                     fd;
+
+    if (((uint32_t)unitId < (uint32_t)RSDK_CSI2_MAX_UNITS) && ((uint32_t)vcId < (uint32_t)RSDK_CSI2_MAX_VC))
+    {
+        (void)pthread_mutex_lock(&gsCsi2ExtLock);
+        if (gsCsi2ExtUnit[unitId].pRing == NULL)
+        {
+            fd = Csi2ExtDevGetLocked(unitId);
+            if (fd >= 0)
+            {
+                // the consumer writes linesConsumed and consumerOn, so the mapping is writable
+                pMap = mmap(NULL, sizeof(rsdkCsi2EvtRing_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                if (pMap != MAP_FAILED)
+                {
+                    gsCsi2ExtUnit[unitId].pRing = (rsdkCsi2EvtRing_t *)pMap;
+                }
+            }
+        }
+        if (gsCsi2ExtUnit[unitId].pRing != NULL)
+        {
+            pWm = &gsCsi2ExtUnit[unitId].pRing->lineWm[vcId];
+        }
+        (void)pthread_mutex_unlock(&gsCsi2ExtLock);
+    }
+    return pWm;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Wait for a line committed in a VC buffer, see RsdkCsi2WaitForLine.
+ *
+ */
+rsdkStatus_t Csi2_WaitForLineLinuxUs(const rsdkCsi2UnitId_t unitId, const rsdkCsi2VirtChnlId_t vcId,
+                                     const uint32_t line, const uint32_t timeoutUs)
+{
+    rsdkStatus_t            rez;
+    rsdkCsi2IocWaitLine_t   waitLine;
+
+    waitLine.vcId = (uint32_t)vcId;
+    waitLine.line = line;
+    waitLine.timeoutUs = timeoutUs;
+    waitLine.rez = (uint32_t)RSDK_CSI2_DRV_ERR_INVALID_REQ;
+    rez = Csi2ExtIoctl(unitId, RSDK_CSI2_IOC_WAIT_LINE, &waitLine);
+    if (rez == RSDK_SUCCESS)
+    {
+        rez = (rsdkStatus_t)waitLine.rez;
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       API calls, see the API header.
+ *
+ */
+rsdkCsi2LineWatermark_t *RsdkCsi2GetLineWatermark(const rsdkCsi2UnitId_t unitId, const rsdkCsi2VirtChnlId_t vcId)
+{
+    return Csi2_GetLineWatermarkLinuxUs(unitId, vcId);
+}
+
+rsdkStatus_t RsdkCsi2WaitForLine(const rsdkCsi2UnitId_t unitId, const rsdkCsi2VirtChnlId_t vcId,
+                                 const uint32_t line, const uint32_t timeoutUs)
+{
+    return Csi2_WaitForLineLinuxUs(unitId, vcId, line, timeoutUs);
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Get a consistent copy of the unit status page, see RsdkCsi2ReadStatusPage.
+ * @details     The page is mapped read-only at the first call for the unit, then it is copied between two reads
+ *              of its sequence counter, as Csi2_ReadStatusPage does in the kernel.
+ *
+ */
+rsdkStatus_t Csi2_ReadStatusPageLinuxUs(const rsdkCsi2UnitId_t unitId, rsdkCsi2StatusPage_t *pStatus)
+{
+    rsdkStatus_t                rez = RSDK_SUCCESS;
+    const rsdkCsi2StatusPage_t  *pPage = NULL;
+    void                        *pMap;
+    uint32_t                    seq;
+    int                         fd;
+
+    if ((uint32_t)unitId >= (uint32_t)RSDK_CSI2_MAX_UNITS)
+    {
+        rez = RSDK_CSI2_DRV_WRG_UNIT_ID;
+    }
+    else if (pStatus == NULL)
+    {
+        rez = RSDK_CSI2_DRV_NULL_PARAM_PTR;
+    }
+    else
+    {
+        (void)pthread_mutex_lock(&gsCsi2ExtLock);
+        if (gsCsi2ExtUnit[unitId].pStatus == NULL)
+        {
+            fd = Csi2ExtDevGetLocked(unitId);
+            if (fd >= 0)
+            {
+                pMap = mmap(NULL, sizeof(rsdkCsi2StatusPage_t), PROT_READ, MAP_SHARED, fd,
+                            (off_t)RSDK_CSI2_STATUS_PAGE_PGOFF * (off_t)sysconf(_SC_PAGESIZE));
+                if (pMap != MAP_FAILED)
+                {
+                    gsCsi2ExtUnit[unitId].pStatus = (const rsdkCsi2StatusPage_t *)pMap;
+                }
+            }
+        }
+        pPage = gsCsi2ExtUnit[unitId].pStatus;
+        (void)pthread_mutex_unlock(&gsCsi2ExtLock);
+        if (pPage == NULL)
+        {
+            rez = RSDK_CSI2_DRV_ERR_EVT_CONN;
+        }
+        else
+        {
+            do
+            {
+                seq = pPage->seq;
+                __atomic_thread_fence(__ATOMIC_ACQUIRE);
+                (void)memcpy(pStatus, (const void *)pPage, sizeof(rsdkCsi2StatusPage_t));
+                __atomic_thread_fence(__ATOMIC_ACQUIRE);
+            } while (((seq & 1u) != 0u) || (seq != pPage->seq));
+            pStatus->seq = seq;
+            if (seq == 0u)
+            {
+                rez = RSDK_CSI2_DRV_NOT_INIT;               // never updated : the unit was never initialized
+            }
+        }
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       API call, see the API header.
+ *
+ */
+rsdkStatus_t RsdkCsi2ReadStatusPage(const rsdkCsi2UnitId_t unitId, rsdkCsi2StatusPage_t *pStatus)
+{
+    return Csi2_ReadStatusPageLinuxUs(unitId, pStatus);
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Configure the multi-unit frame synchronizer, see RsdkCsi2SyncConfig.
+ *
+ */
+rsdkStatus_t Csi2_SyncConfigLinuxUs(const rsdkCsi2SyncParams_t *pParams)
+{
+    rsdkStatus_t        rez;
+    uint8_t             data[sizeof(int32_t) + sizeof(rsdkCsi2SyncParams_t)];
+    int32_t             unitId = 0;         // not used by the call, but the request starts with a unit
+    OAL_FuncArgs_t      inArgs;
+
+    if (pParams == NULL)
+    {
+        rez = RSDK_CSI2_DRV_NULL_PARAM_PTR;
+    }
+    else
+    {
+        (void)memcpy(data, &unitId, sizeof(int32_t));
+        (void)memcpy(&data[sizeof(int32_t)], pParams, sizeof(rsdkCsi2SyncParams_t));
+        inArgs.mpData = data;
+        inArgs.mSize = sizeof(data);
+        rez = Csi2ExtRpcCall(RSDK_CSI2_LX_SYNC_CONFIG, &inArgs, 1u, NULL, 0u);
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Wait for a frame synchronizer cycle, see RsdkCsi2SyncWait.
+ * @details     The synchronizer is for all the units, so the wait is done on the first unit device present.
+ *
+ */
+rsdkStatus_t Csi2_SyncWaitLinuxUs(const uint32_t lastCycleId, const uint32_t timeoutUs, rsdkCsi2SyncCycle_t *pCycle)
+{
+    rsdkStatus_t            rez = RSDK_CSI2_DRV_ERR_EVT_CONN;
+    rsdkCsi2IocSyncWait_t   syncWait;
+    uint32_t                u;
+
+    if (pCycle == NULL)
+    {
+        rez = RSDK_CSI2_DRV_NULL_PARAM_PTR;
+    }
+    else
+    {
+        (void)memset(&syncWait, 0, sizeof(syncWait));
+        syncWait.lastCycleId = lastCycleId;
+        syncWait.timeoutUs = timeoutUs;
+        syncWait.rez = (uint32_t)RSDK_CSI2_DRV_ERR_INVALID_REQ;
+        for (u = 0u; (u < (uint32_t)RSDK_CSI2_MAX_UNITS) && (rez == RSDK_CSI2_DRV_ERR_EVT_CONN); u++)
+        {
+            rez = Csi2ExtIoctl((rsdkCsi2UnitId_t)u, RSDK_CSI2_IOC_SYNC_WAIT, &syncWait);
+        }
+        if (rez == RSDK_SUCCESS)
+        {
+            rez = (rsdkStatus_t)syncWait.rez;
+            if (rez == RSDK_SUCCESS)
+            {
+                *pCycle = syncWait.cycle;
+            }
+        }
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       API calls, see the API header.
+ *
+ */
+rsdkStatus_t RsdkCsi2SyncConfig(const rsdkCsi2SyncParams_t *pParams)
+{
+    return Csi2_SyncConfigLinuxUs(pParams);
+}
+
+rsdkStatus_t RsdkCsi2SyncWait(const uint32_t lastCycleId, const uint32_t timeoutUs, rsdkCsi2SyncCycle_t *pCycle)
+{
+    return Csi2_SyncWaitLinuxUs(lastCycleId, timeoutUs, pCycle);
+}
+
+/*******************************************************************************/
+/**
+ * @brief       API calls of the raw capture recorder, see the API header; the recorder is in Csi2_Linux_Cap.c.
+ *
+ */
+rsdkStatus_t RsdkCsi2CapStart(const rsdkCsi2CapParams_t *pParams)
+{
+    return Csi2_CapStartLinuxUs(pParams);
+}
+
+rsdkStatus_t RsdkCsi2CapFrame(const rsdkCsi2Report_t *pReport)
+{
+    return Csi2_CapFrameLinuxUs(pReport);
+}
+
+rsdkStatus_t RsdkCsi2CapGetStats(rsdkCsi2CapStats_t *pStats)
+{
+    return Csi2_CapGetStatsLinuxUs(pStats);
+}
+
+rsdkStatus_t RsdkCsi2CapStop(rsdkCsi2CapStats_t *pStats)
+{
+    return Csi2_CapStopLinuxUs(pStats);
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Queue an asynchronous unit initialization, see RsdkCsi2InitAsync.
+ * @details     The callbacks are kept by the library and set by Csi2_ModuleInitWaitLinuxUs when the
+ *              initialization succeeded, as the unit calls are rejected until its end.
+ *
+ */
+rsdkStatus_t Csi2_ModuleInitAsyncLinuxUs(const rsdkCsi2UnitId_t unitId, const rsdkCsi2InitParams_t *pCsi2InitParam)
+{
+    rsdkStatus_t        rez;
+    uint8_t             *pReq;
+    size_t              len = 0u;
+    OAL_FuncArgs_t      inArgs;
+
+    if ((uint32_t)unitId >= (uint32_t)RSDK_CSI2_MAX_UNITS)
+    {
+        rez = RSDK_CSI2_DRV_WRG_UNIT_ID;
+    }
+    else if (pCsi2InitParam == NULL)
+    {
+        rez = RSDK_CSI2_DRV_NULL_PARAM_PTR;
+    }
+    else
+    {
+        pReq = Csi2ExtInitPack(unitId, pCsi2InitParam, &len);
+        if (pReq == NULL)
+        {
+            rez = RSDK_CSI2_DRV_ERR_COPY_DATA_ERROR;
+        }
+        else
+        {
+            inArgs.mpData = pReq;
+            inArgs.mSize = len;
+            rez = Csi2ExtRpcCall(RSDK_CSI2_LX_CALL_INIT_ASYNC, &inArgs, 1u, NULL, 0u);
+            free(pReq);
+        }
+        if (rez == RSDK_SUCCESS)
+        {
+            (void)pthread_mutex_lock(&gsCsi2ExtLock);
+            (void)memcpy(gsCsi2ExtUnit[unitId].initCb, pCsi2InitParam->pCallback,
+                                                                    sizeof(gsCsi2ExtUnit[unitId].initCb));
+            gsCsi2ExtUnit[unitId].initCbSet = 1u;
+            (void)pthread_mutex_unlock(&gsCsi2ExtLock);
+        }
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Wait for the end of an asynchronous unit initialization, see RsdkCsi2InitWait.
+ *
+ */
+rsdkStatus_t Csi2_ModuleInitWaitLinuxUs(const rsdkCsi2UnitId_t unitId, const uint32_t timeoutUs)
+{
+    rsdkStatus_t            rez;
+    rsdkCsi2IocInitWait_t   initWait;
+    rsdkCsi2IsrCb_t         initCb[RSDK_CSI2_MAX_IRQ_ID];
+    uint8_t                 initCbSet = 0u;
+    uint32_t                irqId;
+
+    initWait.timeoutUs = timeoutUs;
+    initWait.rez = (uint32_t)RSDK_CSI2_DRV_ERR_INVALID_REQ;
+    rez = Csi2ExtIoctl(unitId, RSDK_CSI2_IOC_INIT_WAIT, &initWait);
+    if (rez == RSDK_SUCCESS)
+    {
+        rez = (rsdkStatus_t)initWait.rez;
+    }
+    if ((rez == RSDK_SUCCESS) && ((uint32_t)unitId < (uint32_t)RSDK_CSI2_MAX_UNITS))
+    {
+        (void)pthread_mutex_lock(&gsCsi2ExtLock);
+        initCbSet = gsCsi2ExtUnit[unitId].initCbSet;
+        gsCsi2ExtUnit[unitId].initCbSet = 0u;
+        (void)memcpy(initCb, gsCsi2ExtUnit[unitId].initCb, sizeof(initCb));
+        (void)pthread_mutex_unlock(&gsCsi2ExtLock);
+    }
+    for (irqId = 0u; (irqId < (uint32_t)RSDK_CSI2_MAX_IRQ_ID) && (initCbSet != 0u); irqId++)
+    {
+        if (initCb[irqId] != NULL)
+        {
+            (void)Csi2_SetCallbackLinuxUs(unitId, (rsdkCsi2IrqId_t)irqId, initCb[irqId]);
+        }
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       API calls, see the API header.
+ *
+ */
+rsdkStatus_t RsdkCsi2InitAsync(const rsdkCsi2UnitId_t unitId, const rsdkCsi2InitParams_t *pCsi2InitParam)
+{
+    return Csi2_ModuleInitAsyncLinuxUs(unitId, pCsi2InitParam);
+}
+
+rsdkStatus_t RsdkCsi2InitWait(const rsdkCsi2UnitId_t unitId, const uint32_t timeoutUs)
+{
+    return Csi2_ModuleInitWaitLinuxUs(unitId, timeoutUs);
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Reconfigure the unit VCs, see RsdkCsi2ReconfigVC.
+ * @details     The request carries the configurations, as for Csi2_ModuleInitAsyncLinuxUs; the new callbacks are
+ *              set when the reconfiguration succeeded.
+ *
+ */
+rsdkStatus_t Csi2_ReconfigVCLinuxUs(const rsdkCsi2UnitId_t unitId, const rsdkCsi2InitParams_t *pCsi2InitParam)
+{
+    rsdkStatus_t        rez;
+    uint8_t             *pReq;
+    size_t              len = 0u;
+    OAL_FuncArgs_t      inArgs;
+    uint32_t            irqId;
+
+    if ((uint32_t)unitId >= (uint32_t)RSDK_CSI2_MAX_UNITS)
+    {
+        rez = RSDK_CSI2_DRV_WRG_UNIT_ID;
+    }
+    else if (pCsi2InitParam == NULL)
+    {
+        rez = RSDK_CSI2_DRV_NULL_PARAM_PTR;
+    }
+    else
+    {
+        pReq = Csi2ExtInitPack(unitId, pCsi2InitParam, &len);
+        if (pReq == NULL)
+        {
+            rez = RSDK_CSI2_DRV_ERR_COPY_DATA_ERROR;
+        }
+        else
+        {
+            inArgs.mpData = pReq;
+            inArgs.mSize = len;
+            rez = Csi2ExtRpcCall(RSDK_CSI2_LX_RECONFIG_VC, &inArgs, 1u, NULL, 0u);
+            free(pReq);
+        }
+        for (irqId = 0u; (irqId < (uint32_t)RSDK_CSI2_MAX_IRQ_ID) && (rez == RSDK_SUCCESS); irqId++)
+        {
+            if (pCsi2InitParam->pCallback[irqId] != NULL)
+            {
+                (void)Csi2_SetCallbackLinuxUs(unitId, (rsdkCsi2IrqId_t)irqId, pCsi2InitParam->pCallback[irqId]);
+            }
+        }
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       API call, see the API header.
+ *
+ */
+rsdkStatus_t RsdkCsi2ReconfigVC(const rsdkCsi2UnitId_t unitId, const rsdkCsi2InitParams_t *pCsi2InitParam)
+{
+    return Csi2_ReconfigVCLinuxUs(unitId, pCsi2InitParam);
+}
+
+
+#ifdef __cplusplus
+}
+#endif
@@ -76,6 +76,13 @@ extern "C"{
 
     #include "S32R45_MIPICSI2.h"
     #include "S32R45_DFS.h"
+#if (CSI2_REPLAY_USAGE == STD_ON)
+    #include "string.h"
+#endif
+#ifdef linux
+    #include <linux/delay.h>
+    #include <linux/interrupt.h>
+#endif
 
 
 /*==================================================================================================
@@ -89,6 +96,23 @@ extern "C"{
 /*==================================================================================================
 *                           LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
 ==================================================================================================*/
+#if (CSI2_REPLAY_USAGE == STD_ON)
+/* Replay session : the capture reader and the pacing time base                                     */
+typedef struct {
+    Csi2_ReplayReadType     pRead;              /* the capture reader                               */
+    void                    *pCtx;              /* the capture reader context                       */
+    Csi2_ReplayPaceType     pace;               /* the replay pacing                                */
+    uint64                  freqRec;            /* the recording counter frequency, 0 = no pacing   */
+    uint64                  timeRec0;           /* the first paced event, recording time            */
+    uint64                  timeHost0;          /* the first paced event, replay time, 0 = none yet */
+} Csi2_ReplaySessionType;
+
+/* Memory capture reader context                                                                    */
+typedef struct {
+    const uint8             *pCrt;              /* the next capture byte                            */
+    uint64                  left;               /* the capture bytes not read yet                   */
+} Csi2_ReplayMemType;
+#endif
 
 /*==================================================================================================
 *                                          LOCAL MACROS
@@ -126,10 +150,18 @@ extern "C"{
 #define CSI2_SOFTRESET_BIT              0x80000000UL    /* the 32 bits value to reset all registry          */
 #define CSI2_FLUSH_CNT_FREQ_LIMIT               200U    /* the max value for flash_cnt limit (200MHz)       */
 #define CSI2_CHIRP_NOT_STARTED                  0U      /* value for first chirp line received              */
+#define CSI2_LINE_EVT_NO_LATENCY    0xFFFFFFFFFFFFFFFFULL   /* no time budget for the LINEDONE moderation       */
 #define CSI2_VC_CFG_OFFSET                      0x04U   /* offset between two similar VC config registry    */
 #define CSI2_MAX_WAIT_FOR_STOP                  1200    /* maximum time to wait for stop state [us]         */
+#ifdef linux
+#define CSI2_STOP_POLL_US                       20u     /* lanes poll period waiting for stop state [us]    */
+#else
+#define CSI2_STOP_POLL_US                       1u      /* lanes poll period waiting for stop state [us]    */
+#endif
 #define CSI2_RXEN_RXEN_DISABLED                 0UL     /* MIPICSI2_RXEN register, RXEN field, Rx disabled. */
 #define CSI2_RXEN_RXEN_ENABLED                  1UL     /* MIPICSI2_RXEN register, RXEN field, Rx enabled.  */
+#define CSI2_REPLAY_VC_BITS                     3u      /* bits per VC in MIPICSI2_RX_VCINTRS/RX_VCINTRE    */
+#define CSI2_REPLAY_SCRATCH_LEN                 256u    /* the buffer for the capture bytes to be skipped   */
 
 #define CSI2_LAN_CS_MARK            (1UL << 5U) /* MIPICSI2_LANxCS register, DxULMA field, Data lane in Mark state. */
 #define CSI2_LAN_CS_ULPA            (1UL << 4U) /* MIPICSI2_LANxCS register, DxULPA field, Data lane ULPS active.   */
@@ -211,6 +243,41 @@ extern "C"{
         volatile uint32 gsCsi2FramesCounter[CSI2_MAX_UNITS][CSI2_MAX_VC];
 #endif /* (CSI2_FRAMES_COUNTER_USED == STD_ON)                                  */
 
+#if (CSI2_TELEMETRY_USAGE == STD_ON)
+    /* Throughput and jitter telemetry, per unit                                */
+        Csi2_TelemetryType gCsi2Telemetry[CSI2_MAX_UNITS];
+    /* Telemetry sequence counters, one per writer (irq handler), odd while the writer updates its part         */
+        volatile uint32 gCsi2TelemetrySeq[CSI2_MAX_UNITS][RSDK_CSI2_MAX_IRQ_ID];
+    /* Value used to reset the telemetry                                        */
+        static const Csi2_TelemetryType gsCsi2TelemetryReset = {0};
+#endif /* (CSI2_TELEMETRY_USAGE == STD_ON)                                      */
+
+#if (CSI2_LINE_WATERMARK_USAGE == STD_ON) && !defined(linux)
+    /* Lines committed watermarks, per unit and VC; for Linux in the unit event ring */
+        static Csi2_LineWatermarkType gsCsi2LineWm[CSI2_MAX_UNITS][CSI2_MAX_VC];
+#endif /* (CSI2_LINE_WATERMARK_USAGE == STD_ON)                                 */
+
+#if (CSI2_STATUS_PAGE_USAGE == STD_ON) && !defined(linux)
+    /* Status pages, per unit; for Linux allocated by the unit device, to be mmap-able */
+        static Csi2_StatusPageType gsCsi2StatusPage[CSI2_MAX_UNITS];
+#endif /* (CSI2_STATUS_PAGE_USAGE == STD_ON)                                    */
+
+#if (CSI2_FRAME_SYNC_USAGE == STD_ON)
+    /* Frame synchronizer : the parameters, the cycle being collected and the last closed cycles */
+        static Csi2_SyncParamsType gsCsi2SyncParams;
+        static uint64 gsCsi2SyncSkew;                   /* the skew tolerance, in counter ticks     */
+        static Csi2_SyncCycleType gsCsi2SyncOpen;
+        static Csi2_SyncCycleType gsCsi2SyncCycles[CSI2_SYNC_CYCLES_NR];    /* by cycleId % NR      */
+        static volatile uint32 gsCsi2SyncLastId;        /* the last closed cycle, 0 = none          */
+    /* Value used to reset the cycle being collected                            */
+        static const Csi2_SyncCycleType gsCsi2SyncCycleReset = {0};
+#endif /* (CSI2_FRAME_SYNC_USAGE == STD_ON)                                     */
+
+#if (CSI2_REPLAY_USAGE == STD_ON)
+    /* Replay : destination of the capture bytes without buffer (dropped data, headers extensions, padding) */
+        static uint8 gsCsi2ReplayScratch[CSI2_REPLAY_SCRATCH_LEN];
+#endif /* (CSI2_REPLAY_USAGE == STD_ON)                                         */
+
 /* Pointer to MIPICSI2 memory map                                               */
         volatile GENERIC_CSI2_Type *gMipiCsi2RegsPtr[CSI2_MAX_UNITS];
 
@@ -501,6 +568,25 @@ static Std_ReturnType Csi2_CheckSetupParams(const Csi2_UnitIdType      unitId,
                                                         (uint8)CSI2_E_DRV_INVALID_DC_PARAMS);
                     CSI2_HALT_ON_ERROR;
                 }
+#if (CSI2_DC_ESTIMATOR_USAGE == STD_ON)
+                /* check the DC estimator                                               */
+                else if ((autoDC != 0u) && ((pCsi2SetupParam->dcEstimator >= (uint8)CSI2_DC_EST_MAX) ||
+                         ((pCsi2SetupParam->dcEstimator == (uint8)CSI2_DC_EST_EMA) &&
+                          ((pCsi2SetupParam->dcEstParam == 0u) ||
+                           (pCsi2SetupParam->dcEstParam > (uint8)CSI2_DC_EMA_MAX_SHIFT))) ||
+                         ((pCsi2SetupParam->dcEstimator == (uint8)CSI2_DC_EST_WINDOW) &&
+                          ((pCsi2SetupParam->dcEstParam < 2u) ||
+                           (pCsi2SetupParam->dcEstParam > (uint8)CSI2_DC_WINDOW_MAX)))))
+                {
+                    rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_INVALID_DC_PARAMS, (uint8)CSI2_API_ID_SETUP,
+                                                        (uint8)CSI2_E_DRV_INVALID_DC_PARAMS);
+                    CSI2_HALT_ON_ERROR;
+                }
+                else
+                {
+                    ;   /* DC estimator ok                                                  */
+                }
+#endif
             }
 #endif
         } /* if((pStart->rxClkFreq < CSI2_MIN_RX_CLK_FREQ) ||...  */
@@ -527,6 +613,9 @@ static Std_ReturnType Csi2_CheckVCParam(const Csi2_VCParamsType *pVC, uint8 *pAu
 #if (CSI2_AUTO_DC_COMPENSATION == STD_ON)
     uint8           i;
 #endif
+#if (CSI2_FRAME_RING_USAGE == STD_ON)
+    uint8           iBuf;
+#endif
 
     rez = (Std_ReturnType)E_OK;                 /* default SUCCESS                  */
     if (pVC != (Csi2_VCParamsType*)NULL_PTR)
@@ -588,6 +677,37 @@ static Std_ReturnType Csi2_CheckVCParam(const Csi2_VCParamsType *pVC, uint8 *pAu
                                                         (uint8)CSI2_E_DRV_BUF_PTR_NULL);
                 CSI2_HALT_ON_ERROR;
             }
+#if (CSI2_FRAME_RING_USAGE == STD_ON)
+            if (pVC->frameBufNum > (uint8)CSI2_MAX_FRAME_BUFS)
+            {
+                rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_INVALID_VC_PARAMS, (uint8)CSI2_API_ID_SETUP,
+                                                        (uint8)CSI2_E_DRV_INVALID_VC_PARAMS);
+                CSI2_HALT_ON_ERROR;
+            }
+            else
+            {
+                for (iBuf = 1u; iBuf < pVC->frameBufNum; iBuf++)
+                {   /* the extra ring buffers must follow the same rules as the first one                   */
+                    addrAlign = (uintptr_t)(pVC->nextBufDataPtr[iBuf - 1u]);
+                    if (addrAlign == (uintptr_t)0u)
+                    {
+                        rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_BUF_PTR_NULL, (uint8)CSI2_API_ID_SETUP,
+                                                        (uint8)CSI2_E_DRV_BUF_PTR_NULL);
+                        CSI2_HALT_ON_ERROR;
+                    }
+                    else if ((addrAlign & 0xfu) != (uintptr_t)0u)
+                    {
+                        rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_BUF_PTR_NOT_ALIGNED, (uint8)CSI2_API_ID_SETUP,
+                                                        (uint8)CSI2_E_DRV_BUF_PTR_NOT_ALIGNED);
+                        CSI2_HALT_ON_ERROR;
+                    }
+                    else
+                    {
+                        /* correct buffer                                                                   */
+                    }
+                }
+            }
+#endif
 
 #if (CSI2_AUTO_DC_COMPENSATION == STD_ON)
             for (i = 0; i < pVC->channelsNum; i++)
@@ -672,6 +792,16 @@ static Std_ReturnType Csi2_RegsMap(const Csi2_UnitIdType unitId, volatile GENERI
     Std_ReturnType rez = (Std_ReturnType)E_OK;
 #if defined(linux)
         *pRegs = (volatile GENERIC_CSI2_Type*)gpRsdkCsi2Device[unitId]->pMemMapVirtAddr;
+#elif (CSI2_REGS_MODEL_USED == STD_ON)
+        /* host build, the registers are the in-memory model provided by the build                                  */
+        if ((uint8)unitId < (uint8)CSI2_MAX_UNITS)
+        {
+            *pRegs = &gCsi2RegsModel[(uint8)unitId];
+        }
+        else
+        {
+            rez = RSDK_CSI2_DRV_WRG_UNIT_ID;
+        }
 #else
         switch (unitId)
         {
@@ -787,6 +917,94 @@ static void Csi2_GetOperatingSpeedMask(const uint16 speed, uint8 *pHSFREQRNG, ui
 }
 /* Csi2_GetOperatingSpeedMask *************************/
 
+
+#if (CSI2_VC_RECONFIG_USAGE == STD_ON)
+/*================================================================================================*/
+/*
+ * @brief       The function check the CSI2 VCs reconfiguration parameters for correctness.
+ * @details     The parameters are checked as for a unit setup, then against the current D-PHY settings : the
+ *              lanes number and swap must be the same and the Rx frequency must give the same D-PHY programming
+ *              (frequency range, oscillator and flush count), as the D-PHY is not programmed again.
+ *
+ * @param[in]   unitId          - unit identifier
+ * @param[in]   pCsi2SetupParam - pointer to CSI2 setup parameters
+ *
+ * @return Std_ReturnType - success or error
+ *
+ */
+static Std_ReturnType Csi2_CheckReconfigParams(const Csi2_UnitIdType      unitId,
+                                                const Csi2_SetupParamsType *pCsi2SetupParam)
+{
+    Std_ReturnType                  rez;
+    const Csi2_DriverParamsType     *pDriverState;
+    uint8                           laneId, lanesSwap;
+    uint8                           hsFreqRangeNew, hsFreqRangeCrt;
+    uint16                          ddlOscFreqNew, ddlOscFreqCrt;
+
+#if (CSI2_DEV_ERROR_DETECT == STD_ON)
+    rez = Csi2_CheckSetupParams(unitId, pCsi2SetupParam);
+#else
+    rez = (Std_ReturnType)E_OK;
+#endif
+    if (rez == (Std_ReturnType)E_OK)
+    {
+        pDriverState = &gCsi2Settings[(uint8)unitId];
+        if ((pDriverState->driverState != CSI2_DRIVER_STATE_ON) &&
+            (pDriverState->driverState != CSI2_DRIVER_STATE_STOP))
+        {       /* the D-PHY must be already setup and powered on                               */
+            if (pDriverState->driverState == CSI2_DRIVER_STATE_NOT_INITIALIZED)
+            {
+                rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_NOT_INIT, (uint8)CSI2_API_ID_RECONFIG_VC,
+                                                        (uint8)CSI2_E_DRV_NOT_INIT);
+            }
+            else
+            {
+                rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_WRG_STATE, (uint8)CSI2_API_ID_RECONFIG_VC,
+                                                        (uint8)CSI2_E_DRV_WRG_STATE);
+            }
+            CSI2_HALT_ON_ERROR;
+        }
+        else if (pCsi2SetupParam->numLanesRx != pDriverState->numLanesRx)
+        {
+            rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_INVALID_LANES_NR, (uint8)CSI2_API_ID_RECONFIG_VC,
+                                                        (uint8)CSI2_E_DRV_INVALID_LANES_NR);
+            CSI2_HALT_ON_ERROR;
+        }
+        else
+        {
+            /* the lanes swap, computed as at setup                                             */
+            lanesSwap = 0u;
+            for (laneId = (uint8)CSI2_LANE_0; laneId < (uint8)CSI2_MAX_LANE; laneId++)
+            {
+                lanesSwap |= ((uint8)pCsi2SetupParam->lanesMapRx[laneId]) << (laneId * 2u);
+            }
+            Csi2_GetOperatingSpeedMask((uint16)pCsi2SetupParam->rxClkFreq, &hsFreqRangeNew, &ddlOscFreqNew);
+            Csi2_GetOperatingSpeedMask((uint16)pDriverState->rxClkFreq, &hsFreqRangeCrt, &ddlOscFreqCrt);
+            if (lanesSwap != pDriverState->lanesSwap)
+            {
+                rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_INVALID_RX_SWAP, (uint8)CSI2_API_ID_RECONFIG_VC,
+                                                        (uint8)CSI2_E_DRV_INVALID_RX_SWAP);
+                CSI2_HALT_ON_ERROR;
+            }
+            else if ((hsFreqRangeNew != hsFreqRangeCrt) || (ddlOscFreqNew != ddlOscFreqCrt) ||
+                     ((pCsi2SetupParam->rxClkFreq < (uint32)CSI2_FLUSH_CNT_FREQ_LIMIT) !=
+                      (pDriverState->rxClkFreq < (uint32)CSI2_FLUSH_CNT_FREQ_LIMIT)))
+            {       /* the D-PHY must be programmed again for this frequency                        */
+                rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_INVALID_CLOCK_FREQ, (uint8)CSI2_API_ID_RECONFIG_VC,
+                                                        (uint8)CSI2_E_DRV_INVALID_CLOCK_FREQ);
+                CSI2_HALT_ON_ERROR;
+            }
+            else
+            {
+                ;   /* same D-PHY settings, the VCs can be reconfigured                                 */
+            }
+        }
+    }
+    return rez;
+}
+/* Csi2_CheckReconfigParams *************************/
+#endif /* #if (CSI2_VC_RECONFIG_USAGE == STD_ON) */
+
 #if (CSI2_AUTO_DC_COMPENSATION == STD_ON)
 /*================================================================================================*/
 /*
@@ -852,6 +1070,62 @@ static uint8 Csi2_SetOffsetMan(Csi2_VCDriverStateType *pVCDrvState, const Csi2_V
     return (statFlag);
 }
 /* Csi2_SetOffsetMan *************************/
+
+/*================================================================================================*/
+/*
+ * @brief       Prepare the DC offset computation for a VC.
+ * @details     The reciprocals of the samples number of the frame mean and of the window length are computed once
+ *              here, so the interrupt handler computes the DC offsets without divisions. The estimators are
+ *              initialized by the first frame.
+ *
+ * @param[in]   pVCDrvState - pointer to VC driver state
+ * @param[in]   pVCparams   - pointer to VC parameters
+ * @param[in]   pParams     - pointer to the unit setup parameters
+ * @param[in]   statFlag    - the statistics management of the unit
+ *
+ */
+static void Csi2_SetDcEstimator(Csi2_VCDriverStateType *pVCDrvState, const Csi2_VCParamsType *pVCparams,
+                                const Csi2_SetupParamsType *pParams, const Csi2_AutoDCComputeTimeType statFlag)
+{
+    uint64  dcDiv;                              /* samples number of the frame mean                 */
+
+    if (pVCparams != (Csi2_VCParamsType*)NULL_PTR)  /* only if the pointer is defined               */
+    {
+        dcDiv = (uint64)pVCparams->expectedNumSamples;
+        if (statFlag == CSI2_AUTODC_EVERY_LINE)
+        {
+            dcDiv *= (uint64)pVCparams->expectedNumLines;
+        }
+        else
+        {
+            if (statFlag == CSI2_AUTODC_AT_FE)
+            {
+                dcDiv *= (uint64)pVCparams->bufNumLines;
+            }
+        }
+        if (dcDiv == 0u)
+        {
+            dcDiv = 1u;                         /* not possible for checked parameters              */
+        }
+        pVCDrvState->dcDiv = dcDiv;
+        pVCDrvState->dcRecip = (((uint64)1u << CSI2_DC_RECIP_SHIFT) + dcDiv - 1u) / dcDiv;
+#if (CSI2_DC_ESTIMATOR_USAGE == STD_ON)
+        pVCDrvState->dcEstimator = pParams->dcEstimator;
+        pVCDrvState->dcEstParam = pParams->dcEstParam;
+        pVCDrvState->dcWinRecip = 0u;
+        if (pParams->dcEstimator == (uint8)CSI2_DC_EST_WINDOW)
+        {
+            pVCDrvState->dcWinRecip = (((uint64)1u << CSI2_DC_RECIP_SHIFT) + (uint64)pParams->dcEstParam - 1u) /
+                                      (uint64)pParams->dcEstParam;
+        }
+        pVCDrvState->dcWinPos = 0u;
+        pVCDrvState->dcEstInit = 0u;
+#else
+        (void)pParams;
+#endif
+    }
+}
+/* Csi2_SetDcEstimator *************************/
 #endif
 
 
@@ -1068,6 +1342,9 @@ static Std_ReturnType Csi2_ConfigVC(const Csi2_UnitIdType csi2UnitNum, const uin
 {
 #if (CSI2_STATISTIC_DATA_USAGE == STD_ON)
     uint32                  i;
+#endif
+#if (CSI2_FRAME_RING_USAGE == STD_ON)
+    uint8                   iBuf;
 #endif
     uint32                  val1, val2, cfg2;
     uint16                  lenChirpData, lenBufData;       /* data lengths                 */
@@ -1172,6 +1449,47 @@ static Std_ReturnType Csi2_ConfigVC(const Csi2_UnitIdType csi2UnitNum, const uin
                     (sint16)CSI2_MAX_VAL_SIGNED : (sint16)CSI2_MAX_VAL_UNSIGNED;
             pDriverStateVC->statDC[i].channelBitToggle = (uint16)0;
         }  /* for   */
+#endif
+#if (CSI2_DEFERRED_STATISTICS == STD_ON)
+        pDriverStateVC->statLineHead = 0u;                  /* nothing pending for the bottom half          */
+        pDriverStateVC->statLineTail = 0u;
+        pDriverStateVC->statFeLines = 0u;
+#if (CSI2_AUTO_DC_COMPENSATION == STD_ON)
+        pDriverStateVC->dcPending = 0u;
+#endif
+#endif
+#if (CSI2_FRAME_RING_USAGE == STD_ON)
+        pDriverStateVC->frameBufCrt = 0u;                   /* the reception starts in the first buffer     */
+        pDriverStateVC->frameBufStat = 0u;
+        for (iBuf = 0u; iBuf < (uint8)CSI2_MAX_FRAME_BUFS; iBuf++)
+        {
+            pDriverStateVC->frameBufOut[iBuf] = 0u;         /* all buffers owned by the driver              */
+            pDriverStateVC->frameBufBack[iBuf] = 0u;
+        }
+#endif
+#if (CSI2_TIMESTAMP_USAGE == STD_ON)
+        pDriverStateVC->timeFrameStart = 0u;                /* no event received yet                        */
+        pDriverStateVC->timeFrameEnd = 0u;
+        pDriverStateVC->timeLineDone = 0u;
+#endif
+#if (CSI2_LINE_EVT_MODERATION == STD_ON)
+        pDriverStateVC->lineEvtFirst = 0u;                  /* no LINEDONE pending                          */
+        pDriverStateVC->lineEvtLast = 0u;
+        pDriverStateVC->lineEvtPeriod = 0u;                 /* line rate not known yet                      */
+        pDriverStateVC->lineEvtTimeFirst = 0u;
+        pDriverStateVC->lineEvtTimeLast = 0u;
+        /* start with the maximum lines budget, but at least one trigger                                    */
+        pDriverStateVC->lineEvtBudget = (pVCparams->lineEvtMaxLines > (uint16)pVCparams->bufNumLinesTrigger) ?
+                                pVCparams->lineEvtMaxLines : (uint16)pVCparams->bufNumLinesTrigger;
+        if (pVCparams->lineEvtMaxLatencyUs != 0u)
+        {   /* the latency budget in counter ticks                                                          */
+            pDriverStateVC->lineEvtLatency = ((uint64)pVCparams->lineEvtMaxLatencyUs * CSI2_GET_TIMESTAMP_FREQ()) /
+                                                    (uint64)1000000u;
+        }
+        else
+        {
+            pDriverStateVC->lineEvtLatency = CSI2_LINE_EVT_NO_LATENCY;
+        }
 #endif
     }
     if(rez == (Std_ReturnType)E_OK)
@@ -1364,7 +1682,9 @@ static void Csi2_WaitLoopNs(uint32 loops)
 /*================================================================================================*/
 /*
  * @brief       Procedure to introduce a microseconds delay in execution.
- * @details     For AUTOSAR, the internal OsOf timer implementation is used
+ * @details     For AUTOSAR, the internal OsOf timer implementation is used.
+ *              For Linux the caller sleeps (process context only, as for the initialization), so the CPU is
+ *              free for the other units initialization or for other tasks during the D-PHY waits.
  *
  * @param[in]   loops   Number of microseconds to wait
  *
@@ -1373,11 +1693,15 @@ static void Csi2_WaitLoopNs(uint32 loops)
 static uint8 Csi2_WaitLoopUs(uint32 uSec)
 {
     uint8   rez = 0u;               /* no error     */
+#ifdef linux
+    usleep_range((unsigned long)uSec, (unsigned long)uSec + ((unsigned long)uSec >> 2u) + 1UL);
+#else
     volatile uint32 i = CSI2_US_DELAY * uSec;
     while(i != 0u)
     {
         i--;
     }
+#endif
     return rez;
 }
 /* Csi2_WaitLoopUs *************************/
@@ -1386,7 +1710,8 @@ static uint8 Csi2_WaitLoopUs(uint32 uSec)
 /*================================================================================================*/
 /*
  * @brief       Procedure which wait for STOP state on data lanes.
- * @details     The time-out is set to 1.2 ms.
+ * @details     The time-out is set to 1.2 ms. The lanes are polled every CSI2_STOP_POLL_US; the time-out is
+ *              counted in poll periods, so it is never shorter than required, even for the longer Linux sleeps.
  *
  * @param[in]   pInitParams     - pointer to the parameters structure
  *
@@ -1398,15 +1723,17 @@ static Std_ReturnType Csi2_WaitForStopState(const volatile
         *pRegs, const uint32 maxLane)
 {
     Std_ReturnType  rez = (Std_ReturnType)E_OK;
-    uint32          i, stp;
+    uint32          waitUs, stp;
     uint32          j;
 
     /* Wait for about 1.2ms for STOP state on data lines or error reported
      * If the frontend CSI2 interface isn't powered up this check (step 25) could fail.
      * But the interface will start working correctly once the front-end CSI2 powers up.    */
-    for(i = 0u; i < (uint32)CSI2_MAX_WAIT_FOR_STOP; i++)
+    waitUs = 0u;
+    do
     {
-        (void)Csi2_WaitLoopUs(1u);
+        (void)Csi2_WaitLoopUs((uint32)CSI2_STOP_POLL_US);
+        waitUs += (uint32)CSI2_STOP_POLL_US;
 
         stp = pRegs->RX_LANCS[0];
         for(j = (uint32)CSI2_LANE_1; j < maxLane; j++)
@@ -1414,13 +1741,8 @@ static Std_ReturnType Csi2_WaitForStopState(const volatile
             stp &= pRegs->RX_LANCS[j];
         }
         stp &= MIPICSI2_RX_LANCS_DSTOP_MASK;
-        if((stp != 0u)
-            )
-        {
-            break;
-        }
-    }
-    if((stp == 0u) && (i >= (uint32)CSI2_MAX_WAIT_FOR_STOP))
+    } while((stp == 0u) && (waitUs < (uint32)CSI2_MAX_WAIT_FOR_STOP));
+    if(stp == 0u)
     {       /* time-out waiting for STOP state      */
         rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_CALIBRATION_TIMEOUT, (uint8)CSI2_API_ID_SETUP,
                                                                 (uint8)CSI2_E_DRV_CALIBRATION_TIMEOUT);
@@ -1588,6 +1910,212 @@ static void Csi2_SetSdma(volatile GENERIC_CSI2_Type *pRegs, const uint8 csi2VC,
 #endif
 
 
+#ifdef linux
+/*================================================================================================*/
+/*
+ * @brief       Procedure to unmap the VCs data buffers of a unit.
+ * @details     The kernel virtual pointers to the VCs buffers are released, before a new setup.
+ *
+ * @param[in]   pDriverState    - pointer to the unit driver state
+ *
+ */
+static void Csi2_UnmapVcBuffers(Csi2_DriverParamsType *pDriverState)
+{
+    uint32          i;
+#if (CSI2_FRAME_RING_USAGE == STD_ON)
+    uint8           iBuf;
+#endif
+
+    for(i =  0; i < (uint32_t)RSDK_CSI2_MAX_VC; i++)
+    {
+        if(pDriverState->workingParamVC[i].pVirtData != NULL)
+        {
+            iounmap(pDriverState->workingParamVC[i].pVirtData);             /* unmap the mapped memory          */
+            pDriverState->workingParamVC[i].pVirtData = NULL;
+#if (CSI2_FRAME_RING_USAGE == STD_ON)
+            pDriverState->workingParamVC[i].pFrameVirtData[0] = NULL;
+            for(iBuf = 1u; iBuf < (uint8)CSI2_MAX_FRAME_BUFS; iBuf++)
+            {
+                if(pDriverState->workingParamVC[i].pFrameVirtData[iBuf] != NULL)
+                {
+                    iounmap(pDriverState->workingParamVC[i].pFrameVirtData[iBuf]);
+                    pDriverState->workingParamVC[i].pFrameVirtData[iBuf] = NULL;
+                }
+            }
+#endif
+        }
+    }
+}
+/* Csi2_UnmapVcBuffers *************************/
+
+
+/*================================================================================================*/
+/*
+ * @brief       Procedure to map the VCs data buffers of a unit.
+ * @details     The VCs buffers are mapped in the kernel space, for statistics usage/computation. If a mapping
+ *              fails, the buffers already mapped are unmapped, so no VC has a partial mapping.
+ *
+ * @param[in]   unitId          - unit identifier
+ * @param[in]   apiId           - the caller API id, for the error report
+ *
+ * @return      Std_ReturnType - E_OK or RSDK_CSI2_DRV_ERR_COPY_DATA_ERROR if a buffer can't be mapped
+ *
+ */
+static Std_ReturnType Csi2_MapVcBuffers(const Csi2_UnitIdType unitId, const uint8 apiId)
+{
+    Csi2_VCDriverStateType  *pVcDriverState;
+    uint64_t                dataRange;
+    uint32                  i;
+    Std_ReturnType          rez = (Std_ReturnType)E_OK;
+#if (CSI2_FRAME_RING_USAGE == STD_ON)
+    uint8                   iBuf;
+#endif
+
+    for(i = 0; (i < (uint32_t)RSDK_CSI2_MAX_VC) && (rez == (Std_ReturnType)E_OK); i++)
+    {
+        pVcDriverState = &gCsi2Settings[unitId].workingParamVC[i];
+        if(pVcDriverState->vcParamsPtr!= NULL)
+        {
+            dataRange = (uint64_t)pVcDriverState->vcParamsPtr->bufNumLines;
+            dataRange *= (uint64_t)pVcDriverState->vcParamsPtr->bufLineLen;
+            /* map the data, for statistics usage/computation                                                       */
+            pVcDriverState->pVirtData = ioremap_cache((uintptr_t)pVcDriverState->vcParamsPtr->bufDataPtr,
+                    dataRange + 0x100UL);
+            if(pVcDriverState->pVirtData == NULL)
+            {
+                rez = (Std_ReturnType)RSDK_CSI2_DRV_ERR_COPY_DATA_ERROR;
+            }
+#if (CSI2_FRAME_RING_USAGE == STD_ON)
+            pVcDriverState->pFrameVirtData[0] = pVcDriverState->pVirtData;
+            for(iBuf = 1u; (iBuf < pVcDriverState->vcParamsPtr->frameBufNum) && (rez == (Std_ReturnType)E_OK);
+                iBuf++)
+            {   /* the other ring buffers, same size as the first one                                              */
+                pVcDriverState->pFrameVirtData[iBuf] = ioremap_cache(
+                        (uintptr_t)pVcDriverState->vcParamsPtr->nextBufDataPtr[iBuf - 1u],
+                        dataRange + 0x100UL);
+                if(pVcDriverState->pFrameVirtData[iBuf] == NULL)
+                {
+                    rez = (Std_ReturnType)RSDK_CSI2_DRV_ERR_COPY_DATA_ERROR;
+                }
+            }
+#endif
+        }
+    }
+    if(rez != (Std_ReturnType)E_OK)
+    {       /* unwind : the mappings done until now are released                                                    */
+        Csi2_UnmapVcBuffers(&gCsi2Settings[unitId]);
+        rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_ERR_COPY_DATA_ERROR, apiId, (uint8)CSI2_E_DRV_ERR_COPY_DATA_ERROR);
+        CSI2_HALT_ON_ERROR;
+    }
+    return rez;
+}
+/* Csi2_MapVcBuffers *************************/
+#endif /* #ifdef linux */
+
+
+/*================================================================================================*/
+/*
+ * @brief       Procedure for the VCs data path setup.
+ * @details     All VCs are disabled, then the statistics management, the VCs, the auxiliary and the metadata
+ *              buffers are programmed. The D-PHY is not touched, so the procedure is used by the unit setup and
+ *              by the VCs reconfiguration.
+ *
+ * @param[in]   csi2UnitNum = MIPI CSI2 unit ID
+ * @param[in]   pRegs       = pointer to unit registry
+ * @param[in]   pParams     = pointer to the unit initialization parameters
+ *
+ * @return      result status, success or error
+ *
+ */
+static Std_ReturnType Csi2_SetupVcData(const Csi2_UnitIdType csi2UnitNum, volatile GENERIC_CSI2_Type *pRegs,
+                                     const Csi2_SetupParamsType *pParams)
+{
+    Std_ReturnType          rez;
+#if (CSI2_STATISTIC_DATA_USAGE == STD_ON)
+    Csi2_DriverParamsType   *pDriverState = &gCsi2Settings[(uint8)csi2UnitNum];
+#endif
+#if (CSI2_AUTO_DC_COMPENSATION == STD_ON)
+    uint32                  i;
+#endif
+
+    pRegs->RX_VCENABLE = 0u;                                    /* disable all                              */
+#if (CSI2_STATISTIC_DATA_USAGE == STD_ON)
+    pDriverState->statisticsFlag = CSI2_AUTODC_NO;              /* disable statistics for unit              */
+    #if (CSI2_AUTO_DC_COMPENSATION == STD_ON)
+    /* process first the DC management for each channel on each VC                                                  */
+    for (i = 0; i < (uint32)CSI2_MAX_VC; i++)
+    {
+        pDriverState->workingParamVC[i].eventsMask = 0;
+        if (Csi2_SetOffsetMan(&pDriverState->workingParamVC[i], pParams->vcConfigPtr[i]) != 0u)
+        {
+            pDriverState->statisticsFlag = (Csi2_AutoDCComputeTimeType)CSI2_AUTODC_LAST_LINE;
+        }
+    }
+    if (pDriverState->statisticsFlag != CSI2_AUTODC_NO)
+    {                                                            /* at least one channel with AUTO_DC       */
+        /* just copy the value, checked before     */
+        pDriverState->statisticsFlag = (Csi2_AutoDCComputeTimeType)pParams->statManagement;
+        for (i = 0; i < (uint32)CSI2_MAX_VC; i++)
+        {
+            Csi2_SetDcEstimator(&pDriverState->workingParamVC[i], pParams->vcConfigPtr[i], pParams,
+                                pDriverState->statisticsFlag);
+        }
+    }
+    #endif
+#endif
+    rez = Csi2_SetupAllVcAux(csi2UnitNum, pRegs, pParams);
+
+    if (rez == (Std_ReturnType)E_OK)
+    {       /* successful VC setup     */
+#if (CSI2_STATISTIC_DATA_USAGE == STD_ON)
+        if (pDriverState->statisticsFlag != CSI2_AUTODC_NO)
+        {
+            pRegs->RX_STAT_CONFIG = (uint32)1
+            ; /* at least one channel with auto DC offset or statistics required  */
+        }
+        else
+        {
+#endif
+            pRegs->RX_STAT_CONFIG = (uint32)0
+            ;                         /* no statistics at all                     */
+#if (CSI2_STATISTIC_DATA_USAGE == STD_ON)
+        }
+#endif
+    }
+    return rez;
+}
+/* Csi2_SetupVcData *************************/
+
+
+#if (CSI2_GPIO_USED == STD_ON) || (CSI2_SDMA_USED == STD_ON)
+/*================================================================================================*/
+/*
+ * @brief       Procedure for the VCs external triggers setup.
+ * @details     The GPIO and SDMA triggers are programmed for all VCs.
+ *
+ * @param[in]   pRegs       = pointer to unit registry
+ * @param[in]   pParams     = pointer to the unit initialization parameters
+ *
+ */
+static void Csi2_SetupVcTriggers(volatile GENERIC_CSI2_Type *pRegs, const Csi2_SetupParamsType *pParams)
+{
+    uint8           vcId;
+
+    for (vcId = (uint8)CSI2_VC_0; vcId < (uint8)CSI2_MAX_VC; vcId++)
+    {
+        /* gpio & sdma programming per VC                                                                           */
+    #if (CSI2_GPIO_USED == STD_ON)
+        Csi2_SetGpio(pRegs, vcId, pParams->vcConfigPtr[vcId]);
+    #endif
+    #if (CSI2_SDMA_USED == STD_ON)
+        Csi2_SetSdma(pRegs, vcId, pParams->vcConfigPtr[vcId]);
+    #endif
+    }  /* for   */
+}
+/* Csi2_SetupVcTriggers *************************/
+#endif /* #if (CSI2_GPIO_USED == STD_ON) || (CSI2_SDMA_USED == STD_ON) */
+
+
 /*================================================================================================*/
 /*
  * @brief       Procedure for specific unit setup.
@@ -1605,12 +2133,6 @@ static Std_ReturnType Csi2_ModuleSetup(const Csi2_UnitIdType csi2UnitNum, const
     Std_ReturnType                      rez;
     Csi2_DriverParamsType *             pDriverState;
     Csi2_UnitIdType                     usedUnit = csi2UnitNum;
-#if (CSI2_AUTO_DC_COMPENSATION == STD_ON) || (CSI2_SAF85XX_PHY_USED == STD_ON)
-    uint32                              i;
-#endif
-#if ((CSI2_GPIO_USED == STD_ON) || (CSI2_SDMA_USED == STD_ON))
-    uint8                               vcId;
-#endif
 
     rez = (Std_ReturnType)E_OK;
 
@@ -1656,15 +2178,7 @@ static Std_ReturnType Csi2_ModuleSetup(const Csi2_UnitIdType csi2UnitNum, const
 #ifdef linux
         if(pDriverState->driverState != CSI2_DRIVER_STATE_NOT_INITIALIZED)
         {
-            for(i =  0; i < (uint32_t)RSDK_CSI2_MAX_VC; i++)
-            {
-                if((pDriverState->workingParamVC[i].vcParamsPtr != NULL) && 
-                                (pDriverState->workingParamVC[i].pVirtData != NULL))
-                {
-                    iounmap(pDriverState->workingParamVC[i].pVirtData);     /* unmap the mapped memory          */
-                    pDriverState->workingParamVC[i].pVirtData = NULL;
-                }
-            }
+            Csi2_UnmapVcBuffers(pDriverState);                          /* unmap the mapped memory                  */
         }
 #endif
         pDriverState->driverState = CSI2_DRIVER_STATE_NOT_INITIALIZED;  /* unit not setup                           */
@@ -1695,6 +2209,9 @@ static Std_ReturnType Csi2_ModuleSetup(const Csi2_UnitIdType csi2UnitNum, const
              * according to the latest RM, only Rx can be used, no Tx available                                     */
 
             pRegs->RX_RXNULANE = (uint32)pParams->numLanesRx + 1u;  /* step 1 - set the Rx num. lanes               */
+        #if ((CSI2_DFS_USAGE == CSI2_DFS_ONCE) || (CSI2_DFS_USAGE == CSI2_DFS_ALWAYS)) && defined(linux)
+            mutex_lock(&gRsdkCsi2DfsLock);  /* the DFS is shared, the units can be initialized in parallel          */
+        #endif
         #if (CSI2_DFS_USAGE == CSI2_DFS_ONCE)
             if(gsCsi2DfsReset == 0u)
             {
@@ -1704,6 +2221,9 @@ static Std_ReturnType Csi2_ModuleSetup(const Csi2_UnitIdType csi2UnitNum, const
         #elif (CSI2_DFS_USAGE == CSI2_DFS_ALWAYS)
             DfsTilt();      /* step 2&3 - Gate/ungate the MIPI_CSI_TXRX_LI_CLK                                      */
         #endif  /* #if (CSI2_DFS_USAGE == CSI2_DFS_ONCE)    */
+        #if ((CSI2_DFS_USAGE == CSI2_DFS_ONCE) || (CSI2_DFS_USAGE == CSI2_DFS_ALWAYS)) && defined(linux)
+            mutex_unlock(&gRsdkCsi2DfsLock);
+        #endif
 
             pRegs->DPHY_RSTCFG = 0u;                                /* step 4 & 5 - clear RSTZ & SHUTDWNZ           */
 
@@ -1943,45 +2463,10 @@ static Std_ReturnType Csi2_ModuleSetup(const Csi2_UnitIdType csi2UnitNum, const
             /* end of DPHY subsystem initialization ===========================================================     */
 
             /* step 20 - configure the circular buffers                                                             */
-            pRegs->RX_VCENABLE = 0u;                                    /* disable all                              */
-#if (CSI2_STATISTIC_DATA_USAGE == STD_ON)
-            pDriverState->statisticsFlag = CSI2_AUTODC_NO;              /* disable statistics for unit              */
-    #if (CSI2_AUTO_DC_COMPENSATION == STD_ON)
-            /* process first the DC management for each channel on each VC                                          */
-            for (i = 0; i < (uint32)CSI2_MAX_VC; i++)
-            {
-                pDriverState->workingParamVC[i].eventsMask = 0;
-                if (Csi2_SetOffsetMan(&pDriverState->workingParamVC[i], pParams->vcConfigPtr[i]) != 0u)
-                {
-                    pDriverState->statisticsFlag = (Csi2_AutoDCComputeTimeType)CSI2_AUTODC_LAST_LINE;
-                }
-            }
-            if (pDriverState->statisticsFlag != CSI2_AUTODC_NO)
-            {                                                            /* at least one channel with AUTO_DC       */
-                /* just copy the value, checked before     */
-                pDriverState->statisticsFlag = (Csi2_AutoDCComputeTimeType)pParams->statManagement;
-            }
-    #endif
-#endif
-            rez = Csi2_SetupAllVcAux(usedUnit, pRegs, pParams);
+            rez = Csi2_SetupVcData(usedUnit, pRegs, pParams);
 
             if (rez == (Std_ReturnType)E_OK)
             {       /* successful VC setup     */
-#if (CSI2_STATISTIC_DATA_USAGE == STD_ON)
-                if (pDriverState->statisticsFlag != CSI2_AUTODC_NO)
-                {
-                    pRegs->RX_STAT_CONFIG = (uint32)1
-                    ; /* at least one channel with auto DC offset or statistics required  */
-                }
-                else
-                {
-#endif
-                    pRegs->RX_STAT_CONFIG = (uint32)0
-                    ;                         /* no statistics at all                     */
-#if (CSI2_STATISTIC_DATA_USAGE == STD_ON)
-                }
-#endif
-
                 /* step 21 - Configure noext_burnin_res_cal_rw                                                      */
                 /*
                 * @section Csi2_c_REF_1
@@ -2011,21 +2496,18 @@ static Std_ReturnType Csi2_ModuleSetup(const Csi2_UnitIdType csi2UnitNum, const
 #if (CSI2_GPIO_USED == STD_ON) || (CSI2_SDMA_USED == STD_ON)
                 /* assume step 26 done with success => setup ok
                  * do the other VC setup - GPIO, SDMA, irq handling                                                 */
-                for (vcId = (uint8)CSI2_VC_0; vcId < (uint8)CSI2_MAX_VC; vcId++)
-                {
-                    /* gpio & sdma programming per VC                                                               */
-        #if (CSI2_GPIO_USED == STD_ON)
-                    Csi2_SetGpio(pRegs, vcId, pParams->vcConfigPtr[vcId]);
-        #endif
-        #if (CSI2_SDMA_USED == STD_ON)
-                    Csi2_SetSdma(pRegs, vcId, pParams->vcConfigPtr[vcId]);
-        #endif
-                }  /* for   */
+                Csi2_SetupVcTriggers(pRegs, pParams);
 #endif /* #if (CSI2_GPIO_USED == STD_ON) || (CSI2_SDMA_USED == STD_ON) */
                 /* interrupts programming                                                                           */
                 rez =
                         Csi2_SetupUIrq(usedUnit, pRegs, pParams);
                 pDriverState->driverState = CSI2_DRIVER_STATE_ON;   /* setup done ok                                */
+#if (CSI2_VC_RECONFIG_USAGE == STD_ON)
+                /* keep the D-PHY settings, the VCs reconfiguration must match them                                 */
+                pDriverState->rxClkFreq = pParams->rxClkFreq;
+                pDriverState->numLanesRx = pParams->numLanesRx;
+                pDriverState->lanesSwap = lanesSwap;
+#endif
 
                 /* step 27 - Clear FORCERXMODE                                                                      */
                 /*
@@ -2050,6 +2532,189 @@ static Std_ReturnType Csi2_ModuleSetup(const Csi2_UnitIdType csi2UnitNum, const
 /* Csi2_ModuleSetup *************************/
 
 
+/*================================================================================================*/
+/*
+ * @brief       Procedure to keep the unit parameters needed at run-time.
+ * @details     The VCs parameters are copied in the driver space (and the auxiliary/metadata ones, if the
+ *              power on/off is used), the frames counters, the telemetry and the lines watermarks are reset.
+ *
+ * @param[in]   unitId          - the unit id to be used
+ * @param[in]   setupParamPtr   - pointer to the CSI2 Driver setup structure, already checked
+ *
+ */
+static void Csi2_SaveSetupParams(const Csi2_UnitIdType unitId, const Csi2_SetupParamsType *setupParamPtr)
+{
+#if (CSI2_POWER_ON_OFF_USAGE == STD_ON)
+    Csi2_SetupParamsType    *pStaticParams;
+    #if (CSI2_AUXILIARY_DATA_USAGE == STD_ON)
+        Csi2_VCParamsType       *pStaticAuxParams;
+    #endif
+    #if (CSI2_METADATA_DATA_USAGE == STD_ON)
+        Csi2_MetaDataParamsType *pStaticMdParams;
+    #endif
+#endif
+#if (CSI2_FRAMES_COUNTER_USED == STD_ON)
+    volatile uint32         *pFramesCntr;
+#endif
+    uint32                  i;
+    Csi2_VCParamsType       *pStaticVcParams;
+    Csi2_DriverParamsType   *pDrvParams;
+
+    /* initialize the driver parameters pointer and the VC specific parameters, needed at run-time    */
+    pDrvParams = &gCsi2Settings[(uint8)unitId];
+    pStaticVcParams = &gsCsi2VCParamCopy[(uint8)unitId][0u];
+#if (CSI2_FRAMES_COUNTER_USED == STD_ON)
+    pFramesCntr = &gsCsi2FramesCounter[(uint8)unitId][0];
+#endif
+    for (i = 0; i < (uint32)CSI2_MAX_VC; i++)
+    {
+        if (setupParamPtr->vcConfigPtr[i] != (Csi2_VCParamsType*)NULL_PTR)
+        {
+            /* copy the VC parameters                                                                       */
+            pStaticVcParams[i] = *setupParamPtr->vcConfigPtr[i];
+            pDrvParams->workingParamVC[i].vcParamsPtr = &pStaticVcParams[i];
+        }
+        else
+        {
+            pDrvParams->workingParamVC[i].vcParamsPtr = (Csi2_VCParamsType*)NULL_PTR;
+        }
+    }
+
+
+#if (CSI2_POWER_ON_OFF_USAGE == STD_ON)
+
+    pStaticParams = &gsCsi2UnitParamCopy[(uint8)unitId];
+    #if (CSI2_AUXILIARY_DATA_USAGE == STD_ON)
+        pStaticAuxParams = &gsCsi2AuxParamCopy[(uint8)unitId][0u];
+    #endif
+    #if (CSI2_METADATA_DATA_USAGE == STD_ON)
+        pStaticMdParams = &gsCsi2MdParamCopy[(uint8)unitId][0u];
+    #endif
+    /* copy the current parameters for future use, if it will be required                                       */
+    if (pStaticParams != setupParamPtr)
+    {
+        *pStaticParams = *setupParamPtr;                        /* base setup                                   */
+        for (i = 0; i < (uint32)CSI2_MAX_VC; i++)
+        {
+            if (setupParamPtr->vcConfigPtr[i] != (Csi2_VCParamsType*)NULL_PTR)
+            {
+                pStaticParams->vcConfigPtr[i] = &pStaticVcParams[i];
+                /* clear the frames counters                                                                    */
+#if (CSI2_FRAMES_COUNTER_USED == STD_ON)
+                pFramesCntr[i] = 0;
+#endif
+            }
+#if (CSI2_AUXILIARY_DATA_USAGE == STD_ON)
+            if (setupParamPtr->auxConfigPtr[i] != (Csi2_VCParamsType*)NULL_PTR)
+            {
+                /* copy the aux VC parameters                                                                   */
+                pStaticAuxParams[i] = *setupParamPtr->auxConfigPtr[i];
+                pStaticParams->auxConfigPtr[i] = &pStaticAuxParams[i];
+            }
+            else
+            {
+                pStaticParams->auxConfigPtr[i] = (Csi2_VCParamsType*)NULL_PTR;
+            }
+#endif
+#if (CSI2_METADATA_DATA_USAGE == STD_ON)
+            if (setupParamPtr->metaDataPtr[i] != (Csi2_MetaDataParamsType*)NULL_PTR)
+            {
+                /* copy the aux VC parameters                                                                   */
+                pStaticMdParams[i] = *setupParamPtr->metaDataPtr[i];
+                pStaticParams->metaDataPtr[i] = &pStaticMdParams[i];
+                pDrvParams->workingParamVC[i].metaDataUsage = 1u;
+            }
+            else
+            {
+                pStaticParams->metaDataPtr[i] = (Csi2_MetaDataParamsType*)NULL_PTR;
+                pDrvParams->workingParamVC[i].metaDataUsage = 0u;
+            }
+#endif
+        }
+    }
+#endif /* (CSI2_POWER_ON_OFF_USAGE == STD_ON)   */
+#if (CSI2_TELEMETRY_USAGE == STD_ON)
+    for (i = 0u; i < (uint32)RSDK_CSI2_MAX_IRQ_ID; i++)
+    {   /* all the parts are changed, so all the readers retry                                                      */
+        gCsi2TelemetrySeq[(uint8)unitId][i]++;
+    }
+    CSI2_WRITE_BARRIER();
+    gCsi2Telemetry[(uint8)unitId] = gsCsi2TelemetryReset;              /* new telemetry for the new setup  */
+    gCsi2Telemetry[(uint8)unitId].counterFreq = CSI2_GET_TIMESTAMP_FREQ();
+    CSI2_WRITE_BARRIER();
+    for (i = 0u; i < (uint32)RSDK_CSI2_MAX_IRQ_ID; i++)
+    {
+        gCsi2TelemetrySeq[(uint8)unitId][i]++;
+    }
+#endif
+#if (CSI2_LINE_WATERMARK_USAGE == STD_ON)
+#ifdef linux
+    pDrvParams->pLineWm = (Csi2_LineWatermarkType *)(void *)gpRsdkCsi2Device[(uint8)unitId]->pEvtRing->lineWm;
+#else
+    pDrvParams->pLineWm = &gsCsi2LineWm[(uint8)unitId][0];
+#endif
+    for (i = 0; i < (uint32)CSI2_MAX_VC; i++)
+    {   /* new watermarks for the new setup, the consumer must attach again                                     */
+        pDrvParams->pLineWm[i].frameSeq = 0u;
+        pDrvParams->pLineWm[i].frameFirstLine = 0u;
+        pDrvParams->pLineWm[i].linesCommitted = 0u;
+        pDrvParams->pLineWm[i].linesConsumed = 0u;
+        pDrvParams->pLineWm[i].consumerOn = 0u;
+        pDrvParams->pLineWm[i].overruns = 0u;
+        pDrvParams->workingParamVC[i].lineWaitFor = 0u;
+        pDrvParams->workingParamVC[i].lineWmOverrun = 0u;
+    }
+#endif
+#if (CSI2_STATUS_PAGE_USAGE == STD_ON)
+#ifdef linux
+    pDrvParams->pStatusPage = (Csi2_StatusPageType *)(void *)gpRsdkCsi2Device[(uint8)unitId]->pStatusPage;
+#else
+    pDrvParams->pStatusPage = &gsCsi2StatusPage[(uint8)unitId];
+#endif
+#endif
+}
+/* Csi2_SaveSetupParams *************************/
+
+#if (CSI2_SECONDARY_FUNCTIONS_USAGE == STD_ON) || (CSI2_STATUS_PAGE_USAGE == STD_ON)
+/*================================================================================================*/
+/*
+ * @brief       Decode the lane status from the MIPICSI2_LANxCS register value.
+ *
+ * @param[in]   regStat   - the LANxCS register value
+ *
+ * @return      Csi2_LaneStatusType - the lane status
+ *
+ */
+static Csi2_LaneStatusType Csi2_LaneRegStatus(const uint32 regStat)
+{
+    Csi2_LaneStatusType ret = CSI2_LANE_STATE_ON;                   /* default - line on                            */
+
+    if ((regStat & CSI2_LAN_CS_MARK) != 0u)
+    {
+        ret = CSI2_LANE_STATE_MARK;
+    }
+    if ((regStat & CSI2_LAN_CS_ULPA) != 0u)
+    {
+        ret = CSI2_LANE_STATE_ULPA;
+    }
+    if ((regStat & CSI2_LAN_CS_STOP) != 0u)
+    {
+        ret = CSI2_LANE_STATE_STOP;
+    }
+    if ((regStat & CSI2_LAN_CS_RXACTH) != 0u)
+    {
+        ret = CSI2_LANE_STATE_REC;
+    }
+    if ((regStat & CSI2_LAN_CS_RXVALH) != 0u)
+    {
+        ret = CSI2_LANE_STATE_VRX;
+    }
+    return ret;
+}
+/* Csi2_LaneRegStatus *************************/
+#endif
+
+
 /*==================================================================================================
 *                                        GLOBAL FUNCTIONS
 ==================================================================================================*/
@@ -2107,27 +2772,10 @@ uint8 Csi2_GetChannelNum(const Csi2_VCDriverStateType *pVCState)
  */
 Std_ReturnType Csi2_Setup(const Csi2_UnitIdType unitId, const Csi2_SetupParamsType *setupParamPtr)
 {
-#if (CSI2_POWER_ON_OFF_USAGE == STD_ON)
-    Csi2_SetupParamsType    *pStaticParams;
-    #if (CSI2_AUXILIARY_DATA_USAGE == STD_ON)
-        Csi2_VCParamsType       *pStaticAuxParams;
-    #endif
-    #if (CSI2_METADATA_DATA_USAGE == STD_ON)
-        Csi2_MetaDataParamsType *pStaticMdParams;
-    #endif
-    #ifdef linux
-        Csi2_VCDriverStateType  *pVcDriverState;
-        uint64_t     dataRange;
-    #endif
-#endif
-#if (CSI2_FRAMES_COUNTER_USED == STD_ON)
-    volatile uint32         *pFramesCntr;
-#endif
-    uint32                  i;
-    Csi2_VCParamsType       *pStaticVcParams;
-    Csi2_DriverParamsType   *pDrvParams;
-
     Std_ReturnType  rez = (Std_ReturnType)E_OK;                     /*call result, intialized as good               */
+#ifdef linux
+    uint32          i;
+#endif
 
     CSI2_TRACE(RSDK_TRACE_EVENT_FUNC_START, (uint16_t)RSDK_TRACE_DBG_CSI2_INIT, (uint32_t)CSI2_SEQ_BEGIN);
 #if (CSI2_DEV_ERROR_DETECT == STD_ON)
@@ -2137,98 +2785,26 @@ Std_ReturnType Csi2_Setup(const Csi2_UnitIdType unitId, const Csi2_SetupParamsTy
     {       /* correct parameters, continue     */
 #endif /* (CSI2_DEV_ERROR_DETECT == STD_ON)     */
 
-        /* initialize the driver parameters pointer and the VC specific parameters, needed at run-time    */
-        pDrvParams = &gCsi2Settings[(uint8)unitId];
-        pStaticVcParams = &gsCsi2VCParamCopy[(uint8)unitId][0u];
-    #if (CSI2_FRAMES_COUNTER_USED == STD_ON)
-        pFramesCntr = &gsCsi2FramesCounter[(uint8)unitId][0];
-    #endif
-        for (i = 0; i < (uint32)CSI2_MAX_VC; i++)
-        {
-            if (setupParamPtr->vcConfigPtr[i] != (Csi2_VCParamsType*)NULL_PTR)
-            {
-                /* copy the VC parameters                                                                       */
-                pStaticVcParams[i] = *setupParamPtr->vcConfigPtr[i];
-                pDrvParams->workingParamVC[i].vcParamsPtr = &pStaticVcParams[i];
-            }
-            else
-            {
-                pDrvParams->workingParamVC[i].vcParamsPtr = (Csi2_VCParamsType*)NULL_PTR;
-            }
-        }
-
-
-#if (CSI2_POWER_ON_OFF_USAGE == STD_ON)
-
-        pStaticParams = &gsCsi2UnitParamCopy[(uint8)unitId];
-        #if (CSI2_AUXILIARY_DATA_USAGE == STD_ON)
-            pStaticAuxParams = &gsCsi2AuxParamCopy[(uint8)unitId][0u];
-        #endif
-        #if (CSI2_METADATA_DATA_USAGE == STD_ON)
-            pStaticMdParams = &gsCsi2MdParamCopy[(uint8)unitId][0u];
-        #endif
-        /* copy the current parameters for future use, if it will be required                                       */
-        if (pStaticParams != setupParamPtr)
-        {
-            *pStaticParams = *setupParamPtr;                        /* base setup                                   */
-            for (i = 0; i < (uint32)CSI2_MAX_VC; i++)
-            {
-                if (setupParamPtr->vcConfigPtr[i] != (Csi2_VCParamsType*)NULL_PTR)
-                {
-                    pStaticParams->vcConfigPtr[i] = &pStaticVcParams[i];
-                    /* clear the frames counters                                                                    */
-    #if (CSI2_FRAMES_COUNTER_USED == STD_ON)
-                    pFramesCntr[i] = 0;
-    #endif
-                }
-    #if (CSI2_AUXILIARY_DATA_USAGE == STD_ON)
-                if (setupParamPtr->auxConfigPtr[i] != (Csi2_VCParamsType*)NULL_PTR)
-                {
-                    /* copy the aux VC parameters                                                                   */
-                    pStaticAuxParams[i] = *setupParamPtr->auxConfigPtr[i];
-                    pStaticParams->auxConfigPtr[i] = &pStaticAuxParams[i];
-                }
-                else
-                {
-                    pStaticParams->auxConfigPtr[i] = (Csi2_VCParamsType*)NULL_PTR;
-                }
-    #endif
-    #if (CSI2_METADATA_DATA_USAGE == STD_ON)
-                if (setupParamPtr->metaDataPtr[i] != (Csi2_MetaDataParamsType*)NULL_PTR)
-                {
-                    /* copy the aux VC parameters                                                                   */
-                    pStaticMdParams[i] = *setupParamPtr->metaDataPtr[i];
-                    pStaticParams->metaDataPtr[i] = &pStaticMdParams[i];
-                    pDrvParams->workingParamVC[i].metaDataUsage = 1u;
-                }
-                else
-                {
-                    pStaticParams->metaDataPtr[i] = (Csi2_MetaDataParamsType*)NULL_PTR;
-                    pDrvParams->workingParamVC[i].metaDataUsage = 0u;
-                }
-    #endif
-            }
-        }
-#endif /* (CSI2_POWER_ON_OFF_USAGE == STD_ON)   */
+        Csi2_SaveSetupParams(unitId, setupParamPtr);               /* keep the parameters needed at run-time   */
         rez = Csi2_ModuleSetup(unitId, setupParamPtr);
 #ifdef linux
         if(rez == (Std_ReturnType)E_OK)
-        {
-            /* initialization of the data buffer virtual pointers  */
-            for(i = 0; i < (uint32_t)RSDK_CSI2_MAX_VC; i++)
-            {
-                pVcDriverState = &gCsi2Settings[unitId].workingParamVC[i];
-                if(pVcDriverState->vcParamsPtr!= NULL)
+        {       /* initialization of the data buffer virtual pointers                                               */
+            rez = Csi2_MapVcBuffers(unitId, (uint8)CSI2_API_ID_SETUP);
+            if(rez != (Std_ReturnType)E_OK)
+            {   /* no VC data and no active VC for the handlers without the buffers mapping, the statistics use it */
+                gMipiCsi2RegsPtr[(uint8)unitId]->RX_VCENABLE = 0u;
+                for (i = 0u; i < (uint32)CSI2_MAX_VC; i++)
                 {
-                    dataRange = (uint64_t)pVcDriverState->vcParamsPtr->bufNumLines;
-                    dataRange *= (uint64_t)pVcDriverState->vcParamsPtr->bufLineLen;
-                    /* map the data, for statistics usage/computation                                               */
-                    pVcDriverState->pVirtData = ioremap_cache((uintptr_t)pVcDriverState->vcParamsPtr->bufDataPtr,
-                            dataRange + 0x100UL);
+                    gCsi2Settings[(uint8)unitId].workingParamVC[i].vcParamsPtr = (Csi2_VCParamsType*)NULL_PTR;
                 }
+                gCsi2Settings[(uint8)unitId].driverState = CSI2_DRIVER_STATE_NOT_INITIALIZED;
             }
         }
 #endif
+#if (CSI2_STATUS_PAGE_USAGE == STD_ON)
+        Csi2_StatusPageUpdate(unitId, CSI2_STATUS_NEW_SETUP, (const Csi2_ErrorReportType *)NULL_PTR);
+#endif
 
 #if (CSI2_DEV_ERROR_DETECT == STD_ON)
     }
@@ -2239,6 +2815,109 @@ Std_ReturnType Csi2_Setup(const Csi2_UnitIdType unitId, const Csi2_SetupParamsTy
 }
 /* Csi2_Setup *************************/
 
+
+#if (CSI2_VC_RECONFIG_USAGE == STD_ON)
+/*================================================================================================*/
+/**
+ * @brief       The function reconfigure the Virtual Channels of a CSI2 unit, keeping the D-PHY locked.
+ * @details     Only what the VCs setup touch is programmed again : the VCs, auxiliary and metadata buffers, the
+ *              statistics management, the GPIO/SDMA triggers and the VCs interrupts enablement. There is no
+ *              interface reset, no D-PHY calibration and no wait for the lanes stop state, so a mode switch
+ *              costs only the registers update. The lanes and the Rx frequency must be the ones used at the
+ *              last Csi2_Setup; the callbacks and the interrupts registration are kept from Csi2_Setup.
+ *              The frames counters, the telemetry and the lines watermarks are reset, as for Csi2_Setup.
+ *
+ * @param[in]   unitId          - the unit id to be used
+ * @param[in]   setupParamPtr   - pointer to the CSI2 Driver setup structure, with the new VCs configuration
+ *
+ * @return      Std_ReturnType - success or error, detailed status information reported on Det.
+ *              If the VCs programming fails, the interface status is NOT_INITIALIZED and Csi2_Setup is required.
+ *
+ * @pre         The unit must be ON or STOP. The call must be done between frames (e.g. after a FrameEnd or
+ *              with the reception stopped), a frame in progress is lost.
+ *
+ * @note        In Linux the unit interrupts and the statistics bottom half use the VCs parameters and the buffers
+ *              mapping, so they are stopped for the whole reconfiguration : the unit irq lines are disabled (the
+ *              running handlers are waited for), the pending bottom half is flushed, and the VCs state is changed
+ *              under the statistics lock. The VCs interrupts are enabled again only if the buffers are mapped.
+ *
+ */
+Std_ReturnType Csi2_ReconfigVC(const Csi2_UnitIdType unitId, const Csi2_SetupParamsType *setupParamPtr)
+{
+    volatile GENERIC_CSI2_Type  *pRegs;
+    Csi2_DriverParamsType       *pDriverState;
+    Std_ReturnType              rez;
+    uint32                      i;
+#ifdef linux
+    rsdkCsi2Device_t            *pDev;
+    uint64_t                    flags;
+#endif
+
+    rez = Csi2_CheckReconfigParams(unitId, setupParamPtr);
+    if (rez == (Std_ReturnType)E_OK)
+    {       /* correct parameters, same D-PHY settings     */
+        pDriverState = &gCsi2Settings[(uint8)unitId];
+        pRegs = gMipiCsi2RegsPtr[(uint8)unitId];
+#ifdef linux
+        pDev = gpRsdkCsi2Device[(uint8)unitId];
+        for (i = 0u; i < (uint32)RSDK_CSI2_MAX_IRQ_ID; i++)
+        {
+            disable_irq(pDev->dtsInfo.irqId[i]);            /* waits for a handler running on another core          */
+        }
+        tasklet_kill(&pDev->statBh.mTasklet);               /* no irq, so no new schedule; waits for the last one   */
+#if (CSI2_LINE_EVT_MODERATION == STD_ON)
+        (void)hrtimer_cancel(&pDev->lineEvtTimer);          /* the held ranges are dropped with the old VCs params  */
+#endif
+#endif
+        pRegs->RX_VCENABLE = 0u;                            /* no VC data from now, the VCs params will change      */
+#ifdef linux
+        Csi2_UnmapVcBuffers(pDriverState);
+        (void)OAL_LockIRQSpin(&pDev->statLock, &flags);
+#endif
+        Csi2_SaveSetupParams(unitId, setupParamPtr);        /* keep the parameters needed at run-time               */
+        rez = Csi2_SetupVcData(unitId, pRegs, setupParamPtr);
+        if (rez == (Std_ReturnType)E_OK)
+        {
+#if (CSI2_GPIO_USED == STD_ON) || (CSI2_SDMA_USED == STD_ON)
+            Csi2_SetupVcTriggers(pRegs, setupParamPtr);
+#endif
+#ifdef linux
+            (void)OAL_UnlockIRQSpin(&pDev->statLock, &flags);
+            rez = Csi2_MapVcBuffers(unitId, (uint8)CSI2_API_ID_RECONFIG_VC);    /* ioremap can sleep, out of lock   */
+            (void)OAL_LockIRQSpin(&pDev->statLock, &flags);
+            if (rez == (Std_ReturnType)E_OK)
+            {
+                Csi2_ReconfigUIrq(unitId, pRegs, setupParamPtr);
+            }
+#else
+            Csi2_ReconfigUIrq(unitId, pRegs, setupParamPtr);
+#endif
+        }
+        if (rez != (Std_ReturnType)E_OK)
+        {       /* the VCs are not usable anymore : no VC data and no active VC for the handlers                    */
+            pRegs->RX_VCENABLE = 0u;
+            for (i = 0u; i < (uint32)CSI2_MAX_VC; i++)
+            {
+                pDriverState->workingParamVC[i].vcParamsPtr = (Csi2_VCParamsType*)NULL_PTR;
+            }
+            pDriverState->driverState = CSI2_DRIVER_STATE_NOT_INITIALIZED;
+        }
+#ifdef linux
+        (void)OAL_UnlockIRQSpin(&pDev->statLock, &flags);
+        for (i = 0u; i < (uint32)RSDK_CSI2_MAX_IRQ_ID; i++)
+        {
+            enable_irq(pDev->dtsInfo.irqId[i]);
+        }
+#endif
+#if (CSI2_STATUS_PAGE_USAGE == STD_ON)
+        Csi2_StatusPageUpdate(unitId, CSI2_STATUS_NEW_SETUP, (const Csi2_ErrorReportType *)NULL_PTR);
+#endif
+    }
+    return rez;
+}
+/* Csi2_ReconfigVC *************************/
+#endif /* #if (CSI2_VC_RECONFIG_USAGE == STD_ON) */
+
 /**************************************************************/
 /* Using the DPHY                                             */
 
@@ -2316,6 +2995,9 @@ Std_ReturnType Csi2_RxStop(const Csi2_UnitIdType unitId)
             {
                 pDriverState->driverState = CSI2_DRIVER_STATE_NOT_INITIALIZED;  /* the state for interface on error */
             }
+#if (CSI2_STATUS_PAGE_USAGE == STD_ON)
+            Csi2_StatusPageUpdate(unitId, CSI2_STATUS_STATE_CHANGE, (const Csi2_ErrorReportType *)NULL_PTR);
+#endif
         }
     }
     CSI2_TRACE(RSDK_TRACE_EVENT_DBG_INFO, (uint16_t)RSDK_TRACE_DBG_CSI2_RX_STOP, (uint32_t)CSI2_SEQ_END);
@@ -2383,6 +3065,9 @@ Std_ReturnType Csi2_RxStart(const Csi2_UnitIdType unitId)
                 {
                     pDriverState->driverState = CSI2_DRIVER_STATE_ON;  /* interface on now                          */
                 }
+#if (CSI2_STATUS_PAGE_USAGE == STD_ON)
+                Csi2_StatusPageUpdate(unitId, CSI2_STATUS_STATE_CHANGE, (const Csi2_ErrorReportType *)NULL_PTR);
+#endif
                 break;
             case CSI2_DRIVER_STATE_ON:                      /* nothing to do, the interface is already on           */
                 break;
@@ -2464,6 +3149,9 @@ Std_ReturnType Csi2_PowerOff(const Csi2_UnitIdType unitId)
             {
                 pDriverState->driverState = CSI2_DRIVER_STATE_NOT_INITIALIZED;  /* the state for interface on error */
             }
+#if (CSI2_STATUS_PAGE_USAGE == STD_ON)
+            Csi2_StatusPageUpdate(unitId, CSI2_STATUS_STATE_CHANGE, (const Csi2_ErrorReportType *)NULL_PTR);
+#endif
         }
     }
     CSI2_TRACE(RSDK_TRACE_EVENT_DBG_INFO, (uint16_t)RSDK_TRACE_DBG_CSI2_POWER_OFF, (uint32_t)CSI2_SEQ_END);
@@ -2504,6 +3192,9 @@ Std_ReturnType Csi2_PowerOn(const Csi2_UnitIdType unitId)
             rez = Csi2_ModuleSetup(unitId,
                     &gsCsi2UnitParamCopy[(uint8)unitId]
                                          );    /* return the init status       */
+#if (CSI2_STATUS_PAGE_USAGE == STD_ON)
+            Csi2_StatusPageUpdate(unitId, CSI2_STATUS_STATE_CHANGE, (const Csi2_ErrorReportType *)NULL_PTR);
+#endif
         }
         else
         {
@@ -2636,28 +3327,7 @@ Csi2_LaneStatusType Csi2_GetLaneStatus(const Csi2_UnitIdType unitId, const Csi2_
         regStat = gMipiCsi2RegsPtr[unitId]->RX_RXNULANE;
         if ((uint32)laneId < regStat)
         {
-            ret = CSI2_LANE_STATE_ON;                                   /* default - line on                        */
-            regStat = gMipiCsi2RegsPtr[unitId]->RX_LANCS[(uint8)laneId];
-            if ((regStat & CSI2_LAN_CS_MARK) != 0u)
-            {
-                ret = CSI2_LANE_STATE_MARK;                             /* default - line on                        */
-            }
-            if ((regStat & CSI2_LAN_CS_ULPA) != 0u)
-            {
-                ret = CSI2_LANE_STATE_ULPA;
-            }
-            if ((regStat & CSI2_LAN_CS_STOP) != 0u)
-            {
-                ret = CSI2_LANE_STATE_STOP;
-            }
-            if ((regStat & CSI2_LAN_CS_RXACTH) != 0u)
-            {
-                ret = CSI2_LANE_STATE_REC;
-            }
-            if ((regStat & CSI2_LAN_CS_RXVALH) != 0u)
-            {
-                ret = CSI2_LANE_STATE_VRX;
-            }
+            ret = Csi2_LaneRegStatus(gMipiCsi2RegsPtr[unitId]->RX_LANCS[(uint8)laneId]);
         }
         else
         {
@@ -2797,6 +3467,1158 @@ uint32 Csi2_GetFramesCounter(const Csi2_UnitIdType unitId, const Csi2_VirtChnlId
 #endif  /* #if (CSI2_FRAMES_COUNTER_USED == STD_ON)     */
 
 
+#if (CSI2_FRAME_RING_USAGE == STD_ON)
+
+/*================================================================================================*/
+/**
+ * @brief       The function give back to the driver a buffer of the VC frame ring.
+ * @details     The buffer index is the one reported by the CSI2_EVT_FRAME_READY event. After this call the buffer
+ *              can be filled again by the interface, so the application must not use it anymore. <br>
+ *              The hand-off needs no lock : frameBufOut is written only by the interrupt and frameBufBack only
+ *              by this function.
+ *
+ * @param[in]   unitId    - unit identifier
+ * @param[in]   vcId      - Virtual Channel identifier
+ * @param[in]   bufIdx    - the index of the buffer in the ring
+ *
+ * @return      Std_ReturnType - success or error, detailed status information reported on Det.
+ *
+ */
+Std_ReturnType Csi2_ReleaseFrameBuf(const Csi2_UnitIdType unitId, const Csi2_VirtChnlIdType vcId, const uint8 bufIdx)
+{
+    Std_ReturnType          rez;
+    Csi2_VCDriverStateType  *pVCState;
+
+    if (((uint8)unitId >= (uint8)CSI2_MAX_UNITS) || ((uint8)vcId >= (uint8)CSI2_MAX_VC))
+    {
+        rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_WRG_UNIT_ID, (uint8)CSI2_API_ID_RELEASE_FRAME,
+                                                        (uint8)CSI2_E_DRV_WRG_UNIT_ID);
+        CSI2_HALT_ON_ERROR;
+    }
+    else
+    {
+        pVCState = &gCsi2Settings[(uint8)unitId].workingParamVC[(uint8)vcId];
+        if ((pVCState->vcParamsPtr == (Csi2_VCParamsType*)NULL_PTR) ||
+                (pVCState->vcParamsPtr->frameBufNum < 2u) || (bufIdx >= pVCState->vcParamsPtr->frameBufNum))
+        {       /* no ring defined for the VC or wrong buffer                                                   */
+            rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_NOT_INIT, (uint8)CSI2_API_ID_RELEASE_FRAME,
+                                                        (uint8)CSI2_E_DRV_NOT_INIT);
+            CSI2_HALT_ON_ERROR;
+        }
+        else if (pVCState->frameBufOut[bufIdx] == pVCState->frameBufBack[bufIdx])
+        {       /* the buffer is not owned by the application                                                   */
+            rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_WRG_STATE, (uint8)CSI2_API_ID_RELEASE_FRAME,
+                                                        (uint8)CSI2_E_DRV_WRG_STATE);
+            CSI2_HALT_ON_ERROR;
+        }
+        else
+        {
+            rez = (Std_ReturnType)E_OK;
+            pVCState->frameBufBack[bufIdx] = pVCState->frameBufOut[bufIdx];     /* buffer free for the irq  */
+        }
+    }
+    return rez;
+}
+/* Csi2_ReleaseFrameBuf *************************/
+#endif  /* #if (CSI2_FRAME_RING_USAGE == STD_ON)     */
+
+
+#if (CSI2_TELEMETRY_USAGE == STD_ON)
+
+/*================================================================================================*/
+/**
+ * @brief       The function gets a consistent copy of the unit throughput and jitter telemetry.
+ * @details     The telemetry is updated lock-free by the interrupt handlers, each part having only one writer
+ *              which marks its updates in a sequence counter (see Csi2_ReadStatusPage), so the copy is retried
+ *              until all the counters are even and not changed by the copy. It is reset by Csi2_Setup.
+ *
+ * @param[in]   unitId      - unit identifier
+ * @param[out]  pTelemetry  - pointer to the structure to be filled
+ *
+ * @return      Std_ReturnType - success or error, detailed status information reported on Det.
+ *
+ */
+Std_ReturnType Csi2_GetTelemetry(const Csi2_UnitIdType unitId, Csi2_TelemetryType *pTelemetry)
+{
+    Std_ReturnType              rez = (Std_ReturnType)E_OK;
+    uint32                      seq[RSDK_CSI2_MAX_IRQ_ID];
+    uint32                      i, retry;
+
+    if ((uint8)unitId >= (uint8)CSI2_MAX_UNITS)
+    {
+        rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_WRG_UNIT_ID, (uint8)CSI2_API_ID_GET_TELEMETRY,
+                                                                    (uint8)CSI2_E_DRV_WRG_UNIT_ID);
+        CSI2_HALT_ON_ERROR;
+    }
+    else if (pTelemetry == (Csi2_TelemetryType *)NULL_PTR)
+    {
+        rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_NULL_PARAM_PTR, (uint8)CSI2_API_ID_GET_TELEMETRY,
+                                                                    (uint8)CSI2_E_DRV_NULL_PARAM_PTR);
+        CSI2_HALT_ON_ERROR;
+    }
+    else
+    {
+        do
+        {
+            retry = 0u;
+            for (i = 0u; i < (uint32)RSDK_CSI2_MAX_IRQ_ID; i++)
+            {
+                seq[i] = gCsi2TelemetrySeq[(uint8)unitId][i];
+                retry |= seq[i] & 1u;
+            }
+            CSI2_READ_BARRIER();
+            *pTelemetry = gCsi2Telemetry[(uint8)unitId];
+            CSI2_READ_BARRIER();
+            for (i = 0u; i < (uint32)RSDK_CSI2_MAX_IRQ_ID; i++)
+            {
+                retry |= (seq[i] != gCsi2TelemetrySeq[(uint8)unitId][i]) ? 1u : 0u;
+            }
+        } while (retry != 0u);
+    }
+    return rez;
+}
+/* Csi2_GetTelemetry *************************/
+#endif  /* #if (CSI2_TELEMETRY_USAGE == STD_ON)     */
+
+
+#if (CSI2_LINE_WATERMARK_USAGE == STD_ON)
+
+/*================================================================================================*/
+/*
+ * @brief       Check if a line was committed; if not, register it for the irq wakeup.
+ * @details     Only the lowest waited line is kept, the other waiters check again at each wakeup. In Linux the
+ *              waiters run concurrently, so the lowest line is kept by a compare-and-swap loop : a plain
+ *              read-modify-write could replace a lower line registered meanwhile and lose its wakeup.
+ *
+ * @param[in]   pVCState    - pointer to the VC driver state
+ * @param[in]   pWm         - pointer to the VC watermark
+ * @param[in]   line        - the line counter value waited for
+ *
+ * @return      1 if the line was committed, 0 otherwise
+ *
+ */
+static uint32 Csi2_LineReached(Csi2_VCDriverStateType *pVCState, const Csi2_LineWatermarkType *pWm, const uint32 line)
+{
+    uint32  rez = 0u;
+#ifdef linux
+    uint32  waitFor, prev;
+#endif
+
+    if ((sint32)(pWm->linesCommitted - line) >= 0)
+    {
+        rez = 1u;
+    }
+    else
+    {
+#ifdef linux
+        waitFor = READ_ONCE(pVCState->lineWaitFor);
+        while ((waitFor == 0u) || ((sint32)(line - waitFor) < 0))
+        {
+            prev = cmpxchg(&pVCState->lineWaitFor, waitFor, line);
+            if (prev == waitFor)
+            {
+                break;
+            }
+            waitFor = prev;         /* changed meanwhile, by another waiter or by the irq                           */
+        }
+        smp_mb();                   /* the registration is seen by the irq before the committed line is read again */
+#else
+        if ((pVCState->lineWaitFor == 0u) || ((sint32)(line - pVCState->lineWaitFor) < 0))
+        {
+            pVCState->lineWaitFor = line;
+        }
+#endif
+        if ((sint32)(pWm->linesCommitted - line) >= 0)
+        {   /* committed while registering                                                                  */
+            rez = 1u;
+        }
+    }
+    return rez;
+}
+/* Csi2_LineReached *************************/
+
+
+/*================================================================================================*/
+/**
+ * @brief       The function return the lines committed watermark of a VC.
+ * @details     The watermark is updated by the events irq at each LINEDONE, so the application can read it at any
+ *              time; the consumer owns the linesConsumed and consumerOn fields. It is reset by Csi2_Setup.
+ *
+ * @param[in]   unitId    - unit identifier
+ * @param[in]   vcId      - Virtual Channel identifier
+ *
+ * @return      pointer to the VC watermark, NULL_PTR for a wrong unitId/vcId or a not initialized unit
+ *
+ */
+Csi2_LineWatermarkType *Csi2_GetLineWatermark(const Csi2_UnitIdType unitId, const Csi2_VirtChnlIdType vcId)
+{
+    Csi2_LineWatermarkType *pRez = (Csi2_LineWatermarkType *)NULL_PTR;
+
+    if (((uint8)unitId < (uint8)CSI2_MAX_UNITS) && ((uint8)vcId < (uint8)CSI2_MAX_VC) &&
+        (gCsi2Settings[(uint8)unitId].pLineWm != NULL_PTR))
+    {
+        pRez = &gCsi2Settings[(uint8)unitId].pLineWm[(uint8)vcId];
+    }
+    return pRez;
+}
+/* Csi2_GetLineWatermark *************************/
+
+
+/*================================================================================================*/
+/**
+ * @brief       The function wait until a line is committed in the VC buffer.
+ * @details     The line is a value of the free running lines counter, see Csi2_LineWatermarkType. In Linux the
+ *              caller sleeps until the events irq commits the line, for bare-metal the watermark is polled each
+ *              microsecond.
+ *
+ * @param[in]   unitId      - unit identifier
+ * @param[in]   vcId        - Virtual Channel identifier
+ * @param[in]   line        - the line counter value to wait for
+ * @param[in]   timeoutUs   - maximum waiting time, in microseconds
+ *
+ * @return      Std_ReturnType - E_OK if the line was committed, RSDK_CSI2_DRV_TIMER_ERROR for timeout, other
+ *              detailed status information reported on Det.
+ *
+ */
+Std_ReturnType Csi2_WaitForLine(const Csi2_UnitIdType unitId, const Csi2_VirtChnlIdType vcId, const uint32 line,
+                                const uint32 timeoutUs)
+{
+    Std_ReturnType          rez;
+    Csi2_DriverParamsType   *pDrvParams;
+    Csi2_VCDriverStateType  *pVCState;
+    Csi2_LineWatermarkType  *pWm;
+#ifdef linux
+    long                    waitRez;
+#else
+    uint32                  waitUs;
+#endif
+
+    if (((uint8)unitId >= (uint8)CSI2_MAX_UNITS) || ((uint8)vcId >= (uint8)CSI2_MAX_VC))
+    {
+        rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_WRG_UNIT_ID, (uint8)CSI2_API_ID_WAIT_FOR_LINE,
+                                                        (uint8)CSI2_E_DRV_WRG_UNIT_ID);
+        CSI2_HALT_ON_ERROR;
+    }
+    else
+    {
+        pDrvParams = &gCsi2Settings[(uint8)unitId];
+        pVCState = &pDrvParams->workingParamVC[(uint8)vcId];
+        if ((pDrvParams->pLineWm == NULL_PTR) || (pVCState->vcParamsPtr == (Csi2_VCParamsType*)NULL_PTR) ||
+            (pVCState->vcParamsPtr->bufNumLinesTrigger == 0u))
+        {       /* no watermark for the VC                                                                      */
+            rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_NOT_INIT, (uint8)CSI2_API_ID_WAIT_FOR_LINE,
+                                                        (uint8)CSI2_E_DRV_NOT_INIT);
+            CSI2_HALT_ON_ERROR;
+        }
+        else
+        {
+            pWm = &pDrvParams->pLineWm[(uint8)vcId];
+            rez = (Std_ReturnType)E_OK;
+#ifdef linux
+            waitRez = OAL_WaitEventInterruptibleTimeout(gpRsdkCsi2Device[(uint8)unitId]->lineWaitQ,
+                                        (Csi2_LineReached(pVCState, pWm, line) != 0u), usecs_to_jiffies(timeoutUs));
+            if (waitRez <= 0)
+            {   /* timeout or signal                                                                            */
+                rez = (Std_ReturnType)RSDK_CSI2_DRV_TIMER_ERROR;
+            }
+#else
+            waitUs = timeoutUs;
+            while ((Csi2_LineReached(pVCState, pWm, line) == 0u) && (waitUs != 0u))
+            {
+                (void)Csi2_WaitLoopUs(1u);
+                waitUs--;
+            }
+            if (Csi2_LineReached(pVCState, pWm, line) == 0u)
+            {
+                rez = (Std_ReturnType)RSDK_CSI2_DRV_TIMER_ERROR;
+            }
+#endif
+        }
+    }
+    return rez;
+}
+/* Csi2_WaitForLine *************************/
+#endif  /* #if (CSI2_LINE_WATERMARK_USAGE == STD_ON)     */
+
+
+#if (CSI2_STATUS_PAGE_USAGE == STD_ON)
+
+/*================================================================================================*/
+/**
+ * @brief       The function update the unit status page.
+ * @details     The page content is written between two increments of the sequence counter, so seq is odd while
+ *              the page is updated. The writers are serialized : in Linux by the unit status lock, for bare-metal
+ *              the interrupt handlers of a unit must have the same priority and the API calls are done with the
+ *              unit interrupts not running (as for the other API calls).
+ *              The lanes status is refreshed only for a state change, a new setup or an error report : the lanes
+ *              registers reads are slow and the events irq runs at each LINEDONE/FrameEnd. The registers are read
+ *              before the page lock is taken.
+ *
+ * @param[in]   unitId    - unit identifier
+ * @param[in]   irqId     - the handler irq ID, CSI2_STATUS_STATE_CHANGE or CSI2_STATUS_NEW_SETUP
+ * @param[in]   pErrorS   - pointer to the handler report, NULL_PTR if not called by a handler
+ *
+ */
+void Csi2_StatusPageUpdate(const Csi2_UnitIdType unitId, const uint32 irqId, const Csi2_ErrorReportType *pErrorS)
+{
+    Csi2_DriverParamsType       *pDrvParams;
+    Csi2_StatusPageType         *pPage;
+    volatile GENERIC_CSI2_Type  *pRegs;
+    uint32                      i, seq, lanesNum, lanesRefresh;
+    uint32                      laneStatus[CSI2_MAX_LANE];
+#ifdef linux
+    unsigned long               flags;
+#endif
+
+    pDrvParams = &gCsi2Settings[(uint8)unitId];
+    pPage = pDrvParams->pStatusPage;
+    pRegs = gMipiCsi2RegsPtr[(uint8)unitId];
+    if (pPage != NULL_PTR)
+    {
+        lanesRefresh = 0u;
+        lanesNum = 0u;
+        if ((irqId >= (uint32)RSDK_CSI2_MAX_IRQ_ID) || ((pErrorS != NULL_PTR) && (pErrorS->errMaskU != 0u)))
+        {   /* state change, new setup or errors reported                                                           */
+            lanesRefresh = 1u;
+            if ((pDrvParams->driverState == CSI2_DRIVER_STATE_ON) && (pRegs != (GENERIC_CSI2_Type*)NULL_PTR))
+            {   /* the lanes registers are significant only with the interface on                                   */
+                lanesNum = pRegs->RX_RXNULANE;
+            }
+            for (i = 0u; (i < lanesNum) && (i < (uint32)CSI2_MAX_LANE); i++)
+            {
+                laneStatus[i] = (uint32)Csi2_LaneRegStatus(pRegs->RX_LANCS[i]);
+            }
+        }
+#ifdef linux
+        (void)OAL_LockIRQSpin(&gpRsdkCsi2Device[(uint8)unitId]->statusLock, &flags);
+#endif
+        seq = pPage->seq + 1u;
+        pPage->seq = seq;                                   /* odd, the page is not consistent from now             */
+        CSI2_WRITE_BARRIER();
+        if (irqId == CSI2_STATUS_NEW_SETUP)
+        {   /* new setup, the counters start again, as the frames counters                                         */
+            for (i = 0u; i < (uint32)RSDK_CSI2_MAX_IRQ_ID; i++)
+            {
+                pPage->irqCount[i] = 0u;
+                pPage->errCount[i] = 0u;
+                pPage->lastErrMask[i] = 0u;
+            }
+        }
+        else if (irqId < (uint32)RSDK_CSI2_MAX_IRQ_ID)
+        {
+            pPage->irqCount[irqId]++;
+            if ((pErrorS != NULL_PTR) && (pErrorS->errMaskU != 0u))
+            {
+                pPage->errCount[irqId]++;
+                pPage->lastErrMask[irqId] = pErrorS->errMaskU;
+            }
+        }
+        else
+        {
+            ;                                               /* only a state change                                  */
+        }
+        switch (pDrvParams->driverState)
+        {   /* the interface status, as Csi2_GetInterfaceStatus                                                     */
+            case CSI2_DRIVER_STATE_ON:
+                pPage->ifaceStatus = (uint32)CSI2_LANE_STATE_ON;
+                break;
+            case CSI2_DRIVER_STATE_STOP:
+                pPage->ifaceStatus = (uint32)CSI2_LANE_STATE_STOP;
+                break;
+            case CSI2_DRIVER_STATE_OFF:
+                pPage->ifaceStatus = (uint32)CSI2_LANE_STATE_OFF;
+                break;
+            default:
+                pPage->ifaceStatus = (uint32)CSI2_LANE_STATE_ERR;
+                break;
+        }
+        if (lanesRefresh != 0u)
+        {
+            for (i = 0u; i < (uint32)CSI2_MAX_LANE; i++)
+            {
+                pPage->laneStatus[i] = (i < lanesNum) ? laneStatus[i] : pPage->ifaceStatus;
+            }
+        }
+#if (CSI2_FRAMES_COUNTER_USED == STD_ON)
+        for (i = 0u; i < (uint32)CSI2_MAX_VC; i++)
+        {
+            pPage->framesCounter[i] = gsCsi2FramesCounter[(uint8)unitId][i];
+        }
+#endif
+#if (CSI2_TIMESTAMP_USAGE == STD_ON)
+        pPage->timeUpdate = CSI2_GET_TIMESTAMP();
+#endif
+        CSI2_WRITE_BARRIER();
+        pPage->seq = seq + 1u;                              /* even, the page is consistent again                   */
+#ifdef linux
+        (void)OAL_UnlockIRQSpin(&gpRsdkCsi2Device[(uint8)unitId]->statusLock, &flags);
+#endif
+    }
+}
+/* Csi2_StatusPageUpdate *************************/
+
+
+/*================================================================================================*/
+/**
+ * @brief       The function return the unit status page.
+ * @details     The page is updated by the driver at any time, see Csi2_ReadStatusPage for a consistent copy.
+ *
+ * @param[in]   unitId    - unit identifier
+ *
+ * @return      pointer to the unit status page, NULL_PTR for a wrong unitId or a unit never initialized
+ *
+ */
+const Csi2_StatusPageType *Csi2_GetStatusPage(const Csi2_UnitIdType unitId)
+{
+    const Csi2_StatusPageType *pRez = (const Csi2_StatusPageType *)NULL_PTR;
+
+    if ((uint8)unitId < (uint8)CSI2_MAX_UNITS)
+    {
+        pRez = gCsi2Settings[(uint8)unitId].pStatusPage;
+    }
+    return pRez;
+}
+/* Csi2_GetStatusPage *************************/
+
+
+/*================================================================================================*/
+/**
+ * @brief       The function take a consistent copy of the unit status page.
+ * @details     The page is copied between two reads of the sequence counter; the copy is retried if the counter
+ *              was odd (update in progress) or was changed during the copy. No lock is taken.
+ *
+ * @param[in]   unitId    - unit identifier
+ * @param[out]  pStatus   - pointer to the structure to be filled
+ *
+ * @return      Std_ReturnType - success or error, detailed status information reported on Det.
+ *
+ */
+Std_ReturnType Csi2_ReadStatusPage(const Csi2_UnitIdType unitId, Csi2_StatusPageType *pStatus)
+{
+    const Csi2_StatusPageType   *pPage;
+    Std_ReturnType              rez = (Std_ReturnType)E_OK;
+    uint32                      seq;
+
+    if ((uint8)unitId >= (uint8)CSI2_MAX_UNITS)
+    {
+        rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_WRG_UNIT_ID, (uint8)CSI2_API_ID_READ_STATUS,
+                                                                    (uint8)CSI2_E_DRV_WRG_UNIT_ID);
+        CSI2_HALT_ON_ERROR;
+    }
+    else if (pStatus == (Csi2_StatusPageType *)NULL_PTR)
+    {
+        rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_NULL_PARAM_PTR, (uint8)CSI2_API_ID_READ_STATUS,
+                                                                    (uint8)CSI2_E_DRV_NULL_PARAM_PTR);
+        CSI2_HALT_ON_ERROR;
+    }
+    else
+    {
+        pPage = gCsi2Settings[(uint8)unitId].pStatusPage;
+        if (pPage == (const Csi2_StatusPageType *)NULL_PTR)
+        {
+            rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_NOT_INIT, (uint8)CSI2_API_ID_READ_STATUS,
+                                                                    (uint8)CSI2_E_DRV_NOT_INIT);
+            CSI2_HALT_ON_ERROR;
+        }
+        else
+        {
+            do
+            {
+                seq = pPage->seq;
+                CSI2_READ_BARRIER();
+                *pStatus = *pPage;
+                CSI2_READ_BARRIER();
+            } while (((seq & 1u) != 0u) || (seq != pPage->seq));
+            pStatus->seq = seq;
+        }
+    }
+    return rez;
+}
+/* Csi2_ReadStatusPage *************************/
+#endif  /* #if (CSI2_STATUS_PAGE_USAGE == STD_ON)     */
+
+
+#if (CSI2_FRAME_SYNC_USAGE == STD_ON)
+
+/*================================================================================================*/
+/**
+ * @brief       The function close the cycle being collected by the frame synchronizer.
+ * @details     Called with the synchronizer lock taken. The cycle is copied to the closed cycles before it is
+ *              published by gsCsi2SyncLastId, so the waiters can copy it without any lock.
+ *
+ */
+static void Csi2_SyncClose(void)
+{
+    uint32                      cycleId;
+
+    cycleId = gsCsi2SyncLastId + 1u;
+    gsCsi2SyncOpen.cycleId = cycleId;
+    gsCsi2SyncOpen.missingMask = gsCsi2SyncParams.memberMask & (~gsCsi2SyncOpen.presentMask);
+    gsCsi2SyncCycles[cycleId % CSI2_SYNC_CYCLES_NR] = gsCsi2SyncOpen;
+    CSI2_WRITE_BARRIER();
+    gsCsi2SyncLastId = cycleId;
+    gsCsi2SyncOpen = gsCsi2SyncCycleReset;
+}
+/* Csi2_SyncClose *************************/
+
+
+/*================================================================================================*/
+/**
+ * @brief       The function check if a cycle newer than lastCycleId was closed.
+ * @details     In Linux the cycle being collected is also closed here if its skew window expired, so a cycle whose
+ *              members stopped is reported at the latest at the wait timeout. For bare-metal the cycle is closed
+ *              only by the next member FrameEnd (the events irq can't be locked out).
+ *
+ * @param[in]   lastCycleId - the last cycle already received
+ *
+ * @return      1 if a newer cycle is available, 0 otherwise
+ *
+ */
+static uint32 Csi2_SyncReady(const uint32 lastCycleId)
+{
+#ifdef linux
+    unsigned long               flags;
+
+    (void)OAL_LockIRQSpin(&gRsdkCsi2SyncLock, &flags);
+    if ((gsCsi2SyncOpen.presentMask != 0u) &&
+        ((sint64)(CSI2_GET_TIMESTAMP() - gsCsi2SyncOpen.timeFirst) > (sint64)gsCsi2SyncSkew))
+    {   /* the missing members are late                                                                     */
+        Csi2_SyncClose();
+    }
+    (void)OAL_UnlockIRQSpin(&gRsdkCsi2SyncLock, &flags);
+#endif
+    return ((sint32)(gsCsi2SyncLastId - lastCycleId) > 0) ? 1u : 0u;
+}
+/* Csi2_SyncReady *************************/
+
+
+/*================================================================================================*/
+/**
+ * @brief       The function configure the multi-unit frame synchronizer.
+ * @details     The FrameEnds of the members (unit, VC) are grouped in cycles, see Csi2_SyncCycleType. A new
+ *              configuration drops the cycle being collected; the cycles counter is not reset, so the waiters
+ *              are not confused.
+ *
+ * @param[in]   pParams   - pointer to the synchronizer parameters
+ *
+ * @return      Std_ReturnType - success or error, detailed status information reported on Det.
+ *
+ */
+Std_ReturnType Csi2_SyncConfig(const Csi2_SyncParamsType *pParams)
+{
+    Std_ReturnType              rez = (Std_ReturnType)E_OK;
+#ifdef linux
+    unsigned long               flags;
+#endif
+
+    if (pParams == (const Csi2_SyncParamsType *)NULL_PTR)
+    {
+        rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_NULL_PARAM_PTR, (uint8)CSI2_API_ID_SYNC_CONFIG,
+                                                                    (uint8)CSI2_E_DRV_NULL_PARAM_PTR);
+        CSI2_HALT_ON_ERROR;
+    }
+    else if ((pParams->memberMask >> ((uint32)CSI2_MAX_UNITS * (uint32)CSI2_MAX_VC)) != 0u)
+    {   /* member of a not existing unit/VC                                                                 */
+        rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_WRG_UNIT_ID, (uint8)CSI2_API_ID_SYNC_CONFIG,
+                                                                    (uint8)CSI2_E_DRV_WRG_UNIT_ID);
+        CSI2_HALT_ON_ERROR;
+    }
+    else
+    {
+#ifdef linux
+        (void)OAL_LockIRQSpin(&gRsdkCsi2SyncLock, &flags);
+#endif
+        gsCsi2SyncParams = *pParams;
+        gsCsi2SyncSkew = ((uint64)pParams->skewUs * CSI2_GET_TIMESTAMP_FREQ()) / (uint64)1000000u;
+        gsCsi2SyncOpen = gsCsi2SyncCycleReset;
+#ifdef linux
+        (void)OAL_UnlockIRQSpin(&gRsdkCsi2SyncLock, &flags);
+#endif
+    }
+    return rez;
+}
+/* Csi2_SyncConfig *************************/
+
+
+/*================================================================================================*/
+/**
+ * @brief       The function account a FrameEnd in the frame synchronizer.
+ * @details     Called by the events irq for each VC FrameEnd; the FrameEnds of not member VCs are ignored.
+ *              The cycle being collected is closed :
+ *              - complete, when all the members reported FrameEnd
+ *              - with missing members, when a present member reports FrameEnd again or a member reports FrameEnd
+ *                out of the skew window; the FrameEnd starts the next cycle.
+ *              The units events irqs can run on different cores, so in Linux the synchronizer is locked.
+ *
+ * @param[in]   unitId    - unit identifier
+ * @param[in]   vcId      - Virtual Channel identifier
+ * @param[in]   timeFe    - the FrameEnd timestamp
+ *
+ */
+void Csi2_SyncFrameEnd(const Csi2_UnitIdType unitId, const uint32 vcId, const uint64 timeFe)
+{
+    uint32                      member, memberBit, closed;
+#ifdef linux
+    unsigned long               flags;
+#endif
+
+    member = ((uint32)unitId * (uint32)CSI2_MAX_VC) + vcId;
+    memberBit = (uint32)1u << member;
+    if ((gsCsi2SyncParams.memberMask & memberBit) != 0u)
+    {
+        closed = 0u;
+#ifdef linux
+        (void)OAL_LockIRQSpin(&gRsdkCsi2SyncLock, &flags);
+#endif
+        if ((gsCsi2SyncOpen.presentMask != 0u) && (((gsCsi2SyncOpen.presentMask & memberBit) != 0u) ||
+            ((sint64)(timeFe - gsCsi2SyncOpen.timeFirst) > (sint64)gsCsi2SyncSkew)))
+        {   /* the next cycle started, some members missed the current one                                  */
+            Csi2_SyncClose();
+            closed++;
+        }
+        if (gsCsi2SyncOpen.presentMask == 0u)
+        {
+            gsCsi2SyncOpen.timeFirst = timeFe;
+        }
+        gsCsi2SyncOpen.presentMask |= memberBit;
+        gsCsi2SyncOpen.timeLast = timeFe;
+#if (CSI2_FRAMES_COUNTER_USED == STD_ON)
+        gsCsi2SyncOpen.frameCounter[member] = gsCsi2FramesCounter[(uint8)unitId][vcId];
+#endif
+        if (gsCsi2SyncOpen.presentMask == gsCsi2SyncParams.memberMask)
+        {   /* complete cycle                                                                               */
+            Csi2_SyncClose();
+            closed++;
+        }
+#ifdef linux
+        (void)OAL_UnlockIRQSpin(&gRsdkCsi2SyncLock, &flags);
+        if (closed != 0u)
+        {
+            (void)OAL_WakeUpInterruptible(&gRsdkCsi2SyncWaitQ);
+        }
+#else
+        (void)closed;
+#endif
+    }
+}
+/* Csi2_SyncFrameEnd *************************/
+
+
+/*================================================================================================*/
+/**
+ * @brief       The function wait for the cycle next to lastCycleId.
+ * @details     The last (CSI2_SYNC_CYCLES_NR - 1) closed cycles are kept; if the next cycle was already dropped,
+ *              the oldest kept cycle is returned, with the dropped cycles number in lostCycles. The copy is done
+ *              without lock and retried if the cycle was overwritten meanwhile. In Linux the caller sleeps until
+ *              a cycle is closed, for bare-metal the cycles counter is polled each microsecond.
+ *
+ * @param[in]   lastCycleId - the last cycle already received, 0 for none
+ * @param[in]   timeoutUs   - maximum waiting time, in microseconds
+ * @param[out]  pCycle      - pointer to the cycle to be filled
+ *
+ * @return      Std_ReturnType - E_OK if a cycle was returned, RSDK_CSI2_DRV_TIMER_ERROR for timeout, other
+ *              detailed status information reported on Det.
+ *
+ */
+Std_ReturnType Csi2_SyncWait(const uint32 lastCycleId, const uint32 timeoutUs, Csi2_SyncCycleType *pCycle)
+{
+    Std_ReturnType              rez;
+    uint32                      cycleId;
+#ifdef linux
+    long                        waitRez;
+#else
+    uint32                      waitUs;
+#endif
+
+    if (pCycle == (Csi2_SyncCycleType *)NULL_PTR)
+    {
+        rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_NULL_PARAM_PTR, (uint8)CSI2_API_ID_SYNC_WAIT,
+                                                                    (uint8)CSI2_E_DRV_NULL_PARAM_PTR);
+        CSI2_HALT_ON_ERROR;
+    }
+    else if (gsCsi2SyncParams.memberMask == 0u)
+    {   /* synchronizer not configured                                                                      */
+        rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_NOT_INIT, (uint8)CSI2_API_ID_SYNC_WAIT,
+                                                                    (uint8)CSI2_E_DRV_NOT_INIT);
+        CSI2_HALT_ON_ERROR;
+    }
+    else
+    {
+        rez = (Std_ReturnType)E_OK;
+#ifdef linux
+        waitRez = OAL_WaitEventInterruptibleTimeout(gRsdkCsi2SyncWaitQ, (Csi2_SyncReady(lastCycleId) != 0u),
+                                                    usecs_to_jiffies(timeoutUs));
+        if (waitRez <= 0)
+        {   /* timeout or signal                                                                            */
+            rez = (Std_ReturnType)RSDK_CSI2_DRV_TIMER_ERROR;
+        }
+#else
+        waitUs = timeoutUs;
+        while ((Csi2_SyncReady(lastCycleId) == 0u) && (waitUs != 0u))
+        {
+            (void)Csi2_WaitLoopUs(1u);
+            waitUs--;
+        }
+        if (Csi2_SyncReady(lastCycleId) == 0u)
+        {
+            rez = (Std_ReturnType)RSDK_CSI2_DRV_TIMER_ERROR;
+        }
+#endif
+        if (rez == (Std_ReturnType)E_OK)
+        {
+            do
+            {
+                cycleId = lastCycleId + 1u;
+                if ((gsCsi2SyncLastId - cycleId) >= (CSI2_SYNC_CYCLES_NR - 1u))
+                {   /* already dropped, take the oldest cycle kept                                              */
+                    cycleId = gsCsi2SyncLastId - (CSI2_SYNC_CYCLES_NR - 2u);
+                }
+                CSI2_READ_BARRIER();
+                *pCycle = gsCsi2SyncCycles[cycleId % CSI2_SYNC_CYCLES_NR];
+                CSI2_READ_BARRIER();
+            } while ((gsCsi2SyncLastId - cycleId) >= (CSI2_SYNC_CYCLES_NR - 1u));   /* overwritten meanwhile     */
+            pCycle->lostCycles = cycleId - lastCycleId - 1u;
+        }
+    }
+    return rez;
+}
+/* Csi2_SyncWait *************************/
+#endif  /* #if (CSI2_FRAME_SYNC_USAGE == STD_ON)     */
+
+#if (CSI2_REPLAY_USAGE == STD_ON)
+
+/*================================================================================================*/
+/**
+ * @brief       The function skip capture bytes, reading them in the scratch buffer.
+ *
+ * @param[in]   pSes    - pointer to the replay session
+ * @param[in]   len     - the number of bytes to skip
+ *
+ * @return      the number of bytes not skipped, because of the capture end; 0 for success
+ *
+ */
+static uint32 Csi2_ReplaySkip(const Csi2_ReplaySessionType *pSes, uint32 len)
+{
+    uint32                      chunk, got;
+
+    got = 1u;
+    while ((len != 0u) && (got != 0u))
+    {
+        chunk = (len < CSI2_REPLAY_SCRATCH_LEN) ? len : CSI2_REPLAY_SCRATCH_LEN;
+        got = pSes->pRead(pSes->pCtx, gsCsi2ReplayScratch, chunk);
+        len -= got;
+        if (got != chunk)
+        {   /* capture end                                                                                  */
+            got = 0u;
+        }
+    }
+    return len;
+}
+/* Csi2_ReplaySkip *************************/
+
+
+/*================================================================================================*/
+/**
+ * @brief       The function read a capture section (auxiliary data or metadata) in its buffer.
+ * @details     The section lines are written from the buffer start, as the interface does; a section without
+ *              buffer or with lines longer than the buffer lines is dropped, as the interface does.
+ *
+ * @param[in]   pSes        - pointer to the replay session
+ * @param[in]   pBuf        - the section buffer, NULL if not configured
+ * @param[in]   bufLineLen  - the buffer line length
+ * @param[in]   bufNumLines - the buffer lines number
+ * @param[in]   lineLen     - the section line length
+ * @param[in]   lines       - the section lines number
+ *
+ * @return      the number of bytes not read, because of the capture end; 0 for success
+ *
+ */
+static uint32 Csi2_ReplaySection(const Csi2_ReplaySessionType *pSes, uint8 *pBuf, const uint16 bufLineLen,
+                                 const uint16 bufNumLines, const uint16 lineLen, const uint16 lines)
+{
+    uint32                      i, left;
+
+    left = 0u;
+    if ((pBuf == NULL_PTR) || (lineLen > bufLineLen) || (bufNumLines == 0u))
+    {   /* dropped section                                                                                  */
+        left = Csi2_ReplaySkip(pSes, (uint32)lineLen * (uint32)lines);
+    }
+    else
+    {
+        for (i = 0u; (i < (uint32)lines) && (left == 0u); i++)
+        {
+            left = (uint32)lineLen - pSes->pRead(pSes->pCtx,
+                                &pBuf[(i % (uint32)bufNumLines) * (uint32)bufLineLen], (uint32)lineLen);
+        }
+    }
+    return left;
+}
+/* Csi2_ReplaySection *************************/
+
+
+/*================================================================================================*/
+/**
+ * @brief       The function wait until the replay time of a recorded event.
+ * @details     The replay time base is set by the first paced event; the events recorded before it are not
+ *              delayed. Without the recording or the host counter frequency there is no pacing.
+ *
+ * @param[in]   pSes        - pointer to the replay session
+ * @param[in]   timeRec     - the recorded event timestamp
+ *
+ */
+static void Csi2_ReplayWaitFor(Csi2_ReplaySessionType *pSes, const uint64 timeRec)
+{
+#if (CSI2_TIMESTAMP_USAGE == STD_ON)
+    uint64                      delta, target, freqHost;
+
+    freqHost = CSI2_GET_TIMESTAMP_FREQ();
+    if ((pSes->pace == CSI2_REPLAY_PACED) && (pSes->freqRec != 0u) && (freqHost != 0u))
+    {
+        if (pSes->timeHost0 == 0u)
+        {   /* first paced event                                                                            */
+            pSes->timeRec0 = timeRec;
+            pSes->timeHost0 = CSI2_GET_TIMESTAMP();
+        }
+        delta = timeRec - pSes->timeRec0;
+        if ((sint64)delta > 0)
+        {   /* recording ticks to host ticks, without overflow for long captures                            */
+            target = pSes->timeHost0 + ((delta / pSes->freqRec) * freqHost) +
+                                        (((delta % pSes->freqRec) * freqHost) / pSes->freqRec);
+            while ((sint64)(CSI2_GET_TIMESTAMP() - target) < 0)
+            {
+                (void)Csi2_WaitLoopUs(1u);
+            }
+        }
+    }
+#else
+    (void)pSes;
+    (void)timeRec;
+#endif
+}
+/* Csi2_ReplayWaitFor *************************/
+
+
+/*================================================================================================*/
+/**
+ * @brief       The function raise an events irq on a unit of the registers model.
+ * @details     The status registers are written as the interface would set them; the model has no write 1 to
+ *              clear, so the status is cleared after the handler.
+ *
+ * @param[in]   unitId      - unit identifier
+ * @param[in]   pRegs       - pointer to the unit registers model
+ * @param[in]   vcStat      - the MIPICSI2_RX_VCINTRS value
+ * @param[in]   chnlStat    - the MIPICSI2_RX_CHNL_INTRS value
+ *
+ */
+static void Csi2_ReplayIrq(const Csi2_UnitIdType unitId, volatile GENERIC_CSI2_Type *pRegs, const uint32 vcStat,
+                           const uint32 chnlStat)
+{
+    pRegs->RX_VCINTRS = vcStat;
+    pRegs->RX_CHNL_INTRS = chnlStat;
+    Csi2_IrqHandlerEvents(unitId);
+    pRegs->RX_VCINTRS = 0u;
+    pRegs->RX_CHNL_INTRS = 0u;
+}
+/* Csi2_ReplayIrq *************************/
+
+
+/*================================================================================================*/
+/**
+ * @brief       The function replay a frame record, its header already read.
+ * @details     The radar data lines are written in the VC buffer currently used by the interface (the frame ring
+ *              included), then the auxiliary data and the metadata lines in their buffers. The events follow the
+ *              interface sequence : FrameStart, LINEDONE after each radar data line, FrameEnd. An event is raised
+ *              only if its irq is enabled; a disabled FrameStart is seen by the next irq, as for the interface.
+ *              The lines are paced evenly between the recorded FrameStart and FrameEnd.
+ *
+ * @param[in]   pSes        - pointer to the replay session
+ * @param[in]   pHdr        - pointer to the frame record header
+ *
+ * @return      Std_ReturnType - success or error, detailed status information reported on Det.
+ *
+ */
+static Std_ReturnType Csi2_ReplayFrame(Csi2_ReplaySessionType *pSes, const rsdkCsi2CapFrameHdr_t *pHdr)
+{
+    Std_ReturnType              rez = (Std_ReturnType)E_OK;
+    uint32                      i, left, vcStat, vcShift;
+    uint64                      frameTime;
+    uint8                       *pBuf;
+    volatile GENERIC_CSI2_Type  *pRegs;
+    const Csi2_VCDriverStateType *pVCState;
+    const Csi2_VCParamsType     *pVCParams;
+    const Csi2_SetupParamsType  *pParams;
+    Csi2_UnitIdType             unitId;
+
+    if ((pHdr->unitId >= (uint8)CSI2_MAX_UNITS) || (pHdr->vcId >= (uint8)CSI2_MAX_VC))
+    {
+        rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_WRG_UNIT_ID, (uint8)CSI2_API_ID_REPLAY, (uint8)CSI2_E_DRV_WRG_UNIT_ID);
+        CSI2_HALT_ON_ERROR;
+    }
+    else if ((gMipiCsi2RegsPtr[pHdr->unitId] == NULL_PTR) ||
+             (gCsi2Settings[pHdr->unitId].driverState == CSI2_DRIVER_STATE_NOT_INITIALIZED))
+    {
+        rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_NOT_INIT, (uint8)CSI2_API_ID_REPLAY, (uint8)CSI2_E_DRV_NOT_INIT);
+        CSI2_HALT_ON_ERROR;
+    }
+    else if (gCsi2Settings[pHdr->unitId].workingParamVC[pHdr->vcId].vcParamsPtr == (Csi2_VCParamsType *)NULL_PTR)
+    {
+        rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_NULL_VC_PARAM_PTR, (uint8)CSI2_API_ID_REPLAY,
+                                                                    (uint8)CSI2_E_DRV_NULL_VC_PARAM_PTR);
+        CSI2_HALT_ON_ERROR;
+    }
+    else if (pHdr->dataLineLen > gCsi2Settings[pHdr->unitId].workingParamVC[pHdr->vcId].vcParamsPtr->bufLineLen)
+    {   /* the recorded lines don't fit the VC buffer                                                       */
+        rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_INVALID_VC_PARAMS, (uint8)CSI2_API_ID_REPLAY,
+                                                                    (uint8)CSI2_E_DRV_INVALID_VC_PARAMS);
+        CSI2_HALT_ON_ERROR;
+    }
+    else
+    {
+        unitId = (Csi2_UnitIdType)pHdr->unitId;
+        pRegs = gMipiCsi2RegsPtr[pHdr->unitId];
+        pVCState = &gCsi2Settings[pHdr->unitId].workingParamVC[pHdr->vcId];
+        pVCParams = pVCState->vcParamsPtr;
+        pParams = &gsCsi2UnitParamCopy[pHdr->unitId];
+#if (CSI2_FRAME_RING_USAGE == STD_ON)
+        pBuf = (uint8 *)((pVCState->frameBufCrt == 0u) ? pVCParams->bufDataPtr :
+                                                     pVCParams->nextBufDataPtr[pVCState->frameBufCrt - 1u]);
+#else
+        pBuf = (uint8 *)pVCParams->bufDataPtr;
+#endif
+        vcShift = (uint32)pHdr->vcId * CSI2_REPLAY_VC_BITS;
+        frameTime = pHdr->timeFrameEnd - pHdr->timeFrameStart;
+
+        /* FrameStart                                                                                       */
+        Csi2_ReplayWaitFor(pSes, pHdr->timeFrameStart);
+        vcStat = (uint32)CSI2_EVT_FRAME_START << vcShift;
+        if ((pRegs->RX_VCINTRE & vcStat) != 0u)
+        {
+            Csi2_ReplayIrq(unitId, pRegs, vcStat, 0u);
+            vcStat = 0u;
+        }
+        /* radar data lines, with LINEDONE                                                                  */
+        left = 0u;
+        for (i = 0u; (i < (uint32)pHdr->dataLines) && (left == 0u); i++)
+        {
+            Csi2_ReplayWaitFor(pSes, pHdr->timeFrameStart + ((frameTime * (uint64)(i + 1u)) / pHdr->dataLines));
+            left = (uint32)pHdr->dataLineLen - pSes->pRead(pSes->pCtx,
+                                &pBuf[(i % (uint32)pVCParams->bufNumLines) * (uint32)pVCParams->bufLineLen],
+                                (uint32)pHdr->dataLineLen);
+            if ((left == 0u) && ((pRegs->RX_CHNL_INTRE & MIPICSI2_RX_CHNL_INTRE_LINEDONEIE_MASK) != 0u))
+            {
+                /* read-only for the software, set by the interface with the last received packet VC         */
+                *(volatile uint32 *)&pRegs->RX_DATAIDR = MIPICSI2_RX_DATAIDR_VCID((uint32)pHdr->vcId);
+                Csi2_ReplayIrq(unitId, pRegs, vcStat, MIPICSI2_RX_CHNL_INTRS_LINEDONE_MASK);
+                vcStat = 0u;
+            }
+        }
+        /* auxiliary data and metadata                                                                      */
+#if (CSI2_AUXILIARY_DATA_USAGE == STD_ON)
+        if ((left == 0u) && (pParams->auxConfigPtr[pHdr->vcId] != (Csi2_VCParamsType *)NULL_PTR))
+        {
+            left = Csi2_ReplaySection(pSes, (uint8 *)pParams->auxConfigPtr[pHdr->vcId]->bufDataPtr,
+                            pParams->auxConfigPtr[pHdr->vcId]->bufLineLen,
+                            pParams->auxConfigPtr[pHdr->vcId]->bufNumLines, pHdr->auxLineLen, pHdr->auxLines);
+        }
+        else
+#endif
+        if (left == 0u)
+        {
+            left = Csi2_ReplaySection(pSes, (uint8 *)NULL_PTR, 0u, 0u, pHdr->auxLineLen, pHdr->auxLines);
+        }
+#if (CSI2_METADATA_DATA_USAGE == STD_ON)
+        if ((left == 0u) && (pParams->metaDataPtr[pHdr->vcId] != (Csi2_MetaDataParamsType *)NULL_PTR))
+        {
+            left = Csi2_ReplaySection(pSes, (uint8 *)pParams->metaDataPtr[pHdr->vcId]->bufDataPtr,
+                            pParams->metaDataPtr[pHdr->vcId]->bufLineLen,
+                            pParams->metaDataPtr[pHdr->vcId]->bufNumLines, pHdr->metaLineLen, pHdr->metaLines);
+        }
+        else
+#endif
+        if (left == 0u)
+        {
+            left = Csi2_ReplaySection(pSes, (uint8 *)NULL_PTR, 0u, 0u, pHdr->metaLineLen, pHdr->metaLines);
+        }
+        /* FrameEnd, always enabled                                                                         */
+        if (left == 0u)
+        {
+            Csi2_ReplayWaitFor(pSes, pHdr->timeFrameEnd);
+            Csi2_ReplayIrq(unitId, pRegs, vcStat | ((uint32)CSI2_EVT_FRAME_END << vcShift), 0u);
+        }
+        else
+        {   /* truncated capture, the frame stays without FrameEnd                                          */
+            rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_TOO_SMALL_BUFFER, (uint8)CSI2_API_ID_REPLAY,
+                                                                    (uint8)CSI2_E_DRV_TOO_SMALL_BUFFER);
+            CSI2_HALT_ON_ERROR;
+        }
+    }
+    return rez;
+}
+/* Csi2_ReplayFrame *************************/
+
+
+/*================================================================================================*/
+/**
+ * @brief       The memory capture reader.
+ *
+ * @param[in]   pCtx    - pointer to the memory capture context, Csi2_ReplayMemType
+ * @param[out]  pDst    - the destination
+ * @param[in]   len     - the number of bytes requested
+ *
+ * @return      the number of bytes copied
+ *
+ */
+static uint32 Csi2_ReplayReadMem(void *pCtx, void *pDst, const uint32 len)
+{
+    Csi2_ReplayMemType          *pMem;
+    uint32                      rez;
+
+    pMem = (Csi2_ReplayMemType *)pCtx;
+    rez = (pMem->left < (uint64)len) ? (uint32)pMem->left : len;
+    (void)memcpy(pDst, pMem->pCrt, rez);
+    pMem->pCrt = &pMem->pCrt[rez];
+    pMem->left -= rez;
+    return rez;
+}
+/* Csi2_ReplayReadMem *************************/
+
+
+/*================================================================================================*/
+/**
+ * @brief       The function replay a raw frames capture, read by a capture reader.
+ * @details     The capture (see rsdkCsi2CapFileHdr_t) is replayed up to its end, on the recorded units/VCs, which
+ *              must be set up before. The frames are written in the VCs buffers and the events irq handler is
+ *              called for the enabled events, so the application callbacks, the frame ring, the lines watermarks
+ *              and all the other consumers of the events see the frames as received by the interface.
+ *              The events timestamps are taken at replay; with CSI2_REPLAY_PACED they keep the recorded timing.
+ *
+ * @param[in]   pRead       - the capture reader
+ * @param[in]   pCtx        - the reader context, passed back to the reader
+ * @param[in]   pace        - the replay pacing
+ * @param[out]  pFramesNum  - the number of frames replayed; can be NULL
+ *
+ * @return      Std_ReturnType - success or error, detailed status information reported on Det.
+ *
+ */
+Std_ReturnType Csi2_ReplayStream(const Csi2_ReplayReadType pRead, void *pCtx, const Csi2_ReplayPaceType pace,
+                                 uint32 *pFramesNum)
+{
+    Std_ReturnType              rez = (Std_ReturnType)E_OK;
+    Csi2_ReplaySessionType      ses;
+    rsdkCsi2CapFileHdr_t        fileHdr;
+    rsdkCsi2CapFrameHdr_t       frameHdr;
+    uint64                      secLen;
+    uint32                      got, framesNum;
+    uint8                       capEnd;
+
+    framesNum = 0u;
+    if (pRead == (Csi2_ReplayReadType)NULL_PTR)
+    {
+        rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_NULL_PARAM_PTR, (uint8)CSI2_API_ID_REPLAY,
+                                                                    (uint8)CSI2_E_DRV_NULL_PARAM_PTR);
+        CSI2_HALT_ON_ERROR;
+    }
+    else
+    {
+        ses.pRead = pRead;
+        ses.pCtx = pCtx;
+        ses.pace = pace;
+        ses.timeRec0 = 0u;
+        ses.timeHost0 = 0u;
+        got = pRead(pCtx, &fileHdr, (uint32)sizeof(fileHdr));
+        if ((got != (uint32)sizeof(fileHdr)) || (fileHdr.magic != RSDK_CSI2_CAP_FILE_MAGIC) ||
+            (fileHdr.version != (uint16)RSDK_CSI2_CAP_VERSION) || (fileHdr.hdrLen < (uint16)sizeof(fileHdr)) ||
+            (Csi2_ReplaySkip(&ses, (uint32)fileHdr.hdrLen - (uint32)sizeof(fileHdr)) != 0u))
+        {   /* not a capture                                                                                */
+            rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_INVALID_DATA_TYPE, (uint8)CSI2_API_ID_REPLAY,
+                                                                    (uint8)CSI2_E_DRV_INVALID_DATA_TYPE);
+            CSI2_HALT_ON_ERROR;
+        }
+        else
+        {
+            ses.freqRec = fileHdr.counterFreq;
+            capEnd = 0u;
+            while ((rez == (Std_ReturnType)E_OK) && (capEnd == 0u))
+            {
+                got = pRead(pCtx, &frameHdr, (uint32)sizeof(frameHdr));
+                secLen = ((uint64)frameHdr.dataLineLen * frameHdr.dataLines) +
+                         ((uint64)frameHdr.auxLineLen * frameHdr.auxLines) +
+                         ((uint64)frameHdr.metaLineLen * frameHdr.metaLines);
+                if (got == 0u)
+                {   /* the capture end, at a record boundary                                                    */
+                    capEnd = 1u;
+                }
+                else if ((got != (uint32)sizeof(frameHdr)) || (frameHdr.magic != RSDK_CSI2_CAP_FRAME_MAGIC) ||
+                         (frameHdr.hdrLen < (uint16)sizeof(frameHdr)) ||
+                         ((uint64)frameHdr.recLen < ((uint64)frameHdr.hdrLen + secLen)) ||
+                         (Csi2_ReplaySkip(&ses, (uint32)frameHdr.hdrLen - (uint32)sizeof(frameHdr)) != 0u))
+                {   /* corrupted or truncated record                                                            */
+                    rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_INVALID_DATA_TYPE, (uint8)CSI2_API_ID_REPLAY,
+                                                                    (uint8)CSI2_E_DRV_INVALID_DATA_TYPE);
+                    CSI2_HALT_ON_ERROR;
+                }
+                else
+                {
+                    rez = Csi2_ReplayFrame(&ses, &frameHdr);
+                    if (rez == (Std_ReturnType)E_OK)
+                    {
+                        framesNum++;
+                        if (Csi2_ReplaySkip(&ses, frameHdr.recLen - (uint32)frameHdr.hdrLen - (uint32)secLen) != 0u)
+                        {   /* truncated record padding                                                         */
+                            rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_TOO_SMALL_BUFFER, (uint8)CSI2_API_ID_REPLAY,
+                                                                    (uint8)CSI2_E_DRV_TOO_SMALL_BUFFER);
+                            CSI2_HALT_ON_ERROR;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    if (pFramesNum != NULL_PTR)
+    {
+        *pFramesNum = framesNum;
+    }
+    return rez;
+}
+/* Csi2_ReplayStream *************************/
+
+
+/*================================================================================================*/
+/**
+ * @brief       The function replay a raw frames capture from memory, for example a memory-mapped capture file.
+ *
+ * @param[in]   pCap        - the capture start address
+ * @param[in]   capLen      - the capture length, in bytes
+ * @param[in]   pace        - the replay pacing
+ * @param[out]  pFramesNum  - the number of frames replayed; can be NULL
+ *
+ * @return      Std_ReturnType - success or error, detailed status information reported on Det.
+ *
+ */
+Std_ReturnType Csi2_ReplayCapture(const void *pCap, const uint64 capLen, const Csi2_ReplayPaceType pace,
+                                  uint32 *pFramesNum)
+{
+    Std_ReturnType              rez;
+    Csi2_ReplayMemType          mem;
+
+    if (pCap == NULL_PTR)
+    {
+        rez = CSI2_REPORT_ERROR(RSDK_CSI2_DRV_NULL_PARAM_PTR, (uint8)CSI2_API_ID_REPLAY,
+                                                                    (uint8)CSI2_E_DRV_NULL_PARAM_PTR);
+        CSI2_HALT_ON_ERROR;
+    }
+    else
+    {
+        mem.pCrt = (const uint8 *)pCap;
+        mem.left = capLen;
+        rez = Csi2_ReplayStream(Csi2_ReplayReadMem, &mem, pace, pFramesNum);
+    }
+    return rez;
+}
+/* Csi2_ReplayCapture *************************/
+#endif  /* #if (CSI2_REPLAY_USAGE == STD_ON)     */
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -413,15 +413,30 @@ static void Csi2_InitEventIrq(const Csi2_UnitIdType iUnit, volatile GENERIC_CSI2
             if (paramsPtr->vcConfigPtr[vcId] != (Csi2_VCParamsType*)NULL_PTR)   /* only for active VC                */
             {
                 /* enable the interrupts for active VC, FE must be processed anyway                                  */
+#if (CSI2_DEFERRED_STATISTICS == STD_ON) && (CSI2_AUTO_DC_COMPENSATION == STD_ON)
+                /* FS too with statistics, the DC offsets computed by the bottom half are written at FrameStart      */
+                Csi2_SetVCEventIrq(vcId, regsPtr,
+                                (uint8)paramsPtr->vcConfigPtr[vcId]->vcEventsReq | (uint8)CSI2_EVT_FRAME_END |
+                                ((driverStatePtr->statisticsFlag != CSI2_AUTODC_NO) ? (uint8)CSI2_EVT_FRAME_START : 0u),
+                                paramsPtr->vcConfigPtr[vcId]->bufNumLinesTrigger);
+#else
                 Csi2_SetVCEventIrq(vcId, regsPtr,
                                 (uint8)paramsPtr->vcConfigPtr[vcId]->vcEventsReq | (uint8)CSI2_EVT_FRAME_END,
                                 paramsPtr->vcConfigPtr[vcId]->bufNumLinesTrigger);
+#endif
             }
             else
             {
                 Csi2_SetVCEventIrq(vcId, regsPtr, 0u, 0u);  /* disable the interrupts for inactive VC                */
             }
             setLDevt |= ((uint8)driverStatePtr->workingParamVC[vcId].eventsMask & (uint8)CSI2_EVT_LINE_END);
+#if (CSI2_LINE_WATERMARK_USAGE == STD_ON)
+            if ((paramsPtr->vcConfigPtr[vcId] != (Csi2_VCParamsType*)NULL_PTR) &&
+                (paramsPtr->vcConfigPtr[vcId]->bufNumLinesTrigger != 0u))
+            {   /* the lines watermark is updated at LINEDONE                                                        */
+                setLDevt = 1u;
+            }
+#endif
         }
         /* enable the "line done" interrupt, for internal purposes at least                                          */
         if (
@@ -770,6 +785,28 @@ Csi2_SetupUIrq(const Csi2_UnitIdType iUnit, volatile GENERIC_CSI2_Type *regsPtr,
 /* Csi2InitUIrq *************************/
 
 
+#if (CSI2_VC_RECONFIG_USAGE == STD_ON)
+/*================================================================================================*/
+/*
+ * @brief       Update the VCs interrupts enablement, after a VCs reconfiguration
+ * @details     The interrupt handlers and the callbacks are kept, only the VCs events and Rx errors
+ *              enablement is programmed again.
+ *
+ * @param[in]   iUnit     - unit ID, RSDK_CSI2_UNIT_0 ... MAX
+ * @param[in]   regsPtr   - pointer to unit registry
+ * @param[in]   paramsPtr - pointer to CSI2 unit new parameters
+ *
+ */
+void Csi2_ReconfigUIrq(const Csi2_UnitIdType iUnit, volatile GENERIC_CSI2_Type *regsPtr,
+                          const Csi2_SetupParamsType *paramsPtr)
+{
+    Csi2_InitEventIrq(iUnit, regsPtr, paramsPtr);
+    Csi2_InitRxIrq(regsPtr, paramsPtr);
+}
+/* Csi2_ReconfigUIrq *************************/
+#endif
+
+
 #ifdef __cplusplus
 }
 #endif
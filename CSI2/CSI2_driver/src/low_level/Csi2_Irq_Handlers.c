@@ -26,9 +26,13 @@ extern "C"{
 #include "rsdk_version.h"
 #if defined(linux)
     #include <linux/string.h>
+    #include <linux/hrtimer.h>
 #else
     #include "string.h"
 #endif
+#if (CSI2_STAT_NEON_USAGE == STD_ON)
+    #include <arm_neon.h>
+#endif
 
 
 /*==================================================================================================
@@ -81,11 +85,25 @@ typedef struct __attribute__((__packed__)) {
 #define CSI2_STAT_CHANNEL_SUM_ADJUST    0x1         /* divider for the channel samples sum                          */
 #define CSI2_VC_CFG_OFFSET              0x10u       /* offset between two similar VC config registry                */
 #define CSI2_OFFSET_AUTOCOMPUTE         0x7fff      /* definition for auto computing offset for incoming data       */
+#define CSI2_DC_EMA_FRAC_BITS           8u          /* fractional bits of the EMA estimator state                   */
+#define CSI2_STAT_NEON_CHANNELS         4u          /* channels of the NEON statistics batch, CSI2_MAX_CHANNEL      */
+#if (CSI2_STAT_NEON_USAGE == STD_ON) && (CSI2_STAT_CHANNEL_SUM_ADJUST != 1)
+    #error "CSI2 : the NEON statistics batch can't divide the channel samples sum"
+#endif
 
 
 /*==================================================================================================
 *                                         LOCAL CONSTANTS
 ==================================================================================================*/
+#if (CSI2_STAT_NEON_USAGE == STD_ON)
+/* NEON statistics batch : the bytes gathered from the 4 packed Csi2_ChChirpStatType records of a line (40 bytes)   */
+static const uint8 gsCsi2StatNeonSumIdx[16] =       /* channelSumScr, 4 x 32 bits                                   */
+    {0u, 1u, 2u, 3u, 10u, 11u, 12u, 13u, 20u, 21u, 22u, 23u, 30u, 31u, 32u, 33u};
+static const uint8 gsCsi2StatNeonMinMaxIdx[16] =    /* channelMin, then channelMax, 8 x 16 bits                     */
+    {4u, 5u, 14u, 15u, 24u, 25u, 34u, 35u, 6u, 7u, 16u, 17u, 26u, 27u, 36u, 37u};
+static const uint8 gsCsi2StatNeonToggleIdx[8] =     /* channelBitToggle, 4 x 16 bits                                */
+    {8u, 9u, 18u, 19u, 28u, 29u, 38u, 39u};
+#endif
 
 /*==================================================================================================
 *                                        GLOBAL CONSTANTS
@@ -98,6 +116,18 @@ typedef struct __attribute__((__packed__)) {
 /*==================================================================================================
 *                                    LOCAL FUNCTION PROTOTYPES
 ==================================================================================================*/
+#if (CSI2_DEFERRED_STATISTICS == STD_ON)
+static void Csi2_DeferredStatisticsVC(const Csi2_UnitIdType iUnit, const uint32 vcId);
+#if (CSI2_AUTO_DC_COMPENSATION == STD_ON)
+static void Csi2_DcOffsetsFrameStart(const Csi2_UnitIdType iUnit, const uint32 vcId);
+#endif
+#endif
+#if (CSI2_TELEMETRY_USAGE == STD_ON)
+static inline void Csi2_TelemetryUpdate(const Csi2_UnitIdType iUnit, const uint32 irqId);
+static inline void Csi2_TelemetryUpdated(const Csi2_UnitIdType iUnit, const uint32 irqId);
+static void Csi2_TelemetryFrame(Csi2_VCTelemetryType *pTel, const Csi2_VCDriverStateType *pVCState,
+                                const uint32 evtMask, const uint64 timeNow);
+#endif
 
 /*==================================================================================================
 *                                         LOCAL VARIABLES
@@ -111,6 +141,24 @@ typedef struct __attribute__((__packed__)) {
 /*==================================================================================================
 *                                         LOCAL FUNCTIONS
 ==================================================================================================*/
+#if (CSI2_FRAME_RING_USAGE == STD_ON)
+/*================================================================================================*/
+/*
+ * @brief       Get the start address of a frame ring buffer.
+ *
+ * @param[in]   pVCparams   - pointer to the VC parameters
+ * @param[in]   bufIdx      - the buffer index in the ring, 0 is the VC buffer (bufDataPtr)
+ *
+ * @return      void*       - the buffer start address
+ *
+ */
+static void *Csi2_GetFrameBufPtr(const Csi2_VCParamsType *pVCparams, const uint8 bufIdx)
+{
+    return (bufIdx == 0u) ? pVCparams->bufDataPtr : pVCparams->nextBufDataPtr[bufIdx - 1u];
+}
+/* Csi2_GetFrameBufPtr *************************/
+
+#endif  /* #if (CSI2_FRAME_RING_USAGE == STD_ON)            */
 /*================================================================================================*/
 /*
  * @brief       Process Rx interrupt at VC level.
@@ -181,16 +229,18 @@ static void Csi2_IrqHandlerRxErrVC(const uint32 vcId, const uint32 regStat, Csi2
  *
  * @param[in]   pRegs
  *              vcId
+ * @param[out]  pFsMask     - mask of the VCs which reported FrameStart
  * @return      -   a 32 bits value, containing all vcId with FrameEnd reported
  *
  */
 static uint32 Csi2_ProcessVcEvents(Csi2_DriverParamsType *pDriverState, Csi2_ErrorReportType *errorS,
-                                    const Csi2_UnitIdType iUnit, uint32 *pCallState, uint32 *pOptFlag)
+                                    const Csi2_UnitIdType iUnit, uint32 *pCallState, uint32 *pOptFlag,
+                                    uint32 *pFsMask)
 {
     uint32                              vcId;                           /* virtual channel ID                       */
     uint32                              toCall, maskW, maskEv, optionalFlags;
     static uint32                       regStat;
-    uint32                              vcIdFe;
+    uint32                              vcIdFe, fsMask;
     volatile GENERIC_CSI2_Type          *pRegs;                         /* registry pointer                         */
     const Csi2_VCDriverStateType        *pVCDriverState;
 
@@ -198,6 +248,7 @@ static uint32 Csi2_ProcessVcEvents(Csi2_DriverParamsType *pDriverState, Csi2_Err
     pRegs = gMipiCsi2RegsPtr[(uint8)iUnit];                               /* get the  registry pointer for the unit   */
     optionalFlags = 0;                                                  /* no optional flags                        */
     toCall = 0;
+    fsMask = 0u;
     regStat = pRegs->RX_VCINTRS;
     pRegs->RX_VCINTRS = regStat;                                        /* clear the bits                           */
     vcIdFe = (uint32)CSI2_MAX_VC;                                       /* FE event unknown                         */
@@ -212,15 +263,44 @@ static uint32 Csi2_ProcessVcEvents(Csi2_DriverParamsType *pDriverState, Csi2_Err
             if (maskW != 0u)
             {  /* there is at least one signal set                                                                  */
                 optionalFlags += maskW;                                 /* set the optionalFlags                    */
+#if (CSI2_TELEMETRY_USAGE == STD_ON)
+                Csi2_TelemetryUpdate(iUnit, (uint32)RSDK_CSI2_EVENTS_IRQ_ID);
+                Csi2_TelemetryFrame(&gCsi2Telemetry[(uint8)iUnit].vc[vcId], pVCDriverState, maskW,
+                                    pDriverState->timeIrq);
+                Csi2_TelemetryUpdated(iUnit, (uint32)RSDK_CSI2_EVENTS_IRQ_ID);
+#endif
                 if((maskW & CSI2_EVT_FRAME_START) != 0u)
                 {
                     /* reset the current received line in buffer counter                                            */
                     pDriverState->workingParamVC[vcId].lastReceivedChirpLine = CSI2_CHIRP_NOT_STARTED;
+                    fsMask |= ((uint32)1u << vcId);
+#if (CSI2_TIMESTAMP_USAGE == STD_ON)
+                    pDriverState->workingParamVC[vcId].timeFrameStart = pDriverState->timeIrq;
+#endif
+#if (CSI2_LINE_WATERMARK_USAGE == STD_ON)
+                    if (pDriverState->pLineWm != NULL_PTR)
+                    {   /* the new frame starts with the next committed line                                        */
+                        pDriverState->pLineWm[vcId].frameFirstLine = pDriverState->pLineWm[vcId].linesCommitted;
+                        pDriverState->pLineWm[vcId].frameSeq++;
+                    }
+#endif
+#if (CSI2_DEFERRED_STATISTICS == STD_ON)
+                    if (pVCDriverState->statFeLines != 0u)
+                    {   /* the previous frame statistics must be done before the new frame                              */
+                        Csi2_DeferredStatisticsVC(iUnit, vcId);
+                    }
+#if (CSI2_AUTO_DC_COMPENSATION == STD_ON)
+                    Csi2_DcOffsetsFrameStart(iUnit, vcId);
+#endif
+#endif
                 }
                 if((maskW & CSI2_EVT_FRAME_END) != 0u)
                 {
                     /* reset the current received line in buffer counter                                            */
                     pDriverState->workingParamVC[vcId].lastReceivedChirpLine = CSI2_CHIRP_NOT_STARTED;
+#if (CSI2_TIMESTAMP_USAGE == STD_ON)
+                    pDriverState->workingParamVC[vcId].timeFrameEnd = pDriverState->timeIrq;
+#endif
                     vcIdFe <<= CSI2_VC_NUM_TOTALBITS;
                     vcIdFe += vcId;                                     /* keep the VC id which generated the event */
                 }
@@ -244,33 +324,524 @@ static uint32 Csi2_ProcessVcEvents(Csi2_DriverParamsType *pDriverState, Csi2_Err
     }  /* for(vcId = (uint32)RSDK_CSI2_VC_0;...   */
     *pCallState |= toCall;
     *pOptFlag |= optionalFlags;
+    *pFsMask = fsMask;
     return vcIdFe;
 }
 /* Csi2_ProcessVcEvents *************************/
 
+#if (CSI2_TIMESTAMP_USAGE == STD_ON)
+/*================================================================================================*/
+/*
+ * @brief       Add the frame counters and the events timestamps of all VCs to the report.
+ *
+ * @param[in]   iUnit       - unit id, CSI2_UNIT_0 ... MAX
+ * @param[in]   pErrorS     - pointer to the report structure
+ *
+ */
+static void Csi2_ReportTimestamps(const Csi2_UnitIdType iUnit, Csi2_ErrorReportType *pErrorS)
+{
+    uint32                              vcId;
+    const Csi2_VCDriverStateType        *pVCDriverState;
+
+    pVCDriverState = gCsi2Settings[(uint8)iUnit].workingParamVC;
+    for (vcId = (uint32)CSI2_VC_0; vcId < (uint32)CSI2_MAX_VC; vcId++)
+    {
+#if (CSI2_FRAMES_COUNTER_USED == STD_ON)
+        pErrorS->frameCounter[vcId] = gsCsi2FramesCounter[(uint8)iUnit][vcId];
+#endif
+        pErrorS->timeFrameStart[vcId] = pVCDriverState->timeFrameStart;
+        pErrorS->timeFrameEnd[vcId] = pVCDriverState->timeFrameEnd;
+        pErrorS->timeLineDone[vcId] = pVCDriverState->timeLineDone;
+        pVCDriverState++;                                               /* move to next VC driver state             */
+    }
+}
+/* Csi2_ReportTimestamps *************************/
+#endif  /* #if (CSI2_TIMESTAMP_USAGE == STD_ON)             */
+
+#if (CSI2_TELEMETRY_USAGE == STD_ON)
+/*================================================================================================*/
+/*
+ * @brief       Mark the start/end of a telemetry update by an interrupt handler (the part's only writer).
+ * @details     The sequence counter is odd during the update, so Csi2_GetTelemetry retries an overlapping copy.
+ *
+ */
+static inline void Csi2_TelemetryUpdate(const Csi2_UnitIdType iUnit, const uint32 irqId)
+{
+    gCsi2TelemetrySeq[(uint8)iUnit][irqId]++;
+    CSI2_WRITE_BARRIER();
+}
+
+static inline void Csi2_TelemetryUpdated(const Csi2_UnitIdType iUnit, const uint32 irqId)
+{
+    CSI2_WRITE_BARRIER();
+    gCsi2TelemetrySeq[(uint8)iUnit][irqId]++;
+}
+/* Csi2_TelemetryUpdate *************************/
+
+/*================================================================================================*/
+/*
+ * @brief       Update the VC frame telemetry, before the new FrameStart/FrameEnd timestamps are saved.
+ * @details     A FrameEnd is accounted only if a FrameStart was received after the previous FrameEnd, so a FrameEnd
+ *              reported in the same irq with the next FrameStart is still measured against the right FrameStart.
+ *
+ * @param[in]   pTel        - pointer to the VC telemetry
+ * @param[in]   pVCState    - pointer to the VC driver state
+ * @param[in]   evtMask     - the VC events (CSI2_EVT_FRAME_START/CSI2_EVT_FRAME_END)
+ * @param[in]   timeNow     - the irq timestamp
+ *
+ */
+static void Csi2_TelemetryFrame(Csi2_VCTelemetryType *pTel, const Csi2_VCDriverStateType *pVCState,
+                                const uint32 evtMask, const uint64 timeNow)
+{
+    uint64                              delta;
+
+    if (((evtMask & (uint32)CSI2_EVT_FRAME_END) != 0u) && (pVCState->timeFrameStart > pVCState->timeFrameEnd))
+    {   /* FrameStart -> FrameEnd duration                                                                          */
+        delta = timeNow - pVCState->timeFrameStart;
+        pTel->frameTimeMin = ((pTel->framesNum == 0u) || (delta < pTel->frameTimeMin)) ? delta : pTel->frameTimeMin;
+        pTel->frameTimeMax = (delta > pTel->frameTimeMax) ? delta : pTel->frameTimeMax;
+        pTel->frameTimeSum += delta;
+        pTel->framesNum++;
+    }
+    if (((evtMask & (uint32)CSI2_EVT_FRAME_START) != 0u) && (pVCState->timeFrameStart != 0u))
+    {   /* FrameStart -> FrameStart period                                                                          */
+        delta = timeNow - pVCState->timeFrameStart;
+        pTel->periodMin = ((pTel->periodsNum == 0u) || (delta < pTel->periodMin)) ? delta : pTel->periodMin;
+        pTel->periodMax = (delta > pTel->periodMax) ? delta : pTel->periodMax;
+        pTel->periodSum += delta;
+        pTel->periodsNum++;
+    }
+}
+/* Csi2_TelemetryFrame *************************/
+
+/*================================================================================================*/
+/*
+ * @brief       Update the interrupt handler telemetry, at the handler end.
+ *
+ * @param[in]   iUnit       - unit id, CSI2_UNIT_0 ... MAX
+ * @param[in]   irqId       - the handler irq ID, RSDK_CSI2_RX_ERR_IRQ_ID ... RSDK_CSI2_EVENTS_IRQ_ID
+ * @param[in]   timeStart   - the timestamp at handler entry
+ * @param[in]   pErrorS     - pointer to the reported structure
+ *
+ */
+static void Csi2_TelemetryIrq(const Csi2_UnitIdType iUnit, const uint32 irqId, const uint64 timeStart,
+                              const Csi2_ErrorReportType *pErrorS)
+{
+    uint64                              delta;
+    uint32                              mask, i;
+    Csi2_IrqTelemetryType               *pTel;
+
+    pTel = &gCsi2Telemetry[(uint8)iUnit].irq[irqId];
+    delta = CSI2_GET_TIMESTAMP() - timeStart;
+    Csi2_TelemetryUpdate(iUnit, irqId);
+    pTel->timeMax = (delta > pTel->timeMax) ? delta : pTel->timeMax;
+    pTel->timeSum += delta;
+    pTel->callsNum++;
+    mask = pErrorS->errMaskU;
+    for (i = 0u; mask != 0u; i++)
+    {   /* count each reported error class                                                                          */
+        pTel->errCount[i] += (mask & 1u);
+        mask >>= 1u;
+    }
+    Csi2_TelemetryUpdated(iUnit, irqId);
+}
+/* Csi2_TelemetryIrq *************************/
+#endif  /* #if (CSI2_TELEMETRY_USAGE == STD_ON)             */
+
+#if (CSI2_LINE_EVT_MODERATION == STD_ON)
+/*================================================================================================*/
+/*
+ * @brief       Decide if a LINEDONE trigger must be reported now or coalesced with the next ones.
+ * @details     The triggers are accumulated in a pending lines range, which is reported when it reaches the
+ *              adaptive lines budget or when its first trigger is older than the latency budget.
+ *              Without moderation each trigger is reported, with its own range. A new held range arms the flush
+ *              timer (Linux), which reports it at the latency deadline if no other trigger or FrameEnd comes; for
+ *              bare-metal the platform calls Csi2_LineEvtFlush periodically.
+ *
+ * @param[in]   iUnit       - unit id, CSI2_UNIT_0 ... MAX
+ * @param[in]   pVCState    - pointer to the VC driver state
+ * @param[in]   line        - the line which generated the trigger, 1 ... expectedNumLines
+ * @param[in]   timeIrq     - the irq timestamp
+ *
+ * @return      the first line of the range to be reported, 0 if the trigger is only accumulated
+ *
+ */
+static uint16 Csi2_LineEvtModerate(const Csi2_UnitIdType iUnit, Csi2_VCDriverStateType *pVCState,
+                                   const uint32 line, const uint64 timeIrq)
+{
+    uint32                              trigger, firstLine, opened;
+    uint64                              sample;
+#ifdef linux
+    uint64_t                            flags;
+    struct hrtimer                      *pTimer;
+    uint32                              latencyUs;
+
+    (void)OAL_LockIRQSpin(&gpRsdkCsi2Device[(uint8)iUnit]->lineEvtLock, &flags);
+#else
+    (void)iUnit;
+#endif
+    opened = 0u;
+    trigger = (uint32)pVCState->vcParamsPtr->bufNumLinesTrigger;
+    if ((pVCState->lineEvtFirst == 0u) || (line <= trigger))
+    {   /* nothing pending or a new frame without the previous FrameEnd, open a new range                           */
+        pVCState->lineEvtFirst = (uint16)(line + 1u - trigger);
+        pVCState->lineEvtTimeFirst = timeIrq;
+        opened = 1u;
+    }
+    pVCState->lineEvtLast = (uint16)line;
+    if (pVCState->lineEvtTimeLast != 0u)
+    {   /* filter the trigger period, 1/8 weight for the new sample                                                 */
+        sample = timeIrq - pVCState->lineEvtTimeLast;
+        if (pVCState->lineEvtPeriod == 0u)
+        {
+            pVCState->lineEvtPeriod = (uint32)sample;
+        }
+        else
+        {
+            pVCState->lineEvtPeriod = (uint32)((sint64)pVCState->lineEvtPeriod +
+                                        (((sint64)sample - (sint64)pVCState->lineEvtPeriod) / 8));
+        }
+    }
+    pVCState->lineEvtTimeLast = timeIrq;
+    firstLine = (uint32)pVCState->lineEvtFirst;
+    if ((pVCState->vcParamsPtr->lineEvtMaxLines == 0u) ||
+        ((line + 1u - firstLine) >= (uint32)pVCState->lineEvtBudget) ||
+        ((timeIrq - pVCState->lineEvtTimeFirst) >= pVCState->lineEvtLatency))
+    {   /* budget reached, the range is reported                                                                    */
+        pVCState->lineEvtFirst = 0u;
+        opened = 0u;
+    }
+    else
+    {
+        firstLine = 0u;
+    }
+#ifdef linux
+    (void)OAL_UnlockIRQSpin(&gpRsdkCsi2Device[(uint8)iUnit]->lineEvtLock, &flags);
+    latencyUs = pVCState->vcParamsPtr->lineEvtMaxLatencyUs;
+    if ((opened != 0u) && (latencyUs != 0u))
+    {   /* a range is held : the flush timer must expire at its deadline, at the latest                             */
+        pTimer = &gpRsdkCsi2Device[(uint8)iUnit]->lineEvtTimer;
+        if ((hrtimer_is_queued(pTimer) == 0) || (ktime_to_us(hrtimer_get_remaining(pTimer)) > (s64)latencyUs))
+        {
+            hrtimer_start(pTimer, us_to_ktime(latencyUs), HRTIMER_MODE_REL);
+        }
+    }
+#else
+    (void)opened;
+#endif
+    return (uint16)firstLine;
+}
+/* Csi2_LineEvtModerate *************************/
+
+/*================================================================================================*/
+/*
+ * @brief       LINEDONE moderation at FrameEnd : report the pending lines range and adapt the lines budget.
+ * @details     The lines budget is the number of lines received in the latency budget at the observed line rate,
+ *              rounded down to full triggers and limited to lineEvtMaxLines.
+ *
+ * @param[in]   iUnit       - unit id, CSI2_UNIT_0 ... MAX
+ * @param[in]   pVCState    - pointer to the VC driver state
+ * @param[in]   vcId        - VC id, CSI2_VC_0 ... MAX
+ * @param[in]   pErrorS     - pointer to the report structure
+ *
+ * @return      1 if the pending range was added to the report, 0 otherwise
+ *
+ */
+static uint32 Csi2_LineEvtFrameEnd(const Csi2_UnitIdType iUnit, Csi2_VCDriverStateType *pVCState,
+                                   const uint32 vcId, Csi2_ErrorReportType *pErrorS)
+{
+    uint32                              toCall, trigger;
+    uint64                              budget;
+#ifdef linux
+    uint64_t                            flags;
+
+    (void)OAL_LockIRQSpin(&gpRsdkCsi2Device[(uint8)iUnit]->lineEvtLock, &flags);
+#else
+    (void)iUnit;
+#endif
+
+    toCall = 0u;
+    trigger = (uint32)pVCState->vcParamsPtr->bufNumLinesTrigger;
+    if ((pVCState->lineEvtFirst != 0u) && ((pVCState->eventsMask & (uint32)CSI2_EVT_LINE_END) != 0u))
+    {   /* the last lines of the frame are reported together with the FrameEnd                                      */
+        pErrorS->evtMaskVC[vcId] |= (uint8)CSI2_EVT_LINE_END;
+        pErrorS->lineFirst[vcId] = pVCState->lineEvtFirst;
+        pErrorS->lineLast[vcId] = pVCState->lineEvtLast;
+        toCall++;
+    }
+    pVCState->lineEvtFirst = 0u;
+    if ((trigger != 0u) && (pVCState->vcParamsPtr->lineEvtMaxLines != 0u))
+    {
+        budget = (uint64)pVCState->vcParamsPtr->lineEvtMaxLines / trigger;   /* maximum triggers               */
+        if ((pVCState->lineEvtPeriod != 0u) && (pVCState->vcParamsPtr->lineEvtMaxLatencyUs != 0u) &&
+            ((pVCState->lineEvtLatency / pVCState->lineEvtPeriod) < budget))
+        {   /* the triggers in the latency budget, at the observed rate                                             */
+            budget = pVCState->lineEvtLatency / pVCState->lineEvtPeriod;
+        }
+        if (budget == 0u)
+        {
+            budget = 1u;                                /* at least one trigger                                     */
+        }
+        pVCState->lineEvtBudget = (uint16)(budget * trigger);
+    }
+    pVCState->lineEvtTimeLast = 0u;                     /* the gap between frames is not a line period              */
+#ifdef linux
+    (void)OAL_UnlockIRQSpin(&gpRsdkCsi2Device[(uint8)iUnit]->lineEvtLock, &flags);
+#endif
+    return toCall;
+}
+/* Csi2_LineEvtFrameEnd *************************/
+
+/*================================================================================================*/
+/*
+ * @brief       Report the held LINEDONE ranges which reached their latency deadline.
+ * @details     Called by the flush timer, outside the events irq, so a range held by the moderation is not delayed
+ *              beyond its latency budget when no other LINEDONE or FrameEnd comes. For bare-metal the platform
+ *              must call it from a periodic timer, at the unit events irq priority.
+ *
+ * @param[in]   iUnit       - unit id, CSI2_UNIT_0 ... MAX
+ *
+ * @return      the microseconds to the next deadline of a still held range, 0 if nothing is held
+ *
+ */
+uint32 Csi2_LineEvtFlush(const Csi2_UnitIdType iUnit)
+{
+    Csi2_ErrorReportType                errorS = {0};       /* report for the flushed ranges                        */
+    Csi2_DriverParamsType               *pDriverState;
+    Csi2_VCDriverStateType              *pVCState;
+    uint32                              vcId, toCall, held;
+    uint64                              now, age, nextTicks, freq;
+#ifdef linux
+    uint64_t                            flags;
+#endif
+
+    toCall = 0u;
+    held = 0u;
+    nextTicks = 0u;
+    pDriverState = &gCsi2Settings[(uint8)iUnit];
+    now = CSI2_GET_TIMESTAMP();
+#ifdef linux
+    (void)OAL_LockIRQSpin(&gpRsdkCsi2Device[(uint8)iUnit]->lineEvtLock, &flags);
+#endif
+    for (vcId = (uint32)CSI2_VC_0; vcId < (uint32)CSI2_MAX_VC; vcId++)
+    {
+        pVCState = &pDriverState->workingParamVC[vcId];
+        if ((pVCState->lineEvtFirst != 0u) && (pVCState->vcParamsPtr != NULL) &&
+            (pVCState->vcParamsPtr->lineEvtMaxLatencyUs != 0u))
+        {
+            age = now - pVCState->lineEvtTimeFirst;
+            if (age >= pVCState->lineEvtLatency)
+            {   /* deadline reached, the range is reported                                                          */
+                if ((pVCState->eventsMask & (uint32)CSI2_EVT_LINE_END) != 0u)
+                {
+                    errorS.evtMaskVC[vcId] |= (uint8)CSI2_EVT_LINE_END;
+                    errorS.lineFirst[vcId] = pVCState->lineEvtFirst;
+                    errorS.lineLast[vcId] = pVCState->lineEvtLast;
+                    toCall = 1u;
+                }
+                pVCState->lineEvtFirst = 0u;
+            }
+            else if ((held == 0u) || ((pVCState->lineEvtLatency - age) < nextTicks))
+            {   /* the nearest deadline of the ranges still held                                                    */
+                nextTicks = pVCState->lineEvtLatency - age;
+                held = 1u;
+            }
+            else
+            {
+                ;   /* a nearer deadline is already kept                                                            */
+            }
+        }
+    }
+#ifdef linux
+    (void)OAL_UnlockIRQSpin(&gpRsdkCsi2Device[(uint8)iUnit]->lineEvtLock, &flags);
+#endif
+    if (toCall != 0u)
+    {
+        errorS.unitId = (uint8)iUnit;
+        Csi2_ReportTimestamps(iUnit, &errorS);
+        if (pDriverState->pCallback[RSDK_CSI2_EVENTS_IRQ_ID] != NULL)
+        {
+            pDriverState->pCallback[RSDK_CSI2_EVENTS_IRQ_ID](&errorS);
+        }
+        else
+        {
+            pDriverState->pCallback[RSDK_CSI2_RX_ERR_IRQ_ID](&errorS);
+        }
+    }
+    if (held != 0u)
+    {
+        freq = CSI2_GET_TIMESTAMP_FREQ();
+        nextTicks = (freq != 0u) ? (((nextTicks * 1000000u) / freq) + 1u) : 1u;
+        held = (nextTicks > 0xFFFFFFFFu) ? 0xFFFFFFFFu : (uint32)nextTicks;
+    }
+    return held;
+}
+/* Csi2_LineEvtFlush *************************/
+#endif  /* #if (CSI2_LINE_EVT_MODERATION == STD_ON)          */
+
+#if (CSI2_LINE_WATERMARK_USAGE == STD_ON)
+/*================================================================================================*/
+/*
+ * @brief       Commit a new line in the VC watermark, check for consumer overrun and wake up the line waiters.
+ * @details     The overrun is reported only once, until the consumer is again inside the buffer.
+ *
+ * @param[in]   iUnit       - unit id, CSI2_UNIT_0 ... MAX
+ * @param[in]   vcId        - VC id, CSI2_VC_0 ... MAX
+ * @param[in]   pVCState    - pointer to the VC driver state
+ * @param[in]   pErrorS     - pointer to the report structure
+ *
+ * @return      1 if a consumer overrun was added to the report, 0 otherwise
+ *
+ */
+static uint32 Csi2_LineWmCommit(const Csi2_UnitIdType iUnit, const uint32 vcId, Csi2_VCDriverStateType *pVCState,
+                                Csi2_ErrorReportType *pErrorS)
+{
+    uint32                              toCall, committed;
+    Csi2_LineWatermarkType              *pWm;
+
+    toCall = 0u;
+    pWm = &gCsi2Settings[(uint8)iUnit].pLineWm[vcId];
+    committed = pWm->linesCommitted + 1u;
+    pWm->linesCommitted = committed;
+    if ((pWm->consumerOn != 0u) &&
+        ((committed - pWm->linesConsumed) > (uint32)pVCState->vcParamsPtr->bufNumLines))
+    {   /* the line just written replaced a line not consumed yet                                                   */
+        if (pVCState->lineWmOverrun == 0u)
+        {
+            pVCState->lineWmOverrun = 1u;
+            pWm->overruns++;
+            pErrorS->errMaskVC[vcId] |= (uint32)CSI2_ERR_CONSUMER_OVERRUN;
+            pErrorS->errMaskU |= (uint32)CSI2_ERR_CONSUMER_OVERRUN;
+            toCall++;
+        }
+    }
+    else
+    {
+        pVCState->lineWmOverrun = 0u;
+    }
+#ifdef linux
+    smp_mb();   /* the committed line is seen by a registering waiter, or its registration is seen here             */
+#endif
+    if ((pVCState->lineWaitFor != 0u) && ((sint32)(committed - pVCState->lineWaitFor) >= 0))
+    {   /* the waited line was received; all the waiters are woken up and register again their lines               */
+        pVCState->lineWaitFor = 0u;
+#ifdef linux
+        (void)OAL_WakeUpInterruptible(&gpRsdkCsi2Device[(uint8)iUnit]->lineWaitQ);
+#endif
+    }
+    return toCall;
+}
+/* Csi2_LineWmCommit *************************/
+#endif  /* #if (CSI2_LINE_WATERMARK_USAGE == STD_ON)         */
+
 #if (CSI2_STATISTIC_DATA_USAGE == STD_ON)
+#if (CSI2_AUTO_DC_COMPENSATION == STD_ON)
 /*================================================================================================*/
 /*
- * @brief       VC FrameEnd process.
- * @details     Process a Frame End signal for the VC : do the VC general statistics.
- *              Return the status of the bit toggle at VC level and next line not aligned.
+ * @brief       Shift right a signed value, rounding toward 0 as the integer division.
  *
- * @param[in]   pRegs
- *              vcId
- * @return      -   0 if no problems
- *                  bits not toggled if necessary and/or 1 on MSbit if NEXTLINE is incorrect
  */
-static uint32 Csi2_ProcessChannelFrameEnd(volatile GENERIC_CSI2_Type *pRegs, const uint8 vcId,
-                 Csi2_VCDriverStateType *pVCState, Csi2_ErrorReportType *pErrorS,Csi2_AutoDCComputeTimeType statFlag)
+static sint64 Csi2_DcShift(const sint64 val, const uint32 shift)
 {
-    uint32              idChannel, numChannel, rez;
-    uint16              fToggle, iToggle;
+    return (val >= 0) ? (sint64)((uint64)val >> shift) : -(sint64)((uint64)(-val) >> shift);
+}
+/* Csi2_DcShift *************************/
+
+/*================================================================================================*/
+/*
+ * @brief       Divide a signed sum by the reciprocal of the divisor (Q CSI2_DC_RECIP_SHIFT), rounding toward 0.
+ * @details     The reciprocal is rounded up, so the quotient is the exact one or one more; the correction step
+ *              makes the result bit-identical to sum / div.
+ *
+ */
+static sint64 Csi2_DcMulRecip(const sint64 sum, const uint64 recip, const uint64 div)
+{
+    uint64  absSum = (sum >= 0) ? (uint64)sum : (uint64)(-sum);
+    uint64  quot = (absSum * recip) >> CSI2_DC_RECIP_SHIFT;
+
+    if ((quot * div) > absSum)
+    {
+        quot--;                                     /* the reciprocal rounding error                    */
+    }
+    return (sum >= 0) ? (sint64)quot : -(sint64)quot;
+}
+/* Csi2_DcMulRecip *************************/
+
+#if (CSI2_DC_ESTIMATOR_USAGE == STD_ON)
+/*================================================================================================*/
+/*
+ * @brief       Apply the VC DC estimator to the frame mean of a channel.
+ * @details     The estimator state is initialized by the first frame mean after setup; the window position is
+ *              moved by the caller, after all the channels.
+ *
+ * @param[in]   pVCState    - pointer to the VC driver state
+ * @param[in]   idChannel   - the channel
+ * @param[in]   dcFrame     - the frame mean of the channel
+ *
+ * @return      the estimated DC offset, before the register adjust
+ *
+ */
+static sint64 Csi2_DcEstimate(Csi2_VCDriverStateType *pVCState, const uint32 idChannel, const sint64 dcFrame)
+{
+    Csi2_ChFrameStatType    *pStat = &pVCState->statDC[idChannel];
+    sint64                  dcRez;
+    uint32                  i;
+
+    switch (pVCState->dcEstimator)
+    {
+        case (uint8)CSI2_DC_EST_EMA:
+            if (pVCState->dcEstInit == 0u)
+            {
+                pStat->dcEst = (sint32)(dcFrame * ((sint64)1 << CSI2_DC_EMA_FRAC_BITS));
+            }
+            else
+            {   /* est += (mean - est) / 2^k                                                                        */
+                pStat->dcEst += (sint32)Csi2_DcShift((dcFrame * ((sint64)1 << CSI2_DC_EMA_FRAC_BITS)) -
+                                                     (sint64)pStat->dcEst, (uint32)pVCState->dcEstParam);
+            }
+            dcRez = Csi2_DcShift((sint64)pStat->dcEst, CSI2_DC_EMA_FRAC_BITS);
+            break;
+        case (uint8)CSI2_DC_EST_WINDOW:
+            if (pVCState->dcEstInit == 0u)
+            {   /* the window filled with the first mean                                                            */
+                for (i = 0u; i < (uint32)pVCState->dcEstParam; i++)
+                {
+                    pStat->dcWin[i] = (sint16)dcFrame;
+                }
+                pStat->dcEst = (sint32)dcFrame * (sint32)pVCState->dcEstParam;
+            }
+            else
+            {   /* the oldest mean replaced by the new one                                                          */
+                pStat->dcEst += (sint32)dcFrame - (sint32)pStat->dcWin[pVCState->dcWinPos];
+                pStat->dcWin[pVCState->dcWinPos] = (sint16)dcFrame;
+            }
+            dcRez = Csi2_DcMulRecip((sint64)pStat->dcEst, pVCState->dcWinRecip, (uint64)pVCState->dcEstParam);
+            break;
+        default:
+            dcRez = dcFrame;                                        /* CSI2_DC_EST_FRAME                            */
+            break;
+    }
+    return dcRez;
+}
+/* Csi2_DcEstimate *************************/
+#endif  /* #if (CSI2_DC_ESTIMATOR_USAGE == STD_ON)          */
+#endif  /* #if (CSI2_AUTO_DC_COMPENSATION == STD_ON)        */
 
 #if (CSI2_AUTO_DC_COMPENSATION == STD_ON)
-    /* autoDC data processing                   */
-    uint32              dcAdj;
-    sint64              dcTmp;
-    sint64              dcDiv;
+/*================================================================================================*/
+/*
+ * @brief       Write the VC channels DC offsets to the registers.
+ * @details     The offsets are the statDC channelDC values; two channels share one register.
+ *
+ * @param[in]   pRegs       - pointer to unit registry
+ * @param[in]   vcId        - VC ID, CSI2_VC_0 ... MAX
+ * @param[in]   pVCState    - pointer to the VC driver state
+ *
+ */
+static void Csi2_WriteDcOffsets(volatile GENERIC_CSI2_Type *pRegs, const uint8 vcId,
+                                const Csi2_VCDriverStateType *pVCState)
+{
+    uint32              idChannel, numChannel, dcAdj;
     volatile uint32     *pDCReg;
 
     switch(vcId)
@@ -288,36 +859,14 @@ static uint32 Csi2_ProcessChannelFrameEnd(volatile GENERIC_CSI2_Type *pRegs, con
             pDCReg = (volatile uint32 *)(&pRegs->RX_CBUF3_CHNLOFFSET0_3);
             break;
     }
-    numChannel = (uint32)Csi2_GetChannelNum(pVCState);      /* get the real number of channels                      */
+    numChannel = (uint32)Csi2_GetChannelNum(pVCState);
     if (numChannel > (uint32)CSI2_MAX_CHANNEL)
     {
         numChannel = (uint32)CSI2_MAX_CHANNEL;
     }
-    /* divisor for channel statistic sum                                                                            */
-    dcDiv = (sint64)pVCState->vcParamsPtr->expectedNumSamples;
-    if (statFlag == CSI2_AUTODC_EVERY_LINE)
-    {
-        dcDiv *= (sint64)pVCState->vcParamsPtr->expectedNumLines;
-    }
-    else
-    {
-        if (statFlag == CSI2_AUTODC_AT_FE)
-        {
-            dcDiv *= (sint64)pVCState->vcParamsPtr->bufNumLines;
-        }
-    }
     dcAdj = 0u;
     for (idChannel = (uint32)CSI2_CHANNEL_A; idChannel < numChannel; idChannel++)
     {
-        /* change the DC offsets, according the new values                                                          */
-        if (pVCState->statDC[idChannel].reqChannelDC == (sint16)CSI2_OFFSET_AUTOCOMPUTE)
-        {                                                           /* auto compute DC offset                       */
-            dcTmp = pVCState->statDC[idChannel].channelSum / dcDiv; /* the real DC offset                           */
-            /* adjust the offset to be able to set the registry correctly                                           */
-            dcTmp = dcTmp * (sint64)CSI2_STAT_DC_OFFSET_ADJUST;
-            pVCState->statDC[idChannel].channelDC = (sint16)dcTmp;
-            pVCState->statDC[idChannel].channelSum = 0;             /* reset the channel statistic sum              */
-        }
         if ((idChannel & 1u) == 0u)
         {  /* even number => first channel processed                                                                */
             dcAdj = (((uint32)pVCState->statDC[idChannel].channelDC) & (uint32)0xffff);
@@ -333,6 +882,89 @@ static uint32 Csi2_ProcessChannelFrameEnd(volatile GENERIC_CSI2_Type *pRegs, con
             dcAdj = 0u;
         }
     }
+}
+/* Csi2_WriteDcOffsets *************************/
+#endif  /* #if (CSI2_AUTO_DC_COMPENSATION == STD_ON)        */
+
+/*================================================================================================*/
+/*
+ * @brief       VC FrameEnd process.
+ * @details     Process a Frame End signal for the VC : do the VC general statistics.
+ *              If CSI2_EVT_CHANNEL_STAT is requested, the frame channels statistics are put in the report and the
+ *              min/max are restarted for the next frame.
+ *              The new DC offsets are written to the registers here, or, for the deferred statistics, marked
+ *              pending and written by the events irq at the next FrameStart, so always between two frames.
+ *              Return the status of the bit toggle at VC level and next line not aligned.
+ *
+ * @param[in]   pRegs
+ *              vcId
+ * @return      -   0 if no problems
+ *                  bits not toggled if necessary and/or 1 on MSbit if NEXTLINE is incorrect
+ */
+static uint32 Csi2_ProcessChannelFrameEnd(volatile GENERIC_CSI2_Type *pRegs, const uint8 vcId,
+                 Csi2_VCDriverStateType *pVCState, Csi2_ErrorReportType *pErrorS,Csi2_AutoDCComputeTimeType statFlag)
+{
+    uint32              idChannel, numChannel, rez, chStatOn;
+    uint16              fToggle, iToggle;
+
+#if (CSI2_AUTO_DC_COMPENSATION == STD_ON)
+    /* autoDC data processing                   */
+    sint64              dcTmp;
+
+    numChannel = (uint32)Csi2_GetChannelNum(pVCState);      /* get the real number of channels                      */
+    if (numChannel > (uint32)CSI2_MAX_CHANNEL)
+    {
+        numChannel = (uint32)CSI2_MAX_CHANNEL;
+    }
+    /* the channel statistic sum is divided using the reciprocal prepared at setup (Csi2_SetDcEstimator)           */
+    (void)statFlag;
+    chStatOn = (uint32)pVCState->eventsMask & (uint32)CSI2_EVT_CHANNEL_STAT;
+    for (idChannel = (uint32)CSI2_CHANNEL_A; idChannel < numChannel; idChannel++)
+    {
+        if ((pVCState->statDC[idChannel].reqChannelDC == (sint16)CSI2_OFFSET_AUTOCOMPUTE) || (chStatOn != 0u))
+        {
+            dcTmp = Csi2_DcMulRecip(pVCState->statDC[idChannel].channelSum, pVCState->dcRecip,  /* the frame mean   */
+                                    pVCState->dcDiv);
+            pVCState->statDC[idChannel].channelSum = 0;             /* reset the channel statistic sum              */
+            if (chStatOn != 0u)
+            {   /* frame statistics, then restart min/max for the next frame                                        */
+                pErrorS->chStat[vcId][idChannel].chMin = pVCState->statDC[idChannel].channelMin;
+                pErrorS->chStat[vcId][idChannel].chMax = pVCState->statDC[idChannel].channelMax;
+                pErrorS->chStat[vcId][idChannel].chMean = (sint16)dcTmp;
+                pVCState->statDC[idChannel].channelMax =
+                    ((pVCState->outputDataMode & (uint32)CSI2_VC_BUF_FLIP_SIGN) == 0u) ?
+                        (sint16)CSI2_MIN_VAL_SIGNED : (sint16)CSI2_MIN_VAL_UNSIGNED;
+                pVCState->statDC[idChannel].channelMin =
+                    ((pVCState->outputDataMode & (uint32)CSI2_VC_BUF_FLIP_SIGN) == 0u) ?
+                        (sint16)CSI2_MAX_VAL_SIGNED : (sint16)CSI2_MAX_VAL_UNSIGNED;
+            }
+            /* change the DC offsets, according the new values                                                      */
+            if (pVCState->statDC[idChannel].reqChannelDC == (sint16)CSI2_OFFSET_AUTOCOMPUTE)
+            {                                                       /* auto compute DC offset                       */
+#if (CSI2_DC_ESTIMATOR_USAGE == STD_ON)
+                dcTmp = Csi2_DcEstimate(pVCState, idChannel, dcTmp);
+#endif
+                /* adjust the offset to be able to set the registry correctly                                       */
+                dcTmp = dcTmp * (sint64)CSI2_STAT_DC_OFFSET_ADJUST;
+                pVCState->statDC[idChannel].channelDC = (sint16)dcTmp;
+            }
+        }
+    }
+#if (CSI2_DEFERRED_STATISTICS == STD_ON)
+    (void)pRegs;
+    pVCState->dcPending = 1u;                                       /* written by the events irq at FrameStart      */
+#else
+    Csi2_WriteDcOffsets(pRegs, vcId, pVCState);
+#endif
+#if (CSI2_DC_ESTIMATOR_USAGE == STD_ON)
+    /* the estimators are initialized, move the window to the next oldest frame                                     */
+    pVCState->dcEstInit = 1u;
+    pVCState->dcWinPos++;
+    if (pVCState->dcWinPos >= pVCState->dcEstParam)
+    {
+        pVCState->dcWinPos = 0u;
+    }
+#endif
 #endif  /* #if (CSI2_AUTO_DC_COMPENSATION == STD_ON)        */
 
     rez = 0u;
@@ -344,94 +976,384 @@ static uint32 Csi2_ProcessChannelFrameEnd(volatile GENERIC_CSI2_Type *pRegs, con
         iToggle = (uint16)((~pVCState->statDC[idChannel].channelBitToggle) & CSI2_TOGGLE_BITS_MASK);
         fToggle |= iToggle;                                         /* reversed toggled bit status                  */
         pErrorS->notToggledBits[idChannel] = iToggle;               /* the current bits not toggled (1=not toggled) */
+        pErrorS->chStat[vcId][idChannel].chToggle = pVCState->statDC[idChannel].channelBitToggle;
         pVCState->statDC[idChannel].channelBitToggle = 0u;          /* reset toggle bits for next frame             */
     }
     if (fToggle != 0u)
     {
         rez = (uint32)CSI2_EVT_BIT_NOT_TOGGLE;                      /* report issue to caller                       */
     }
+    if (chStatOn != 0u)
+    {
+        pErrorS->evtMaskVC[vcId] |= (uint8)CSI2_EVT_CHANNEL_STAT;   /* frame statistics to be reported              */
+    }
     /* process the next line position   */
     return rez;
 }
 /* Csi2_ProcessChannelFrameEnd *************************/
 
 
+#if (CSI2_STAT_NEON_USAGE == STD_ON)
 /*================================================================================================*/
 /*
- * @brief       VC statistics process.
+ * @brief       VC statistics process with NEON, for a batch of consecutive lines with all the channels in use.
+ * @details     The 4 packed statistics records of a line are loaded without reading past them and gathered by
+ *              field with table lookups, so each line updates all the channels at once. The results are identical
+ *              with the scalar loop of Csi2_ProcessChannelStatistics.
+ *
+ * @param[in]   pStatLine   - the statistics of the first line
+ *              lineLen     - the buffer line length, in bytes
+ *              numLines    - number of lines/chirps to be processed
+ * @param[in,out] pSum, pMin, pMax, pToggle - the channels accumulators, CSI2_STAT_NEON_CHANNELS each
+ *
+ */
+static void Csi2_ProcessStatisticsNeon(const uint8 *pStatLine, const uint32 lineLen, const uint32 numLines,
+                                       sint64 *pSum, sint16 *pMin, sint16 *pMax, uint16 *pToggle)
+{
+    uint32                  iLine;
+    uint8x16x3_t            stat;
+    const uint8x16_t        sumIdx = vld1q_u8(gsCsi2StatNeonSumIdx);
+    const uint8x16_t        minMaxIdx = vld1q_u8(gsCsi2StatNeonMinMaxIdx);
+    const uint8x8_t         toggleIdx = vld1_u8(gsCsi2StatNeonToggleIdx);
+    int64x2_t               sum01, sum23;
+    int32x4_t               sum;
+    int16x8_t               minMax;
+    int16x4_t               accMin, accMax;
+    uint16x4_t              accToggle;
+
+    sum01 = vld1q_s64(&pSum[0]);
+    sum23 = vld1q_s64(&pSum[2]);
+    accMin = vld1_s16(pMin);
+    accMax = vld1_s16(pMax);
+    accToggle = vld1_u16(pToggle);
+    for (iLine = 0u; iLine < numLines; iLine++)
+    {
+        stat.val[0] = vld1q_u8(pStatLine);
+        stat.val[1] = vld1q_u8(&pStatLine[16]);
+        stat.val[2] = vcombine_u8(vld1_u8(&pStatLine[32]), vdup_n_u8(0u));
+        /* the sums are sign extended from 32 bits, as by the scalar loop (CSI2_STAT_CHANNEL_SUM_ADJUST is 1)       */
+        sum = vreinterpretq_s32_u8(vqtbl3q_u8(stat, sumIdx));
+        sum01 = vaddw_s32(sum01, vget_low_s32(sum));
+        sum23 = vaddw_high_s32(sum23, sum);
+        minMax = vreinterpretq_s16_u8(vqtbl3q_u8(stat, minMaxIdx));
+        accMin = vmin_s16(accMin, vget_low_s16(minMax));
+        accMax = vmax_s16(accMax, vget_high_s16(minMax));
+        accToggle = vorr_u16(accToggle, vreinterpret_u16_u8(vqtbl3_u8(stat, toggleIdx)));
+        pStatLine = &pStatLine[lineLen];                                            /* next line statistics         */
+    }
+    vst1q_s64(&pSum[0], sum01);
+    vst1q_s64(&pSum[2], sum23);
+    vst1_s16(pMin, accMin);
+    vst1_s16(pMax, accMax);
+    vst1_u16(pToggle, accToggle);
+}
+/* Csi2_ProcessStatisticsNeon *************************/
+#endif  /* #if (CSI2_STAT_NEON_USAGE == STD_ON)              */
+
+/*================================================================================================*/
+/*
+ * @brief       VC statistics process, for a batch of consecutive lines.
  * @details     At the end of each chirp, the VC statistics are processed.
+ *              The channel accumulators are kept locally for the whole batch and saved only once at the end, so
+ *              the inner loop is branch free (sign extension, min & max are done with selects) and reads the
+ *              statistics sequentially. The results are identical with processing the lines one by one.
+ *              With all the channels in use, the NEON batch is used where available (CSI2_STAT_NEON_USAGE).
  *
  * @param[in]   pVCState    - pointer to the unit/VC driver state
- *              crtLine     - the current line/chirp reported by the interface
+ *              firstLine   - the first line/chirp to be processed
+ *              numLines    - number of lines/chirps to be processed
  *
  */
-static void Csi2_ProcessChannelStatistics(Csi2_VCDriverStateType *pVCState, uint16 crtLine)
+static void Csi2_ProcessChannelStatistics(Csi2_VCDriverStateType *pVCState, uint16 firstLine, uint16 numLines)
 {
-    uint32                  idChannel, numChannel, statOffset;
+    uint32                  idChannel, numChannel, statOffset, iLine;
     const uint8             *pMapMem;
     const Csi2_ChChirpStatType* pStat;                          /* pointer to statistics                        */
+    uint16                  chToggle[CSI2_MAX_CHANNEL];         /* local accumulators for the batch             */
 #if (CSI2_AUTO_DC_COMPENSATION == STD_ON)
-    uint32                  sum32;
     sint64                  sumBase;
-    uint64                  sumU;
+    sint64                  chSum[CSI2_MAX_CHANNEL];
+    sint16                  chMin[CSI2_MAX_CHANNEL];
+    sint16                  chMax[CSI2_MAX_CHANNEL];
 #endif
 
     /* determine the exact position for the received statistics                                                     */
+#if (CSI2_FRAME_RING_USAGE == STD_ON)
+#ifdef linux
+    pMapMem = pVCState->pFrameVirtData[pVCState->frameBufStat];
+#else
+    pMapMem = (const uint8 *)Csi2_GetFrameBufPtr(pVCState->vcParamsPtr, pVCState->frameBufStat);
+#endif
+#else
 #ifdef linux
     pMapMem = pVCState->pVirtData;
 #else
     pMapMem = (const uint8 *)pVCState->vcParamsPtr->bufDataPtr;
 #endif
+#endif  /* #if (CSI2_FRAME_RING_USAGE == STD_ON)            */
 
     numChannel = (uint32)Csi2_GetChannelNum(
         (Csi2_VCDriverStateType *)pVCState);               /* get the real number of channels               */
-    /* the real pointer to the statistics, according the current line                                               */
-    statOffset = ((uint32)pVCState->vcParamsPtr->bufLineLen * (uint32)crtLine) +
+    /* the real offset to the statistics of the first line                                                          */
+    statOffset = ((uint32)pVCState->vcParamsPtr->bufLineLen * (uint32)firstLine) +
             (numChannel * (uint32)CSI2_BYTES_PER_SAMPLE * (uint32)pVCState->vcParamsPtr->expectedNumSamples);
-    /*
-    * @section Csi2_Irq_c_REF_3
-    * Violates MISRA C-2012 Advisory Rule 11.3,
-    * #A cast shall not be performed between a pointer to object type and a pointer to a different object type
-    * This is the only possibility to get the correct pointer to the data to be processed.
-    *
-    * @section Csi2_Irq_c_REF_4
-    * Violates MISRA C-2012 Required Rule 18.4,
-    * #The +, -, += and -= operators should not be applied to an expression of pointer type
-    * Necessary pointer operation, not possible to use normal pointer association.
-    */
-    pStat = (const Csi2_ChChirpStatType *)&pMapMem[statOffset];
-    /* analyze statistics for each channel                                                                          */
+    if (numChannel > (uint32)CSI2_MAX_CHANNEL)
+    {
+        numChannel = (uint32)CSI2_MAX_CHANNEL;
+    }
     for (idChannel = (uint32)CSI2_CHANNEL_A; idChannel < numChannel; idChannel++)
     {
 #if (CSI2_AUTO_DC_COMPENSATION == STD_ON)
-        /* total channel samples sum, without unnecessary bits
-         * little endian for ARM                                                                                    */
-        sum32 = pStat->channelSumScr;
-        sumU = (uint64)sum32;
-        if ((sumU & 0x80000000u) != 0u)
+        chSum[idChannel] = pVCState->statDC[idChannel].channelSum;
+        chMin[idChannel] = pVCState->statDC[idChannel].channelMin;
+        chMax[idChannel] = pVCState->statDC[idChannel].channelMax;
+#endif
+        chToggle[idChannel] = pVCState->statDC[idChannel].channelBitToggle;
+    }
+    iLine = 0u;
+#if (CSI2_STAT_NEON_USAGE == STD_ON)
+    if (numChannel == (uint32)CSI2_STAT_NEON_CHANNELS)
+    {   /* all the channels in use, the whole batch is vectorized                                                   */
+        Csi2_ProcessStatisticsNeon(&pMapMem[statOffset], (uint32)pVCState->vcParamsPtr->bufLineLen, (uint32)numLines,
+                                   chSum, chMin, chMax, chToggle);
+        iLine = (uint32)numLines;
+    }
+#endif
+    for (; iLine < (uint32)numLines; iLine++)
+    {
+        /*
+        * @section Csi2_Irq_c_REF_3
+        * Violates MISRA C-2012 Advisory Rule 11.3,
+        * #A cast shall not be performed between a pointer to object type and a pointer to a different object type
+        * This is the only possibility to get the correct pointer to the data to be processed.
+        *
+        * @section Csi2_Irq_c_REF_4
+        * Violates MISRA C-2012 Required Rule 18.4,
+        * #The +, -, += and -= operators should not be applied to an expression of pointer type
+        * Necessary pointer operation, not possible to use normal pointer association.
+        */
+        pStat = (const Csi2_ChChirpStatType *)&pMapMem[statOffset];
+        /* analyze statistics for each channel                                                                      */
+        for (idChannel = (uint32)CSI2_CHANNEL_A; idChannel < numChannel; idChannel++)
         {
-            sumU += 0xffffffff00000000u;
+#if (CSI2_AUTO_DC_COMPENSATION == STD_ON)
+            /* total channel samples sum, without unnecessary bits, sign extended without branch
+             * little endian for ARM                                                                                */
+            sumBase = (sint64)((uint64)pStat->channelSumScr ^ 0x80000000u) - (sint64)0x80000000;
+            chSum[idChannel] += (sumBase / (sint64)CSI2_STAT_CHANNEL_SUM_ADJUST);
+            chMin[idChannel] = (chMin[idChannel] > pStat->channelMin) ? pStat->channelMin : chMin[idChannel];
+            chMax[idChannel] = (chMax[idChannel] < pStat->channelMax) ? pStat->channelMax : chMax[idChannel];
+#endif
+            chToggle[idChannel] |= pStat->channelBitToggle;                         /* toggled bits                 */
+
+            pStat++;                                                                /* next channel statistics      */
         }
-        sumBase = (sint64)sumU;
-        pVCState->statDC[idChannel].channelSum += (sumBase / (sint64)CSI2_STAT_CHANNEL_SUM_ADJUST);
-        if (pVCState->statDC[idChannel].channelMin > pStat->channelMin)
-        {
-            pVCState->statDC[idChannel].channelMin = pStat->channelMin;             /* current min value            */
+        statOffset += (uint32)pVCState->vcParamsPtr->bufLineLen;                    /* next line statistics         */
+    }
+    /* save the accumulators                                                                                        */
+    for (idChannel = (uint32)CSI2_CHANNEL_A; idChannel < numChannel; idChannel++)
+    {
+#if (CSI2_AUTO_DC_COMPENSATION == STD_ON)
+        pVCState->statDC[idChannel].channelSum = chSum[idChannel];
+        pVCState->statDC[idChannel].channelMin = chMin[idChannel];
+        pVCState->statDC[idChannel].channelMax = chMax[idChannel];
+#endif
+        pVCState->statDC[idChannel].channelBitToggle = chToggle[idChannel];
+    }
+}
+/* Csi2_ProcessChannelStatistics *************************/
+
+#if (CSI2_DEFERRED_STATISTICS == STD_ON)
+/*================================================================================================*/
+/*
+ * @brief       Deferred statistics process for one VC.
+ * @details     Process the buffer lines latched by the events irq and, if a FrameEnd is pending, the final
+ *              statistics and the new DC offsets. The BIT_NOT_TOGGLE and CHANNEL_STAT events are reported with a
+ *              separate callback.
+ *              Called by the bottom half, or by the events irq if the next frame starts before the bottom half.
+ *
+ * @param[in]   iUnit       - unit id, CSI2_UNIT_0 ... MAX
+ * @param[in]   vcId        - VC ID, CSI2_VC_0 ... MAX
+ *
+ */
+static void Csi2_DeferredStatisticsVC(const Csi2_UnitIdType iUnit, const uint32 vcId)
+{
+    uint16                              lineHead, lineTail, feLines;
+    uint32                              regStat;
+    uint64_t                            flags;
+    Csi2_ErrorReportType                errorS = {0};           /* report for BIT_NOT_TOGGLE & CHANNEL_STAT         */
+    Csi2_DriverParamsType               *pDriverState;          /* unit driver state pointer                        */
+    Csi2_VCDriverStateType              *pVCDriverState;        /* VC driver state pointer                          */
+
+    pDriverState = &gCsi2Settings[(uint8)iUnit];
+    pVCDriverState = &pDriverState->workingParamVC[vcId];
+    regStat = 0u;
+    (void)OAL_LockIRQSpin(&gpRsdkCsi2Device[(uint8)iUnit]->statLock, &flags);
+    if (pVCDriverState->vcParamsPtr != NULL)
+    {
+        /* the lines received since the last run, only for statistics at every line; the head is a buffer line
+         * index, so it is lower than the tail if the buffer wrapped since the last run                             */
+        lineHead = pVCDriverState->statLineHead;
+        lineTail = pVCDriverState->statLineTail;
+        if (lineHead < lineTail)
+        {   /* the buffer end first, then the buffer start                                                          */
+            Csi2_ProcessChannelStatistics(pVCDriverState, lineTail,
+                                          (uint16)(pVCDriverState->vcParamsPtr->bufNumLines - lineTail));
+            lineTail = 0u;
         }
-        if (pVCState->statDC[idChannel].channelMax < pStat->channelMax)
+        if (lineHead > lineTail)
         {
-            pVCState->statDC[idChannel].channelMax = pStat->channelMax;             /* current max value            */
+            Csi2_ProcessChannelStatistics(pVCDriverState, lineTail, (uint16)(lineHead - lineTail));
         }
+        pVCDriverState->statLineTail = lineHead;
+        feLines = pVCDriverState->statFeLines;
+        if (feLines != 0u)
+        {   /* FrameEnd pending, do the final statistics and set the DC offsets                                     */
+            Csi2_ProcessChannelStatistics(pVCDriverState, 0u, feLines);
+            regStat = Csi2_ProcessChannelFrameEnd(gMipiCsi2RegsPtr[(uint8)iUnit], (uint8)vcId, pVCDriverState,
+                                                  &errorS, pDriverState->statisticsFlag);
+            pVCDriverState->statLineHead = 0u;
+            pVCDriverState->statLineTail = 0u;
+            pVCDriverState->statFeLines = 0u;
+#if (CSI2_FRAME_RING_USAGE == STD_ON)
+            pVCDriverState->frameBufStat = pVCDriverState->frameBufCrt;    /* next statistics in the new buffer */
+#endif
+        }
+    }
+    (void)OAL_UnlockIRQSpin(&gpRsdkCsi2Device[(uint8)iUnit]->statLock, &flags);
+    if (((pVCDriverState->eventsMask & (uint32)CSI2_EVT_BIT_NOT_TOGGLE) != 0u) &&
+        ((regStat & ((uint32)CSI2_EVT_BIT_NOT_TOGGLE)) != 0u))
+    {
+        errorS.evtMaskVC[vcId] |= (uint8)CSI2_EVT_BIT_NOT_TOGGLE;
+        errorS.notToggledBits[vcId] = (uint16)regStat;
+    }
+    if (errorS.evtMaskVC[vcId] != 0u)
+    {   /* BIT_NOT_TOGGLE and/or CHANNEL_STAT to be reported                                                        */
+        errorS.unitId = (uint8)iUnit;
+#if (CSI2_TIMESTAMP_USAGE == STD_ON)
+        Csi2_ReportTimestamps(iUnit, &errorS);
 #endif
-        pVCState->statDC[idChannel].channelBitToggle |= pStat->channelBitToggle;  /* toggled bits                   */
+        if(pDriverState->pCallback[RSDK_CSI2_EVENTS_IRQ_ID] != NULL)
+        {
+            pDriverState->pCallback[RSDK_CSI2_EVENTS_IRQ_ID](&errorS);
+        }
+        else
+        {
+            pDriverState->pCallback[RSDK_CSI2_RX_ERR_IRQ_ID](&errorS);
+        }
+    }
+}
+/* Csi2_DeferredStatisticsVC *************************/
 
-        pStat++;                                                                    /* next channel statistics      */
+#if (CSI2_AUTO_DC_COMPENSATION == STD_ON)
+/*================================================================================================*/
+/*
+ * @brief       Write the DC offsets computed by the bottom half, at the VC FrameStart.
+ * @details     The bottom half runs at any time in the next frame, so the offsets it computes are written only at
+ *              the following FrameStart : a frame is received with one set of offsets.
+ *
+ * @param[in]   iUnit       - unit id, CSI2_UNIT_0 ... MAX
+ * @param[in]   vcId        - VC ID, CSI2_VC_0 ... MAX
+ *
+ */
+static void Csi2_DcOffsetsFrameStart(const Csi2_UnitIdType iUnit, const uint32 vcId)
+{
+    uint64_t                            flags;
+    Csi2_VCDriverStateType              *pVCDriverState;        /* VC driver state pointer                          */
+
+    pVCDriverState = &gCsi2Settings[(uint8)iUnit].workingParamVC[vcId];
+    if (pVCDriverState->dcPending != 0u)
+    {
+        (void)OAL_LockIRQSpin(&gpRsdkCsi2Device[(uint8)iUnit]->statLock, &flags);
+        Csi2_WriteDcOffsets(gMipiCsi2RegsPtr[(uint8)iUnit], (uint8)vcId, pVCDriverState);
+        pVCDriverState->dcPending = 0u;
+        (void)OAL_UnlockIRQSpin(&gpRsdkCsi2Device[(uint8)iUnit]->statLock, &flags);
     }
 }
-/* Csi2_ProcessChannelStatistics *************************/
+/* Csi2_DcOffsetsFrameStart *************************/
+#endif  /* #if (CSI2_AUTO_DC_COMPENSATION == STD_ON)        */
+#endif  /* #if (CSI2_DEFERRED_STATISTICS == STD_ON)         */
 
 #endif  /* #if (CSI2_STATISTIC_DATA_USAGE == STD_ON)        */
 
+#if (CSI2_FRAME_RING_USAGE == STD_ON)
+/*================================================================================================*/
+/*
+ * @brief       Frame ring management at FrameEnd.
+ * @details     The just received frame is handed to the application with a CSI2_EVT_FRAME_READY event and the VC
+ *              is moved to the next free buffer of the ring; the new start address is taken by the interface at the
+ *              next FrameStart. If all the other buffers are still held by the application, the next frame is
+ *              received in the same buffer (the frame is dropped) and CSI2_ERR_FRAME_OVERRUN is reported.
+ *
+ * @param[in]   pRegs       - pointer to unit registry
+ * @param[in]   iUnit       - unit id, CSI2_UNIT_0 ... MAX
+ * @param[in]   vcId        - VC ID, CSI2_VC_0 ... MAX
+ * @param[in]   pVCState    - pointer to the VC driver state
+ * @param[in]   pErrorS     - pointer to error structure
+ *
+ * @return      uint32      - 1 if the application must be called, 0 otherwise
+ *
+ */
+static uint32 Csi2_FrameRingNext(volatile GENERIC_CSI2_Type *pRegs, const Csi2_UnitIdType iUnit, const uint32 vcId,
+                                 Csi2_VCDriverStateType *pVCState, Csi2_ErrorReportType *pErrorS)
+{
+    uint32                  rez;
+    uint8                   numBufs, crtBuf, nextBuf, i, found;
+#if (CSI2_DEFERRED_STATISTICS == STD_ON)
+    uint64_t                flags;
+#endif
+
+    rez = 0u;
+    numBufs = pVCState->vcParamsPtr->frameBufNum;
+    if (numBufs > 1u)
+    {
+        crtBuf = pVCState->frameBufCrt;
+        nextBuf = crtBuf;
+        found = 0u;
+        for (i = 1u; (i < numBufs) && (found == 0u); i++)
+        {   /* first buffer not held by the application, in ring order                                          */
+            nextBuf = (uint8)((crtBuf + i) % numBufs);
+            if (pVCState->frameBufOut[nextBuf] == pVCState->frameBufBack[nextBuf])
+            {
+                found = 1u;
+            }
+        }
+        if (found != 0u)
+        {
+            pRegs->RX[vcId].CBUF_SRTPTR = (uint32)(uintptr_t)Csi2_GetFrameBufPtr(pVCState->vcParamsPtr, nextBuf);
+            pVCState->frameBufOut[crtBuf]++;                /* the buffer is owned now by the application       */
+            pErrorS->evtMaskVC[vcId] |= (uint8)CSI2_EVT_FRAME_READY;
+            pErrorS->readyFrameBuf[vcId] = crtBuf;
+#if (CSI2_DEFERRED_STATISTICS == STD_ON)
+            (void)OAL_LockIRQSpin(&gpRsdkCsi2Device[(uint8)iUnit]->statLock, &flags);
+#else
+            (void)iUnit;
+#endif
+            pVCState->frameBufCrt = nextBuf;
+#if (CSI2_STATISTIC_DATA_USAGE == STD_ON)
+#if (CSI2_DEFERRED_STATISTICS == STD_ON)
+            if (pVCState->statFeLines == 0u)
+#endif
+            {   /* if the FrameEnd statistics are pending, the bottom half will move to the new buffer          */
+                pVCState->frameBufStat = nextBuf;
+            }
+#endif
+#if (CSI2_DEFERRED_STATISTICS == STD_ON)
+            (void)OAL_UnlockIRQSpin(&gpRsdkCsi2Device[(uint8)iUnit]->statLock, &flags);
+#endif
+        }
+        else
+        {
+            pErrorS->errMaskVC[vcId] |= (uint32)CSI2_ERR_FRAME_OVERRUN;
+            pErrorS->errMaskU |= (uint32)CSI2_ERR_FRAME_OVERRUN;
+        }
+        rez = 1u;
+    }
+    return rez;
+}
+/* Csi2_FrameRingNext *************************/
+#endif  /* #if (CSI2_FRAME_RING_USAGE == STD_ON)            */
+
 #if (CSI2_FRAMES_COUNTER_USED == STD_ON)
 
 /*================================================================================================*/
@@ -477,6 +1399,11 @@ void Csi2_IrqHandlerRxErr(const Csi2_UnitIdType iUnit)
     volatile GENERIC_CSI2_Type          *pRegs;             /* pointer to CSI2 registers                            */
     uint32                              i;
     uint32                              mask;
+#if (CSI2_TELEMETRY_USAGE == STD_ON)
+    uint64                              timeStart;
+
+    timeStart = CSI2_GET_TIMESTAMP();                       /* handler execution time start                         */
+#endif
 
     CSI2_TRACE(RSDK_TRACE_EVENT_DBG_INFO, (uint16_t)RSDK_TRACE_DBG_CSI2_PHY_ERR_ISR, (uint32_t)CSI2_SEQ_BEGIN);
     pRegs = gMipiCsi2RegsPtr[(uint8)iUnit];                   /* get the  registry pointer for the unit               */
@@ -542,6 +1469,12 @@ void Csi2_IrqHandlerRxErr(const Csi2_UnitIdType iUnit)
         }
         CSI2_TRACE(RSDK_TRACE_EVENT_DBG_INFO, (uint16_t)RSDK_TRACE_DBG_CSI2_PHY_ERR_ISR, (uint32_t)CSI2_SEQ_END);
         pDriverParams->pCallback[RSDK_CSI2_RX_ERR_IRQ_ID](&errorS);
+#if (CSI2_TELEMETRY_USAGE == STD_ON)
+        Csi2_TelemetryIrq(iUnit, (uint32)RSDK_CSI2_RX_ERR_IRQ_ID, timeStart, &errorS);
+#endif
+#if (CSI2_STATUS_PAGE_USAGE == STD_ON)
+        Csi2_StatusPageUpdate(iUnit, (uint32)RSDK_CSI2_RX_ERR_IRQ_ID, &errorS);
+#endif
     } /* if (pRegs != NULL)     */
 }
 /* Csi2_IrqHandlerRxErr *************************/
@@ -565,6 +1498,11 @@ void Csi2_IrqHandlerPathErr(const Csi2_UnitIdType iUnit)
     Csi2_ErrorReportType                errorS = {0};               /* reporting error structure                    */
     volatile GENERIC_CSI2_Type          *pRegs;                     /* pointer to unit registry                     */
     const Csi2_DriverParamsType         *pDriverParams;
+#if (CSI2_TELEMETRY_USAGE == STD_ON)
+    uint64                              timeStart;
+
+    timeStart = CSI2_GET_TIMESTAMP();                               /* handler execution time start                 */
+#endif
 
     CSI2_TRACE(RSDK_TRACE_EVENT_DBG_INFO, (uint16_t)RSDK_TRACE_DBG_CSI2_PKT_ERR_ISR, (uint32_t)CSI2_SEQ_BEGIN);
 
@@ -683,6 +1621,12 @@ void Csi2_IrqHandlerPathErr(const Csi2_UnitIdType iUnit)
         {
             pDriverParams->pCallback[RSDK_CSI2_RX_ERR_IRQ_ID](&errorS);
         }
+#if (CSI2_TELEMETRY_USAGE == STD_ON)
+        Csi2_TelemetryIrq(iUnit, (uint32)RSDK_CSI2_PATH_ERR_IRQ_ID, timeStart, &errorS);
+#endif
+#if (CSI2_STATUS_PAGE_USAGE == STD_ON)
+        Csi2_StatusPageUpdate(iUnit, (uint32)RSDK_CSI2_PATH_ERR_IRQ_ID, &errorS);
+#endif
     } /* if (pRegs != NULL)     */
 }
 /* Csi2_IrqHandlerPathErr *************************/
@@ -698,13 +1642,16 @@ void Csi2_IrqHandlerPathErr(const Csi2_UnitIdType iUnit)
 void Csi2_IrqHandlerEvents(const Csi2_UnitIdType iUnit)
 {
 #if (CSI2_STATISTIC_DATA_USAGE == STD_ON)
-    uint16                              i;
-    uint32                              j;
+#if (CSI2_DEFERRED_STATISTICS == STD_OFF)
     static uint32                       regStat;
+#endif
+    uint32                              j;
 #endif
     uint32                              vcIdFe;                 /* virtual channel ID which generated the FE event  */
     uint32                              workVcIdFe;             /* virtual channel ID updated                       */
+    uint32                              vcFsMask;               /* VCs which reported FrameStart                    */
     uint32                              toCall, optionalFlags, nextLine;
+    uint32                              lineFirst;              /* first line of the LINEDONE report, 0 = none      */
     Csi2_ErrorReportType                errorS = {0};           /* error structure                                  */
     volatile GENERIC_CSI2_Type          *pRegs;                 /* registry pointer                                 */
     Csi2_DriverParamsType               *pDriverState;          /* unit driver state pointer                        */
@@ -717,7 +1664,11 @@ void Csi2_IrqHandlerEvents(const Csi2_UnitIdType iUnit)
     {
         (void)memset(&errorS, 0, sizeof(uint32) * 7u);   /* set the masks to 0                           */
         pDriverState = &gCsi2Settings[(uint8)iUnit];
+#if (CSI2_TIMESTAMP_USAGE == STD_ON)
+        pDriverState->timeIrq = CSI2_GET_TIMESTAMP();               /* one timestamp for all the irq events         */
+#endif
         errorS.unitId = (uint8)iUnit;
+        toCall = 0u;                                                /* no necessary to call the application         */
 
         /* FIRST step - process linedone event                                                                      */
         optionalFlags = pRegs->RX_CHNL_INTRS;                       /* read the LINEDONE bit                        */
@@ -727,13 +1678,40 @@ void Csi2_IrqHandlerEvents(const Csi2_UnitIdType iUnit)
             /* vc with last received data   */
             workVcIdFe = (pRegs->RX_DATAIDR & MIPICSI2_RX_DATAIDR_VCID_MASK) >> MIPICSI2_RX_DATAIDR_VCID_SHIFT;
             pVCDriverState = &pDriverState->workingParamVC[workVcIdFe];         /* get the pointer to VC params     */
+#if (CSI2_TIMESTAMP_USAGE == STD_ON)
+            pVCDriverState->timeLineDone = pDriverState->timeIrq;
+#endif
+#if (CSI2_TELEMETRY_USAGE == STD_ON)
+            Csi2_TelemetryUpdate(iUnit, (uint32)RSDK_CSI2_EVENTS_IRQ_ID);
+            if (gCsi2Telemetry[(uint8)iUnit].vc[workVcIdFe].linesNum == 0u)
+            {
+                gCsi2Telemetry[(uint8)iUnit].vc[workVcIdFe].timeFirstLine = pDriverState->timeIrq;
+            }
+            gCsi2Telemetry[(uint8)iUnit].vc[workVcIdFe].timeLastLine = pDriverState->timeIrq;
+            gCsi2Telemetry[(uint8)iUnit].vc[workVcIdFe].linesNum++;
+            Csi2_TelemetryUpdated(iUnit, (uint32)RSDK_CSI2_EVENTS_IRQ_ID);
+#endif
             nextLine = pVCDriverState->lastReceivedChirpLine;                   /* increase the line number         */
             nextLine++;
             /* do processing for application requests (line done trigger)                                           */
+            lineFirst = 0u;                                                     /* nothing to report                */
             if (((pVCDriverState->eventsMask & (uint32)CSI2_EVT_LINE_END) != 0u) &&
                 ((nextLine % pVCDriverState->vcParamsPtr->bufNumLinesTrigger) == 0u))
             {
+#if (CSI2_LINE_EVT_MODERATION == STD_ON)
+                lineFirst = (uint32)Csi2_LineEvtModerate(iUnit, pVCDriverState, nextLine, pDriverState->timeIrq);
+#else
+                lineFirst = nextLine + 1u - (uint32)pVCDriverState->vcParamsPtr->bufNumLinesTrigger;
+#endif
+            }
+            if (lineFirst != 0u)
+            {
+                errorS.lineFirst[workVcIdFe] = (uint16)lineFirst;           /* the lines covered by the report  */
+                errorS.lineLast[workVcIdFe] = (uint16)nextLine;
                 errorS.evtMaskVC[workVcIdFe] = (uint8)CSI2_EVT_LINE_END;    /* mask for application             */
+#if (CSI2_TIMESTAMP_USAGE == STD_ON)
+                Csi2_ReportTimestamps(iUnit, &errorS);
+#endif
                 /* callback for LINEDONE only
                  * if both LINEDONE and FrameEnd occurred, the call for FE will be done at handler end          */
                 if(pDriverState->pCallback[RSDK_CSI2_EVENTS_IRQ_ID] != NULL)
@@ -747,21 +1725,37 @@ void Csi2_IrqHandlerEvents(const Csi2_UnitIdType iUnit)
                 errorS.evtMaskVC[workVcIdFe] = 0u;                          /* reset the LINEDONE bit           */
             }
             pVCDriverState->lastReceivedChirpLine = (uint16)nextLine;           /* keep the line for the next irq   */
+#if (CSI2_LINE_WATERMARK_USAGE == STD_ON)
+            if (pDriverState->pLineWm != NULL_PTR)
+            {
+                toCall += Csi2_LineWmCommit(iUnit, workVcIdFe, pVCDriverState, &errorS);
+            }
+#endif
             nextLine = pVCDriverState->lastReceivedBufLine;                     /* keep the buffer pointer          */
             /* do processing for VC/channels statistics                                                             */
-#if (CSI2_STATISTIC_DATA_USAGE == STD_ON)
+#if (CSI2_DEFERRED_STATISTICS == STD_ON)
+            if (pVCDriverState->statFeLines != 0u)
+            {   /* new frame data while the previous FrameEnd is still pending                                      */
+                Csi2_DeferredStatisticsVC(iUnit, workVcIdFe);
+            }
+            if (pDriverState->statisticsFlag == CSI2_AUTODC_EVERY_LINE)
+            {   /* only latch the line, as buffer index, the statistics are done by the bottom half                 */
+                pVCDriverState->statLineHead =
+                    (uint16)((nextLine + 1u) % (uint32)pVCDriverState->vcParamsPtr->bufNumLines);
+                OAL_ScheduleBottomHalf(&gpRsdkCsi2Device[(uint8)iUnit]->statBh);
+            }
+#elif (CSI2_STATISTIC_DATA_USAGE == STD_ON)
             if (pDriverState->statisticsFlag == CSI2_AUTODC_EVERY_LINE)
             {
-                Csi2_ProcessChannelStatistics(pVCDriverState, (uint16)nextLine);
+                Csi2_ProcessChannelStatistics(pVCDriverState, (uint16)nextLine, 1u);
             }
 #endif
             nextLine++;
             pVCDriverState->lastReceivedBufLine = (uint16)nextLine;
         }
 
-        toCall = 0u;                                                /* no necessary to call the application         */
         /* SECOND step = check for VC level Packet & Protocol errors                                                */
-        vcIdFe = Csi2_ProcessVcEvents(pDriverState, &errorS, iUnit, &toCall, &optionalFlags);
+        vcIdFe = Csi2_ProcessVcEvents(pDriverState, &errorS, iUnit, &toCall, &optionalFlags, &vcFsMask);
 
         /* THIRD step - process frame end event (final statistics management)                                       */
         while (vcIdFe != (uint32)CSI2_MAX_VC)
@@ -783,11 +1777,23 @@ void Csi2_IrqHandlerEvents(const Csi2_UnitIdType iUnit)
                     j = 1;
                 }
 #endif
-                for (i = 0u; i < j; i++)
+#if (CSI2_DEFERRED_STATISTICS == STD_ON)
+                /* only latch the FrameEnd, the statistics and the DC offsets are done by the bottom half           */
+                pVCDriverState = &pDriverState->workingParamVC[workVcIdFe];
+                pVCDriverState->statFeLines = (uint16)j;
+                pVCDriverState->lastReceivedChirpLine = CSI2_CHIRP_NOT_STARTED;
+                pVCDriverState->lastReceivedBufLine = CSI2_CHIRP_NOT_STARTED;
+                if ((vcFsMask & ((uint32)1u << workVcIdFe)) != 0u)
+                {   /* the next frame already started, no time for the bottom half                                  */
+                    Csi2_DeferredStatisticsVC(iUnit, workVcIdFe);
+                }
+                else
                 {
-                    /* do processing for VC/channels statistics                                                     */
-                    Csi2_ProcessChannelStatistics(pVCDriverState, i);
+                    OAL_ScheduleBottomHalf(&gpRsdkCsi2Device[(uint8)iUnit]->statBh);
                 }
+#else
+                /* do processing for VC/channels statistics, all lines at once                                      */
+                Csi2_ProcessChannelStatistics(pVCDriverState, 0u, (uint16)j);
                 /* process FrameEnd => statistics, so is possible to have toggle_bit problems                       */
                 regStat =
                     Csi2_ProcessChannelFrameEnd(pRegs, (uint8)workVcIdFe, &pDriverState->workingParamVC[workVcIdFe],
@@ -802,12 +1808,27 @@ void Csi2_IrqHandlerEvents(const Csi2_UnitIdType iUnit)
                     errorS.notToggledBits[workVcIdFe] = (uint16)regStat;
                     toCall++;
                 }
+                if ((errorS.evtMaskVC[workVcIdFe] & (uint8)CSI2_EVT_CHANNEL_STAT) != 0u)
+                {
+                    toCall++;
+                }
+#endif  /* #if (CSI2_DEFERRED_STATISTICS == STD_ON)          */
 #if (CSI2_AUTO_DC_COMPENSATION == STD_ON)
             }
 #endif
 #endif /* #if (CSI2_STATISTIC_DATA_USAGE == STD_ON) */
+#if (CSI2_LINE_EVT_MODERATION == STD_ON)
+            toCall += Csi2_LineEvtFrameEnd(iUnit, &pDriverState->workingParamVC[workVcIdFe], workVcIdFe, &errorS);
+#endif
+#if (CSI2_FRAME_RING_USAGE == STD_ON)
+            toCall += Csi2_FrameRingNext(pRegs, iUnit, workVcIdFe, &pDriverState->workingParamVC[workVcIdFe],
+                                         &errorS);
+#endif
 #if (CSI2_FRAMES_COUNTER_USED == STD_ON)
             Csi2_IncFramesCounter(iUnit, workVcIdFe);
+#endif
+#if (CSI2_FRAME_SYNC_USAGE == STD_ON)
+            Csi2_SyncFrameEnd(iUnit, workVcIdFe, pDriverState->timeIrq);
 #endif
         }   /* while    */
         /* FOURTH step - application callback                                                                       */
@@ -821,6 +1842,9 @@ void Csi2_IrqHandlerEvents(const Csi2_UnitIdType iUnit)
 
         if(toCall != 0u)
         {
+#if (CSI2_TIMESTAMP_USAGE == STD_ON)
+            Csi2_ReportTimestamps(iUnit, &errorS);
+#endif
             if(pDriverState->pCallback[RSDK_CSI2_EVENTS_IRQ_ID] != NULL)
             {
                 pDriverState->pCallback[RSDK_CSI2_EVENTS_IRQ_ID](&errorS);
@@ -830,10 +1854,40 @@ void Csi2_IrqHandlerEvents(const Csi2_UnitIdType iUnit)
                 pDriverState->pCallback[RSDK_CSI2_RX_ERR_IRQ_ID](&errorS);
             }
         }
+#if (CSI2_TELEMETRY_USAGE == STD_ON)
+        Csi2_TelemetryIrq(iUnit, (uint32)RSDK_CSI2_EVENTS_IRQ_ID, pDriverState->timeIrq, &errorS);
+#endif
+#if (CSI2_STATUS_PAGE_USAGE == STD_ON)
+        Csi2_StatusPageUpdate(iUnit, (uint32)RSDK_CSI2_EVENTS_IRQ_ID, &errorS);
+#endif
     }   /* if (pRegs != NULL)   */
 }
 /* Csi2IrqHandlerEvents *************************/
 
+#if (CSI2_DEFERRED_STATISTICS == STD_ON)
+/*================================================================================================*/
+/*
+ * @brief       Deferred statistics procedure, the bottom half of the events irq.
+ * @details     Process the channels statistics and the DC offsets latched by the events irq, for all VCs.
+ *
+ * @param[in]   iUnit   - unit id, CSI2_UNIT_0 ... MAX
+ *
+ */
+void Csi2_IrqDeferredStatistics(const Csi2_UnitIdType iUnit)
+{
+    uint32                              vcId;
+
+    if (gMipiCsi2RegsPtr[(uint8)iUnit] != NULL)
+    {
+        for (vcId = (uint32)CSI2_VC_0; vcId < (uint32)CSI2_MAX_VC; vcId++)
+        {
+            Csi2_DeferredStatisticsVC(iUnit, vcId);
+        }
+    }
+}
+/* Csi2_IrqDeferredStatistics *************************/
+#endif  /* #if (CSI2_DEFERRED_STATISTICS == STD_ON)         */
+
 
 
 #ifdef __cplusplus
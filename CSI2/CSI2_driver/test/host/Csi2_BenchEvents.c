@@ -0,0 +1,127 @@
+/*
+ * Copyright 2023 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <string.h>
+#include "Csi2_HostModel.h"
+
+/*==================================================================================================
+*                                          LOCAL MACROS
+==================================================================================================*/
+#define BENCH_CHANNELS      4u
+#define BENCH_SAMPLES       512u
+#define BENCH_LINES         256u
+#define BENCH_LINE_LEN      ((BENCH_CHANNELS * BENCH_SAMPLES * 2u) + CSI2_HOST_STAT_LEN)
+#define BENCH_FRAMES        200u
+
+/*==================================================================================================
+*                                         LOCAL VARIABLES
+==================================================================================================*/
+static uint8                    gsBenchBuf[BENCH_LINES * BENCH_LINE_LEN] __attribute__((aligned(16)));
+static Csi2_SetupParamsType     gsBenchSetup;
+static Csi2_VCParamsType        gsBenchVC;
+static uint32                   gsBenchEvents;
+
+/*==================================================================================================
+*                                         LOCAL FUNCTIONS
+==================================================================================================*/
+static void Bench_EventsCb(Csi2_ErrorReportType *pReport)
+{
+    (void)pReport;
+    gsBenchEvents++;
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Time the events irq of the frames already in the buffer : FrameStart, LINEDONE for each line
+ *              (with the line statistics) and FrameEnd. The chirps are generated once, so only the driver is timed.
+ *
+ */
+static void Bench_Events(const char *pName, const uint8 statManagement, const uint8 bufNumLinesTrigger)
+{
+    Csi2Host_ChirpGenType   gen;
+    uint64_t                tStart, tEnd;
+    uint32                  iFrame, iLine, iCh;
+    const Csi2_VCDriverStateType *pVCState = &gCsi2Settings[(uint8)CSI2_UNIT_0].workingParamVC[CSI2_VC_0];
+
+    Csi2Host_ModelReset(CSI2_UNIT_0);
+    gsBenchSetup.statManagement = statManagement;
+    gsBenchVC.bufNumLinesTrigger = bufNumLinesTrigger;
+    for (iCh = 0u; iCh < BENCH_CHANNELS; iCh++)
+    {   /* the auto DC channels need the statistics                                                                 */
+        gsBenchVC.offsetCompReal[iCh] = (statManagement == (uint8)CSI2_AUTODC_NO) ? (sint16)0 :
+                                                                                  (sint16)CSI2_OFFSET_AUTOCOMPUTE;
+    }
+    if (Csi2_Setup(CSI2_UNIT_0, &gsBenchSetup) != (Std_ReturnType)E_OK)
+    {
+        (void)printf("%-28s : setup failed\n", pName);
+        gCsi2HostFails++;
+    }
+    else
+    {
+        (void)memset(&gen, 0, sizeof(gen));
+        gen.seed = 1u;
+        gen.amp = 1000;
+        gen.noise = 100;
+        for (iLine = 0u; iLine < BENCH_LINES; iLine++)
+        {
+            Csi2Host_ChirpLine(&gen, pVCState, &gsBenchBuf[iLine * BENCH_LINE_LEN]);
+        }
+        gsBenchEvents = 0u;
+        tStart = Csi2Host_GetTime();
+        for (iFrame = 0u; iFrame < BENCH_FRAMES; iFrame++)
+        {
+            Csi2Host_RaiseEvents(CSI2_UNIT_0, (uint32)CSI2_EVT_FRAME_START, 0u, (uint32)CSI2_VC_0);
+            for (iLine = 0u; iLine < BENCH_LINES; iLine++)
+            {
+                Csi2Host_RaiseEvents(CSI2_UNIT_0, 0u, MIPICSI2_RX_CHNL_INTRS_LINEDONE_MASK, (uint32)CSI2_VC_0);
+            }
+            Csi2Host_RaiseEvents(CSI2_UNIT_0, (uint32)CSI2_EVT_FRAME_END, 0u, (uint32)CSI2_VC_0);
+        }
+        tEnd = Csi2Host_GetTime();
+        (void)printf("%-28s : %8.1f ns/line, %8.2f us/frame, %u callbacks\n", pName,
+                     (double)(tEnd - tStart) / (double)(BENCH_FRAMES * BENCH_LINES),
+                     (double)(tEnd - tStart) / (double)BENCH_FRAMES / 1000.0, (unsigned)gsBenchEvents);
+    }
+}
+
+/*==================================================================================================
+*                                        GLOBAL FUNCTIONS
+==================================================================================================*/
+int main(void)
+{
+    uint32  i;
+
+    gsBenchSetup.numLanesRx = (uint8)CSI2_LANE_3;
+    for (i = 0u; i < (uint32)CSI2_MAX_LANE; i++)
+    {
+        gsBenchSetup.lanesMapRx[i] = (uint8)i;
+    }
+    gsBenchSetup.rxClkFreq = 800u;
+    gsBenchSetup.vcConfigPtr[CSI2_VC_0] = &gsBenchVC;
+    gsBenchSetup.pCallback[RSDK_CSI2_RX_ERR_IRQ_ID] = Bench_EventsCb;      /* all the callbacks are required    */
+    gsBenchSetup.pCallback[RSDK_CSI2_PATH_ERR_IRQ_ID] = Bench_EventsCb;
+    gsBenchSetup.pCallback[RSDK_CSI2_EVENTS_IRQ_ID] = Bench_EventsCb;
+    gsBenchVC.streamDataType = (uint16)CSI2_DATA_TYPE_RAW12;
+    gsBenchVC.channelsNum = (uint8)BENCH_CHANNELS;
+    gsBenchVC.vcEventsReq = (uint32)CSI2_EVT_FRAME_START | (uint32)CSI2_EVT_FRAME_END | (uint32)CSI2_EVT_LINE_END |
+                            (uint32)CSI2_EVT_CHANNEL_STAT;
+    gsBenchVC.expectedNumSamples = (uint16)BENCH_SAMPLES;
+    gsBenchVC.expectedNumLines = (uint16)BENCH_LINES;
+    gsBenchVC.bufNumLines = (uint16)BENCH_LINES;
+    gsBenchVC.bufLineLen = (uint16)BENCH_LINE_LEN;
+    gsBenchVC.bufDataPtr = gsBenchBuf;
+
+    (void)printf("CSI2 events irq, %u lines x %u samples x %u channels, %u frames\n", (unsigned)BENCH_LINES,
+                 (unsigned)BENCH_SAMPLES, (unsigned)BENCH_CHANNELS, (unsigned)BENCH_FRAMES);
+    Bench_Events("no statistics", (uint8)CSI2_AUTODC_NO, 1u);
+    Bench_Events("statistics every line", (uint8)CSI2_AUTODC_EVERY_LINE, 1u);
+    Bench_Events("statistics at FrameEnd", (uint8)CSI2_AUTODC_AT_FE, 1u);
+    Bench_Events("statistics every line, /16", (uint8)CSI2_AUTODC_EVERY_LINE, 16u);
+    return (gCsi2HostFails == 0u) ? 0 : 1;
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright 2023 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef CSI2_HOSTCFG_H
+#define CSI2_HOSTCFG_H
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*==================================================================================================
+*                                       DEFINES AND MACROS
+==================================================================================================*/
+/* Platform definitions of the host build, included before any driver source (-include).
+ * The events timestamps use the host monotonic clock, in ns.                                       */
+#define CSI2_GET_TIMESTAMP()        ((uint64)Csi2Host_GetTime())
+#define CSI2_GET_TIMESTAMP_FREQ()   ((uint64)1000000000u)
+
+/*==================================================================================================
+*                                       FUNCTION PROTOTYPES
+==================================================================================================*/
+uint64_t Csi2Host_GetTime(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CSI2_HOSTCFG_H */
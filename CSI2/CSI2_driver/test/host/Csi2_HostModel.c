@@ -0,0 +1,194 @@
+/*
+ * Copyright 2023 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <string.h>
+#include <time.h>
+#include "Csi2_HostModel.h"
+#include "Csi2_Irq.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*==================================================================================================
+*                                          LOCAL MACROS
+==================================================================================================*/
+#define CSI2_HOST_VC_BITS           3u          /* bits per VC in MIPICSI2_RX_VCINTRS/RX_VCINTRE                */
+#define CSI2_HOST_SAMPLE_LEN        2u          /* bytes per radar sample                                       */
+
+/*==================================================================================================
+*                                        GLOBAL VARIABLES
+==================================================================================================*/
+/* The unit registers, in memory (CSI2_REGS_MODEL_USED)                                             */
+volatile GENERIC_CSI2_Type gCsi2RegsModel[CSI2_MAX_UNITS];
+uint32 gCsi2HostFails = 0u;
+
+/*==================================================================================================
+*                                         LOCAL FUNCTIONS
+==================================================================================================*/
+/*================================================================================================*/
+/*
+ * @brief       The noise generator, a 32 bits xorshift.
+ *
+ */
+static sint16 Csi2Host_Noise(Csi2Host_ChirpGenType *pGen)
+{
+    uint32  x = pGen->seed;
+    sint16  rez = 0;
+
+    x ^= x << 13u;
+    x ^= x >> 17u;
+    x ^= x << 5u;
+    pGen->seed = x;
+    if (pGen->noise != 0)
+    {
+        rez = (sint16)((sint32)(x % ((2u * (uint32)pGen->noise) + 1u)) - (sint32)pGen->noise);
+    }
+    return rez;
+}
+
+/*==================================================================================================
+*                                        GLOBAL FUNCTIONS
+==================================================================================================*/
+/*================================================================================================*/
+/*
+ * @brief       The host monotonic clock, in ns, used as the events timestamps counter.
+ *
+ */
+uint64_t Csi2Host_GetTime(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000u) + (uint64_t)ts.tv_nsec;
+}
+
+/*================================================================================================*/
+void Csi2Host_ModelReset(const Csi2_UnitIdType unitId)
+{
+    (void)memset((void *)&gCsi2RegsModel[(uint8)unitId], 0, sizeof(GENERIC_CSI2_Type));
+}
+
+/*================================================================================================*/
+void Csi2Host_RaiseEvents(const Csi2_UnitIdType unitId, const uint32 vcStat, const uint32 chnlStat,
+                          const uint32 vcId)
+{
+    volatile GENERIC_CSI2_Type  *pRegs = &gCsi2RegsModel[(uint8)unitId];
+
+    /* read-only for the software, set by the interface with the last received packet VC                        */
+    *(volatile uint32 *)&pRegs->RX_DATAIDR = MIPICSI2_RX_DATAIDR_VCID(vcId);
+    pRegs->RX_VCINTRS = vcStat;
+    pRegs->RX_CHNL_INTRS = chnlStat;
+    Csi2_IrqHandlerEvents(unitId);
+    pRegs->RX_VCINTRS = 0u;
+    pRegs->RX_CHNL_INTRS = 0u;
+}
+
+/*================================================================================================*/
+uint8 *Csi2Host_CurrentBuf(const Csi2_UnitIdType unitId, const uint32 vcId)
+{
+    const Csi2_VCDriverStateType    *pVCState = &gCsi2Settings[(uint8)unitId].workingParamVC[vcId];
+    uint8                           *pBuf;
+
+#if (CSI2_FRAME_RING_USAGE == STD_ON)
+    pBuf = (uint8 *)((pVCState->frameBufCrt == 0u) ? pVCState->vcParamsPtr->bufDataPtr :
+                                                pVCState->vcParamsPtr->nextBufDataPtr[pVCState->frameBufCrt - 1u]);
+#else
+    pBuf = (uint8 *)pVCState->vcParamsPtr->bufDataPtr;
+#endif
+    return pBuf;
+}
+
+/*================================================================================================*/
+void Csi2Host_ChirpLine(Csi2Host_ChirpGenType *pGen, const Csi2_VCDriverStateType *pVCState, uint8 *pLine)
+{
+    const Csi2_VCParamsType *pVC = pVCState->vcParamsPtr;
+    uint32                  numChannel, iCh, iSmp, half;
+    sint32                  sum[CSI2_MAX_CHANNEL];
+    sint16                  vMin[CSI2_MAX_CHANNEL], vMax[CSI2_MAX_CHANNEL], val, prev[CSI2_MAX_CHANNEL];
+    uint16                  toggle[CSI2_MAX_CHANNEL];
+    uint8                   *pRec;
+
+    numChannel = (uint32)Csi2_GetChannelNum(pVCState);
+    if (numChannel > (uint32)CSI2_MAX_CHANNEL)
+    {
+        numChannel = (uint32)CSI2_MAX_CHANNEL;
+    }
+    half = ((uint32)pVC->expectedNumSamples / 2u) + 1u;
+    for (iCh = 0u; iCh < numChannel; iCh++)
+    {
+        sum[iCh] = 0;
+        vMin[iCh] = (sint16)0x7fff;
+        vMax[iCh] = (sint16)-0x8000;
+        toggle[iCh] = 0u;
+        prev[iCh] = pGen->dc[iCh];
+    }
+    /* the samples, interleaved                                                                                     */
+    for (iSmp = 0u; iSmp < (uint32)pVC->expectedNumSamples; iSmp++)
+    {
+        for (iCh = 0u; iCh < numChannel; iCh++)
+        {
+            val = (sint16)((sint32)pGen->dc[iCh] + Csi2Host_Noise(pGen) +
+                           ((((sint32)pGen->amp) * (sint32)((iSmp < half) ? iSmp : ((2u * half) - iSmp))) /
+                                                                                            (sint32)half));
+            (void)memcpy(&pLine[((iSmp * numChannel) + iCh) * CSI2_HOST_SAMPLE_LEN], &val, sizeof(val));
+            sum[iCh] += val;
+            vMin[iCh] = (val < vMin[iCh]) ? val : vMin[iCh];
+            vMax[iCh] = (val > vMax[iCh]) ? val : vMax[iCh];
+            toggle[iCh] |= (uint16)((uint16)val ^ (uint16)prev[iCh]);
+            prev[iCh] = val;
+        }
+    }
+    /* the statistics records, after the samples                                                                    */
+    pRec = &pLine[(uint32)pVC->expectedNumSamples * numChannel * CSI2_HOST_SAMPLE_LEN];
+    for (iCh = 0u; iCh < numChannel; iCh++)
+    {
+        (void)memcpy(&pRec[0], &sum[iCh], sizeof(sint32));
+        (void)memcpy(&pRec[4], &vMin[iCh], sizeof(sint16));
+        (void)memcpy(&pRec[6], &vMax[iCh], sizeof(sint16));
+        (void)memcpy(&pRec[8], &toggle[iCh], sizeof(uint16));
+        pRec = &pRec[CSI2_HOST_STAT_REC_LEN];
+    }
+}
+
+/*================================================================================================*/
+void Csi2Host_ChirpFrame(const Csi2_UnitIdType unitId, const uint32 vcId, Csi2Host_ChirpGenType *pGen)
+{
+    volatile GENERIC_CSI2_Type      *pRegs = &gCsi2RegsModel[(uint8)unitId];
+    const Csi2_VCDriverStateType    *pVCState = &gCsi2Settings[(uint8)unitId].workingParamVC[vcId];
+    const Csi2_VCParamsType         *pVC = pVCState->vcParamsPtr;
+    uint8                           *pBuf;
+    uint32                          iLine, vcStat, vcShift;
+
+    pBuf = Csi2Host_CurrentBuf(unitId, vcId);
+    vcShift = vcId * CSI2_HOST_VC_BITS;
+    /* FrameStart                                                                                                   */
+    vcStat = (uint32)CSI2_EVT_FRAME_START << vcShift;
+    if ((pRegs->RX_VCINTRE & vcStat) != 0u)
+    {
+        Csi2Host_RaiseEvents(unitId, vcStat, 0u, vcId);
+        vcStat = 0u;
+    }
+    /* radar data lines, with LINEDONE                                                                              */
+    for (iLine = 0u; iLine < (uint32)pVC->expectedNumLines; iLine++)
+    {
+        Csi2Host_ChirpLine(pGen, pVCState, &pBuf[(iLine % (uint32)pVC->bufNumLines) * (uint32)pVC->bufLineLen]);
+        if ((pRegs->RX_CHNL_INTRE & MIPICSI2_RX_CHNL_INTRE_LINEDONEIE_MASK) != 0u)
+        {
+            Csi2Host_RaiseEvents(unitId, vcStat, MIPICSI2_RX_CHNL_INTRS_LINEDONE_MASK, vcId);
+            vcStat = 0u;
+        }
+    }
+    /* FrameEnd, always enabled                                                                                     */
+    Csi2Host_RaiseEvents(unitId, vcStat | ((uint32)CSI2_EVT_FRAME_END << vcShift), 0u, vcId);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,112 @@
+/*
+ * Copyright 2023 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef CSI2_HOSTMODEL_H
+#define CSI2_HOSTMODEL_H
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <stdio.h>
+#include "CDD_Csi2.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*==================================================================================================
+*                                       DEFINES AND MACROS
+==================================================================================================*/
+#define CSI2_HOST_STAT_REC_LEN      10u         /* the packed statistics record of a channel, added after the chirp */
+#define CSI2_HOST_STAT_LEN          80u         /* the statistics room required at each buffer line end             */
+
+/* test check : the failure is reported and counted, the test goes on                               */
+#define CSI2_HOST_CHECK(cond)                                                                           \
+    do {                                                                                                \
+        if (!(cond))                                                                                    \
+        {                                                                                               \
+            (void)printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);                      \
+            gCsi2HostFails++;                                                                           \
+        }                                                                                               \
+    } while (0)
+
+/*==================================================================================================
+*                                  STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+ * @brief   Synthetic chirp generator.
+ * @details Each channel sample is dc + a triangle of amp amplitude over the chirp + a pseudo-random noise of
+ *          noise amplitude; the generator state is the noise seed only, so a frame is reproducible.
+ *
+ */
+typedef struct {
+    uint32          seed;                       /* the noise generator state                        */
+    sint16          dc[CSI2_MAX_CHANNEL];       /* the channels DC level                            */
+    sint16          amp;                        /* the triangle amplitude                           */
+    sint16          noise;                      /* the noise amplitude, 0 = no noise                */
+} Csi2Host_ChirpGenType;
+
+/*==================================================================================================
+*                                  GLOBAL VARIABLE DECLARATIONS
+==================================================================================================*/
+extern uint32 gCsi2HostFails;                   /* the failed checks number                         */
+
+/*==================================================================================================
+*                                       FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+ * @brief       Reset the registers model of a unit, to the state after the power-on reset.
+ */
+void Csi2Host_ModelReset(const Csi2_UnitIdType unitId);
+
+/**
+ * @brief       Raise an events irq on a unit of the registers model.
+ * @details     The status registers are written as the interface would set them; the model has no write 1 to
+ *              clear, so the status is cleared after the handler.
+ *
+ * @param[in]   unitId      - unit identifier
+ * @param[in]   vcStat      - the MIPICSI2_RX_VCINTRS value
+ * @param[in]   chnlStat    - the MIPICSI2_RX_CHNL_INTRS value
+ * @param[in]   vcId        - the VC of the last received packet, reported by MIPICSI2_RX_DATAIDR
+ *
+ */
+void Csi2Host_RaiseEvents(const Csi2_UnitIdType unitId, const uint32 vcStat, const uint32 chnlStat,
+                          const uint32 vcId);
+
+/**
+ * @brief       Get the VC buffer currently written by the interface (the frame ring included).
+ */
+uint8 *Csi2Host_CurrentBuf(const Csi2_UnitIdType unitId, const uint32 vcId);
+
+/**
+ * @brief       Write a synthetic chirp as the interface does : the interleaved channels samples, then the
+ *              packed statistics record of each channel.
+ *
+ * @param[in,out] pGen      - the chirp generator
+ * @param[in]   pVCState    - the VC driver state, after setup
+ * @param[out]  pLine       - the buffer line
+ *
+ */
+void Csi2Host_ChirpLine(Csi2Host_ChirpGenType *pGen, const Csi2_VCDriverStateType *pVCState, uint8 *pLine);
+
+/**
+ * @brief       Receive a synthetic frame on a VC of the registers model.
+ * @details     The interface sequence is followed : FrameStart, a chirp line and LINEDONE for each expected line,
+ *              FrameEnd. An event is raised only if its irq is enabled; a disabled FrameStart is seen by the next
+ *              irq, as for the interface.
+ *
+ * @param[in]   unitId      - unit identifier
+ * @param[in]   vcId        - VC identifier
+ * @param[in,out] pGen      - the chirp generator
+ *
+ */
+void Csi2Host_ChirpFrame(const Csi2_UnitIdType unitId, const uint32 vcId, Csi2Host_ChirpGenType *pGen);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CSI2_HOSTMODEL_H */
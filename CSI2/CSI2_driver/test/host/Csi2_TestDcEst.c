@@ -0,0 +1,268 @@
+/*
+ * Copyright 2023 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <string.h>
+#include "Csi2_HostModel.h"
+
+/*==================================================================================================
+*                                          LOCAL MACROS
+==================================================================================================*/
+#define TEST_CHANNELS       4u
+#define TEST_SAMPLES        64u
+#define TEST_LINES          16u
+#define TEST_LINE_LEN       ((TEST_CHANNELS * TEST_SAMPLES * 2u) + CSI2_HOST_STAT_LEN)
+#define TEST_FRAMES         40u
+#define TEST_DC_ADJUST      4           /* the DC offset register unit, in samples                          */
+#define TEST_EMA_FRAC_BITS  8u          /* the EMA state fractional bits                                    */
+
+/*==================================================================================================
+*                                  LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+/* the reference estimator of a channel, with the plain divisions                                   */
+typedef struct {
+    sint64          ema;                            /* EMA state, Q TEST_EMA_FRAC_BITS              */
+    sint64          win[CSI2_DC_WINDOW_MAX];        /* the last frames means                        */
+} Test_DcRefType;
+
+/*==================================================================================================
+*                                         LOCAL VARIABLES
+==================================================================================================*/
+static uint8                    gsTestBuf[TEST_LINES * TEST_LINE_LEN] __attribute__((aligned(16)));
+static Csi2_SetupParamsType     gsTestSetup;
+static Csi2_VCParamsType        gsTestVC;
+static uint32                   gsTestErr;
+
+/* the channels DC levels, before and after a step at the middle of the test                        */
+static const sint32             gsTestDcLow[TEST_CHANNELS] = { 100, -300, 0, 2000 };
+static const sint32             gsTestDcHigh[TEST_CHANNELS] = { 180, -1, -513, 1021 };
+
+/*==================================================================================================
+*                                         LOCAL FUNCTIONS
+==================================================================================================*/
+static void Test_EventsCb(Csi2_ErrorReportType *pReport)
+{
+    (void)pReport;
+}
+
+static void Test_ErrorsCb(Csi2_ErrorReportType *pReport)
+{
+    (void)pReport;
+    gsTestErr++;
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Set up unit 0, VC 0 : RAW12, auto DC on all the channels at FrameEnd, with the DC estimator.
+ *
+ */
+static Std_ReturnType Test_Setup(const uint8 estimator, const uint8 estParam)
+{
+    uint32  i;
+
+    Csi2Host_ModelReset(CSI2_UNIT_0);
+    (void)memset(&gsTestSetup, 0, sizeof(gsTestSetup));
+    (void)memset(&gsTestVC, 0, sizeof(gsTestVC));
+    gsTestSetup.numLanesRx = (uint8)CSI2_LANE_3;
+    for (i = 0u; i < (uint32)CSI2_MAX_LANE; i++)
+    {
+        gsTestSetup.lanesMapRx[i] = (uint8)i;
+    }
+    gsTestSetup.rxClkFreq = 800u;
+    gsTestSetup.statManagement = (uint8)CSI2_AUTODC_AT_FE;
+    gsTestSetup.dcEstimator = estimator;
+    gsTestSetup.dcEstParam = estParam;
+    gsTestSetup.vcConfigPtr[CSI2_VC_0] = &gsTestVC;
+    gsTestSetup.pCallback[RSDK_CSI2_RX_ERR_IRQ_ID] = Test_ErrorsCb;
+    gsTestSetup.pCallback[RSDK_CSI2_PATH_ERR_IRQ_ID] = Test_ErrorsCb;
+    gsTestSetup.pCallback[RSDK_CSI2_EVENTS_IRQ_ID] = Test_EventsCb;
+    gsTestVC.streamDataType = (uint16)CSI2_DATA_TYPE_RAW12;
+    gsTestVC.channelsNum = (uint8)TEST_CHANNELS;
+    gsTestVC.vcEventsReq = (uint32)CSI2_EVT_FRAME_START | (uint32)CSI2_EVT_FRAME_END;
+    gsTestVC.expectedNumSamples = (uint16)TEST_SAMPLES;
+    gsTestVC.expectedNumLines = (uint16)TEST_LINES;
+    gsTestVC.bufNumLines = (uint16)TEST_LINES;
+    gsTestVC.bufLineLen = (uint16)TEST_LINE_LEN;
+    gsTestVC.bufDataPtr = gsTestBuf;
+    gsTestVC.bufNumLinesTrigger = 1u;
+    for (i = 0u; i < TEST_CHANNELS; i++)
+    {
+        gsTestVC.offsetCompReal[i] = (sint16)CSI2_OFFSET_AUTOCOMPUTE;
+    }
+    gsTestErr = 0u;
+    return Csi2_Setup(CSI2_UNIT_0, &gsTestSetup);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       The frame samples sum of a channel : the DC level plus a small frame to frame wander and a
+ *              remainder, so the frame mean is truncated toward 0 by the driver.
+ *
+ */
+static sint64 Test_FrameSum(const uint32 iFrame, const uint32 iCh)
+{
+    sint64  dc = (iFrame < (TEST_FRAMES / 2u)) ? gsTestDcLow[iCh] : gsTestDcHigh[iCh];
+    sint64  wander = (sint64)(((iFrame * 7u) + (iCh * 3u)) % 11u) - 5;
+    sint64  rem = (sint64)(((iFrame * 131u) + (iCh * 17u)) % (TEST_LINES * TEST_SAMPLES));
+
+    return ((dc + wander) * (sint64)(TEST_LINES * TEST_SAMPLES)) + (((dc + wander) < 0) ? -rem : rem);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Write the statistics records of a frame, the channel sums spread over the lines.
+ *
+ */
+static void Test_WriteFrame(const uint32 iFrame)
+{
+    uint32  iLine, iCh;
+    uint8   *pRec;
+    sint64  frameSum;
+    sint32  sum;
+    sint16  vMin = (sint16)-2048, vMax = (sint16)2047;
+    uint16  toggle = 0x0ff0u;
+
+    for (iLine = 0u; iLine < TEST_LINES; iLine++)
+    {
+        pRec = &gsTestBuf[(iLine * TEST_LINE_LEN) + (TEST_CHANNELS * TEST_SAMPLES * 2u)];
+        for (iCh = 0u; iCh < TEST_CHANNELS; iCh++)
+        {
+            frameSum = Test_FrameSum(iFrame, iCh);
+            sum = (sint32)(frameSum / (sint64)TEST_LINES);
+            if (iLine == 0u)
+            {
+                sum += (sint32)(frameSum % (sint64)TEST_LINES);
+            }
+            (void)memcpy(&pRec[0], &sum, sizeof(sum));
+            (void)memcpy(&pRec[4], &vMin, sizeof(vMin));
+            (void)memcpy(&pRec[6], &vMax, sizeof(vMax));
+            (void)memcpy(&pRec[8], &toggle, sizeof(toggle));
+            pRec = &pRec[CSI2_HOST_STAT_REC_LEN];
+        }
+    }
+}
+
+/*================================================================================================*/
+/*
+ * @brief       The reference estimate of a channel, after the frame mean of iFrame.
+ *
+ */
+static sint64 Test_RefEstimate(Test_DcRefType *pRef, const uint8 estimator, const uint32 estParam,
+                               const uint32 iFrame, const sint64 mean)
+{
+    sint64  rez, sum;
+    uint32  i;
+
+    switch (estimator)
+    {
+        case (uint8)CSI2_DC_EST_EMA:
+            if (iFrame == 0u)
+            {
+                pRef->ema = mean * ((sint64)1 << TEST_EMA_FRAC_BITS);
+            }
+            else
+            {
+                pRef->ema += ((mean * ((sint64)1 << TEST_EMA_FRAC_BITS)) - pRef->ema) / ((sint64)1 << estParam);
+            }
+            rez = pRef->ema / ((sint64)1 << TEST_EMA_FRAC_BITS);
+            break;
+        case (uint8)CSI2_DC_EST_WINDOW:
+            for (i = estParam - 1u; i > 0u; i--)
+            {   /* the window filled with the first mean, then shifted                                              */
+                pRef->win[i] = (iFrame == 0u) ? mean : pRef->win[i - 1u];
+            }
+            pRef->win[0] = mean;
+            sum = 0;
+            for (i = 0u; i < estParam; i++)
+            {
+                sum += pRef->win[i];
+            }
+            rez = sum / (sint64)estParam;
+            break;
+        default:
+            rez = mean;
+            break;
+    }
+    return rez;
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Frames with known means : the channels DC offsets and the offset registers follow the reference
+ *              estimator, computed with the plain divisions.
+ *
+ */
+static void Test_Estimator(const uint8 estimator, const uint8 estParam)
+{
+    const Csi2_VCDriverStateType *pVCState = &gCsi2Settings[(uint8)CSI2_UNIT_0].workingParamVC[CSI2_VC_0];
+    volatile GENERIC_CSI2_Type  *pRegs = &gCsi2RegsModel[(uint8)CSI2_UNIT_0];
+    Test_DcRefType              ref[TEST_CHANNELS];
+    sint16                      expDC[TEST_CHANNELS];
+    uint32                      iFrame, iCh, expReg, fails;
+
+    fails = gCsi2HostFails;
+    CSI2_HOST_CHECK(Test_Setup(estimator, estParam) == (Std_ReturnType)E_OK);
+    (void)memset(ref, 0, sizeof(ref));
+    for (iFrame = 0u; iFrame < TEST_FRAMES; iFrame++)
+    {
+        Test_WriteFrame(iFrame);
+        Csi2Host_RaiseEvents(CSI2_UNIT_0, (uint32)CSI2_EVT_FRAME_START, 0u, (uint32)CSI2_VC_0);
+        Csi2Host_RaiseEvents(CSI2_UNIT_0, (uint32)CSI2_EVT_FRAME_END, 0u, (uint32)CSI2_VC_0);
+        for (iCh = 0u; iCh < TEST_CHANNELS; iCh++)
+        {
+            expDC[iCh] = (sint16)(Test_RefEstimate(&ref[iCh], estimator, (uint32)estParam, iFrame,
+                                                   Test_FrameSum(iFrame, iCh) /
+                                                   (sint64)(TEST_LINES * TEST_SAMPLES)) * TEST_DC_ADJUST);
+            CSI2_HOST_CHECK(pVCState->statDC[iCh].channelDC == expDC[iCh]);
+        }
+        /* channels A & B share the first offset register                                                           */
+        expReg = (uint32)(uint16)expDC[0] | ((uint32)(uint16)expDC[1] << 16u);
+        CSI2_HOST_CHECK(*(volatile uint32 *)&pRegs->RX_CBUF0_CHNLOFFSET0_0 == expReg);
+        if (gCsi2HostFails != fails)
+        {
+            (void)printf("  estimator %u/%u, frame %u\n", (unsigned)estimator, (unsigned)estParam, (unsigned)iFrame);
+            break;
+        }
+    }
+    CSI2_HOST_CHECK(gsTestErr == 0u);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       The estimator parameters out of range are refused by the setup.
+ *
+ */
+static void Test_BadParams(void)
+{
+    CSI2_HOST_CHECK(Test_Setup((uint8)CSI2_DC_EST_EMA, 0u) != (Std_ReturnType)E_OK);
+    CSI2_HOST_CHECK(Test_Setup((uint8)CSI2_DC_EST_EMA, (uint8)(CSI2_DC_EMA_MAX_SHIFT + 1u)) != (Std_ReturnType)E_OK);
+    CSI2_HOST_CHECK(Test_Setup((uint8)CSI2_DC_EST_WINDOW, 1u) != (Std_ReturnType)E_OK);
+    CSI2_HOST_CHECK(Test_Setup((uint8)CSI2_DC_EST_WINDOW, (uint8)(CSI2_DC_WINDOW_MAX + 1u)) !=
+                    (Std_ReturnType)E_OK);
+    CSI2_HOST_CHECK(Test_Setup((uint8)CSI2_DC_EST_MAX, 0u) != (Std_ReturnType)E_OK);
+    CSI2_HOST_CHECK(Test_Setup((uint8)CSI2_DC_EST_EMA, (uint8)CSI2_DC_EMA_MAX_SHIFT) == (Std_ReturnType)E_OK);
+    CSI2_HOST_CHECK(Test_Setup((uint8)CSI2_DC_EST_WINDOW, (uint8)CSI2_DC_WINDOW_MAX) == (Std_ReturnType)E_OK);
+}
+
+/*==================================================================================================
+*                                        GLOBAL FUNCTIONS
+==================================================================================================*/
+int main(void)
+{
+    Test_Estimator((uint8)CSI2_DC_EST_FRAME, 0u);
+    Test_Estimator((uint8)CSI2_DC_EST_EMA, 1u);
+    Test_Estimator((uint8)CSI2_DC_EST_EMA, 3u);
+    Test_Estimator((uint8)CSI2_DC_EST_EMA, (uint8)CSI2_DC_EMA_MAX_SHIFT);
+    Test_Estimator((uint8)CSI2_DC_EST_WINDOW, 2u);
+    Test_Estimator((uint8)CSI2_DC_EST_WINDOW, 5u);
+    Test_Estimator((uint8)CSI2_DC_EST_WINDOW, (uint8)CSI2_DC_WINDOW_MAX);
+    Test_BadParams();
+    (void)printf("Csi2_TestDcEst : %s (%u failed checks)\n", (gCsi2HostFails == 0u) ? "PASS" : "FAIL",
+                 (unsigned)gCsi2HostFails);
+    return (gCsi2HostFails == 0u) ? 0 : 1;
+}
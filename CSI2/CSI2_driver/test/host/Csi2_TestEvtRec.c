@@ -0,0 +1,212 @@
+/*
+ * Copyright 2023 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <stdio.h>
+#include <string.h>
+#include "Csi2_Linux_Def.h"
+
+/*==================================================================================================
+*                                          LOCAL MACROS
+==================================================================================================*/
+#define TEST_REC_BAD        0xffffffffu         /* Csi2_EvtDecodeLinuxUs result for a bad record    */
+
+/* test check : the failure is reported and counted, the test goes on                               */
+#define TEST_CHECK(cond)                                                                                \
+    do {                                                                                                \
+        if (!(cond))                                                                                    \
+        {                                                                                               \
+            (void)printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);                      \
+            gsTestFails++;                                                                              \
+        }                                                                                               \
+    } while (0)
+
+/*==================================================================================================
+*                                         LOCAL VARIABLES
+==================================================================================================*/
+static uint64_t         gsTestRec[RSDK_CSI2_EVT_REC_MAX_LEN / sizeof(uint64_t)];
+static rsdkCsi2Report_t gsTestRep, gsTestDec;
+static uint32_t         gsTestFails = 0u;
+
+/*==================================================================================================
+*                                         LOCAL FUNCTIONS
+==================================================================================================*/
+/*================================================================================================*/
+/*
+ * @brief       Encode the test report as the ring producer does (the record type set after the encoding).
+ *
+ */
+static uint32_t Test_Encode(const rsdkCsi2IrqId_t irqId)
+{
+    uint32_t    recLen;
+
+    (void)memset(gsTestRec, 0xa5, sizeof(gsTestRec));
+    recLen = RsdkCsi2EvtRecEncodeLinux(&gsTestRep, (uint8_t *)gsTestRec);
+    ((rsdkCsi2EvtRecHdr_t *)(void *)gsTestRec)->recType = (uint8_t)irqId;
+    TEST_CHECK(recLen == ((rsdkCsi2EvtRecHdr_t *)(void *)gsTestRec)->recLen);
+    TEST_CHECK((recLen % RSDK_CSI2_EVT_REC_ALIGN) == 0u);
+    TEST_CHECK(recLen <= RSDK_CSI2_EVT_REC_MAX_LEN);
+    return recLen;
+}
+
+/*================================================================================================*/
+/*
+ * @brief       A report with every field set on some VCs : the decoded report is the encoded one.
+ *
+ */
+static void Test_RoundTripFull(void)
+{
+    const rsdkCsi2EvtRecHdr_t   *pHdr = (const rsdkCsi2EvtRecHdr_t *)(const void *)gsTestRec;
+    uint32_t                    recLen, vc, ch;
+
+    (void)memset(&gsTestRep, 0, sizeof(gsTestRep));
+    gsTestRep.unitId = 2u;
+    gsTestRep.errMaskU = 0x80000011u;
+    for (vc = 1u; vc < (uint32_t)RSDK_CSI2_MAX_VC; vc += 2u)
+    {
+        gsTestRep.errMaskVC[vc] = 0x100u + vc;
+        gsTestRep.evtMaskVC[vc] = (uint8_t)(RSDK_CSI2_EVT_FRAME_END | RSDK_CSI2_EVT_CHANNEL_STAT);
+        gsTestRep.frameCounter[vc] = 0x01020304u * vc;
+        gsTestRep.readyFrameBuf[vc] = (uint8_t)vc;
+        gsTestRep.timeFrameStart[vc] = 0x1000000000ull + vc;
+        gsTestRep.timeFrameEnd[vc] = 0x2000000000ull + vc;
+        gsTestRep.timeLineDone[vc] = 0x1800000000ull + vc;
+        gsTestRep.lineFirst[vc] = 1u;
+        gsTestRep.lineLast[vc] = (uint16_t)(256u + vc);
+        gsTestRep.expectedCRC[vc] = 0xbeefu;
+        gsTestRep.receivedCRC[vc] = 0xdeadu;
+        gsTestRep.invalidPacketID[vc] = 0x3fu;
+        gsTestRep.eccOneBitErrPos[vc] = 7u;
+        gsTestRep.lastDroppedData[vc] = 0x2cu;
+        gsTestRep.lineLengthErr[vc].linePoz = 12u;
+        gsTestRep.lineLengthErr[vc].lineLength = 0x00010ff0u;
+        gsTestRep.shortPackets[vc].dataID = 0x08u;
+        gsTestRep.shortPackets[vc].dataVal = 0x1234u;
+        for (ch = 0u; ch < (uint32_t)RSDK_CSI2_MAX_CHANNEL; ch++)
+        {
+            gsTestRep.chStat[vc][ch].chMin = (int16_t)(-2048 + (int32_t)ch);
+            gsTestRep.chStat[vc][ch].chMax = (int16_t)(2047 - (int32_t)ch);
+            gsTestRep.chStat[vc][ch].chMean = (int16_t)(-(int32_t)ch);
+            gsTestRep.chStat[vc][ch].chToggle = (uint16_t)(0xfff0u | ch);
+        }
+    }
+    gsTestRep.notToggledBits[0] = 0x8000u;
+    gsTestRep.notToggledBits[RSDK_CSI2_MAX_CHANNEL - 1u] = 0x0001u;
+
+    recLen = Test_Encode(RSDK_CSI2_EVENTS_IRQ_ID);
+    TEST_CHECK(pHdr->vcMask == 0x0au);
+    TEST_CHECK(pHdr->recFlags == (RSDK_CSI2_EVT_REC_TOGGLE | RSDK_CSI2_EVT_REC_CH_STAT));
+    TEST_CHECK(pHdr->timestamp == (0x2000000000ull + 3u));
+    TEST_CHECK(recLen == (sizeof(rsdkCsi2EvtRecHdr_t) +
+                          (2u * (sizeof(rsdkCsi2EvtRecVc_t) + (8u * RSDK_CSI2_EVT_SUB_LEN))) +
+                          sizeof(gsTestRep.notToggledBits) + (2u * sizeof(gsTestRep.chStat[0]))));
+    (void)memset(&gsTestDec, 0x5a, sizeof(gsTestDec));
+    TEST_CHECK(Csi2_EvtDecodeLinuxUs(gsTestRec, recLen, &gsTestDec) == (uint32_t)RSDK_CSI2_EVENTS_IRQ_ID);
+    TEST_CHECK(memcmp(&gsTestDec, &gsTestRep, sizeof(gsTestRep)) == 0);
+    /* more bytes available than the record : the same decoding                                                     */
+    (void)memset(&gsTestDec, 0x5a, sizeof(gsTestDec));
+    TEST_CHECK(Csi2_EvtDecodeLinuxUs(gsTestRec, sizeof(gsTestRec), &gsTestDec) == (uint32_t)RSDK_CSI2_EVENTS_IRQ_ID);
+    TEST_CHECK(memcmp(&gsTestDec, &gsTestRep, sizeof(gsTestRep)) == 0);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Sparse reports : only the not null fields are recorded, the others are decoded as 0.
+ *
+ */
+static void Test_RoundTripSparse(void)
+{
+    const rsdkCsi2EvtRecHdr_t   *pHdr = (const rsdkCsi2EvtRecHdr_t *)(const void *)gsTestRec;
+    uint32_t                    recLen;
+
+    /* empty report, the header only                                                                                */
+    (void)memset(&gsTestRep, 0, sizeof(gsTestRep));
+    gsTestRep.unitId = 1u;
+    recLen = Test_Encode(RSDK_CSI2_RX_ERR_IRQ_ID);
+    TEST_CHECK(recLen == sizeof(rsdkCsi2EvtRecHdr_t));
+    TEST_CHECK((pHdr->vcMask == 0u) && (pHdr->recFlags == 0u) && (pHdr->timestamp == 0u));
+    (void)memset(&gsTestDec, 0x5a, sizeof(gsTestDec));
+    TEST_CHECK(Csi2_EvtDecodeLinuxUs(gsTestRec, recLen, &gsTestDec) == (uint32_t)RSDK_CSI2_RX_ERR_IRQ_ID);
+    TEST_CHECK(memcmp(&gsTestDec, &gsTestRep, sizeof(gsTestRep)) == 0);
+
+    /* a FrameStart : one VC block, with the frame and the FrameStart time sub-records                              */
+    gsTestRep.evtMaskVC[0] = (uint8_t)RSDK_CSI2_EVT_FRAME_START;
+    gsTestRep.frameCounter[0] = 41u;
+    gsTestRep.timeFrameStart[0] = 123456789u;
+    recLen = Test_Encode(RSDK_CSI2_EVENTS_IRQ_ID);
+    TEST_CHECK(recLen == (sizeof(rsdkCsi2EvtRecHdr_t) + sizeof(rsdkCsi2EvtRecVc_t) + (2u * RSDK_CSI2_EVT_SUB_LEN)));
+    TEST_CHECK((pHdr->vcMask == 0x01u) && (pHdr->timestamp == 123456789u));
+    (void)memset(&gsTestDec, 0x5a, sizeof(gsTestDec));
+    TEST_CHECK(Csi2_EvtDecodeLinuxUs(gsTestRec, recLen, &gsTestDec) == (uint32_t)RSDK_CSI2_EVENTS_IRQ_ID);
+    TEST_CHECK(memcmp(&gsTestDec, &gsTestRep, sizeof(gsTestRep)) == 0);
+
+    /* an error only VC : a block without sub-records                                                               */
+    (void)memset(&gsTestRep, 0, sizeof(gsTestRep));
+    gsTestRep.errMaskVC[RSDK_CSI2_MAX_VC - 1u] = 0x4u;
+    recLen = Test_Encode(RSDK_CSI2_PATH_ERR_IRQ_ID);
+    TEST_CHECK(recLen == (sizeof(rsdkCsi2EvtRecHdr_t) + sizeof(rsdkCsi2EvtRecVc_t)));
+    (void)memset(&gsTestDec, 0x5a, sizeof(gsTestDec));
+    TEST_CHECK(Csi2_EvtDecodeLinuxUs(gsTestRec, recLen, &gsTestDec) == (uint32_t)RSDK_CSI2_PATH_ERR_IRQ_ID);
+    TEST_CHECK(memcmp(&gsTestDec, &gsTestRep, sizeof(gsTestRep)) == 0);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Pad/exit records, truncated and wrong records.
+ *
+ */
+static void Test_BadRecords(void)
+{
+    rsdkCsi2EvtRecHdr_t *pHdr = (rsdkCsi2EvtRecHdr_t *)(void *)gsTestRec;
+    uint32_t            recLen, len;
+
+    /* pad & exit : the type returned, no report                                                                    */
+    (void)memset(gsTestRec, 0, sizeof(gsTestRec));
+    pHdr->recLen = 64u;
+    pHdr->recType = RSDK_CSI2_EVT_REC_PAD;
+    (void)memset(&gsTestDec, 0x5a, sizeof(gsTestDec));
+    TEST_CHECK(Csi2_EvtDecodeLinuxUs(gsTestRec, 64u, &gsTestDec) == RSDK_CSI2_EVT_REC_PAD);
+    TEST_CHECK(gsTestDec.unitId == 0x5au);
+    pHdr->recLen = (uint16_t)sizeof(rsdkCsi2EvtRecHdr_t);
+    pHdr->recType = RSDK_CSI2_EVT_REC_EXIT;
+    TEST_CHECK(Csi2_EvtDecodeLinuxUs(gsTestRec, sizeof(rsdkCsi2EvtRecHdr_t), &gsTestDec) == RSDK_CSI2_EVT_REC_EXIT);
+    TEST_CHECK(gsTestDec.unitId == 0x5au);
+
+    /* every shorter record length, or fewer available bytes, is a truncated record                                 */
+    Test_RoundTripFull();
+    recLen = pHdr->recLen;
+    for (len = RSDK_CSI2_EVT_REC_ALIGN; len < recLen; len += RSDK_CSI2_EVT_REC_ALIGN)
+    {
+        TEST_CHECK(Csi2_EvtDecodeLinuxUs(gsTestRec, len, &gsTestDec) == TEST_REC_BAD);
+        pHdr->recLen = (uint16_t)len;
+        TEST_CHECK(Csi2_EvtDecodeLinuxUs(gsTestRec, recLen, &gsTestDec) == TEST_REC_BAD);
+        pHdr->recLen = (uint16_t)recLen;
+    }
+    TEST_CHECK(Csi2_EvtDecodeLinuxUs(gsTestRec, RSDK_CSI2_EVT_REC_ALIGN - 1u, &gsTestDec) == TEST_REC_BAD);
+
+    /* wrong type, NULL pointers                                                                                    */
+    pHdr->recType = (uint8_t)RSDK_CSI2_MAX_IRQ_ID;
+    TEST_CHECK(Csi2_EvtDecodeLinuxUs(gsTestRec, recLen, &gsTestDec) == TEST_REC_BAD);
+    pHdr->recType = (uint8_t)RSDK_CSI2_EVENTS_IRQ_ID;
+    TEST_CHECK(Csi2_EvtDecodeLinuxUs(NULL, recLen, &gsTestDec) == TEST_REC_BAD);
+    TEST_CHECK(Csi2_EvtDecodeLinuxUs(gsTestRec, recLen, NULL) == TEST_REC_BAD);
+    TEST_CHECK(Csi2_EvtDecodeLinuxUs(gsTestRec, recLen, &gsTestDec) == (uint32_t)RSDK_CSI2_EVENTS_IRQ_ID);
+}
+
+/*==================================================================================================
+*                                        GLOBAL FUNCTIONS
+==================================================================================================*/
+int main(void)
+{
+    Test_RoundTripFull();
+    Test_RoundTripSparse();
+    Test_BadRecords();
+    (void)printf("Csi2_TestEvtRec : %s (%u failed checks)\n", (gsTestFails == 0u) ? "PASS" : "FAIL",
+                 (unsigned)gsTestFails);
+    return (gsTestFails == 0u) ? 0 : 1;
+}
@@ -0,0 +1,209 @@
+/*
+ * Copyright 2023 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <string.h>
+#include "Csi2_HostModel.h"
+
+/*==================================================================================================
+*                                          LOCAL MACROS
+==================================================================================================*/
+#define TEST_CHANNELS       4u
+#define TEST_SAMPLES        64u
+#define TEST_LINES          16u
+#define TEST_FRAMES         5u
+#define TEST_LINE_LEN       ((TEST_CHANNELS * TEST_SAMPLES * 2u) + CSI2_HOST_STAT_LEN)
+
+/*==================================================================================================
+*                                         LOCAL VARIABLES
+==================================================================================================*/
+static uint8                    gsTestBuf[TEST_LINES * TEST_LINE_LEN] __attribute__((aligned(16)));
+static Csi2_SetupParamsType     gsTestSetup;
+static Csi2_VCParamsType        gsTestVC;
+static uint32                   gsTestFs, gsTestLineEnd, gsTestFe, gsTestChStat, gsTestErr;
+static Csi2_ChStatType          gsTestLastStat[TEST_CHANNELS];
+
+/*==================================================================================================
+*                                         LOCAL FUNCTIONS
+==================================================================================================*/
+static void Test_EventsCb(Csi2_ErrorReportType *pReport)
+{
+    uint8   evt = pReport->evtMaskVC[CSI2_VC_0];
+
+    gsTestFs += ((evt & (uint8)CSI2_EVT_FRAME_START) != 0u) ? 1u : 0u;
+    gsTestLineEnd += ((evt & (uint8)CSI2_EVT_LINE_END) != 0u) ? 1u : 0u;
+    gsTestFe += ((evt & (uint8)CSI2_EVT_FRAME_END) != 0u) ? 1u : 0u;
+    if ((evt & (uint8)CSI2_EVT_CHANNEL_STAT) != 0u)
+    {
+        gsTestChStat++;
+        (void)memcpy(gsTestLastStat, pReport->chStat[CSI2_VC_0], sizeof(gsTestLastStat));
+    }
+}
+
+static void Test_ErrorsCb(Csi2_ErrorReportType *pReport)
+{
+    (void)pReport;
+    gsTestErr++;
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Set up unit 0, VC 0 : RAW12, 4 channels with auto DC, one frame per buffer, every event and the
+ *              frame statistics at FrameEnd.
+ *
+ */
+static Std_ReturnType Test_Setup(void)
+{
+    uint32  i;
+
+    Csi2Host_ModelReset(CSI2_UNIT_0);
+    (void)memset(&gsTestSetup, 0, sizeof(gsTestSetup));
+    (void)memset(&gsTestVC, 0, sizeof(gsTestVC));
+    gsTestSetup.numLanesRx = (uint8)CSI2_LANE_3;
+    for (i = 0u; i < (uint32)CSI2_MAX_LANE; i++)
+    {
+        gsTestSetup.lanesMapRx[i] = (uint8)i;
+    }
+    gsTestSetup.rxClkFreq = 800u;
+    gsTestSetup.statManagement = (uint8)CSI2_AUTODC_AT_FE;        /* the frame statistics over the whole buffer */
+    gsTestSetup.vcConfigPtr[CSI2_VC_0] = &gsTestVC;
+    gsTestSetup.pCallback[RSDK_CSI2_RX_ERR_IRQ_ID] = Test_ErrorsCb;
+    gsTestSetup.pCallback[RSDK_CSI2_PATH_ERR_IRQ_ID] = Test_ErrorsCb;
+    gsTestSetup.pCallback[RSDK_CSI2_EVENTS_IRQ_ID] = Test_EventsCb;
+    gsTestVC.streamDataType = (uint16)CSI2_DATA_TYPE_RAW12;
+    gsTestVC.channelsNum = (uint8)TEST_CHANNELS;
+    gsTestVC.vcEventsReq = (uint32)CSI2_EVT_FRAME_START | (uint32)CSI2_EVT_FRAME_END | (uint32)CSI2_EVT_LINE_END |
+                           (uint32)CSI2_EVT_CHANNEL_STAT;
+    gsTestVC.expectedNumSamples = (uint16)TEST_SAMPLES;
+    gsTestVC.expectedNumLines = (uint16)TEST_LINES;
+    gsTestVC.bufNumLines = (uint16)TEST_LINES;
+    gsTestVC.bufLineLen = (uint16)TEST_LINE_LEN;
+    gsTestVC.bufDataPtr = gsTestBuf;
+    gsTestVC.bufNumLinesTrigger = 1u;
+    for (i = 0u; i < TEST_CHANNELS; i++)
+    {   /* the channels statistics are managed only with the auto DC                                                */
+        gsTestVC.offsetCompReal[i] = (sint16)CSI2_OFFSET_AUTOCOMPUTE;
+    }
+    gsTestFs = 0u;
+    gsTestLineEnd = 0u;
+    gsTestFe = 0u;
+    gsTestChStat = 0u;
+    gsTestErr = 0u;
+    return Csi2_Setup(CSI2_UNIT_0, &gsTestSetup);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Frames received on the model : events, frames counter and the frame statistics, checked
+ *              against the samples in the buffer.
+ *
+ */
+static void Test_Frames(void)
+{
+    Csi2Host_ChirpGenType   gen;
+    uint32                  iFrame, iLine, iSmp, iCh;
+    sint16                  val, expMin[TEST_CHANNELS], expMax[TEST_CHANNELS];
+    sint64                  expSum[TEST_CHANNELS];
+
+    CSI2_HOST_CHECK(Test_Setup() == (Std_ReturnType)E_OK);
+    (void)memset(&gen, 0, sizeof(gen));
+    gen.seed = 0x1234567u;
+    gen.dc[0] = 100;
+    gen.dc[1] = -200;
+    gen.dc[2] = 0;
+    gen.dc[3] = 1500;
+    gen.amp = 800;
+    gen.noise = 40;
+    for (iFrame = 0u; iFrame < TEST_FRAMES; iFrame++)
+    {
+        Csi2Host_ChirpFrame(CSI2_UNIT_0, (uint32)CSI2_VC_0, &gen);
+    }
+    CSI2_HOST_CHECK(gsTestErr == 0u);
+    CSI2_HOST_CHECK(gsTestFs == TEST_FRAMES);
+    CSI2_HOST_CHECK(gsTestLineEnd == (TEST_FRAMES * TEST_LINES));
+    CSI2_HOST_CHECK(gsTestFe == TEST_FRAMES);
+    CSI2_HOST_CHECK(gsTestChStat == TEST_FRAMES);
+    CSI2_HOST_CHECK(Csi2_GetFramesCounter(CSI2_UNIT_0, CSI2_VC_0) == TEST_FRAMES);
+
+    /* the last frame statistics, from the samples                                                                  */
+    for (iCh = 0u; iCh < TEST_CHANNELS; iCh++)
+    {
+        expSum[iCh] = 0;
+        expMin[iCh] = (sint16)0x7fff;
+        expMax[iCh] = (sint16)-0x8000;
+    }
+    for (iLine = 0u; iLine < TEST_LINES; iLine++)
+    {
+        for (iSmp = 0u; iSmp < TEST_SAMPLES; iSmp++)
+        {
+            for (iCh = 0u; iCh < TEST_CHANNELS; iCh++)
+            {
+                (void)memcpy(&val, &gsTestBuf[(iLine * TEST_LINE_LEN) + (((iSmp * TEST_CHANNELS) + iCh) * 2u)],
+                             sizeof(val));
+                expSum[iCh] += val;
+                expMin[iCh] = (val < expMin[iCh]) ? val : expMin[iCh];
+                expMax[iCh] = (val > expMax[iCh]) ? val : expMax[iCh];
+            }
+        }
+    }
+    for (iCh = 0u; iCh < TEST_CHANNELS; iCh++)
+    {
+        val = (sint16)(expSum[iCh] / (sint64)(TEST_LINES * TEST_SAMPLES));
+        CSI2_HOST_CHECK(gsTestLastStat[iCh].chMin == expMin[iCh]);
+        CSI2_HOST_CHECK(gsTestLastStat[iCh].chMax == expMax[iCh]);
+        CSI2_HOST_CHECK((gsTestLastStat[iCh].chMean >= (val - 1)) && (gsTestLastStat[iCh].chMean <= (val + 1)));
+        CSI2_HOST_CHECK(gsTestLastStat[iCh].chToggle != 0u);
+    }
+}
+
+/*================================================================================================*/
+/*
+ * @brief       The same generator seed gives the same frame.
+ *
+ */
+static void Test_Generator(void)
+{
+    static uint8            line1[TEST_LINE_LEN], line2[TEST_LINE_LEN];
+    Csi2Host_ChirpGenType   gen1, gen2;
+    const Csi2_VCDriverStateType *pVCState = &gCsi2Settings[(uint8)CSI2_UNIT_0].workingParamVC[CSI2_VC_0];
+    sint32                  sum;
+    sint16                  val;
+    uint32                  iSmp;
+
+    CSI2_HOST_CHECK(Test_Setup() == (Std_ReturnType)E_OK);
+    (void)memset(&gen1, 0, sizeof(gen1));
+    gen1.seed = 77u;
+    gen1.dc[0] = -1000;
+    gen1.amp = 300;
+    gen1.noise = 10;
+    gen2 = gen1;
+    Csi2Host_ChirpLine(&gen1, pVCState, line1);
+    Csi2Host_ChirpLine(&gen2, pVCState, line2);
+    CSI2_HOST_CHECK(memcmp(line1, line2, sizeof(line1)) == 0);
+    /* the channel A record sum, the sum of its samples                                                             */
+    sum = 0;
+    for (iSmp = 0u; iSmp < TEST_SAMPLES; iSmp++)
+    {
+        (void)memcpy(&val, &line1[iSmp * TEST_CHANNELS * 2u], sizeof(val));
+        sum += val;
+    }
+    CSI2_HOST_CHECK(memcmp(&line1[TEST_CHANNELS * TEST_SAMPLES * 2u], &sum, sizeof(sum)) == 0);
+    CSI2_HOST_CHECK(sum < 0);
+}
+
+/*==================================================================================================
+*                                        GLOBAL FUNCTIONS
+==================================================================================================*/
+int main(void)
+{
+    Test_Generator();
+    Test_Frames();
+    (void)printf("Csi2_TestModel : %s (%u failed checks)\n", (gCsi2HostFails == 0u) ? "PASS" : "FAIL",
+                 (unsigned)gCsi2HostFails);
+    return (gCsi2HostFails == 0u) ? 0 : 1;
+}
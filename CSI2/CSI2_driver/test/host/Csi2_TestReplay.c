@@ -0,0 +1,257 @@
+/*
+ * Copyright 2023 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <string.h>
+#include "Csi2_HostModel.h"
+#include "rsdk_csi2_driver_api.h"
+
+/*==================================================================================================
+*                                          LOCAL MACROS
+==================================================================================================*/
+#define TEST_CHANNELS       4u
+#define TEST_SAMPLES        64u
+#define TEST_LINES          16u
+#define TEST_FRAMES         3u
+#define TEST_LINE_LEN       ((TEST_CHANNELS * TEST_SAMPLES * 2u) + CSI2_HOST_STAT_LEN)
+/* the recorded line : the samples and the statistics records, without the padding to the buffer line length      */
+#define TEST_DATA_LINE_LEN  ((TEST_CHANNELS * TEST_SAMPLES * 2u) + (TEST_CHANNELS * CSI2_HOST_STAT_REC_LEN))
+#define TEST_REC_LEN        (((uint32)sizeof(rsdkCsi2CapFrameHdr_t) + (TEST_LINES * TEST_DATA_LINE_LEN) +      \
+                              (RSDK_CSI2_CAP_ALIGN - 1u)) & ~(RSDK_CSI2_CAP_ALIGN - 1u))
+#define TEST_CAP_LEN        ((uint32)sizeof(rsdkCsi2CapFileHdr_t) + (TEST_FRAMES * TEST_REC_LEN))
+#define TEST_FREQ_REC       1000000u        /* the recording counter, 1 MHz                                         */
+#define TEST_FRAME_PERIOD   5000u           /* the recorded frames period, in recording ticks                       */
+
+/*==================================================================================================
+*                                         LOCAL VARIABLES
+==================================================================================================*/
+static uint8                    gsTestBuf[TEST_LINES * TEST_LINE_LEN] __attribute__((aligned(16)));
+static uint8                    gsTestCap[TEST_CAP_LEN] __attribute__((aligned(16)));
+static Csi2_SetupParamsType     gsTestSetup;
+static Csi2_VCParamsType        gsTestVC;
+static uint32                   gsTestFs, gsTestLineEnd, gsTestFe, gsTestErr;
+
+/*==================================================================================================
+*                                         LOCAL FUNCTIONS
+==================================================================================================*/
+static void Test_EventsCb(Csi2_ErrorReportType *pReport)
+{
+    uint8   evt = pReport->evtMaskVC[CSI2_VC_0];
+
+    gsTestFs += ((evt & (uint8)CSI2_EVT_FRAME_START) != 0u) ? 1u : 0u;
+    gsTestLineEnd += ((evt & (uint8)CSI2_EVT_LINE_END) != 0u) ? 1u : 0u;
+    gsTestFe += ((evt & (uint8)CSI2_EVT_FRAME_END) != 0u) ? 1u : 0u;
+}
+
+static void Test_ErrorsCb(Csi2_ErrorReportType *pReport)
+{
+    (void)pReport;
+    gsTestErr++;
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Set up unit 0, VC 0 : RAW12, 4 channels, one frame per buffer, FrameStart/LINEDONE/FrameEnd.
+ *
+ */
+static Std_ReturnType Test_Setup(void)
+{
+    uint32  i;
+
+    Csi2Host_ModelReset(CSI2_UNIT_0);
+    (void)memset(&gsTestSetup, 0, sizeof(gsTestSetup));
+    (void)memset(&gsTestVC, 0, sizeof(gsTestVC));
+    (void)memset(gsTestBuf, 0, sizeof(gsTestBuf));
+    gsTestSetup.numLanesRx = (uint8)CSI2_LANE_3;
+    for (i = 0u; i < (uint32)CSI2_MAX_LANE; i++)
+    {
+        gsTestSetup.lanesMapRx[i] = (uint8)i;
+    }
+    gsTestSetup.rxClkFreq = 800u;
+    gsTestSetup.vcConfigPtr[CSI2_VC_0] = &gsTestVC;
+    gsTestSetup.pCallback[RSDK_CSI2_RX_ERR_IRQ_ID] = Test_ErrorsCb;
+    gsTestSetup.pCallback[RSDK_CSI2_PATH_ERR_IRQ_ID] = Test_ErrorsCb;
+    gsTestSetup.pCallback[RSDK_CSI2_EVENTS_IRQ_ID] = Test_EventsCb;
+    gsTestVC.streamDataType = (uint16)CSI2_DATA_TYPE_RAW12;
+    gsTestVC.channelsNum = (uint8)TEST_CHANNELS;
+    gsTestVC.vcEventsReq = (uint32)CSI2_EVT_FRAME_START | (uint32)CSI2_EVT_FRAME_END | (uint32)CSI2_EVT_LINE_END;
+    gsTestVC.expectedNumSamples = (uint16)TEST_SAMPLES;
+    gsTestVC.expectedNumLines = (uint16)TEST_LINES;
+    gsTestVC.bufNumLines = (uint16)TEST_LINES;
+    gsTestVC.bufLineLen = (uint16)TEST_LINE_LEN;
+    gsTestVC.bufDataPtr = gsTestBuf;
+    gsTestVC.bufNumLinesTrigger = 1u;
+    gsTestFs = 0u;
+    gsTestLineEnd = 0u;
+    gsTestFe = 0u;
+    gsTestErr = 0u;
+    return Csi2_Setup(CSI2_UNIT_0, &gsTestSetup);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Record TEST_FRAMES synthetic frames of unit 0, VC 0 in gsTestCap, TEST_FRAME_PERIOD apart.
+ *
+ */
+static void Test_Record(void)
+{
+    static uint8            line[TEST_LINE_LEN];
+    rsdkCsi2CapFileHdr_t    fileHdr;
+    rsdkCsi2CapFrameHdr_t   frameHdr;
+    Csi2Host_ChirpGenType   gen;
+    uint8                   *pRec;
+    uint32                  iFrame, iLine;
+    const Csi2_VCDriverStateType *pVCState = &gCsi2Settings[(uint8)CSI2_UNIT_0].workingParamVC[CSI2_VC_0];
+
+    (void)memset(gsTestCap, 0, sizeof(gsTestCap));
+    (void)memset(&fileHdr, 0, sizeof(fileHdr));
+    fileHdr.magic = RSDK_CSI2_CAP_FILE_MAGIC;
+    fileHdr.version = (uint16_t)RSDK_CSI2_CAP_VERSION;
+    fileHdr.hdrLen = (uint16_t)sizeof(fileHdr);
+    fileHdr.framesNum = TEST_FRAMES;
+    fileHdr.counterFreq = TEST_FREQ_REC;
+    (void)memcpy(gsTestCap, &fileHdr, sizeof(fileHdr));
+    (void)memset(&gen, 0, sizeof(gen));
+    gen.seed = 0xcafeu;
+    gen.dc[0] = -300;
+    gen.dc[1] = 300;
+    gen.amp = 1000;
+    gen.noise = 50;
+    for (iFrame = 0u; iFrame < TEST_FRAMES; iFrame++)
+    {
+        pRec = &gsTestCap[(uint32)sizeof(fileHdr) + (iFrame * TEST_REC_LEN)];
+        (void)memset(&frameHdr, 0, sizeof(frameHdr));
+        frameHdr.magic = RSDK_CSI2_CAP_FRAME_MAGIC;
+        frameHdr.hdrLen = (uint16_t)sizeof(frameHdr);
+        frameHdr.unitId = (uint8_t)CSI2_UNIT_0;
+        frameHdr.vcId = (uint8_t)CSI2_VC_0;
+        frameHdr.recLen = TEST_REC_LEN;
+        frameHdr.frameSeq = iFrame + 1u;
+        frameHdr.timeFrameStart = (uint64_t)iFrame * TEST_FRAME_PERIOD;
+        frameHdr.timeFrameEnd = frameHdr.timeFrameStart + (TEST_FRAME_PERIOD / 2u);
+        frameHdr.dataLineLen = (uint16_t)TEST_DATA_LINE_LEN;
+        frameHdr.dataLines = (uint16_t)TEST_LINES;
+        (void)memcpy(pRec, &frameHdr, sizeof(frameHdr));
+        for (iLine = 0u; iLine < TEST_LINES; iLine++)
+        {
+            Csi2Host_ChirpLine(&gen, pVCState, line);
+            (void)memcpy(&pRec[sizeof(frameHdr) + (iLine * TEST_DATA_LINE_LEN)], line, TEST_DATA_LINE_LEN);
+        }
+    }
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Check the buffer holds the lines of a recorded frame.
+ *
+ */
+static boolean Test_BufIsFrame(const uint32 iFrame)
+{
+    const uint8 *pRec = &gsTestCap[(uint32)sizeof(rsdkCsi2CapFileHdr_t) + (iFrame * TEST_REC_LEN) +
+                                   (uint32)sizeof(rsdkCsi2CapFrameHdr_t)];
+    uint32      iLine;
+    boolean     rez = TRUE;
+
+    for (iLine = 0u; iLine < TEST_LINES; iLine++)
+    {
+        if (memcmp(&gsTestBuf[iLine * TEST_LINE_LEN], &pRec[iLine * TEST_DATA_LINE_LEN], TEST_DATA_LINE_LEN) != 0)
+        {
+            rez = FALSE;
+        }
+    }
+    return rez;
+}
+
+/*================================================================================================*/
+/*
+ * @brief       A capture replayed as fast as possible : the frames are in the buffer and the events are raised
+ *              as for a real reception.
+ *
+ */
+static void Test_ReplayFast(void)
+{
+    uint32  framesNum = 0u;
+
+    CSI2_HOST_CHECK(Test_Setup() == (Std_ReturnType)E_OK);
+    Test_Record();
+    CSI2_HOST_CHECK(Csi2_ReplayCapture(gsTestCap, TEST_CAP_LEN, CSI2_REPLAY_FAST, &framesNum) ==
+                    (Std_ReturnType)E_OK);
+    CSI2_HOST_CHECK(framesNum == TEST_FRAMES);
+    CSI2_HOST_CHECK(gsTestErr == 0u);
+    CSI2_HOST_CHECK(gsTestFs == TEST_FRAMES);
+    CSI2_HOST_CHECK(gsTestLineEnd == (TEST_FRAMES * TEST_LINES));
+    CSI2_HOST_CHECK(gsTestFe == TEST_FRAMES);
+    CSI2_HOST_CHECK(Csi2_GetFramesCounter(CSI2_UNIT_0, CSI2_VC_0) == TEST_FRAMES);
+    CSI2_HOST_CHECK(Test_BufIsFrame(TEST_FRAMES - 1u) == TRUE);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       A paced replay keeps the recorded timing, from the first FrameStart to the last FrameEnd.
+ *
+ */
+static void Test_ReplayPaced(void)
+{
+    uint32      framesNum = 0u;
+    uint64_t    tStart, tElapsed, tRec;
+
+    CSI2_HOST_CHECK(Test_Setup() == (Std_ReturnType)E_OK);
+    Test_Record();
+    tStart = Csi2Host_GetTime();
+    CSI2_HOST_CHECK(Csi2_ReplayCapture(gsTestCap, TEST_CAP_LEN, CSI2_REPLAY_PACED, &framesNum) ==
+                    (Std_ReturnType)E_OK);
+    tElapsed = Csi2Host_GetTime() - tStart;
+    /* recording ticks to ns, the host counter                                                                      */
+    tRec = ((((uint64_t)(TEST_FRAMES - 1u) * TEST_FRAME_PERIOD) + (TEST_FRAME_PERIOD / 2u)) * 1000000000u) /
+           TEST_FREQ_REC;
+    CSI2_HOST_CHECK(framesNum == TEST_FRAMES);
+    CSI2_HOST_CHECK(gsTestFe == TEST_FRAMES);
+    CSI2_HOST_CHECK(tElapsed >= tRec);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Truncated and corrupted captures : the complete frames are replayed, then an error.
+ *
+ */
+static void Test_ReplayBroken(void)
+{
+    uint32  framesNum = 0u;
+
+    CSI2_HOST_CHECK(Test_Setup() == (Std_ReturnType)E_OK);
+    Test_Record();
+    /* cut in the second frame radar data                                                                           */
+    CSI2_HOST_CHECK(Csi2_ReplayCapture(gsTestCap, (uint64)sizeof(rsdkCsi2CapFileHdr_t) + TEST_REC_LEN + 100u,
+                                       CSI2_REPLAY_FAST, &framesNum) != (Std_ReturnType)E_OK);
+    CSI2_HOST_CHECK(framesNum == 1u);
+    CSI2_HOST_CHECK(gsTestFe == 1u);
+    /* a corrupted second frame header                                                                              */
+    gsTestCap[(uint32)sizeof(rsdkCsi2CapFileHdr_t) + TEST_REC_LEN] ^= 0xffu;
+    CSI2_HOST_CHECK(Csi2_ReplayCapture(gsTestCap, TEST_CAP_LEN, CSI2_REPLAY_FAST, &framesNum) !=
+                    (Std_ReturnType)E_OK);
+    CSI2_HOST_CHECK(framesNum == 1u);
+    /* not a capture                                                                                                */
+    gsTestCap[0] ^= 0xffu;
+    CSI2_HOST_CHECK(Csi2_ReplayCapture(gsTestCap, TEST_CAP_LEN, CSI2_REPLAY_FAST, &framesNum) !=
+                    (Std_ReturnType)E_OK);
+    CSI2_HOST_CHECK(framesNum == 0u);
+    CSI2_HOST_CHECK(Csi2_ReplayCapture(NULL_PTR, TEST_CAP_LEN, CSI2_REPLAY_FAST, NULL_PTR) != (Std_ReturnType)E_OK);
+}
+
+/*==================================================================================================
+*                                        GLOBAL FUNCTIONS
+==================================================================================================*/
+int main(void)
+{
+    Test_ReplayFast();
+    Test_ReplayPaced();
+    Test_ReplayBroken();
+    (void)printf("Csi2_TestReplay : %s (%u failed checks)\n", (gCsi2HostFails == 0u) ? "PASS" : "FAIL",
+                 (unsigned)gCsi2HostFails);
+    return (gCsi2HostFails == 0u) ? 0 : 1;
+}
@@ -0,0 +1,223 @@
+/*
+ * Copyright 2023 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <string.h>
+#include "Csi2_HostModel.h"
+
+/*==================================================================================================
+*                                          LOCAL MACROS
+==================================================================================================*/
+#define TEST_MAX_CHANNELS   4u
+#define TEST_SAMPLES        64u
+#define TEST_LINES          16u
+#define TEST_LINE_LEN       ((TEST_MAX_CHANNELS * TEST_SAMPLES * 2u) + CSI2_HOST_STAT_LEN)
+
+/*==================================================================================================
+*                                  LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+/* the reference accumulators of a channel, from the statistics records                             */
+typedef struct {
+    sint64          sum;
+    sint16          min;
+    sint16          max;
+    uint16          toggle;
+} Test_StatRefType;
+
+/*==================================================================================================
+*                                         LOCAL VARIABLES
+==================================================================================================*/
+static uint8                    gsTestBuf[TEST_LINES * TEST_LINE_LEN] __attribute__((aligned(16)));
+static Csi2_SetupParamsType     gsTestSetup;
+static Csi2_VCParamsType        gsTestVC;
+static uint32                   gsTestChStat, gsTestErr;
+static Csi2_ChStatType          gsTestLastStat[TEST_MAX_CHANNELS];
+
+/* the statistics records sums : the 32 bits limits, around 0 and both signs                        */
+static const sint32             gsTestSums[] = {
+    -1, 0, 1, (sint32)0x7fffffff, (sint32)(-0x7fffffff - 1), -123456789, 123456789, -32768, 32767, -65536,
+    (sint32)0x40000000, (sint32)-0x40000000, -2, 7, -1000000, 999999
+};
+
+/*==================================================================================================
+*                                         LOCAL FUNCTIONS
+==================================================================================================*/
+static void Test_EventsCb(Csi2_ErrorReportType *pReport)
+{
+    if ((pReport->evtMaskVC[CSI2_VC_0] & (uint8)CSI2_EVT_CHANNEL_STAT) != 0u)
+    {
+        gsTestChStat++;
+        (void)memcpy(gsTestLastStat, pReport->chStat[CSI2_VC_0], sizeof(gsTestLastStat));
+    }
+}
+
+static void Test_ErrorsCb(Csi2_ErrorReportType *pReport)
+{
+    (void)pReport;
+    gsTestErr++;
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Set up unit 0, VC 0 : RAW12, auto DC on all the channels, the frame statistics reported.
+ *
+ */
+static Std_ReturnType Test_Setup(const uint8 channels, const uint8 statManagement)
+{
+    uint32  i;
+
+    Csi2Host_ModelReset(CSI2_UNIT_0);
+    (void)memset(&gsTestSetup, 0, sizeof(gsTestSetup));
+    (void)memset(&gsTestVC, 0, sizeof(gsTestVC));
+    gsTestSetup.numLanesRx = (uint8)CSI2_LANE_3;
+    for (i = 0u; i < (uint32)CSI2_MAX_LANE; i++)
+    {
+        gsTestSetup.lanesMapRx[i] = (uint8)i;
+    }
+    gsTestSetup.rxClkFreq = 800u;
+    gsTestSetup.statManagement = statManagement;
+    gsTestSetup.vcConfigPtr[CSI2_VC_0] = &gsTestVC;
+    gsTestSetup.pCallback[RSDK_CSI2_RX_ERR_IRQ_ID] = Test_ErrorsCb;
+    gsTestSetup.pCallback[RSDK_CSI2_PATH_ERR_IRQ_ID] = Test_ErrorsCb;
+    gsTestSetup.pCallback[RSDK_CSI2_EVENTS_IRQ_ID] = Test_EventsCb;
+    gsTestVC.streamDataType = (uint16)CSI2_DATA_TYPE_RAW12;
+    gsTestVC.channelsNum = channels;
+    gsTestVC.vcEventsReq = (uint32)CSI2_EVT_FRAME_START | (uint32)CSI2_EVT_FRAME_END | (uint32)CSI2_EVT_LINE_END |
+                           (uint32)CSI2_EVT_CHANNEL_STAT;
+    gsTestVC.expectedNumSamples = (uint16)TEST_SAMPLES;
+    gsTestVC.expectedNumLines = (uint16)TEST_LINES;
+    gsTestVC.bufNumLines = (uint16)TEST_LINES;
+    gsTestVC.bufLineLen = (uint16)TEST_LINE_LEN;
+    gsTestVC.bufDataPtr = gsTestBuf;
+    gsTestVC.bufNumLinesTrigger = 1u;
+    for (i = 0u; i < (uint32)channels; i++)
+    {
+        gsTestVC.offsetCompReal[i] = (sint16)CSI2_OFFSET_AUTOCOMPUTE;
+    }
+    gsTestChStat = 0u;
+    gsTestErr = 0u;
+    return Csi2_Setup(CSI2_UNIT_0, &gsTestSetup);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Write the statistics records of all the buffer lines, as the interface does, and the reference
+ *              accumulators of the frame.
+ *
+ */
+static void Test_WriteStat(const uint32 channels, Test_StatRefType *pRef)
+{
+    uint32  iLine, iCh, k;
+    uint8   *pRec;
+    sint32  sum;
+    sint16  vMin, vMax;
+    uint16  toggle;
+
+    for (iCh = 0u; iCh < channels; iCh++)
+    {
+        pRef[iCh].sum = 0;
+        pRef[iCh].min = (sint16)0x7fff;
+        pRef[iCh].max = (sint16)-0x8000;
+        pRef[iCh].toggle = 0u;
+    }
+    for (iLine = 0u; iLine < TEST_LINES; iLine++)
+    {
+        pRec = &gsTestBuf[(iLine * TEST_LINE_LEN) + (channels * TEST_SAMPLES * 2u)];
+        for (iCh = 0u; iCh < channels; iCh++)
+        {
+            k = (iLine * channels) + iCh;
+            sum = gsTestSums[k % (uint32)(sizeof(gsTestSums) / sizeof(gsTestSums[0]))];
+            vMin = (sint16)(-2048 + (sint32)((k * 37u) % 1500u));
+            vMax = (sint16)(2047 - (sint32)((k * 53u) % 1500u));
+            toggle = (uint16)(0x10u << (k % 12u));
+            (void)memcpy(&pRec[0], &sum, sizeof(sum));
+            (void)memcpy(&pRec[4], &vMin, sizeof(vMin));
+            (void)memcpy(&pRec[6], &vMax, sizeof(vMax));
+            (void)memcpy(&pRec[8], &toggle, sizeof(toggle));
+            pRec = &pRec[CSI2_HOST_STAT_REC_LEN];
+            pRef[iCh].sum += sum;
+            pRef[iCh].min = (vMin < pRef[iCh].min) ? vMin : pRef[iCh].min;
+            pRef[iCh].max = (vMax > pRef[iCh].max) ? vMax : pRef[iCh].max;
+            pRef[iCh].toggle |= toggle;
+        }
+    }
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Statistics of every line : the channels accumulators, after the frame lines, equal the reference.
+ *
+ */
+static void Test_StatEveryLine(const uint8 channels)
+{
+    Test_StatRefType    ref[TEST_MAX_CHANNELS];
+    const Csi2_VCDriverStateType *pVCState = &gCsi2Settings[(uint8)CSI2_UNIT_0].workingParamVC[CSI2_VC_0];
+    uint32              iLine, iCh;
+
+    CSI2_HOST_CHECK(Test_Setup(channels, (uint8)CSI2_AUTODC_EVERY_LINE) == (Std_ReturnType)E_OK);
+    Test_WriteStat((uint32)channels, ref);
+    Csi2Host_RaiseEvents(CSI2_UNIT_0, (uint32)CSI2_EVT_FRAME_START, 0u, (uint32)CSI2_VC_0);
+    for (iLine = 0u; iLine < TEST_LINES; iLine++)
+    {
+        Csi2Host_RaiseEvents(CSI2_UNIT_0, 0u, MIPICSI2_RX_CHNL_INTRS_LINEDONE_MASK, (uint32)CSI2_VC_0);
+    }
+    for (iCh = 0u; iCh < (uint32)channels; iCh++)
+    {
+        CSI2_HOST_CHECK(pVCState->statDC[iCh].channelSum == ref[iCh].sum);
+        CSI2_HOST_CHECK(pVCState->statDC[iCh].channelMin == ref[iCh].min);
+        CSI2_HOST_CHECK(pVCState->statDC[iCh].channelMax == ref[iCh].max);
+        CSI2_HOST_CHECK(pVCState->statDC[iCh].channelBitToggle == ref[iCh].toggle);
+    }
+    CSI2_HOST_CHECK(gsTestErr == 0u);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Statistics at FrameEnd : the whole buffer in one batch, the frame statistics equal the reference.
+ *
+ */
+static void Test_StatAtFe(const uint8 channels)
+{
+    Test_StatRefType    ref[TEST_MAX_CHANNELS];
+    sint64              mean;
+    sint16              meanErr;
+    uint32              iCh;
+
+    CSI2_HOST_CHECK(Test_Setup(channels, (uint8)CSI2_AUTODC_AT_FE) == (Std_ReturnType)E_OK);
+    Test_WriteStat((uint32)channels, ref);
+    Csi2Host_RaiseEvents(CSI2_UNIT_0, (uint32)CSI2_EVT_FRAME_START, 0u, (uint32)CSI2_VC_0);
+    Csi2Host_RaiseEvents(CSI2_UNIT_0, (uint32)CSI2_EVT_FRAME_END, 0u, (uint32)CSI2_VC_0);
+    CSI2_HOST_CHECK(gsTestChStat == 1u);
+    for (iCh = 0u; iCh < (uint32)channels; iCh++)
+    {
+        /* the extreme sums give means out of the sample range, the reported mean keeps the low 16 bits            */
+        mean = ref[iCh].sum / (sint64)(TEST_LINES * TEST_SAMPLES);
+        meanErr = (sint16)(uint16)((uint16)gsTestLastStat[iCh].chMean - (uint16)mean);
+        CSI2_HOST_CHECK(gsTestLastStat[iCh].chMin == ref[iCh].min);
+        CSI2_HOST_CHECK(gsTestLastStat[iCh].chMax == ref[iCh].max);
+        CSI2_HOST_CHECK(gsTestLastStat[iCh].chToggle == ref[iCh].toggle);
+        CSI2_HOST_CHECK((meanErr >= -1) && (meanErr <= 1));
+    }
+    CSI2_HOST_CHECK(gsTestErr == 0u);
+}
+
+/*==================================================================================================
+*                                        GLOBAL FUNCTIONS
+==================================================================================================*/
+int main(void)
+{
+    /* 4 channels : the 40 bytes statistics block, the NEON batch where used; 3 channels : always scalar            */
+    Test_StatEveryLine(4u);
+    Test_StatAtFe(4u);
+    Test_StatEveryLine(3u);
+    Test_StatAtFe(3u);
+    (void)printf("Csi2_TestStat (%s) : %s (%u failed checks)\n",
+                 (CSI2_STAT_NEON_USAGE == STD_ON) ? "NEON" : "scalar", (gCsi2HostFails == 0u) ? "PASS" : "FAIL",
+                 (unsigned)gCsi2HostFails);
+    return (gCsi2HostFails == 0u) ? 0 : 1;
+}
@@ -0,0 +1,20 @@
+/*
+ * Copyright 2023 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef RSDK_HOST_LINUX_KERNEL_H
+#define RSDK_HOST_LINUX_KERNEL_H
+
+/*  Host build replacement of the kernel helpers used by the kernel-space sources built on the host (the event
+ *  records encoder).
+ */
+#include <stddef.h>
+#include <stdint.h>
+
+#define max(a, b)           (((a) > (b)) ? (a) : (b))
+#define max3(a, b, c)       max(max((a), (b)), (c))
+#define ALIGN(x, a)         (((x) + ((a) - 1u)) & ~((size_t)(a) - 1u))
+
+#endif /* RSDK_HOST_LINUX_KERNEL_H */
@@ -0,0 +1,31 @@
+/*
+ * Copyright 2023 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef RSDK_HOST_LINUX_STRING_H
+#define RSDK_HOST_LINUX_STRING_H
+
+/*  Host build replacement of the kernel string helpers.
+ */
+#include <stddef.h>
+#include <string.h>
+
+/* the first byte not equal to c, NULL if all the bytes are c                                       */
+static inline void *memchr_inv(const void *start, int c, size_t bytes)
+{
+    const unsigned char *p = (const unsigned char *)start;
+    size_t              i;
+
+    for (i = 0u; i < bytes; i++)
+    {
+        if (p[i] != (unsigned char)c)
+        {
+            return (void *)&p[i];
+        }
+    }
+    return NULL;
+}
+
+#endif /* RSDK_HOST_LINUX_STRING_H */
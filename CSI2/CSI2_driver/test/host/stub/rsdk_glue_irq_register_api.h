@@ -0,0 +1,39 @@
+/*
+ * Copyright 2023 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef RSDK_GLUE_IRQ_REGISTER_API_H
+#define RSDK_GLUE_IRQ_REGISTER_API_H
+
+/*  Host build replacement of the platform irq glue : the registers model has no interrupt controller, the handlers
+ *  are called by the model itself, so the registration always succeeds.
+ */
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef uint32_t rsdkCoreId_t;
+typedef void (*rsdkIrqHandler_t)(void);
+
+#define RSDK_CURRENT_CORE       0u
+#define IRQ_REGISTER_SUCCESS    0
+
+static inline int32_t RsdkGlueIrqHandlerRegister(const rsdkIrqHandler_t handler, const uint32_t irqId,
+                                                 const rsdkCoreId_t core, const uint8_t priority)
+{
+    (void)handler;
+    (void)irqId;
+    (void)core;
+    (void)priority;
+    return IRQ_REGISTER_SUCCESS;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RSDK_GLUE_IRQ_REGISTER_API_H */
@@ -45,6 +45,17 @@ extern "C" {
                                                              * this value is internally used by the driver, and if 
                                                              * application use it as parameter, unknown results can
                                                              * appear.                                              */
+#define RSDK_CTE_LUT_PART_LEN               32u             /**< The number of events in a CTE LUT part             */
+#define RSDK_CTE_LUT_PARTS                  2u              /**< The number of CTE LUT parts                        */
+#define RSDK_CTE_LUT_IMAGE_VERSION          1u              /**< The current version of the LUT image layout        */
+#define RSDK_CTE_PLAYLIST_MAX_LEN           8u              /**< The maximum number of table sets into a playlist   */
+#define RSDK_CTE_IRQ_SET_INDEX_SHIFT        24u             /**< While a playlist is used, the reported events
+                                                             * contain the active table set index in the upper byte */
+#define RSDK_CTE_IRQ_SET_INDEX_MASK         0xff000000u
+#define RSDK_CTE_TABLES_BLOB_VERSION        1u              /**< The current version of the tables blob layout      */
+#define RSDK_CTE_STATS_EVT_BITS             10u             /**< The events with timing statistics, bits 0..9       */
+#define RSDK_CTE_STATS_HIST_BINS            32u             /**< Histogram bins : bin N counts the times with N
+                                                             * significant bits, the last bin the longer times      */
 
 /*==================================================================================================
  *                                             ENUMS
@@ -195,7 +206,12 @@ typedef enum {
     RSDK_CTE_IRQ_TT1_END        = 0x08u,    /**< End of TimeTable 1 execution                   */
     RSDK_CTE_IRQ_RCS            = 0x40u,    /**< Raising edge of RCS signal                     */
     RSDK_CTE_IRQ_RFS            = 0x80u,    /**< Raising edge of RFS signal                     */
-    RSDK_CTE_IRQ_TABLE_EXEC_END = 0x200u    /**< Table execution was finished                   */
+    RSDK_CTE_IRQ_TABLE_EXEC_END = 0x200u,   /**< Table execution was finished                   */
+    RSDK_CTE_IRQ_TABLES_UPDATED = 0x400u,   /**< Software event : the tables update requested by
+                                                 RsdkCteUpdateTablesShadow took effect          */
+    RSDK_CTE_IRQ_TABLES_TORN    = 0x800u    /**< Software event : a table was started while the update
+                                                 was written, that execution could mix old and new
+                                                 events                                         */
 } rsdkCteIrqDefinition_t;
 
 /*==================================================================================================
@@ -339,6 +355,124 @@ typedef struct {
 #endif
 } rsdkCteInitParams_t;
 
+/**
+ * @brief   Structure for a part of the CTE LUT.
+ * @details The layout is the same as for the CTE registry.
+ *
+ */
+typedef struct {
+    uint32_t            lsbWords[RSDK_CTE_LUT_PART_LEN];    /**< The LUT_LSB values                                 */
+    uint32_t            msbWords[RSDK_CTE_LUT_PART_LEN];    /**< The LUT_MSB values                                 */
+} rsdkCteLutPart_t;
+
+/**
+ * @brief   Structure for a precompiled LUT image.
+ * @details The image is produced by RsdkCteLutImageCompile and contains no pointers, so it can be saved and
+ *          registered later, as is, using RsdkCteLutImageRegister. The image is valid only for a CTE initialization
+ *          with the same clock frequency and output definitions, and timing tables of the same time extent.
+ *
+ */
+typedef struct {
+    uint32_t            imageVersion;               /**< The image layout version, RSDK_CTE_LUT_IMAGE_VERSION       */
+    uint8_t             lutPartsNr;                 /**< The number of used LUT parts (1 or 2)                      */
+    uint8_t             reserved[3];                /**< Not used, must be 0                                        */
+    uint32_t            lutDuration[RSDK_CTE_LUT_PARTS];    /**< The tables execution limits, in CTE ticks          */
+    uint64_t            setupHash;                  /**< The hash of the CTE setup the image was compiled for       */
+    rsdkCteLutPart_t    lutParts[RSDK_CTE_LUT_PARTS];       /**< The LUT content                                    */
+    uint64_t            contentHash;                /**< The hash of all the fields above, the image identifier     */
+    uint64_t            lutChecksum;                /**< The expected LUT checksum after the image load; 0 means not
+                                                        known yet, the value is recorded by the driver at the first
+                                                        load of the image                                       */
+} rsdkCteLutImage_t;
+
+/**
+ * @brief   Timing statistics for one event type.
+ * @details All times are in system counter ticks (rsdkCteTimingStats_t::counterFreq).
+ *          Missed events are estimated from the inter-arrival periods longer than 1.5 x the average period.
+ *
+ */
+typedef struct {
+    uint32_t            eventsNum;                  /**< Events seen by the interrupt handler                       */
+    uint32_t            missedNum;                  /**< Events estimated as missed                                 */
+    uint32_t            periodsNum;                 /**< Inter-arrival periods measured                             */
+    uint32_t            reserved;
+    uint64_t            lastTime;                   /**< Timestamp of the last event                                */
+    uint64_t            periodMin;                  /**< Minimum inter-arrival period                               */
+    uint64_t            periodMax;                  /**< Maximum inter-arrival period                               */
+    uint64_t            periodSum;                  /**< Sum of the inter-arrival periods                           */
+    uint64_t            periodAvg;                  /**< Moving average of the period                               */
+    uint32_t            periodHist[RSDK_CTE_STATS_HIST_BINS];   /**< Inter-arrival periods histogram                */
+} rsdkCteEvtTimingStats_t;
+
+/**
+ * @brief   Events timing statistics, reset by RsdkCteInit.
+ *
+ */
+typedef struct {
+    uint64_t            counterFreq;                /**< System counter frequency, 0 if unknown                     */
+    uint32_t            callsNum;                   /**< Number of interrupt handler executions                     */
+    uint32_t            reserved;
+    uint64_t            serviceMax;                 /**< Maximum interrupt service time, the callback included      */
+    uint64_t            serviceSum;                 /**< Sum of the interrupt service times                         */
+    uint32_t            serviceHist[RSDK_CTE_STATS_HIST_BINS];  /**< Interrupt service times histogram              */
+    rsdkCteEvtTimingStats_t evt[RSDK_CTE_STATS_EVT_BITS];   /**< Per event type, index is the bit of
+                                                                 rsdkCteIrqDefinition_t                             */
+} rsdkCteTimingStats_t;
+
+/**
+ * @brief   Header of a flat tables blob.
+ * @details The blob has no pointers, so it can be built once, saved or transferred as is, and the driver uses it
+ *          directly, after a single validation pass. The header is followed by the sections below, in this order,
+ *          each one immediately after the previous one:
+ *          - rsdkCteBlobOutput_t[outputsNr[0] + outputsNr[1]] : the output definitions for table 0, then table 1
+ *          - rsdkCteBlobEvent_t[tableLen[0] + tableLen[1]]    : the events of table 0, then table 1
+ *          - rsdkCteBlobAction_t[actionsNr]                   : the actions of all the events, in the events order
+ *          and the padding to a multiple of 4 bytes. The blob must be 4 bytes aligned.
+ *          For RsdkCteUpdateTablesBlob, the output definitions of the initialization are used and outputsNr must be 0.
+ *
+ */
+typedef struct {
+    uint32_t            blobVersion;                /**< The blob layout version, RSDK_CTE_TABLES_BLOB_VERSION      */
+    uint32_t            blobSize;                   /**< The blob size in bytes, the header and the padding included*/
+    uint8_t             tableLen[RSDK_CTE_LUT_PARTS];   /**< The events number of each table; tableLen[1] = 0 means a
+                                                        single table, of up to 64 events, else each table has up to
+                                                        32 events                                                   */
+    uint8_t             outputsNr[RSDK_CTE_LUT_PARTS];  /**< The output definitions number for each table          */
+    uint16_t            actionsNr;                  /**< The total number of actions                                */
+    uint16_t            reserved;                   /**< Not used, must be 0                                        */
+    uint32_t            timeLimit[RSDK_CTE_LUT_PARTS];  /**< The tables time limits, in ns; 0 means no limit       */
+} rsdkCteBlobHeader_t;
+
+/**
+ * @brief   Output definition into a tables blob, the compact form of rsdkCteSingleOutputDef_t.
+ *
+ */
+typedef struct {
+    uint8_t             outputSignal;               /**< The output signal, a rsdkCteOutput_t value                 */
+    uint8_t             signalType;                 /**< The signal type, a rsdkCteOutputType_t value               */
+    uint16_t            reserved;                   /**< Not used, must be 0                                        */
+    uint32_t            clockPeriod;                /**< The clock period, in ns, used only for CLOCK type          */
+} rsdkCteBlobOutput_t;
+
+/**
+ * @brief   Event into a tables blob; the actions of the event follow the ones of the previous event.
+ *
+ */
+typedef struct {
+    uint32_t            absTime;                    /**< The absolute time of the event, in ns                     */
+    uint8_t             actionsNr;                  /**< The number of actions, at most one for each output        */
+    uint8_t             reserved[3];                /**< Not used, must be 0                                        */
+} rsdkCteBlobEvent_t;
+
+/**
+ * @brief   Action into a tables blob, the compact form of rsdkCteAction_t.
+ *
+ */
+typedef struct {
+    uint8_t             outputSignal;               /**< The output signal, a rsdkCteOutput_t value                 */
+    uint8_t             newState;                   /**< The new state, according to the output type               */
+} rsdkCteBlobAction_t;
+
 /*==================================================================================================
  *                                GLOBAL VARIABLE DECLARATIONS
  ==================================================================================================*/
@@ -438,6 +572,163 @@ rsdkStatus_t RsdkCteUpdateTables(rsdkCteTimeTableDef_t *pTable0, rsdkCteTimeTabl
  */
 uint64_t RsdkCteGetLutChecksum(void);
 
+/**
+ * @brief   Compile the timing table(s) into a LUT image.
+ * @details The image is computed for the current CTE initialization, so a successful RsdkCteInit must be done before.
+ *          The CTE is not changed, so the call can be done while the CTE is working.
+ *
+ * @param[in]   pTable0, pTable1    = pointer to the table(s); first pointer must not be NULL;
+                                        if second is NULL, only one table used, else two tables used
+ * @param[out]  pLutImage           = pointer to the resulting image
+ * @return  RSDK_SUCCESS    = compile succeeded
+ * @return  other values    = compile failed; the rsdk_stat.h contains the values and explanations
+ *
+ */
+rsdkStatus_t RsdkCteLutImageCompile(rsdkCteTimeTableDef_t *pTable0, rsdkCteTimeTableDef_t *pTable1,
+        rsdkCteLutImage_t *pLutImage);
+
+/**
+ * @brief   Register a LUT image into the driver.
+ * @details The driver keeps a limited number of images, identified by the content hash.
+ *          Registering an image already registered is not an error.
+ *
+ * @param[in]   pLutImage           = pointer to the image
+ * @param[out]  pContentHash        = pointer to a uint64_t value, which will receive the image identifier
+ * @return  RSDK_SUCCESS    = registration succeeded
+ * @return  other values    = registration failed; the rsdk_stat.h contains the values and explanations
+ *
+ */
+rsdkStatus_t RsdkCteLutImageRegister(const rsdkCteLutImage_t *pLutImage, uint64_t *pContentHash);
+
+/**
+ * @brief   Load a registered LUT image.
+ * @details The timing tables are replaced by the image content, as a simple copy. The CTE must be stopped.
+ *          Unlike RsdkCteUpdateTables, the tables execution limits are set too.
+ *
+ * @param[in]   contentHash         = the image identifier, as returned by RsdkCteLutImageRegister
+ * @param[out]  pLutChecksum        = pointer to a uint64_t value, which will receive the final LUT checksum
+ * @return  RSDK_SUCCESS    = load succeeded
+ * @return  other values    = load failed; the rsdk_stat.h contains the values and explanations
+ *
+ */
+rsdkStatus_t RsdkCteLutImageLoad(uint64_t contentHash, uint64_t *pLutChecksum);
+
+/**
+ * @brief   Remove a LUT image from the driver.
+ *
+ * @param[in]   contentHash         = the image identifier, as returned by RsdkCteLutImageRegister
+ * @return  RSDK_SUCCESS    = the image was removed
+ * @return  other values    = the image was not registered
+ *
+ */
+rsdkStatus_t RsdkCteLutImageRemove(uint64_t contentHash);
+
+/**
+ * @brief   Stage a timing tables update while the CTE is running.
+ * @details The new LUT content is prepared without stopping the CTE. Each table is replaced at the end of its
+ *          execution, so a running table is not changed; RSDK_CTE_IRQ_TABLES_UPDATED is signaled when all the
+ *          tables were replaced. The replacement is done by the interrupt handler, so a table started again
+ *          before it is finished is possible: it is signaled by RSDK_CTE_IRQ_TABLES_TORN, as that execution could
+ *          mix old and new events. If the CTE is not running, the update is done immediately.
+ *          The number of tables must be the same as for the current tables.
+ *
+ * @param[in]   pTable0, pTable1    = pointer to the new table(s); first pointer must not be NULL;
+                                        if second is NULL, only one table used, else two tables used
+ * @return  RSDK_SUCCESS    = the update was staged
+ * @return  other values    = the update failed; the rsdk_stat.h contains the values and explanations
+ *
+ */
+rsdkStatus_t RsdkCteUpdateTablesShadow(rsdkCteTimeTableDef_t *pTable0, rsdkCteTimeTableDef_t *pTable1);
+
+/**
+ * @brief   Get the status of the last staged tables update.
+ *
+ * @param[out]  pLutChecksum        = pointer to a uint64_t value, which will receive the LUT checksum after update
+ * @return  RSDK_SUCCESS                = the update was done
+ * @return  RSDK_CTE_DRV_UPDATE_PENDING = the update is waiting for the table end
+ *
+ */
+rsdkStatus_t RsdkCteUpdateTablesShadowStatus(uint64_t *pLutChecksum);
+
+/**
+ * @brief   Set a playlist of registered LUT images.
+ * @details Each image is a table set, registered before by RsdkCteLutImageRegister. The first set is loaded now;
+ *          while the CTE is running, the driver switches to the next set at each table end, cyclically, without
+ *          any application action. RSDK_CTE_IRQ_TABLES_UPDATED is signaled at each switch and the events reported
+ *          to the callback contain the active set index (RSDK_CTE_IRQ_SET_INDEX_MASK).
+ *          All the images must use the same number of tables. The CTE must be stopped.
+ *
+ * @param[in]   pContentHash        = pointer to the images identifiers, in the execution order
+ * @param[in]   setsNr              = the number of table sets, 1 to RSDK_CTE_PLAYLIST_MAX_LEN
+ * @return  RSDK_SUCCESS    = the playlist was set
+ * @return  other values    = the playlist was not accepted; the rsdk_stat.h contains the values and explanations
+ *
+ */
+rsdkStatus_t RsdkCtePlaylistSet(const uint64_t *pContentHash, uint8_t setsNr);
+
+/**
+ * @brief   Stop the playlist usage.
+ * @details If the CTE is running, the table set already staged is still used from the next table end.
+ *
+ * @return  RSDK_SUCCESS    = the playlist was cleared
+ * @return  other values    = no playlist used
+ *
+ */
+rsdkStatus_t RsdkCtePlaylistClear(void);
+
+/**
+ * @brief   Get the playlist status.
+ *
+ * @param[out]  pActiveIdx          = pointer to the index of the table set in execution
+ * @param[out]  pSwitchesNr         = pointer to the number of table sets switches since the playlist was set
+ * @return  RSDK_SUCCESS    = the status was reported
+ * @return  other values    = no playlist used
+ *
+ */
+rsdkStatus_t RsdkCtePlaylistStatusGet(uint8_t *pActiveIdx, uint32_t *pSwitchesNr);
+
+/**
+ * @brief   Get the events timing statistics.
+ * @details The interrupt handler measures, for each event type, the inter-arrival periods (histogram, min, max)
+ *          and estimates the missed events; the interrupt service time is measured too.
+ *          The statistics are reset at each RsdkCteInit.
+ *
+ * @param[out]  pTimingStats        = pointer to the statistics copy
+ * @return  RSDK_SUCCESS    = the statistics were copied
+ * @return  other values    = the statistics are not available
+ *
+ */
+rsdkStatus_t RsdkCteGetTimingStats(rsdkCteTimingStats_t *pTimingStats);
+
+/**
+ * @brief   CTE initialization using a tables blob.
+ * @details The same as RsdkCteInit, but the output definitions and the timing tables are taken from the blob;
+ *          the pSignalDef0/1 and pTimeTable0/1 fields of pCteInitParams are not used.
+ *
+ * @param[in]   pCteInitParams      = pointer to the initialization structure
+ * @param[in]   pBlob               = pointer to the tables blob, pBlob->blobSize bytes
+ * @param[out]  pLutChecksum        = pointer to a uint64_t value, which will receive the final LUT checksum
+ * @return  RSDK_SUCCESS    = initialization succeeded
+ * @return  other values    = initialization failed; the rsdk_stat.h contains the values and explanations
+ *
+ */
+rsdkStatus_t RsdkCteInitBlob(const rsdkCteInitParams_t *pCteInitParams, const rsdkCteBlobHeader_t *pBlob,
+        uint64_t *pLutChecksum);
+
+/**
+ * @brief   Timing tables update using a tables blob.
+ * @details The same as RsdkCteUpdateTables, but the tables are taken from the blob, which must have no output
+ *          definitions and the same number of tables as the initialization. The CTE must be stopped.
+ *          Unlike RsdkCteUpdateTables, the tables time limits are set too.
+ *
+ * @param[in]   pBlob               = pointer to the tables blob, pBlob->blobSize bytes
+ * @param[out]  pLutChecksum        = pointer to a uint64_t value, which will receive the final LUT checksum
+ * @return  RSDK_SUCCESS    = update succeeded
+ * @return  other values    = update failed; the rsdk_stat.h contains the values and explanations
+ *
+ */
+rsdkStatus_t RsdkCteUpdateTablesBlob(const rsdkCteBlobHeader_t *pBlob, uint64_t *pLutChecksum);
+
 
 /** @}*/
 
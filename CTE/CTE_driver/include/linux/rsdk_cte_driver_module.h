@@ -12,6 +12,7 @@
 ==================================================================================================*/
 #include <linux/cdev.h>
 #include <linux/interrupt.h>
+#include <linux/spinlock.h>
 #include "oal_comm_kernel.h"
 #include "oal_waitqueue.h"
 #include "rsdk_cte_linux_def.h"
@@ -59,8 +60,11 @@ typedef struct
 	volatile uint32_t *pSrc_1;				// pointer to the SRC_1 registry, used only for Linux
 
     OAL_RPCService_t gspRpcServ;
+    // waitqueue & event ring for reporting the events; the waitqueue is the poll() doorbell
     OAL_waitqueue_t  irqWaitQ;
     uint8_t          registeredEvents;
+    rsdkCteEvtRing_t *pEvtRing;             // vmalloc_user() memory, mmap-able by the user-space
+    spinlock_t       evtRingLock;           // the interrupt and the exit request are the ring producers
 
 } rsdkCteDevice_t;
 
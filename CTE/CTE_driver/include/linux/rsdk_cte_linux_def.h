@@ -22,6 +22,12 @@ extern "C" {
 *                                      DEFINES AND MACROS
 ==================================================================================================*/
 #define RSDK_CTE_RPC_CHANNEL_NAME "RsdkCteRpc"  // RPC channel name
+#define RSDK_CTE_EVT_RING_LEN       64u             // number of slots in the event ring, must be a power of 2
+#define RSDK_CTE_EVT_RING_MASK      (RSDK_CTE_EVT_RING_LEN - 1u)    // mask to get the slot from a ring index
+#define RSDK_CTE_EVT_RING_VERSION   1u              // layout version of the mmap-able event ring
+#define RSDK_CTE_EVT_BITS           16u             // number of event bits counted, the set index not included
+#define RSDK_CTE_EVT_TO_EXIT        0x00fffff0u     // fake event mask to signal closing the events consumer
+#define RSDK_CTE_EVT_READ_MAX       32u             // maximum number of slots returned by one RSDK_CTE_LX_CTE_EVT_READ
 
 /*==================================================================================================
 *                                STRUCTURES AND OTHER TYPEDEFS
@@ -38,6 +44,19 @@ typedef enum
     RSDK_CTE_LX_CTE_REG_EVT,            // register unit event
     RSDK_CTE_LX_CTE_EVTMGR_STOP,        // stop events management
     RSDK_CTE_LX_CTE_READ_CHECKSUM,      // read and return the LUT checksum
+    RSDK_CTE_LX_CTE_IMAGE_COMPILE,      // compile the tables into a LUT image and return it
+    RSDK_CTE_LX_CTE_IMAGE_REGISTER,     // register a LUT image and return its hash
+    RSDK_CTE_LX_CTE_IMAGE_LOAD,         // load a registered LUT image and return the LUT checksum
+    RSDK_CTE_LX_CTE_IMAGE_REMOVE,       // remove a registered LUT image
+    RSDK_CTE_LX_CTE_TABLE_UPDATE_SHADOW,    // stage a table(s) update, committed at the table end
+    RSDK_CTE_LX_CTE_SHADOW_STATUS,      // get the staged update status and the LUT checksum
+    RSDK_CTE_LX_CTE_PLAYLIST_SET,       // set a playlist of registered LUT images
+    RSDK_CTE_LX_CTE_PLAYLIST_CLEAR,     // stop the playlist usage
+    RSDK_CTE_LX_CTE_PLAYLIST_STATUS,    // get the status, as (switches number << 32) | active set index
+    RSDK_CTE_LX_CTE_EVT_READ,           // drain a batch of the event ring slots, without waiting
+    RSDK_CTE_LX_CTE_GET_TIMING_STATS,   // get the events timing statistics
+    RSDK_CTE_LX_CTE_INIT_BLOB,          // CTE initialization, rsdkCteLinuxBlobInit_t followed by the tables blob
+    RSDK_CTE_LX_CTE_TABLE_UPDATE_BLOB,  // table(s) update, the tables blob
     RSDK_CTE_LX_CTE_CALL_MAX            // the total number of defined RPC calls
 } rsdkCteRpcCalls_t;
 
@@ -51,10 +70,57 @@ typedef enum
     RSDK_CTE_LX_EVT_RFS,                // RFS event
     RSDK_CTE_LX_EVT_RCS,                // RCS event
     RSDK_CTE_LX_EVT_TT_END,             // TimeTable ended execution
+    RSDK_CTE_LX_EVT_TABLES_UPDATED,     // the staged table(s) update was committed
     RSDK_CTE_LX_EVT_EVTMGR_STOP,        // Call for user-space thread stop
     RSDK_CTE_LX_EVT_MAX                 // the total number of defined events
 } rsdkCteRpcEvents_t;
 
+/*  One event ring slot : the events reported by one CTE interrupt.
+ */
+typedef struct
+{
+    uint32_t            evtMask;            // rsdkCteIrqDefinition_t bits, with the playlist set index in upper byte
+    uint32_t            evtSeq;             // the interrupt sequence number, a gap means dropped slots
+    uint64_t            timeStamp;          // monotonic time of the interrupt, in ns (ktime_get_ns)
+} rsdkCteEvtSlot_t;
+
+/*  Device event ring, shared between kernel and user-space.
+ *
+ *  All the CTE events are multiplexed into this ring, one slot for each interrupt, instead of one RPC event for
+ *  each event bit. The ring can be mapped read/write using mmap() on the CTE device (/dev/rsdk_cte), offset 0,
+ *  size sizeof(rsdkCteEvtRing_t), or drained in batches by the RSDK_CTE_LX_CTE_EVT_READ RPC.
+ *  It is a single consumer ring :
+ *      - writeIdx is written only by the kernel, after the slot content is complete
+ *      - readIdx is written only by the consumer, after the slot content was used
+ *      - both indexes are free running, the slot is (index & RSDK_CTE_EVT_RING_MASK)
+ *      - the ring is empty when readIdx == writeIdx
+ *  evtCounters[] count each event bit since the driver load, even if the slot was dropped, so the number of
+ *  RCS/RFS edges between two reads is always known. When no slot is available, lostEvents is incremented.
+ *  The last free slot is reserved for the RSDK_CTE_EVT_TO_EXIT request (RSDK_CTE_LX_CTE_EVTMGR_STOP).
+ *  poll() on the CTE device returns POLLIN while the ring is not empty.
+ */
+typedef struct
+{
+    volatile uint32_t   writeIdx;           // producer index, updated by kernel
+    volatile uint32_t   readIdx;            // consumer index, updated by user-space
+    uint32_t            version;            // RSDK_CTE_EVT_RING_VERSION
+    uint32_t            ringLen;            // RSDK_CTE_EVT_RING_LEN
+    volatile uint32_t   lostEvents;         // slots dropped because the ring was full
+    volatile uint32_t   evtSeq;             // the number of interrupts reported
+    uint32_t            reserved[2];        // padding, to keep the slots 16 bytes aligned
+    volatile uint32_t   evtCounters[RSDK_CTE_EVT_BITS];     // occurrences of each event bit
+    rsdkCteEvtSlot_t    evtSlot[RSDK_CTE_EVT_RING_LEN];
+} rsdkCteEvtRing_t;
+
+/*  The reply of RSDK_CTE_LX_CTE_EVT_READ, followed by slotsNr rsdkCteEvtSlot_t.
+ */
+typedef struct
+{
+    uint32_t            slotsNr;            // the number of slots which follow
+    uint32_t            lostEvents;         // the ring lostEvents at the read time
+    uint32_t            evtCounters[RSDK_CTE_EVT_BITS];     // the ring evtCounters at the read time
+} rsdkCteEvtReadHdr_t;
+
 /**
  * @brief   The structure for timing table  initialization, internally used.
  * @details To be used in kernel  space.
@@ -102,6 +168,20 @@ typedef struct {
     rsdkCteIsrCb_t              pCteCallback;   /**< The application callback to be used for the requested events   */
 } rsdkCteLinuxTransfer_t;
 
+/**
+ * @brief   The parameters for CTE initialization using a tables blob, internally used.
+ * @details The structure is followed by the tables blob (rsdkCteBlobHeader_t), which is used in place by the kernel.
+ *          The structure size is a multiple of 4, so the blob stays aligned.
+ *
+ */
+typedef struct {
+    rsdkCteModeDefinition_t     cteMode;        /**< Specify the CTE usage, as for rsdkCteInitParams_t              */
+    uint32_t                    cteClockFrecq;  /**< The frequency of the CTE_clock signal, in Hz, at working time  */
+    uint16_t                    repeatCount;    /**< The number of times the table execution will be repeated      */
+    uint16_t                    reserved;       /**< Not used                                                       */
+    rsdkCteIrqDefinition_t      cteIrqEvents;   /**< The requested combination of interrupt sequence to be used     */
+} rsdkCteLinuxBlobInit_t;
+
 
 /*==================================================================================================
 *                                GLOBAL VARIABLE DECLARATIONS
@@ -118,6 +198,20 @@ rsdkStatus_t CtePlatformModuleRfsGenerateLinuxUs(void);
 rsdkStatus_t CtePlatformModuleUpdateTablesLinuxUs(rsdkCteTimeTableDef_t *pTable0, rsdkCteTimeTableDef_t *pTable1, 
                     uint64_t *pUInt64);
 uint64_t     CtePlatformModuleLinuxUsGetLutChecksum(void);
+rsdkStatus_t CtePlatformModuleLutImageCompileLinuxUs(rsdkCteTimeTableDef_t *pTable0, rsdkCteTimeTableDef_t *pTable1,
+                    rsdkCteLutImage_t *pLutImage);
+rsdkStatus_t CtePlatformModuleLutImageRegisterLinuxUs(const rsdkCteLutImage_t *pLutImage, uint64_t *pContentHash);
+rsdkStatus_t CtePlatformModuleLutImageLoadLinuxUs(uint64_t contentHash, uint64_t *pLutChecksum);
+rsdkStatus_t CtePlatformModuleLutImageRemoveLinuxUs(uint64_t contentHash);
+rsdkStatus_t CtePlatformModuleUpdateTablesShadowLinuxUs(rsdkCteTimeTableDef_t *pTable0, rsdkCteTimeTableDef_t *pTable1);
+rsdkStatus_t CtePlatformModuleUpdateTablesShadowStatusLinuxUs(uint64_t *pLutChecksum);
+rsdkStatus_t CtePlatformModulePlaylistSetLinuxUs(const uint64_t *pContentHash, uint8_t setsNr);
+rsdkStatus_t CtePlatformModulePlaylistClearLinuxUs(void);
+rsdkStatus_t CtePlatformModulePlaylistStatusGetLinuxUs(uint8_t *pActiveIdx, uint32_t *pSwitchesNr);
+rsdkStatus_t CtePlatformModuleGetTimingStatsLinuxUs(rsdkCteTimingStats_t *pTimingStats);
+rsdkStatus_t CtePlatformModuleInitBlobLinuxUs(const rsdkCteInitParams_t *pCteInitParam, const rsdkCteBlobHeader_t *pBlob,
+        uint64_t *pLutChecksum);
+rsdkStatus_t CtePlatformModuleUpdateTablesBlobLinuxUs(const rsdkCteBlobHeader_t *pBlob, uint64_t *pLutChecksum);
 
 
 #ifdef __cplusplus
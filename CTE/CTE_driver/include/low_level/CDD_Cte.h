@@ -207,6 +207,167 @@ Std_ReturnType Cte_UpdateTables(Cte_TimeTableDefType *table0Ptr, Cte_TimeTableDe
  */
 uint64 Cte_GetLutChecksum(void);
 
+#if (CTE_LUT_IMAGE_USAGE == STD_ON)
+/**
+ * @brief   Compile the timing table(s) into a LUT image.
+ * @details The image is computed for the current CTE setup, so the driver must be initialized before.
+ *          No CTE registry is changed. The image contains no pointers and can be saved for a later registration.
+ *
+ * @param[in]   table0Ptr, table1Ptr    = pointer to the table(s); first pointer must not be NULL;
+                                          if second is NULL, only one table used, else two tables used
+ * @param[out]  imagePtr                = pointer to the resulting image
+ * @return  E_OK/RSDK_SUCCESS           = compile succeeded
+ * @return  other values                = compile failed, use the appropriate tools to detect the issue
+ *
+ */
+Std_ReturnType Cte_LutImageCompile(Cte_TimeTableDefType *table0Ptr, Cte_TimeTableDefType *table1Ptr,
+        Cte_LutImageType *imagePtr);
+
+/**
+ * @brief   Register a LUT image into the driver cache.
+ * @details The image is checked and copied; the content hash is the image identifier for the next calls.
+ *
+ * @param[in]   imagePtr                = pointer to the image
+ * @param[out]  contentHashPtr          = pointer to the image identifier
+ * @return  E_OK/RSDK_SUCCESS           = registration succeeded
+ * @return  other values                = registration failed, use the appropriate tools to detect the issue
+ *
+ */
+Std_ReturnType Cte_LutImageRegister(const Cte_LutImageType *imagePtr, uint64 *contentHashPtr);
+
+/**
+ * @brief   Load a registered LUT image.
+ * @details The image is copied into the LUT, without any table processing. The CTE must be initialized, with the
+ *          same setup used for the image compilation, and not running.
+ *
+ * @param[in]   contentHash             = the image identifier
+ * @param[out]  lutChecksumPtr          = pointer to a uint64 value, which will receive the final LUT checksum
+ * @return  E_OK/RSDK_SUCCESS           = load succeeded
+ * @return  other values                = load failed, use the appropriate tools to detect the issue
+ *
+ */
+Std_ReturnType Cte_LutImageLoad(uint64 contentHash, uint64 *lutChecksumPtr);
+
+/**
+ * @brief   Remove a LUT image from the driver cache.
+ *
+ * @param[in]   contentHash             = the image identifier
+ * @return  E_OK/RSDK_SUCCESS           = the image was removed
+ * @return  other values                = the image was not found
+ *
+ */
+Std_ReturnType Cte_LutImageRemove(uint64 contentHash);
+#endif
+
+#if (CTE_SHADOW_UPDATE_USAGE == STD_ON)
+/**
+ * @brief   Stage a timing tables update, committed at the table end.
+ * @details The new LUT content is prepared without stopping the CTE; each LUT part is written at the end of its
+ *          table execution and CTE_IRQ_TABLES_UPDATED is reported when the update is complete; CTE_IRQ_TABLES_TORN
+ *          is reported if a table was started again while its LUT part was written.
+ *          If the CTE is not running, the update is done immediately. The number of tables can't be changed.
+ *
+ * @param[in]   table0Ptr, table1Ptr    = pointer to the new table(s); first pointer must not be NULL;
+                                          if second is NULL, only one table used, else two tables used
+ * @return  E_OK/RSDK_SUCCESS           = the update was staged
+ * @return  other values                = the update failed, use the appropriate tools to detect the issue
+ *
+ */
+Std_ReturnType Cte_UpdateTablesShadow(Cte_TimeTableDefType *table0Ptr, Cte_TimeTableDefType *table1Ptr);
+
+/**
+ * @brief   Get the status of the last staged tables update.
+ *
+ * @param[out]  lutChecksumPtr          = pointer to a uint64 value, which will receive the LUT checksum after
+ *                                        the update; can be NULL
+ * @return  E_OK/RSDK_SUCCESS           = the update was committed
+ * @return  RSDK_CTE_DRV_UPDATE_PENDING = the update is waiting for the table end
+ *
+ */
+Std_ReturnType Cte_UpdateTablesShadowStatus(uint64 *lutChecksumPtr);
+#endif
+
+#if (CTE_PLAYLIST_USAGE == STD_ON)
+/**
+ * @brief   Set a playlist of registered LUT images.
+ * @details The first table set is loaded now; while the CTE is running, the interrupt handler switches to the next
+ *          set at each table end, cyclically. The reported events contain the active set index
+ *          (CTE_IRQ_SET_INDEX_MASK). The images must use the same run mode and the CTE must not be running.
+ *
+ * @param[in]   contentHashPtr          = pointer to the images identifiers, in the execution order
+ * @param[in]   setsNr                  = the number of table sets, 1 to CTE_PLAYLIST_MAX_LEN
+ * @return  E_OK/RSDK_SUCCESS           = the playlist was set
+ * @return  other values                = the playlist was not accepted
+ *
+ */
+Std_ReturnType Cte_PlaylistSet(const uint64 *contentHashPtr, uint8 setsNr);
+
+/**
+ * @brief   Stop the playlist usage; if running, the set already staged is still written at the next table end.
+ *
+ * @return  E_OK/RSDK_SUCCESS           = the playlist was cleared
+ * @return  other values                = no playlist used
+ *
+ */
+Std_ReturnType Cte_PlaylistClear(void);
+
+/**
+ * @brief   Get the playlist status.
+ *
+ * @param[out]  activeIdxPtr            = pointer to the index of the table set in execution
+ * @param[out]  switchesNrPtr           = pointer to the number of sets switches since the playlist set; can be NULL
+ * @return  E_OK/RSDK_SUCCESS           = the status was reported
+ * @return  other values                = no playlist used or wrong parameters
+ *
+ */
+Std_ReturnType Cte_PlaylistStatusGet(uint8 *activeIdxPtr, uint32 *switchesNrPtr);
+#endif
+
+#if (CTE_TIMING_STATS_USAGE == STD_ON)
+/**
+ * @brief   Get the events timing statistics.
+ * @details The statistics are updated lock-free by the interrupt handler, the only writer, so they can be read at
+ *          any time. They are reset by Cte_Setup.
+ *
+ * @return  pointer to the statistics
+ *
+ */
+const Cte_TimingStatsType *Cte_GetTimingStats(void);
+#endif
+
+#if (CTE_TABLES_BLOB_USAGE == STD_ON)
+/**
+ * @brief   CTE setup using a tables blob.
+ * @details The same as Cte_Setup, but the output definitions and the timing tables are taken from the blob, which is
+ *          validated in a single pass and used in place; the signalDef0Ptr/signalDef1Ptr and the
+ *          timeTable0Ptr/timeTable1Ptr fields of the parameters are not used.
+ *
+ * @param[in]   cteInitParamsPtr        = pointer to the initialization structure
+ * @param[in]   blobPtr                 = pointer to the tables blob, 4 bytes aligned
+ * @param[in]   bufferSize              = the bytes available at blobPtr, at least blobPtr->blobSize
+ * @param[out]  lutChecksumPtr          = pointer to a uint64 value, which will receive the final LUT checksum
+ * @return  E_OK/RSDK_SUCCESS           = initialization succeeded
+ * @return  other values                = initialization failed, use the appropriate tools to detect the issue
+ *
+ */
+Std_ReturnType Cte_SetupBlob(const Cte_SetupParamsType *cteInitParamsPtr, const Cte_BlobHeaderType *blobPtr,
+        uint32 bufferSize, uint64 *lutChecksumPtr);
+
+/**
+ * @brief   Timing tables update using a tables blob.
+ * @details The blob must have no output definitions (the ones of the setup are used) and the same number of tables
+ *          and LUT parts as the setup. The CTE must be stopped. Unlike Cte_UpdateTables, the time limits are set too.
+ *
+ * @param[in]   blobPtr                 = pointer to the tables blob, 4 bytes aligned
+ * @param[in]   bufferSize              = the bytes available at blobPtr, at least blobPtr->blobSize
+ * @param[out]  lutChecksumPtr          = pointer to a uint64 value, which will receive the final LUT checksum
+ * @return  E_OK/RSDK_SUCCESS           = update succeeded
+ * @return  other values                = update failed, use the appropriate tools to detect the issue
+ *
+ */
+Std_ReturnType Cte_UpdateTablesBlob(const Cte_BlobHeaderType *blobPtr, uint32 bufferSize, uint64 *lutChecksumPtr);
+#endif
+
 /** @} */
 
 
@@ -60,6 +60,56 @@ extern "C"{
 #define CTE_START_STOP_USAGE                STD_ON
 #endif
 
+/* Pre-processor switch for the precompiled LUT images, kept by the driver in a cache indexed by the image
+ * content hash; a registered image is loaded with a registry copy, without any table processing         */
+#ifndef CTE_LUT_IMAGE_USAGE
+#define CTE_LUT_IMAGE_USAGE                 STD_ON
+#endif
+#define CTE_LUT_IMAGE_CACHE_SIZE            8u      /* the number of LUT images kept by the driver          */
+
+/* Pre-processor switch for the tables update while the CTE is running; the new tables are staged and written
+ * into the LUT parts from the CTE interrupt, at the table end                                                */
+#ifndef CTE_SHADOW_UPDATE_USAGE
+#define CTE_SHADOW_UPDATE_USAGE             STD_ON
+#endif
+
+/* Pre-processor switch for the playlists of registered LUT images, switched by the CTE interrupt at each table
+ * end; it needs the LUT images and the shadow update                                                         */
+#if (CTE_LUT_IMAGE_USAGE == STD_ON) && (CTE_SHADOW_UPDATE_USAGE == STD_ON)
+#define CTE_PLAYLIST_USAGE                  STD_ON
+#else
+#define CTE_PLAYLIST_USAGE                  STD_OFF
+#endif
+#define CTE_PLAYLIST_MAX_LEN                8u      /* the maximum number of table sets into a playlist     */
+
+/* Pre-processor switch for the events timing statistics (inter-arrival histograms, missed events, irq service
+ * time), updated by the CTE interrupt handler; Linux uses the arch counter, a bare-metal build has a counter
+ * only if the platform defines CTE_GET_TIMESTAMP & CTE_GET_TIMESTAMP_FREQ, otherwise the statistics are not used */
+#ifndef CTE_TIMING_STATS_USAGE
+#if defined(linux) || defined(CTE_GET_TIMESTAMP)
+#define CTE_TIMING_STATS_USAGE              STD_ON
+#else
+#define CTE_TIMING_STATS_USAGE              STD_OFF
+#endif
+#endif
+
+/* Pre-processor switch for the flat tables blob (no pointers, offsets implied by the sections lengths), used
+ * directly by the setup and the tables update, after a single validation pass                                */
+#ifndef CTE_TABLES_BLOB_USAGE
+#define CTE_TABLES_BLOB_USAGE               STD_ON
+#endif
+
+/* Pre-processor switch for a non-Linux host build, with the CTE registry in an in-memory model (gCteRegsModel and
+ * gCteSrc1Model, defined by the build); the irq handler is called by the model. The driver selects its Linux paths
+ * on the "linux" macro, which the GNU C modes (the gcc default, -std=gnu99/gnu11) predefine on a Linux host: such
+ * a build must use a strict ISO mode (-std=c99/c11) or -Ulinux. See test/host, built by "make test"           */
+#ifndef CTE_REGS_MODEL_USED
+#define CTE_REGS_MODEL_USED                 STD_OFF
+#endif
+#if (CTE_REGS_MODEL_USED == STD_ON) && defined(linux)
+    #error "CTE : the registers model build must not define linux, use -std=c99/c11 or -Ulinux"
+#endif
+
 
 
 /* Formal instance id for CTE driver, to be used at development time                           */
@@ -78,6 +128,10 @@ extern "C"{
 #define CTE_POWER_OFF                          8u      /* error when calling PowerOff                      */
 #define CTE_POWER_ON                           9u      /* error when calling PowerOn                       */
 #define CTE_GET_VALUE                          10u     /* error when calling a get function                */
+#define CTE_LUT_IMAGE_CALL                     11u     /* error when calling a LUT image function          */
+#define CTE_SHADOW_UPDATE_CALL                 12u     /* error when calling a shadow update function      */
+#define CTE_PLAYLIST_CALL                      13u     /* error when calling a playlist function           */
+#define CTE_TABLES_BLOB_CALL                   14u     /* error when checking a tables blob                */
 
 /* error report management      */
     #define CTE_REPORT_ERROR(a,b,c)  rez = (a)
@@ -35,6 +35,10 @@ extern "C"{
 ==================================================================================================*/
 #include "Cte_Cfg.h"
 #include "Cte_Types.h"
+#if defined(linux) && (CTE_TIMING_STATS_USAGE == STD_ON)
+    #include <linux/timex.h>
+    #include <asm/arch_timer.h>
+#endif
 
 /*==================================================================================================
 *                                 SOURCE FILE VERSION INFORMATION
@@ -51,6 +55,29 @@ extern "C"{
 /*==================================================================================================
 *                                       DEFINES AND MACROS
 ==================================================================================================*/
+#if (CTE_SHADOW_UPDATE_USAGE == STD_ON) && !defined(CTE_WRITE_BARRIER)
+    #if defined(linux)
+        /* the staged tables are read by the irq handler, possibly on another core                                 */
+        #define CTE_WRITE_BARRIER()         smp_wmb()
+    #else
+        /* single core writer/reader by default (application & irq); for SMP the platform must define a DMB        */
+        #define CTE_WRITE_BARRIER()         __asm__ volatile ("" ::: "memory")
+    #endif
+#endif
+
+#if (CTE_TIMING_STATS_USAGE == STD_ON) && !defined(CTE_GET_TIMESTAMP)
+    #if defined(linux)
+        /* the arch (system) counter, monotonic and the same for all cores                                          */
+        #define CTE_GET_TIMESTAMP()         ((uint64)get_cycles())
+        #define CTE_GET_TIMESTAMP_FREQ()    ((uint64)arch_timer_get_cntfrq())
+    #else
+        /* no generic counter access for bare-metal, a null counter would silently give empty statistics            */
+        #error "CTE : CTE_TIMING_STATS_USAGE needs CTE_GET_TIMESTAMP & CTE_GET_TIMESTAMP_FREQ defined by the platform"
+    #endif
+#endif
+#if defined(CTE_GET_TIMESTAMP) != defined(CTE_GET_TIMESTAMP_FREQ)
+    #error "CTE : CTE_GET_TIMESTAMP & CTE_GET_TIMESTAMP_FREQ must be defined together"
+#endif
 
 /*==================================================================================================
 *                                              ENUMS
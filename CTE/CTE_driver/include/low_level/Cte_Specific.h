@@ -20,6 +20,9 @@
     #endif
 
     #include "S32R45_CTE.h"
+#if (CTE_REGS_MODEL_USED == STD_ON)
+    #include "S32R45_SRC_1.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -59,6 +62,11 @@ extern "C" {
 #define CTE_MAX_REQ_CLK_DIVIDER     192u                        /* Max clock divider                                */
 #define CTE_MAX_CLK_DIVIDERS        8u                          // the number of possible dividers for clocks       */
 
+#define CTE_HASH_OFFSET_BASIS       0xcbf29ce484222325LLU       /* FNV-1a 64 bits offset basis                      */
+#define CTE_HASH_PRIME              0x00000100000001b3LLU       /* FNV-1a 64 bits prime                             */
+
+#define CTE_IRQ_HW_MASK             0x3ffu                      /* the irq sources of the hardware, INTEN/INTSTAT   */
+
 
 /*==================================================================================================
  *                                             ENUMS
@@ -94,6 +102,13 @@ typedef enum {
     CTE_DRIVER_STATE_RUNNING,
 }Cte_DriverStatusType;
 
+/* enum for the states of the tables update staged while running                */
+typedef enum {
+    CTE_SHADOW_IDLE = 0u,                   /* no update requested                                          */
+    CTE_SHADOW_PENDING,                     /* the update is staged, waiting for the table(s) end           */
+    CTE_SHADOW_DONE,                        /* the update took effect                                       */
+}Cte_ShadowStateType;
+
 
 /*==================================================================================================
  *                                STRUCTURES AND OTHER TYPEDEFS
@@ -103,6 +118,7 @@ typedef struct {
     uint8                   cteDriverStatus;        /* the current status of the driver                             */
     uint8                   cteMainClockDivider;    /* the main divider, for main CTE clock divider                 */
     uint8                   cteUsedClockDividers;   /* the number of used clocks                                    */
+    uint8                   cteLutPartsNr;          /* the number of LUT parts used by the current run mode         */
     uint32                  cteWorkingFreq;         /* the CTE working frequency, in Hz                             */
     uint32                  cteReqEvents;           /* the CTE events requested by application to be signaled       */
     Cte_IsrCbType           pCteCallback;           /* the application callback to be used for the requested events */
@@ -111,16 +127,48 @@ typedef struct {
     Cte_SingleOutputDefType signalDef1Ptr[CTE_OUTPUT_MAX + 1u];
 } Cte_DriverStateType;
 
+/* Structure for the tables update staged while the CTE is running   */
+typedef struct {
+    Cte_LutImageType        image;                  /* the new LUT content, for Cte_UpdateTablesShadow              */
+    const Cte_LutImageType  *imagePtr;              /* the staged image : the one above or a registered image       */
+    volatile uint8          state;                  /* the update state, Cte_ShadowStateType                        */
+    volatile uint8          pendingParts;           /* the LUT parts not written yet, one bit for each part         */
+    uint32                  addedIrqs;              /* the irq sources enabled only for the update                  */
+    uint64                  lutChecksum;            /* the LUT checksum after the update                            */
+} Cte_ShadowUpdateType;
+
+/* Structure for the playlist of registered LUT images      */
+typedef struct {
+    volatile uint8          setsNr;                 /* the number of table sets, 0 if no playlist used              */
+    volatile uint8          activeIdx;              /* the table set in execution                                   */
+    uint8                   stagedIdx;              /* the table set staged for the next table end                  */
+    uint8                   imageIdx[CTE_PLAYLIST_MAX_LEN]; /* the driver cache index of each table set image       */
+    uint32                  switchesNr;             /* the number of table sets switches since the playlist set     */
+} Cte_PlaylistType;
+
 /*==================================================================================================
  *                                GLOBAL VARIABLE DECLARATIONS
  ==================================================================================================*/
 extern Cte_DriverStateType gsDriverData;            /* the driver necessary data                */
 extern volatile CTE_Type *gspCTEPtr;                   /* the pointer to the CTE registry          */
+#if (CTE_TIMING_STATS_USAGE == STD_ON)
+extern Cte_TimingStatsType gCteTimingStats;         /* the events timing statistics             */
+#endif
+#if (CTE_REGS_MODEL_USED == STD_ON)
+extern volatile CTE_Type gCteRegsModel;             /* the CTE registry, in memory              */
+extern volatile SRC_1_Type gCteSrc1Model;           /* the SRC_1 registry, for the slave mode   */
+#endif
 
 
 /*==================================================================================================
  *                                    FUNCTION PROTOTYPES
  ==================================================================================================*/
+#if (CTE_SHADOW_UPDATE_USAGE == STD_ON)
+uint32 Cte_ShadowCommit(uint32 cteEvents);          /* shadow update step, called from the CTE irq handler      */
+#endif
+#if (CTE_PLAYLIST_USAGE == STD_ON)
+uint32 Cte_PlaylistEventsGet(uint32 cteEvents);     /* add the active table set index to the reported events    */
+#endif
 
 
 #ifdef __cplusplus
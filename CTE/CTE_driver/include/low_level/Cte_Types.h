@@ -51,6 +51,18 @@ extern "C"{
 
 #define CTE_DEFAULT_INPUT_CLOCK         80000000u      /**< The default input clock for CTE                     */
 
+#define CTE_LUT_IMAGE_VERSION           1u             /**< The current version of the LUT image layout         */
+
+#define CTE_IRQ_SET_INDEX_SHIFT         24u            /**< While a playlist is used, the reported events contain
+                                                         * the index of the active table set in the upper byte   */
+#define CTE_IRQ_SET_INDEX_MASK          0xff000000u
+
+#define CTE_TABLES_BLOB_VERSION         1u             /**< The current version of the tables blob layout       */
+
+#define CTE_STATS_EVT_BITS              10u            /**< The hardware events with timing statistics, bits 0..9 */
+#define CTE_STATS_HIST_BINS             32u            /**< Histogram bins : bin N counts the times with N significant
+                                                         * bits (2^(N-1) to 2^N - 1 ticks), the last bin the rest */
+
 
 #if defined(TRACE_ENABLE)
         #define CTE_TRACE(a,b,c) RsdkTraceLogEvent(a,b,c)
@@ -217,7 +229,11 @@ typedef enum {
     CTE_IRQ_TT1_END        = 0x08u,    /**< End of TimeTable 1 execution                   */
     CTE_IRQ_RCS            = 0x40u,    /**< Raising edge of RCS signal                     */
     CTE_IRQ_RFS            = 0x80u,    /**< Raising edge of RFS signal                     */
-    CTE_IRQ_TABLE_EXEC_END = 0x200u    /**< Table execution was finished                   */
+    CTE_IRQ_TABLE_EXEC_END = 0x200u,   /**< Table execution was finished                   */
+    CTE_IRQ_TABLES_UPDATED = 0x400u,   /**< Software event : the tables update staged while running
+                                            took effect                                    */
+    CTE_IRQ_TABLES_TORN    = 0x800u    /**< Software event : a table was started while the staged update
+                                            was written, that execution could mix old and new events */
 } Cte_IrqDefinitionType;
 
 
@@ -379,6 +395,120 @@ typedef struct {
 #endif
 } Cte_SetupParamsType;
 
+/**
+ * @brief   Structure for a part of the CTE LUT.
+ * @details The layout is the same as for the CTE registry, so a part can be copied word by word.
+ *
+ */
+typedef struct {
+    uint32  lsbWords[CTE_LUT_LUT_LSB_COUNT];    /**< The LUT_LSB values, time ticks and the low part of the masks  */
+    uint32  msbWords[CTE_LUT_LUT_MSB_COUNT];    /**< The LUT_MSB values, the high part of the signals masks        */
+} Cte_LutPartType;
+
+/**
+ * @brief   Structure for a precompiled LUT image.
+ * @details The image is produced by Cte_LutImageCompile from the timing table(s) and contains no pointers,
+ *          so it can be saved and registered later, as is. The image is valid only for a CTE setup with the same
+ *          clock and output definitions (checked using setupHash).
+ *
+ */
+typedef struct {
+    uint32          imageVersion;               /**< The image layout version, CTE_LUT_IMAGE_VERSION               */
+    uint8           lutPartsNr;                 /**< The number of used LUT parts : 1 for a single table of up to 32
+                                                    events, 2 for a longer single table or for two tables         */
+    uint8           reserved[3];                /**< Not used, must be 0                                            */
+    uint32          lutDuration[CTE_LUT_COUNT]; /**< The LUT_DUR and LUT_DUR1 values                                */
+    uint64          setupHash;                  /**< The hash of the CTE setup the image was compiled for           */
+    Cte_LutPartType lutParts[CTE_LUT_COUNT];    /**< The LUT content                                                */
+    uint64          contentHash;                /**< The hash of all the fields above, used as image identifier     */
+    uint64          lutChecksum;                /**< The hardware LUT checksum after the image load; 0 means not
+                                                    known yet, the value is recorded at the first load            */
+} Cte_LutImageType;
+
+/**
+ * @brief   Timing statistics for one event type, updated only by the CTE irq handler.
+ * @details All times are in system counter ticks. Mirror of rsdkCteEvtTimingStats_t.
+ *
+ */
+typedef struct {
+    uint32      eventsNum;                      /**< Events seen by the irq handler                             */
+    uint32      missedNum;                      /**< Events estimated as missed, from the too long periods      */
+    uint32      periodsNum;                     /**< Inter-arrival periods measured                             */
+    uint32      reserved;
+    uint64      lastTime;                       /**< Timestamp of the last event                                */
+    uint64      periodMin;                      /**< Minimum inter-arrival period                               */
+    uint64      periodMax;                      /**< Maximum inter-arrival period                               */
+    uint64      periodSum;                      /**< Sum of the inter-arrival periods, the missed ones included */
+    uint64      periodAvg;                      /**< Moving average of the period, used to detect missed events */
+    uint32      periodHist[CTE_STATS_HIST_BINS];    /**< Inter-arrival periods histogram                        */
+} Cte_EvtTimingStatsType;
+
+/**
+ * @brief   Events timing statistics. Mirror of rsdkCteTimingStats_t.
+ *
+ */
+typedef struct {
+    uint64                  counterFreq;                /**< System counter frequency, 0 if unknown             */
+    uint32                  callsNum;                   /**< Number of irq handler executions                   */
+    uint32                  reserved;
+    uint64                  serviceMax;                 /**< Maximum irq service time, the callback included    */
+    uint64                  serviceSum;                 /**< Sum of the irq service times                       */
+    uint32                  serviceHist[CTE_STATS_HIST_BINS];   /**< Irq service times histogram                */
+    Cte_EvtTimingStatsType  evt[CTE_STATS_EVT_BITS];    /**< Per event type, index is the event bit             */
+} Cte_TimingStatsType;
+
+/**
+ * @brief   Header of a flat tables blob.
+ * @details The blob has no pointers, so it can be built once, saved or transferred as is. The header is followed by
+ *          the sections below, in this order, each one immediately after the previous one:
+ *          - Cte_BlobOutputType[outputsNr[0] + outputsNr[1]] : the output definitions for table 0, then table 1
+ *          - Cte_BlobEventType[tableLen[0] + tableLen[1]]    : the events of table 0, then table 1
+ *          - Cte_BlobActionType[actionsNr]                   : the actions of all the events, in the events order
+ *          and the padding to a multiple of 4 bytes. The blob must be 4 bytes aligned.
+ *          For a tables update, the output definitions of the setup are used and outputsNr must be 0.
+ *
+ */
+typedef struct {
+    uint32          blobVersion;                /**< The blob layout version, CTE_TABLES_BLOB_VERSION               */
+    uint32          blobSize;                   /**< The blob size in bytes, the header and the padding included    */
+    uint8           tableLen[CTE_LUT_COUNT];    /**< The events number of each table; tableLen[1] = 0 means a single
+                                                    table, of up to 64 events, else each table has up to 32 events */
+    uint8           outputsNr[CTE_LUT_COUNT];   /**< The output definitions number for each table                  */
+    uint16          actionsNr;                  /**< The total number of actions                                    */
+    uint16          reserved;                   /**< Not used, must be 0                                            */
+    uint32          timeLimit[CTE_LUT_COUNT];   /**< The tables time limits, in ns; 0 means no limit               */
+} Cte_BlobHeaderType;
+
+/**
+ * @brief   Output definition into a tables blob, the compact form of Cte_SingleOutputDefType.
+ *
+ */
+typedef struct {
+    uint8           outputSignal;               /**< The output signal, a Cte_OutputType value                      */
+    uint8           signalType;                 /**< The signal type, a Cte_OutputTypeType value                    */
+    uint16          reserved;                   /**< Not used, must be 0                                            */
+    uint32          clockPeriod;                /**< The clock period, in ns, used only for CLOCK type              */
+} Cte_BlobOutputType;
+
+/**
+ * @brief   Event into a tables blob; the actions of the event follow the ones of the previous event.
+ *
+ */
+typedef struct {
+    uint32          absTime;                    /**< The absolute time of the event, in ns                         */
+    uint8           actionsNr;                  /**< The number of actions, at most one for each output            */
+    uint8           reserved[3];                /**< Not used, must be 0                                            */
+} Cte_BlobEventType;
+
+/**
+ * @brief   Action into a tables blob, the compact form of Cte_ActionType.
+ *
+ */
+typedef struct {
+    uint8           outputSignal;               /**< The output signal, a Cte_OutputType value                      */
+    uint8           newState;                   /**< The new state, according to the output type                   */
+} Cte_BlobActionType;
+
 /** @} */
 
 
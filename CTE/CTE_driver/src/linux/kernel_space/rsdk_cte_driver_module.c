@@ -20,10 +20,17 @@
 #include <linux/platform_device.h>
 #include <linux/uaccess.h>
 #include <linux/clk.h>
+#include <linux/mm.h>
+#include <linux/vmalloc.h>
+#include <linux/poll.h>
+#include <linux/debugfs.h>
+#include <linux/seq_file.h>
+#include <linux/math64.h>
 
 #include "rsdk_S32R45.h"
 #include "rsdk_cte_driver_module.h"
 #include "rsdk_cte_interrupt.h"
+#include "CDD_Cte.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -69,6 +76,9 @@ static const struct of_device_id gsRsdkCteMatch[] = {
 };
 
 rsdkCteDevice_t *gpRsdkCteDevice = NULL;
+#if (CTE_TIMING_STATS_USAGE == STD_ON)
+static struct dentry            *gspRsdkCteDebugDir = NULL;     // the debugfs directory of the driver
+#endif
 
 /*==================================================================================================
 *                                       FUNCTIONS
@@ -123,6 +133,109 @@ static int RsdkCteRelease(struct inode *pInode, struct file *fp)
     return err;
 }
 
+/******************************************************************************/
+/**
+ * @brief   Map the event ring into the user-space
+ * @details Only the ring itself can be mapped, starting with offset 0.
+ */
+static int RsdkCteMmap(struct file *fp, struct vm_area_struct *pVma)
+{
+    rsdkCteDevice_t *pRsdkCteDevice = (rsdkCteDevice_t *)fp->private_data;
+    int32_t           err = 0;
+
+    if ((pRsdkCteDevice == NULL) || (pRsdkCteDevice->pEvtRing == NULL))
+    {
+        err = -ENODEV;
+    }
+    else if ((pVma->vm_pgoff != 0u) || ((pVma->vm_end - pVma->vm_start) > PAGE_ALIGN(sizeof(rsdkCteEvtRing_t))))
+    {
+        (void)pr_err("RsdkCteMmap: wrong offset/size for the event ring.\n");
+        err = -EINVAL;
+    }
+    else
+    {
+        err = remap_vmalloc_range(pVma, pRsdkCteDevice->pEvtRing, 0);
+    }
+    return err;
+}
+
+/******************************************************************************/
+/**
+ * @brief   Poll the event ring
+ * @details The device is readable while the event ring is not empty.
+ */
+static __poll_t RsdkCtePoll(struct file *fp, struct poll_table_struct *pWait)
+{
+    rsdkCteDevice_t *pRsdkCteDevice = (rsdkCteDevice_t *)fp->private_data;
+    __poll_t          mask = 0;
+
+    if ((pRsdkCteDevice == NULL) || (pRsdkCteDevice->pEvtRing == NULL))
+    {
+        mask = EPOLLERR;
+    }
+    else
+    {
+        poll_wait(fp, &pRsdkCteDevice->irqWaitQ, pWait);
+        if (READ_ONCE(pRsdkCteDevice->pEvtRing->readIdx) != smp_load_acquire(&pRsdkCteDevice->pEvtRing->writeIdx))
+        {
+            mask = EPOLLIN | EPOLLRDNORM;
+        }
+    }
+    return mask;
+}
+
+#if (CTE_TIMING_STATS_USAGE == STD_ON)
+/******************************************************************************/
+/**
+ * @brief   Show the events timing statistics in debugfs
+ * @details /sys/kernel/debug/rsdk_cte/timing_stats, times in system counter ticks; the histograms bins are log2
+ *          (bin N = N significant bits) and only the not empty bins are shown as bin:count. The same data, binary,
+ *          is available by the RSDK_CTE_LX_CTE_GET_TIMING_STATS RPC.
+ */
+static int RsdkCteTimingStatsShow(struct seq_file *pSeq, void *pData)
+{
+    static const char *const evtNames[CTE_STATS_EVT_BITS] = {"tt0_start", "tt1_start", "tt0_end", "tt1_end",
+                                                    "bit4", "bit5", "rcs", "rfs", "bit8", "table_exec_end"};
+    const Cte_TimingStatsType       *pStats = Cte_GetTimingStats();
+    const Cte_EvtTimingStatsType    *pEvt;
+    uint32_t                        i, j;
+
+    (void)pData;
+    seq_printf(pSeq, "counter_freq %llu\n", pStats->counterFreq);
+    seq_printf(pSeq, "irq calls %u service_mean %llu service_max %llu hist", pStats->callsNum,
+               (pStats->callsNum == 0u) ? 0ULL : div64_u64(pStats->serviceSum, pStats->callsNum), pStats->serviceMax);
+    for (j = 0u; j < CTE_STATS_HIST_BINS; j++)
+    {
+        if (pStats->serviceHist[j] != 0u)
+        {
+            seq_printf(pSeq, " %u:%u", j, pStats->serviceHist[j]);
+        }
+    }
+    seq_printf(pSeq, "\nevent count missed period_min period_mean period_max hist\n");
+    for (i = 0u; i < CTE_STATS_EVT_BITS; i++)
+    {
+        pEvt = &pStats->evt[i];
+        if (pEvt->eventsNum != 0u)
+        {   // only the seen events
+            seq_printf(pSeq, "%s %u %u %llu %llu %llu", evtNames[i], pEvt->eventsNum, pEvt->missedNum,
+                       pEvt->periodMin,
+                       (pEvt->periodsNum == 0u) ? 0ULL : div64_u64(pEvt->periodSum, pEvt->periodsNum),
+                       pEvt->periodMax);
+            for (j = 0u; j < CTE_STATS_HIST_BINS; j++)
+            {
+                if (pEvt->periodHist[j] != 0u)
+                {
+                    seq_printf(pSeq, " %u:%u", j, pEvt->periodHist[j]);
+                }
+            }
+            seq_printf(pSeq, "\n");
+        }
+    }
+    return 0;
+}
+DEFINE_SHOW_ATTRIBUTE(RsdkCteTimingStats);
+#endif  // #if (CTE_TIMING_STATS_USAGE == STD_ON)
+
 /**
  * @brief   Get dts properties
  */
@@ -208,6 +321,8 @@ static int RsdkCteProbe(struct platform_device *pPlatDev)
         .owner = THIS_MODULE,
         .open = RsdkCteOpen,
         .release = RsdkCteRelease,
+        .mmap = RsdkCteMmap,
+        .poll = RsdkCtePoll,
     };
 
     int32_t             err = 0;
@@ -397,6 +512,30 @@ static int RsdkCteProbe(struct platform_device *pPlatDev)
         }
     }
 
+    if (err == 0)
+    {
+        // allocate the event ring, page aligned and zeroed, to be mapped by the user-space
+        pRsdkCteDev->pEvtRing = (rsdkCteEvtRing_t *)vmalloc_user(sizeof(rsdkCteEvtRing_t));
+        if (pRsdkCteDev->pEvtRing == NULL)
+        {
+            (void)pr_err("RsdkCteProbe: event ring allocation failed!.\n");
+            err = -ENOMEM;
+            //revert previous actions:
+            (void)OAL_DestroyWaitQueue(&(pRsdkCteDev->irqWaitQ));
+            (void)free_irq(pRsdkCteDev->dtsInfo.irqId, pRsdkCteDev);
+            iounmap(pRsdkCteDev->pMemMapVirtAddr);
+            device_destroy(gspRsdkCteClass, devNo);
+            cdev_del(&pRsdkCteDev->cdevRef);
+            kvfree(pRsdkCteDev);
+        }
+        else
+        {
+            spin_lock_init(&pRsdkCteDev->evtRingLock);
+            pRsdkCteDev->pEvtRing->version = RSDK_CTE_EVT_RING_VERSION;
+            pRsdkCteDev->pEvtRing->ringLen = RSDK_CTE_EVT_RING_LEN;
+        }
+    }
+
     if (err == 0)
     {
         err = RsdkCteRpcSrvInit();
@@ -413,6 +552,13 @@ static int RsdkCteProbe(struct platform_device *pPlatDev)
 #endif
         }
     }
+#if (CTE_TIMING_STATS_USAGE == STD_ON)
+    if (err == 0)
+    {   // the debugfs entries are only diagnostic, a failure is not reported
+        gspRsdkCteDebugDir = debugfs_create_dir(DEVICE_NAME, NULL);
+        (void)debugfs_create_file("timing_stats", 0444, gspRsdkCteDebugDir, NULL, &RsdkCteTimingStats_fops);
+    }
+#endif
 
     return err;
 }
@@ -427,11 +573,16 @@ static int RsdkCteRemove(struct platform_device *ofpdev)
     (void)pr_alert("RsdkCteRemove: START \n");
 
     dev_set_drvdata(&ofpdev->dev, NULL);
+#if (CTE_TIMING_STATS_USAGE == STD_ON)
+    debugfs_remove_recursive(gspRsdkCteDebugDir);
+    gspRsdkCteDebugDir = NULL;
+#endif
 
     (void)CtePlatformUnregisterEvents();
     (void)RsdkCteRpcSrvExit();
     (void)OAL_DestroyWaitQueue(&(pRsdkCteDev->irqWaitQ));
     (void)free_irq(pRsdkCteDev->dtsInfo.irqId, pRsdkCteDev);
+    vfree(pRsdkCteDev->pEvtRing);
     iounmap(pRsdkCteDev->pMemMapVirtAddr);
     device_destroy(gspRsdkCteClass, MKDEV(gsNumRsdkCteMajor, gsNumRsdkCteMinor + pRsdkCteDev->dtsInfo.devId));
     cdev_del(&pRsdkCteDev->cdevRef);
@@ -21,6 +21,7 @@
 #include <linux/platform_device.h>
 #include <linux/uaccess.h>
 #include <linux/fs.h>
+#include <linux/timekeeping.h>
 
 #include "rsdk_cte_driver_module.h"
 #include "rsdk_cte_driver_api.h"
@@ -41,6 +42,9 @@ extern "C" {
 // flag for debug building
 // if uncommented, all DebugMessage will produce effect
 // #define DEBUG_VERSION 1
+// the scratch size for the rebuilt tables of the legacy init call
+#define CTE_INIT_SCRATCH_SIZE   (2u * ((CTE_MAX_LARGE_TIME_TABLE_LEN * sizeof(rsdkCteLinuxTtEvents_t)) + \
+                                ((uint32_t)RSDK_CTE_OUTPUT_MAX * sizeof(rsdkCteSingleOutputDef_t))))
 
 /*==================================================================================================
 *                                             ENUMS
@@ -54,6 +58,11 @@ extern "C" {
 *                                GLOBAL VARIABLE DECLARATIONS
 ==================================================================================================*/
 static OAL_RPCEvent_t   gsRpcEvents[RSDK_CTE_LX_EVT_MAX] = {0};
+#if (CTE_LUT_IMAGE_USAGE == STD_ON)
+static Cte_LutImageType gsLutImage;             // the compiled image, the RPC calls are serialized
+#endif
+static uint64_t         gsInitScratch[(CTE_INIT_SCRATCH_SIZE + sizeof(uint64_t) - 1u) / sizeof(uint64_t)];
+                                                // the legacy init scratch, the RPC calls are serialized
 
 /*==================================================================================================
 *                                       FUNCTIONS
@@ -63,54 +72,125 @@ static void    Callback(rsdkCteIrqDefinition_t events);
 
 /*  DEALING WITH INTERRUPT EVENTS IN LINUX ENVIRONMENT
  *
- *  In Linux environment is possible to have a limited communication between kernel-space 
- *  (where the interrupts are catch) and the user-space (where the interrupt significance is checked). 
- *  To make is simple, in the user-space are sent only few events :
-    RSDK_CTE_LX_EVT_TT0_START = 0,      = TimeTable 0 start
-    RSDK_CTE_LX_EVT_TT1_START,          = TimeTable 1 start
-    RSDK_CTE_LX_EVT_TT0_STOP,           = TimeTable 0 stop
-    RSDK_CTE_LX_EVT_TT1_STOP,           = TimeTable 1 stop
-    RSDK_CTE_LX_EVT_RFS,                = RFS event
-    RSDK_CTE_LX_EVT_RCS,                = RCS event
-    RSDK_CTE_LX_EVT_TT_END,             = TimeTable ended execution
-
+ *  All the events reported by one CTE interrupt are recorded into a single slot of the device event ring
+ *  (rsdkCteEvtRing_t) : the events mask, the monotonic timestamp and the interrupt sequence number.
+ *  The ring keeps a counter for each event bit too, so high rate RCS/RFS events are never collapsed.
+ *  The user-space consumer is woken up using the device wait queue (poll() on /dev/rsdk_cte) and can drain
+ *  many slots at once, from the mmap-ed ring or using the RSDK_CTE_LX_CTE_EVT_READ call.
+ *  The per event RPC events (rsdkCteRpcEvents_t) are no longer triggered, only RSDK_CTE_LX_EVT_EVTMGR_STOP.
 */
 
 /**
- * @brief       False callback for Rx interrupt error.
- * @details     The function is called from Rx interrupt. It will remap this to the user-space defined events.
+ * @brief       Record a slot into the device event ring.
+ * @details     The slot content is complete before the producer index is published. The last free slot is kept
+ *              for the exit request. Called from the interrupt (the callback) and from the RPC dispatcher.
  *
  */
-static void Callback(rsdkCteIrqDefinition_t events)
+static void RecordEventAndWakeup(uint32_t evtMask, uint64_t timeStamp)
 {
-    uint32_t i, mask;
-    static int32_t          gsRpcEventsConversion[] = {
-        (int32_t)RSDK_CTE_LX_EVT_TT0_START,          // TimeTable 0 start
-        (int32_t)RSDK_CTE_LX_EVT_TT1_START,          // TimeTable 1 start
-        (int32_t)RSDK_CTE_LX_EVT_TT0_STOP,           // TimeTable 0 stop
-        (int32_t)RSDK_CTE_LX_EVT_TT1_STOP,           // TimeTable 1 stop
-        -1, -1,
-        (int32_t)RSDK_CTE_LX_EVT_RFS,                // RFS event
-        (int32_t)RSDK_CTE_LX_EVT_RCS,                // RCS event
-        -1,
-        (int32_t)RSDK_CTE_LX_EVT_TT_END,             // TimeTable ended execution
-    };
-
-    mask = 1u;
-    for(i = 0u; i < sizeof(gsRpcEventsConversion); i++)
+    rsdkCteEvtRing_t    *pRing = gpRsdkCteDevice->pEvtRing;
+    rsdkCteEvtSlot_t    *pSlot;
+    uint32_t            pWrite, maxUsed, i;
+    unsigned long       flags;
+
+    maxUsed = (evtMask == RSDK_CTE_EVT_TO_EXIT) ? RSDK_CTE_EVT_RING_LEN : (RSDK_CTE_EVT_RING_LEN - 1u);
+    spin_lock_irqsave(&gpRsdkCteDevice->evtRingLock, flags);
+    if (evtMask != RSDK_CTE_EVT_TO_EXIT)
     {
-        if((((uint32_t)events) & mask) != 0u)
-        {
-            if(gsRpcEventsConversion[i] != -1)
+        for (i = 0u; i < RSDK_CTE_EVT_BITS; i++)
+        {   // the occurrences are counted even if the slot is dropped
+            if ((evtMask & (1u << i)) != 0u)
             {
-                (void)OAL_RPCTriggerEvent(
-                    gsRpcEvents[gsRpcEventsConversion[i]]);  // trigger the event
+                pRing->evtCounters[i]++;
             }
         }
-        mask <<= 1u;
+        pRing->evtSeq++;
     }
+    pWrite = pRing->writeIdx;
+    if ((pWrite - READ_ONCE(pRing->readIdx)) >= maxUsed)
+    {       // no free slot, the slot is dropped and accounted
+        pRing->lostEvents++;
+    }
+    else
+    {
+        pSlot = &pRing->evtSlot[pWrite & RSDK_CTE_EVT_RING_MASK];
+        pSlot->evtMask = evtMask;
+        pSlot->evtSeq = pRing->evtSeq;
+        pSlot->timeStamp = timeStamp;
+        smp_store_release(&pRing->writeIdx, pWrite + 1u);     // publish the slot to the consumer
+    }
+    spin_unlock_irqrestore(&gpRsdkCteDevice->evtRingLock, flags);
+    (void)OAL_WakeUpInterruptible(&(gpRsdkCteDevice->irqWaitQ));
 }
 
+/**
+ * @brief       Kernel callback for the CTE interrupt.
+ * @details     The function is called from the CTE interrupt. All the reported events go into one ring slot.
+ *
+ */
+static void Callback(rsdkCteIrqDefinition_t events)
+{
+    RecordEventAndWakeup((uint32_t)events, ktime_get_ns());
+}
+
+/**
+ * @brief       Drain a batch of the event ring slots, into the RPC reply.
+ * @details     No wait is done, the RPC calls are serialized. The exit request is reported only as the first slot.
+ *
+ */
+static uint32_t CteRpcEventsRead(oal_dispatcher_t *dispatcher)
+{
+    rsdkCteEvtRing_t    *pRing = gpRsdkCteDevice->pEvtRing;
+    rsdkCteEvtReadHdr_t hdr;
+    uint32_t            pRead, pWrite, len, i;
+    uint32_t            rez = (uint32_t)RSDK_SUCCESS;
+
+    pRead = pRing->readIdx;
+    pWrite = smp_load_acquire(&pRing->writeIdx);
+    if ((pRead != pWrite) && (pRing->evtSlot[pRead & RSDK_CTE_EVT_RING_MASK].evtMask == RSDK_CTE_EVT_TO_EXIT))
+    {
+        smp_store_release(&pRing->readIdx, pRead + 1u);        // the close request is consumed
+        rez = (uint32_t)RSDK_CTE_DRV_EVT_STREAM_CLOSED;
+    }
+    else
+    {
+        len = 0u;
+        while (((pRead + len) != pWrite) && (len < RSDK_CTE_EVT_READ_MAX) &&
+                (pRing->evtSlot[(pRead + len) & RSDK_CTE_EVT_RING_MASK].evtMask != RSDK_CTE_EVT_TO_EXIT))
+        {
+            len++;
+        }
+        hdr.slotsNr = len;
+        hdr.lostEvents = READ_ONCE(pRing->lostEvents);
+        for (i = 0u; i < RSDK_CTE_EVT_BITS; i++)
+        {
+            hdr.evtCounters[i] = READ_ONCE(pRing->evtCounters[i]);
+        }
+        rez = (uint32_t)OAL_RPCAppendReply(dispatcher, (uint8_t*)&hdr, sizeof(hdr));
+        // the slots are copied in at most two chunks, before and after the ring end
+        i = RSDK_CTE_EVT_RING_LEN - (pRead & RSDK_CTE_EVT_RING_MASK);
+        i = (i < len) ? i : len;
+        if ((rez == (uint32_t)RSDK_SUCCESS) && (i != 0u))
+        {
+            rez = (uint32_t)OAL_RPCAppendReply(dispatcher, (uint8_t*)&pRing->evtSlot[pRead & RSDK_CTE_EVT_RING_MASK],
+                            i * sizeof(rsdkCteEvtSlot_t));
+        }
+        if ((rez == (uint32_t)RSDK_SUCCESS) && (i != len))
+        {
+            rez = (uint32_t)OAL_RPCAppendReply(dispatcher, (uint8_t*)&pRing->evtSlot[0],
+                            (len - i) * sizeof(rsdkCteEvtSlot_t));
+        }
+        if (rez == (uint32_t)RSDK_SUCCESS)
+        {
+            smp_store_release(&pRing->readIdx, pRead + len);    // the slots were processed
+        }
+        else
+        {
+            rez = (uint32_t)RSDK_CTE_DRV_ERR_COPY_DATA_ERROR;  // signal the copy error
+        }
+    }
+    return rez;
+}
 
 /**
  * @brief       Replace the user-space callbacks with the kernel callbacks.
@@ -121,9 +201,7 @@ static uint32_t CteLinuxKernelInit(rsdkCteLinuxTransfer_t *pParams, uint64_t *pU
 {
     uint32_t            i, j, k, rez;
     Cte_SetupParamsType llInitParams;               // the init params in expected low-level format
-    uint8_t             *pBuf = kzalloc(2u * ((CTE_MAX_LARGE_TIME_TABLE_LEN * sizeof(rsdkCteLinuxTtEvents_t)) + 
-                                ((uint32_t)RSDK_CTE_OUTPUT_MAX * sizeof(rsdkCteSingleOutputDef_t))), GFP_KERNEL);
-    uint8_t				*pTmp = pBuf;
+    uint8_t             *pBuf = (uint8_t*)gsInitScratch;    // no allocation, the scratch is reused
     
     // adapt the parameters to be transferred to kernel
     // general parameters
@@ -229,12 +307,59 @@ static uint32_t CteLinuxKernelInit(rsdkCteLinuxTransfer_t *pParams, uint64_t *pU
         }
     }
 	rez = (uint32_t)Cte_Setup(&llInitParams, pUInt64);
-	
-	
-	kvfree(pTmp);
     return(rez);
 }
 
+#if (CTE_TABLES_BLOB_USAGE == STD_ON)
+/**
+ * @brief       Initialize the CTE from a tables blob.
+ * @details     The blob follows the init parameters into the received data and is used in place.
+ *
+ */
+static uint32_t CteLinuxKernelInitBlob(rsdkCteLinuxBlobInit_t *pParams, uint32_t len, uint64_t *pUInt64)
+{
+    Cte_SetupParamsType llInitParams;               // the init params in expected low-level format
+
+    llInitParams.cteMode            = *(Cte_ModeDefinitionType*)&pParams->cteMode;
+    llInitParams.cteClockFrecq      = pParams->cteClockFrecq;
+    llInitParams.repeatCount        = pParams->repeatCount;
+    llInitParams.cteIrqEvents       = pParams->cteIrqEvents;
+    llInitParams.pCteCallback       = &Callback;                 // use the kernel callback
+    llInitParams.signalDef0Ptr      = NULL;                      // the tables and outputs are in the blob
+    llInitParams.signalDef1Ptr      = NULL;
+    llInitParams.timeTable0Ptr      = NULL;
+    llInitParams.timeTable1Ptr      = NULL;
+    return (uint32_t)Cte_SetupBlob(&llInitParams,
+            (const Cte_BlobHeaderType*)(void*)((uint8_t*)pParams + sizeof(rsdkCteLinuxBlobInit_t)),
+            len - (uint32_t)sizeof(rsdkCteLinuxBlobInit_t), pUInt64);
+}
+#endif
+
+/**
+ * @brief       Get the table(s) pointers from the received data.
+ * @details     The two tables are consecutive, 4 bytes aligned; an unused table has the wrong time length.
+ *
+ */
+static void CteRpcTablesGet(void *pParams, Cte_TimeTableDefType **ppTable0, Cte_TimeTableDefType **ppTable1)
+{
+    uintptr_t               realTableGap, brickMask;
+
+    // align the table pointers to 4 bites chunks
+    brickMask = (uintptr_t)(sizeof(uint32_t) - 1u);
+    realTableGap = (sizeof(rsdkCteTimeTableDef_t) + brickMask) & (~brickMask);
+    *ppTable0 = (Cte_TimeTableDefType*)pParams;
+    *ppTable1 = (Cte_TimeTableDefType*)(pParams + realTableGap);
+    if((*ppTable0)->tableTimeExecLimit == RSDK_CTE_WRONG_TABLE_TIME_LENGTH)
+    {
+        *ppTable0 = NULL;
+    }
+    if((*ppTable1)->tableTimeExecLimit == RSDK_CTE_WRONG_TABLE_TIME_LENGTH)
+    {
+        *ppTable1 = NULL;
+    }
+    DebugMessage("CteRpcTablesGet: pTable0=%lx, pTable1=%lx\n", (long)*ppTable0, (long)*ppTable1);
+}
+
 /**
  * @brief       RemoteProcedureCall server dispatcher.
  * @details     The function is called when the user-space library ask for driver action.
@@ -243,10 +368,13 @@ static uint32_t CteLinuxKernelInit(rsdkCteLinuxTransfer_t *pParams, uint64_t *pU
 static uint32_t RsdkCteRpcDispatcher(oal_dispatcher_t *dispatcher, uint32_t func, uintptr_t inData, int32_t len)
 {
     uint32_t                rez;
-    uintptr_t               realTableGap, brickMask;
     Cte_TimeTableDefType    *pTable0, *pTable1;
     void                    *pParams = NULL;
     uint64_t                uInt64Val;
+#if (CTE_PLAYLIST_USAGE == STD_ON)
+    uint32_t                uInt32Val;
+    uint8_t                 uInt8Val;
+#endif
 
     DebugMessage("RsdkCteRpcDispatcher: func=%d, len=%d\n", func, len);
     // the input data must have at least an integer
@@ -286,20 +414,7 @@ static uint32_t RsdkCteRpcDispatcher(oal_dispatcher_t *dispatcher, uint32_t func
             }
             else
             {
-                // align the table pointers to 4 bites chunks
-                brickMask = (uintptr_t)(sizeof(uint32_t) - 1u);
-                realTableGap = (sizeof(rsdkCteTimeTableDef_t) + brickMask) & (~brickMask);
-                pTable0 = (Cte_TimeTableDefType*)pParams;
-                pTable1 = (Cte_TimeTableDefType*)(pParams + realTableGap);                
-                if(pTable0->tableTimeExecLimit == RSDK_CTE_WRONG_TABLE_TIME_LENGTH)
-                {
-                    pTable0 = NULL;
-                }
-                if(pTable1->tableTimeExecLimit == RSDK_CTE_WRONG_TABLE_TIME_LENGTH)
-                {
-                    pTable1 = NULL;
-                }
-                DebugMessage("RsdkCteRpcDispatcher: pTable0=%lx, pTable1=%lx\n", (long)pTable0, (long)pTable1);
+                CteRpcTablesGet(pParams, &pTable0, &pTable1);
                 rez = (uint32_t)Cte_UpdateTables(pTable0, pTable1, &uInt64Val);  // real unit initialization
             }
             break;
@@ -307,20 +422,153 @@ static uint32_t RsdkCteRpcDispatcher(oal_dispatcher_t *dispatcher, uint32_t func
                 rez = (uint32_t)CtePlatformRegisterEvents();  // all defined events are registered at a time
             break;
         case (uint32_t)RSDK_CTE_LX_CTE_EVTMGR_STOP:
+            RecordEventAndWakeup(RSDK_CTE_EVT_TO_EXIT, ktime_get_ns());    // close the events ring consumer
             if (gpRsdkCteDevice->registeredEvents != 0u)
             {
                 (void)OAL_RPCTriggerEvent(gsRpcEvents[(int32_t)RSDK_CTE_LX_EVT_EVTMGR_STOP]);
-                rez = (uint32_t)RSDK_SUCCESS;
+            }
+            rez = (uint32_t)RSDK_SUCCESS;
+            break;
+        case (uint32_t)RSDK_CTE_LX_CTE_EVT_READ:            // a batch of events, rsdkCteEvtReadHdr_t + slots
+            rez = CteRpcEventsRead(dispatcher);
+            break;
+#if (CTE_TABLES_BLOB_USAGE == STD_ON)
+        case (uint32_t)RSDK_CTE_LX_CTE_INIT_BLOB:           // init from a blob, the LUT checksum is returned
+            if ((uint32_t)len < (sizeof(rsdkCteLinuxBlobInit_t) + sizeof(Cte_BlobHeaderType)))
+            {
+                rez = (uint32_t)RSDK_CTE_DRV_LX_NOT_ENOUGH_PARAM;  // not enough data
             }
             else
             {
-                rez = (uint32_t)RSDK_CTE_DRV_LX_WRG_CALL;
+                rez = CteLinuxKernelInitBlob((rsdkCteLinuxBlobInit_t*)pParams, (uint32_t)len, &uInt64Val);
+                if (rez == (uint32_t)RSDK_SUCCESS)
+                {
+                    rez = (uint32_t)OAL_RPCAppendReply(dispatcher, (uint8_t*)&uInt64Val, sizeof(uint64_t));
+                }
             }
             break;
+        case (uint32_t)RSDK_CTE_LX_CTE_TABLE_UPDATE_BLOB:   // table(s) update from a blob, the checksum is returned
+            if ((uint32_t)len < sizeof(Cte_BlobHeaderType))
+            {
+                rez = (uint32_t)RSDK_CTE_DRV_LX_NOT_ENOUGH_PARAM;  // not enough data
+            }
+            else
+            {
+                rez = (uint32_t)Cte_UpdateTablesBlob((const Cte_BlobHeaderType*)pParams, (uint32_t)len, &uInt64Val);
+                if (rez == (uint32_t)RSDK_SUCCESS)
+                {
+                    rez = (uint32_t)OAL_RPCAppendReply(dispatcher, (uint8_t*)&uInt64Val, sizeof(uint64_t));
+                }
+            }
+            break;
+#endif
+#if (CTE_TIMING_STATS_USAGE == STD_ON)
+        case (uint32_t)RSDK_CTE_LX_CTE_GET_TIMING_STATS:    // the statistics are copied as they are
+            rez = (uint32_t)OAL_RPCAppendReply(dispatcher, (uint8_t*)Cte_GetTimingStats(), sizeof(Cte_TimingStatsType));
+            break;
+#endif
         case (uint32_t)RSDK_CTE_LX_CTE_READ_CHECKSUM:                 // get the TT checksum
             uInt64Val = Cte_GetLutChecksum();
             rez = (uint32_t)OAL_RPCAppendReply(dispatcher, (uint8_t*)&uInt64Val, sizeof(uint64_t));
             break;
+#if (CTE_LUT_IMAGE_USAGE == STD_ON)
+        case (uint32_t)RSDK_CTE_LX_CTE_IMAGE_COMPILE:       // compile the table(s), the image is returned
+            if ((uint32_t)len < ((sizeof(uintptr_t)) * 2u))
+            {
+                rez = (uint32_t)RSDK_CTE_DRV_LX_NOT_ENOUGH_PARAM;  // not enough data
+            }
+            else
+            {
+                CteRpcTablesGet(pParams, &pTable0, &pTable1);
+                rez = (uint32_t)Cte_LutImageCompile(pTable0, pTable1, &gsLutImage);
+                if (rez == (uint32_t)RSDK_SUCCESS)
+                {
+                    rez = (uint32_t)OAL_RPCAppendReply(dispatcher, (uint8_t*)&gsLutImage, sizeof(Cte_LutImageType));
+                }
+            }
+            break;
+        case (uint32_t)RSDK_CTE_LX_CTE_IMAGE_REGISTER:      // register an image, the hash is returned
+            if ((uint32_t)len < sizeof(Cte_LutImageType))
+            {
+                rez = (uint32_t)RSDK_CTE_DRV_LX_NOT_ENOUGH_PARAM;  // not enough data
+            }
+            else
+            {
+                rez = (uint32_t)Cte_LutImageRegister((Cte_LutImageType*)pParams, &uInt64Val);
+                if (rez == (uint32_t)RSDK_SUCCESS)
+                {
+                    rez = (uint32_t)OAL_RPCAppendReply(dispatcher, (uint8_t*)&uInt64Val, sizeof(uint64_t));
+                }
+            }
+            break;
+        case (uint32_t)RSDK_CTE_LX_CTE_IMAGE_LOAD:          // load an image, the LUT checksum is returned
+            if ((uint32_t)len < sizeof(uint64_t))
+            {
+                rez = (uint32_t)RSDK_CTE_DRV_LX_NOT_ENOUGH_PARAM;  // not enough data
+            }
+            else
+            {
+                rez = (uint32_t)Cte_LutImageLoad(*(uint64_t*)pParams, &uInt64Val);
+                if ((rez == (uint32_t)RSDK_SUCCESS) || (rez == (uint32_t)RSDK_CTE_DRV_LUT_CHECKSUM_ERROR))
+                {
+                    (void)OAL_RPCAppendReply(dispatcher, (uint8_t*)&uInt64Val, sizeof(uint64_t));
+                }
+            }
+            break;
+        case (uint32_t)RSDK_CTE_LX_CTE_IMAGE_REMOVE:        // remove an image
+            if ((uint32_t)len < sizeof(uint64_t))
+            {
+                rez = (uint32_t)RSDK_CTE_DRV_LX_NOT_ENOUGH_PARAM;  // not enough data
+            }
+            else
+            {
+                rez = (uint32_t)Cte_LutImageRemove(*(uint64_t*)pParams);
+            }
+            break;
+#endif
+#if (CTE_SHADOW_UPDATE_USAGE == STD_ON)
+        case (uint32_t)RSDK_CTE_LX_CTE_TABLE_UPDATE_SHADOW: // stage a table(s) update, done at the table end
+            if ((uint32_t)len < ((sizeof(uintptr_t)) * 2u))
+            {
+                rez = (uint32_t)RSDK_CTE_DRV_LX_NOT_ENOUGH_PARAM;  // not enough data
+            }
+            else
+            {
+                CteRpcTablesGet(pParams, &pTable0, &pTable1);
+                rez = (uint32_t)Cte_UpdateTablesShadow(pTable0, pTable1);
+            }
+            break;
+        case (uint32_t)RSDK_CTE_LX_CTE_SHADOW_STATUS:       // staged update status, the LUT checksum is returned
+            rez = (uint32_t)Cte_UpdateTablesShadowStatus(&uInt64Val);
+            if (rez == (uint32_t)RSDK_SUCCESS)
+            {
+                rez = (uint32_t)OAL_RPCAppendReply(dispatcher, (uint8_t*)&uInt64Val, sizeof(uint64_t));
+            }
+            break;
+#endif
+#if (CTE_PLAYLIST_USAGE == STD_ON)
+        case (uint32_t)RSDK_CTE_LX_CTE_PLAYLIST_SET:        // the images hashes, in the execution order
+            if (((uint32_t)len < sizeof(uint64_t)) || ((uint32_t)len > (CTE_PLAYLIST_MAX_LEN * sizeof(uint64_t))))
+            {
+                rez = (uint32_t)RSDK_CTE_DRV_LX_NOT_ENOUGH_PARAM;  // not enough data
+            }
+            else
+            {
+                rez = (uint32_t)Cte_PlaylistSet((const uint64_t*)pParams, (uint8_t)((uint32_t)len / sizeof(uint64_t)));
+            }
+            break;
+        case (uint32_t)RSDK_CTE_LX_CTE_PLAYLIST_CLEAR:
+            rez = (uint32_t)Cte_PlaylistClear();
+            break;
+        case (uint32_t)RSDK_CTE_LX_CTE_PLAYLIST_STATUS:     // the active set index and the switches number returned
+            rez = (uint32_t)Cte_PlaylistStatusGet(&uInt8Val, &uInt32Val);
+            if (rez == (uint32_t)RSDK_SUCCESS)
+            {
+                uInt64Val = ((uint64_t)uInt32Val << 32u) | (uint64_t)uInt8Val;
+                rez = (uint32_t)OAL_RPCAppendReply(dispatcher, (uint8_t*)&uInt64Val, sizeof(uint64_t));
+            }
+            break;
+#endif
         default:
             rez = (uint32_t)RSDK_CTE_DRV_LX_WRG_CALL;       // unknown request
             break;
@@ -0,0 +1,624 @@
+/*
+ * Copyright 2023 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <stdint.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <string.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+
+#include "rsdk_cte_linux_def.h"
+#include "oal_comm.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                      DEFINES AND MACROS
+==================================================================================================*/
+// the gap between the two tables of a request, the tables are 4 bytes aligned, as CteRpcTablesGet expects
+#define CTE_EXT_TABLE_GAP   ((sizeof(rsdkCteTimeTableDef_t) + sizeof(uint32_t) - 1u) & ~(sizeof(uint32_t) - 1u))
+#define CTE_EXT_DEV_NAME    "/dev/rsdk_cte"         // the CTE device, holding the event ring
+
+/*==================================================================================================
+*                                       LOCAL VARIABLES
+==================================================================================================*/
+// The extension calls use their own RPC channel, opened at the first call; the serving kernel dispatcher is
+// the same as for the base library calls.
+static pthread_mutex_t      gsCteExtLock = PTHREAD_MUTEX_INITIALIZER;
+static OAL_DriverHandle_t   gsCteExtRpc = NULL;
+// The events consumer of the blob initialization: the application callback and the consumer state.
+static rsdkCteIsrCb_t       gsCteExtCallback = NULL;
+static uint8_t              gsCteExtConsumerOn = 0u;
+static int                  gsCteExtEvtFd = -1;                 // the CTE device, while the consumer is on
+static rsdkCteEvtRing_t     *gsCteExtEvtRing = NULL;            // the event ring mapping, while the consumer is on
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+
+/*******************************************************************************/
+/**
+ * @brief       Call the RPC server, opening the channel at the first call.
+ *
+ * @return      the kernel call result, RSDK_CTE_DRV_ERR_EVT_CONN if the channel can't be opened
+ *
+ */
+static rsdkStatus_t CteExtRpcCall(const rsdkCteRpcCalls_t func, OAL_FuncArgs_t *pIn, const size_t inNr,
+                                  OAL_FuncArgs_t *pOut, const size_t outNr)
+{
+    rsdkStatus_t        rez;
+    OAL_DriverHandle_t  hRpc;
+
+    (void)pthread_mutex_lock(&gsCteExtLock);
+    if (gsCteExtRpc == NULL)
+    {
+        gsCteExtRpc = OAL_OpenDriver(RSDK_CTE_RPC_CHANNEL_NAME);
+    }
+    hRpc = gsCteExtRpc;
+    (void)pthread_mutex_unlock(&gsCteExtLock);
+    if (hRpc == NULL)
+    {
+        rez = RSDK_CTE_DRV_ERR_EVT_CONN;
+    }
+    else
+    {
+        rez = (rsdkStatus_t)OAL_DriverCall(hRpc, (uint32_t)func, pIn, inNr, pOut, outNr);
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Call the RPC server with a table(s) request.
+ * @details     The two tables are copied one after the other, as the kernel CteRpcTablesGet expects;
+ *              a missing table is marked by RSDK_CTE_WRONG_TABLE_TIME_LENGTH as execution limit.
+ *              The tables events are referred by their pointers, as for the base RsdkCteUpdateTables.
+ *
+ */
+static rsdkStatus_t CteExtTablesCall(const rsdkCteRpcCalls_t func, const rsdkCteTimeTableDef_t *pTable0,
+                                     const rsdkCteTimeTableDef_t *pTable1, OAL_FuncArgs_t *pOut, const size_t outNr)
+{
+    uint32_t            data[(2u * CTE_EXT_TABLE_GAP) / sizeof(uint32_t)];
+    uint8_t             *pData = (uint8_t *)data;
+    rsdkCteTimeTableDef_t   table;
+    OAL_FuncArgs_t      inArgs;
+
+    (void)memset(&table, 0, sizeof(table));
+    table.tableTimeExecLimit = RSDK_CTE_WRONG_TABLE_TIME_LENGTH;
+    (void)memcpy(pData, (pTable0 == NULL) ? &table : pTable0, sizeof(rsdkCteTimeTableDef_t));
+    (void)memcpy(pData + CTE_EXT_TABLE_GAP, (pTable1 == NULL) ? &table : pTable1, sizeof(rsdkCteTimeTableDef_t));
+    inArgs.mpData = data;
+    inArgs.mSize = sizeof(data);
+    return CteExtRpcCall(func, &inArgs, 1u, pOut, outNr);
+}
+
+/*******************************************************************************/
+/**
+ * @brief       The events consumer thread of the blob initialization.
+ * @details     The event ring slots are reported to the application callback, one call for each interrupt, until
+ *              the RSDK_CTE_EVT_TO_EXIT slot, posted by the RSDK_CTE_LX_CTE_EVTMGR_STOP call.
+ *
+ */
+static void *CteExtEvtConsumer(void *pArg)
+{
+    rsdkCteEvtRing_t    *pRing = gsCteExtEvtRing;
+    struct pollfd       pollFd;
+    uint32_t            readIdx, writeIdx, evtMask;
+    rsdkCteIsrCb_t      pCallback;
+    uint8_t             goOn = 1u;
+
+    (void)pArg;
+    pollFd.fd = gsCteExtEvtFd;
+    pollFd.events = POLLIN;
+    readIdx = pRing->readIdx;
+    while (goOn != 0u)
+    {
+        writeIdx = __atomic_load_n(&pRing->writeIdx, __ATOMIC_ACQUIRE);
+        if (readIdx == writeIdx)
+        {
+            // wait for the ring to be not empty
+            pollFd.revents = 0;
+            if (((poll(&pollFd, 1, -1) < 0) && (errno != EINTR)) || ((pollFd.revents & (POLLERR | POLLNVAL)) != 0))
+            {
+                goOn = 0u;                          // the device is no more usable
+            }
+        }
+        else
+        {
+            evtMask = pRing->evtSlot[readIdx & RSDK_CTE_EVT_RING_MASK].evtMask;
+            readIdx++;
+            __atomic_store_n(&pRing->readIdx, readIdx, __ATOMIC_RELEASE);
+            if (evtMask == RSDK_CTE_EVT_TO_EXIT)
+            {
+                goOn = 0u;
+            }
+            else
+            {
+                pCallback = __atomic_load_n(&gsCteExtCallback, __ATOMIC_ACQUIRE);
+                if (pCallback != NULL)
+                {
+                    pCallback(evtMask);
+                }
+            }
+        }
+    }
+    (void)pthread_mutex_lock(&gsCteExtLock);
+    (void)munmap(pRing, sizeof(rsdkCteEvtRing_t));
+    (void)close(pollFd.fd);
+    gsCteExtEvtRing = NULL;
+    gsCteExtEvtFd = -1;
+    gsCteExtConsumerOn = 0u;
+    (void)pthread_mutex_unlock(&gsCteExtLock);
+    return NULL;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Start the events consumer of the blob initialization, if not already running.
+ * @details     The event ring is mapped from the CTE device and consumed by a detached thread; a running consumer
+ *              only gets the new callback.
+ *
+ * @return      RSDK_SUCCESS or RSDK_CTE_DRV_ERR_START_EVT_MGR
+ *
+ */
+static rsdkStatus_t CteExtConsumerStart(const rsdkCteIsrCb_t pCallback)
+{
+    rsdkStatus_t        rez = RSDK_SUCCESS;
+    rsdkCteEvtRing_t    *pRing;
+    pthread_t           thread;
+    int                 fd;
+
+    __atomic_store_n(&gsCteExtCallback, pCallback, __ATOMIC_RELEASE);
+    (void)pthread_mutex_lock(&gsCteExtLock);
+    if (gsCteExtConsumerOn == 0u)
+    {
+        rez = RSDK_CTE_DRV_ERR_START_EVT_MGR;
+        fd = open(CTE_EXT_DEV_NAME, O_RDWR | O_CLOEXEC);
+        if (fd >= 0)
+        {
+            pRing = (rsdkCteEvtRing_t *)mmap(NULL, sizeof(rsdkCteEvtRing_t), PROT_READ | PROT_WRITE, MAP_SHARED,
+                                             fd, 0);
+            if (pRing == MAP_FAILED)
+            {
+                (void)close(fd);
+            }
+            else
+            {
+                gsCteExtEvtFd = fd;
+                gsCteExtEvtRing = pRing;
+                if (pthread_create(&thread, NULL, CteExtEvtConsumer, NULL) == 0)
+                {
+                    (void)pthread_detach(thread);
+                    gsCteExtConsumerOn = 1u;
+                    rez = RSDK_SUCCESS;
+                }
+                else
+                {
+                    gsCteExtEvtRing = NULL;
+                    gsCteExtEvtFd = -1;
+                    (void)munmap(pRing, sizeof(rsdkCteEvtRing_t));
+                    (void)close(fd);
+                }
+            }
+        }
+    }
+    (void)pthread_mutex_unlock(&gsCteExtLock);
+    return rez;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/*******************************************************************************/
+/**
+ * @brief       Compile the table(s) into a LUT image, see RsdkCteLutImageCompile.
+ *
+ */
+rsdkStatus_t CtePlatformModuleLutImageCompileLinuxUs(rsdkCteTimeTableDef_t *pTable0, rsdkCteTimeTableDef_t *pTable1,
+                    rsdkCteLutImage_t *pLutImage)
+{
+    rsdkStatus_t        rez;
+    OAL_FuncArgs_t      outArgs;
+
+    if ((pTable0 == NULL) || (pLutImage == NULL))
+    {
+        rez = RSDK_CTE_DRV_NULL_PTR_PARAMS;
+    }
+    else
+    {
+        outArgs.mpData = pLutImage;
+        outArgs.mSize = sizeof(rsdkCteLutImage_t);
+        rez = CteExtTablesCall(RSDK_CTE_LX_CTE_IMAGE_COMPILE, pTable0, pTable1, &outArgs, 1u);
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Register a LUT image into the driver, see RsdkCteLutImageRegister.
+ *
+ */
+rsdkStatus_t CtePlatformModuleLutImageRegisterLinuxUs(const rsdkCteLutImage_t *pLutImage, uint64_t *pContentHash)
+{
+    rsdkStatus_t        rez;
+    OAL_FuncArgs_t      inArgs, outArgs;
+
+    if ((pLutImage == NULL) || (pContentHash == NULL))
+    {
+        rez = RSDK_CTE_DRV_NULL_PTR_PARAMS;
+    }
+    else
+    {
+        inArgs.mpData = (void *)(uintptr_t)pLutImage;
+        inArgs.mSize = sizeof(rsdkCteLutImage_t);
+        outArgs.mpData = pContentHash;
+        outArgs.mSize = sizeof(uint64_t);
+        rez = CteExtRpcCall(RSDK_CTE_LX_CTE_IMAGE_REGISTER, &inArgs, 1u, &outArgs, 1u);
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Load a registered LUT image, see RsdkCteLutImageLoad.
+ * @details     The LUT checksum is returned for a checksum error too.
+ *
+ */
+rsdkStatus_t CtePlatformModuleLutImageLoadLinuxUs(uint64_t contentHash, uint64_t *pLutChecksum)
+{
+    rsdkStatus_t        rez;
+    OAL_FuncArgs_t      inArgs, outArgs;
+
+    if (pLutChecksum == NULL)
+    {
+        rez = RSDK_CTE_DRV_NULL_PTR_PARAMS;
+    }
+    else
+    {
+        inArgs.mpData = &contentHash;
+        inArgs.mSize = sizeof(uint64_t);
+        outArgs.mpData = pLutChecksum;
+        outArgs.mSize = sizeof(uint64_t);
+        rez = CteExtRpcCall(RSDK_CTE_LX_CTE_IMAGE_LOAD, &inArgs, 1u, &outArgs, 1u);
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Remove a registered LUT image, see RsdkCteLutImageRemove.
+ *
+ */
+rsdkStatus_t CtePlatformModuleLutImageRemoveLinuxUs(uint64_t contentHash)
+{
+    OAL_FuncArgs_t      inArgs;
+
+    inArgs.mpData = &contentHash;
+    inArgs.mSize = sizeof(uint64_t);
+    return CteExtRpcCall(RSDK_CTE_LX_CTE_IMAGE_REMOVE, &inArgs, 1u, NULL, 0u);
+}
+
+/*******************************************************************************/
+/**
+ * @brief       API calls, see the API header.
+ *
+ */
+rsdkStatus_t RsdkCteLutImageCompile(rsdkCteTimeTableDef_t *pTable0, rsdkCteTimeTableDef_t *pTable1,
+        rsdkCteLutImage_t *pLutImage)
+{
+    return CtePlatformModuleLutImageCompileLinuxUs(pTable0, pTable1, pLutImage);
+}
+
+rsdkStatus_t RsdkCteLutImageRegister(const rsdkCteLutImage_t *pLutImage, uint64_t *pContentHash)
+{
+    return CtePlatformModuleLutImageRegisterLinuxUs(pLutImage, pContentHash);
+}
+
+rsdkStatus_t RsdkCteLutImageLoad(uint64_t contentHash, uint64_t *pLutChecksum)
+{
+    return CtePlatformModuleLutImageLoadLinuxUs(contentHash, pLutChecksum);
+}
+
+rsdkStatus_t RsdkCteLutImageRemove(uint64_t contentHash)
+{
+    return CtePlatformModuleLutImageRemoveLinuxUs(contentHash);
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Stage a table(s) update, see RsdkCteUpdateTablesShadow.
+ *
+ */
+rsdkStatus_t CtePlatformModuleUpdateTablesShadowLinuxUs(rsdkCteTimeTableDef_t *pTable0, rsdkCteTimeTableDef_t *pTable1)
+{
+    rsdkStatus_t        rez;
+
+    if (pTable0 == NULL)
+    {
+        rez = RSDK_CTE_DRV_NULL_PTR_TABLE0;
+    }
+    else
+    {
+        rez = CteExtTablesCall(RSDK_CTE_LX_CTE_TABLE_UPDATE_SHADOW, pTable0, pTable1, NULL, 0u);
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Get the staged update status, see RsdkCteUpdateTablesShadowStatus.
+ *
+ */
+rsdkStatus_t CtePlatformModuleUpdateTablesShadowStatusLinuxUs(uint64_t *pLutChecksum)
+{
+    rsdkStatus_t        rez;
+    OAL_FuncArgs_t      outArgs;
+
+    if (pLutChecksum == NULL)
+    {
+        rez = RSDK_CTE_DRV_NULL_PTR_PARAMS;
+    }
+    else
+    {
+        outArgs.mpData = pLutChecksum;
+        outArgs.mSize = sizeof(uint64_t);
+        rez = CteExtRpcCall(RSDK_CTE_LX_CTE_SHADOW_STATUS, NULL, 0u, &outArgs, 1u);
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       API calls, see the API header.
+ *
+ */
+rsdkStatus_t RsdkCteUpdateTablesShadow(rsdkCteTimeTableDef_t *pTable0, rsdkCteTimeTableDef_t *pTable1)
+{
+    return CtePlatformModuleUpdateTablesShadowLinuxUs(pTable0, pTable1);
+}
+
+rsdkStatus_t RsdkCteUpdateTablesShadowStatus(uint64_t *pLutChecksum)
+{
+    return CtePlatformModuleUpdateTablesShadowStatusLinuxUs(pLutChecksum);
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Set a playlist of registered LUT images, see RsdkCtePlaylistSet.
+ *
+ */
+rsdkStatus_t CtePlatformModulePlaylistSetLinuxUs(const uint64_t *pContentHash, uint8_t setsNr)
+{
+    rsdkStatus_t        rez;
+    OAL_FuncArgs_t      inArgs;
+
+    if (pContentHash == NULL)
+    {
+        rez = RSDK_CTE_DRV_NULL_PTR_PARAMS;
+    }
+    else if ((setsNr == 0u) || (setsNr > RSDK_CTE_PLAYLIST_MAX_LEN))
+    {
+        rez = RSDK_CTE_DRV_PLAYLIST_WRG;
+    }
+    else
+    {
+        // the sets number is given by the request length
+        inArgs.mpData = (void *)(uintptr_t)pContentHash;
+        inArgs.mSize = (size_t)setsNr * sizeof(uint64_t);
+        rez = CteExtRpcCall(RSDK_CTE_LX_CTE_PLAYLIST_SET, &inArgs, 1u, NULL, 0u);
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Stop the playlist usage, see RsdkCtePlaylistClear.
+ *
+ */
+rsdkStatus_t CtePlatformModulePlaylistClearLinuxUs(void)
+{
+    return CteExtRpcCall(RSDK_CTE_LX_CTE_PLAYLIST_CLEAR, NULL, 0u, NULL, 0u);
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Get the playlist status, see RsdkCtePlaylistStatusGet.
+ *
+ */
+rsdkStatus_t CtePlatformModulePlaylistStatusGetLinuxUs(uint8_t *pActiveIdx, uint32_t *pSwitchesNr)
+{
+    rsdkStatus_t        rez;
+    uint64_t            status = 0u;
+    OAL_FuncArgs_t      outArgs;
+
+    if ((pActiveIdx == NULL) || (pSwitchesNr == NULL))
+    {
+        rez = RSDK_CTE_DRV_NULL_PTR_PARAMS;
+    }
+    else
+    {
+        outArgs.mpData = &status;
+        outArgs.mSize = sizeof(uint64_t);
+        rez = CteExtRpcCall(RSDK_CTE_LX_CTE_PLAYLIST_STATUS, NULL, 0u, &outArgs, 1u);
+        if (rez == RSDK_SUCCESS)
+        {
+            // the reply is (switches number << 32) | active set index
+            *pActiveIdx = (uint8_t)(status & 0xffu);
+            *pSwitchesNr = (uint32_t)(status >> 32u);
+        }
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       API calls, see the API header.
+ *
+ */
+rsdkStatus_t RsdkCtePlaylistSet(const uint64_t *pContentHash, uint8_t setsNr)
+{
+    return CtePlatformModulePlaylistSetLinuxUs(pContentHash, setsNr);
+}
+
+rsdkStatus_t RsdkCtePlaylistClear(void)
+{
+    return CtePlatformModulePlaylistClearLinuxUs();
+}
+
+rsdkStatus_t RsdkCtePlaylistStatusGet(uint8_t *pActiveIdx, uint32_t *pSwitchesNr)
+{
+    return CtePlatformModulePlaylistStatusGetLinuxUs(pActiveIdx, pSwitchesNr);
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Get the events timing statistics, see RsdkCteGetTimingStats.
+ *
+ */
+rsdkStatus_t CtePlatformModuleGetTimingStatsLinuxUs(rsdkCteTimingStats_t *pTimingStats)
+{
+    rsdkStatus_t        rez;
+    OAL_FuncArgs_t      outArgs;
+
+    if (pTimingStats == NULL)
+    {
+        rez = RSDK_CTE_DRV_NULL_PTR_PARAMS;
+    }
+    else
+    {
+        outArgs.mpData = pTimingStats;
+        outArgs.mSize = sizeof(rsdkCteTimingStats_t);
+        rez = CteExtRpcCall(RSDK_CTE_LX_CTE_GET_TIMING_STATS, NULL, 0u, &outArgs, 1u);
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       API call, see the API header.
+ *
+ */
+rsdkStatus_t RsdkCteGetTimingStats(rsdkCteTimingStats_t *pTimingStats)
+{
+    return CtePlatformModuleGetTimingStatsLinuxUs(pTimingStats);
+}
+
+/*******************************************************************************/
+/**
+ * @brief       CTE initialization using a tables blob, see RsdkCteInitBlob.
+ * @details     The request is rsdkCteLinuxBlobInit_t followed by the blob copy. The kernel records the events into
+ *              the CTE event ring; if events are requested, a consumer thread reports the ring slots to the
+ *              application callback, until the events management is stopped. Only one consumer per ring may run,
+ *              so the ring must not be drained by other means while the blob initialization callback is used.
+ *
+ */
+rsdkStatus_t CtePlatformModuleInitBlobLinuxUs(const rsdkCteInitParams_t *pCteInitParam, const rsdkCteBlobHeader_t *pBlob,
+        uint64_t *pLutChecksum)
+{
+    rsdkStatus_t            rez;
+    rsdkCteLinuxBlobInit_t  *pReq;
+    OAL_FuncArgs_t          inArgs, outArgs;
+
+    if ((pCteInitParam == NULL) || (pBlob == NULL) || (pLutChecksum == NULL))
+    {
+        rez = RSDK_CTE_DRV_NULL_PTR_PARAMS;
+    }
+    else if (((uint32_t)pCteInitParam->cteIrqEvents != 0u) && (pCteInitParam->pCteCallback == NULL))
+    {
+        rez = RSDK_CTE_DRV_NULL_CALLBACK;
+    }
+    else if (pBlob->blobSize < sizeof(rsdkCteBlobHeader_t))
+    {
+        rez = RSDK_CTE_DRV_BLOB_WRG_FORMAT;
+    }
+    else
+    {
+        pReq = (rsdkCteLinuxBlobInit_t *)calloc(1u, sizeof(rsdkCteLinuxBlobInit_t) + pBlob->blobSize);
+        if (pReq == NULL)
+        {
+            rez = RSDK_CTE_DRV_ERR_COPY_DATA_ERROR;
+        }
+        else
+        {
+            pReq->cteMode = pCteInitParam->cteMode;
+            pReq->cteClockFrecq = pCteInitParam->cteClockFrecq;
+            pReq->repeatCount = pCteInitParam->repeatCount;
+            pReq->cteIrqEvents = pCteInitParam->cteIrqEvents;
+            (void)memcpy((uint8_t *)pReq + sizeof(rsdkCteLinuxBlobInit_t), pBlob, pBlob->blobSize);
+            inArgs.mpData = pReq;
+            inArgs.mSize = sizeof(rsdkCteLinuxBlobInit_t) + pBlob->blobSize;
+            outArgs.mpData = pLutChecksum;
+            outArgs.mSize = sizeof(uint64_t);
+            rez = CteExtRpcCall(RSDK_CTE_LX_CTE_INIT_BLOB, &inArgs, 1u, &outArgs, 1u);
+            free(pReq);
+        }
+        if ((rez == RSDK_SUCCESS) && ((uint32_t)pCteInitParam->cteIrqEvents != 0u))
+        {
+            rez = CteExtConsumerStart(pCteInitParam->pCteCallback);
+        }
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       Table(s) update using a tables blob, see RsdkCteUpdateTablesBlob.
+ *
+ */
+rsdkStatus_t CtePlatformModuleUpdateTablesBlobLinuxUs(const rsdkCteBlobHeader_t *pBlob, uint64_t *pLutChecksum)
+{
+    rsdkStatus_t        rez;
+    OAL_FuncArgs_t      inArgs, outArgs;
+
+    if ((pBlob == NULL) || (pLutChecksum == NULL))
+    {
+        rez = RSDK_CTE_DRV_NULL_PTR_PARAMS;
+    }
+    else if (pBlob->blobSize < sizeof(rsdkCteBlobHeader_t))
+    {
+        rez = RSDK_CTE_DRV_BLOB_WRG_FORMAT;
+    }
+    else
+    {
+        inArgs.mpData = (void *)(uintptr_t)pBlob;
+        inArgs.mSize = pBlob->blobSize;
+        outArgs.mpData = pLutChecksum;
+        outArgs.mSize = sizeof(uint64_t);
+        rez = CteExtRpcCall(RSDK_CTE_LX_CTE_TABLE_UPDATE_BLOB, &inArgs, 1u, &outArgs, 1u);
+    }
+    return rez;
+}
+
+/*******************************************************************************/
+/**
+ * @brief       API calls, see the API header.
+ *
+ */
+rsdkStatus_t RsdkCteInitBlob(const rsdkCteInitParams_t *pCteInitParams, const rsdkCteBlobHeader_t *pBlob,
+        uint64_t *pLutChecksum)
+{
+    return CtePlatformModuleInitBlobLinuxUs(pCteInitParams, pBlob, pLutChecksum);
+}
+
+rsdkStatus_t RsdkCteUpdateTablesBlob(const rsdkCteBlobHeader_t *pBlob, uint64_t *pLutChecksum)
+{
+    return CtePlatformModuleUpdateTablesBlobLinuxUs(pBlob, pLutChecksum);
+}
+
+
+#ifdef __cplusplus
+}
+#endif
@@ -104,6 +104,19 @@ typedef struct LUT{
     __IO uint32 MSB[CTE_LUT_LUT_MSB_COUNT];        /**< TT 0 (MSB)..TT 1 (MSB), array */
 } LutType;
 
+#if (CTE_TABLES_BLOB_USAGE == STD_ON)
+/* The sections of a checked tables blob                            */
+typedef struct {
+    const Cte_BlobHeaderType    *hdrPtr;                    /* the blob header                                  */
+    const Cte_BlobOutputType    *outputsPtr;                /* the output definitions section                   */
+    const Cte_BlobEventType     *eventsPtr;                 /* the events section                               */
+    const Cte_BlobActionType    *actionsPtr;                /* the actions section                              */
+    uint16                      firstAction[CTE_LUT_COUNT]; /* the index of the first action of each table      */
+    uint32                      maxDelay;                   /* the max delay between consecutive events, in ns  */
+    Cte_TimeTableDefType        tables[CTE_LUT_COUNT];      /* the tables lengths and time limits, no events    */
+} Cte_BlobViewType;
+#endif
+
 /*==================================================================================================
 *                                          LOCAL MACROS
 ==================================================================================================*/
@@ -125,6 +138,27 @@ typedef struct LUT{
 
 #endif  /* #if (CTE_DEV_ERROR_DETECT == STD_ON)                    */
 
+#if (CTE_LUT_IMAGE_USAGE == STD_ON)
+/* the registered LUT images and the slots usage                    */
+static Cte_LutImageType gsCteLutImages[CTE_LUT_IMAGE_CACHE_SIZE];
+static boolean          gsCteLutImageUsed[CTE_LUT_IMAGE_CACHE_SIZE] = { FALSE };
+#endif
+
+#if (CTE_SHADOW_UPDATE_USAGE == STD_ON)
+/* the tables update staged while the CTE is running                */
+static Cte_ShadowUpdateType gsCteShadow = { 0u };
+#endif
+
+#if (CTE_PLAYLIST_USAGE == STD_ON)
+/* the playlist of registered LUT images                            */
+static Cte_PlaylistType gsCtePlaylist = { 0u };
+#endif
+
+#if (CTE_TIMING_STATS_USAGE == STD_ON)
+/* value used to reset the timing statistics                        */
+static const Cte_TimingStatsType gsCteTimingStatsReset = { 0u };
+#endif
+
 
 /*==================================================================================================
  *                                      GLOBAL CONSTANTS
@@ -136,6 +170,9 @@ typedef struct LUT{
 
 volatile CTE_Type *gspCTEPtr = NULL_PTR;                    /* the pointer to the CTE registry            */
 Cte_DriverStateType gsDriverData = { 0u };              /* the driver necessary data                     */
+#if (CTE_TIMING_STATS_USAGE == STD_ON)
+Cte_TimingStatsType gCteTimingStats;                    /* the events timing statistics                  */
+#endif
 
 
 /*==================================================================================================
@@ -145,6 +182,7 @@ Cte_DriverStateType gsDriverData = { 0u };              /* the driver necessary
 static Std_ReturnType Cte_TtEventCheck(Cte_TimingEventType *eventPtr);
 static Std_ReturnType Cte_TimeTableCheck(Cte_TimeTableDefType *tablePtr);
 static Std_ReturnType Cte_SignalDefsCheck(Cte_SingleOutputDefType *signalsPtr);
+static Std_ReturnType Cte_ModeParamsCheck(const Cte_SetupParamsType *cteInitParamsPtr);
 static Std_ReturnType Cte_InitParamsCheck(const Cte_SetupParamsType *cteInitParamsPtr);
 #endif
 
@@ -303,16 +341,15 @@ static Std_ReturnType Cte_SignalDefsCheck(Cte_SingleOutputDefType *signalsPtr)
 
 /*==================================================================================================*/
 /**
- * @brief   Procedure to check the initialization parameters.
- * @details All necessary checks are done, to assure correct initialization flow.
- *          If many error occurs, only one is reported.
+ * @brief   Procedure to check the working mode and the clock of the initialization parameters.
+ * @details The tables and the output definitions are not checked.
  *
  * @param[in]   cteInitParamsPtr    = pointer to the initialization structure
  * @return      E_OK/RSDK_SUCCESS = initialization succeeded
  *              other values      = initialization failed, use the appropriate tools to detect the issue
  *
  */
-static Std_ReturnType Cte_InitParamsCheck(const Cte_SetupParamsType *cteInitParamsPtr)
+static Std_ReturnType Cte_ModeParamsCheck(const Cte_SetupParamsType *cteInitParamsPtr)
 {
     Std_ReturnType rez = (Std_ReturnType)E_OK;
 
@@ -343,6 +380,26 @@ static Std_ReturnType Cte_InitParamsCheck(const Cte_SetupParamsType *cteInitPara
         rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_ZERO_FREQ, CTE_E_PARAM_VALUE, CTE_SETUP_PARAM_CHECK);
         CTE_HALT_ON_ERROR;
     }
+    return rez;
+}
+/*=== Cte_ModeParamsCheck ===========================*/
+
+/*==================================================================================================*/
+/**
+ * @brief   Procedure to check the initialization parameters.
+ * @details All necessary checks are done, to assure correct initialization flow.
+ *          If many error occurs, only one is reported.
+ *
+ * @param[in]   cteInitParamsPtr    = pointer to the initialization structure
+ * @return      E_OK/RSDK_SUCCESS = initialization succeeded
+ *              other values      = initialization failed, use the appropriate tools to detect the issue
+ *
+ */
+static Std_ReturnType Cte_InitParamsCheck(const Cte_SetupParamsType *cteInitParamsPtr)
+{
+    Std_ReturnType rez;
+
+    rez = Cte_ModeParamsCheck(cteInitParamsPtr);
     if (rez == (Std_ReturnType)E_OK)
     {
         /* check the first time table pointer       */
@@ -438,6 +495,36 @@ static uint32 Cte_64BitCounting(uint32 initialValue, uint32 mul1, uint32 mul2, u
 }
 /*=== Cte_64BitCounting ===========================*/
 
+/*==================================================================================================*/
+/**
+ * @brief   Procedure to get the CTE clock divider for a maximum delay between consecutive events.
+ * @details The smallest divider which ensure the delay can be counted is selected
+ *
+ * @param[in]   maxDelay    = the maximum delay, in ns; CTE_TOO_BIG_TIME_DELAY for an incorrect time sequence
+ * @return      The necessary clock divider
+ * @pre         The CTE clock frequency must be set before
+ *
+ */
+static uint8 Cte_ClockDividerFromDelay(uint32 maxDelay)
+{
+    uint8  clockDivider;            /* final clock divider                                  */
+    uint32 largeIntCount;           /* special value to get correct uint32 computing        */
+
+    largeIntCount = Cte_64BitCounting(maxDelay, gsDriverData.cteWorkingFreq, 1u, /* remember, maxDelay is in ns      */
+            CTE_1G_FREQUENCY, CTE_MAX_TIME_COUNTER); /* divider is_equal to (maxDelay*CTE_clk_freq)/(1G*MAX_COUNTER) */
+    largeIntCount++;
+    if (largeIntCount > (uint32)CTE_CLOCK_DIVIDER_LIMIT)
+    {
+        clockDivider = CTE_CLOCK_DIVIDER_LIMIT;         /* divider limit exceeded       */
+    }
+    else
+    {
+        clockDivider = (uint8)largeIntCount;           /* the final divider            */
+    }
+    return clockDivider;
+}
+/*=== Cte_ClockDividerFromDelay ===========================*/
+
 /*==================================================================================================*/
 /**
  * @brief   Procedure to find the appropriate CTE clock divider.
@@ -451,12 +538,10 @@ static uint32 Cte_64BitCounting(uint32 initialValue, uint32 mul1, uint32 mul2, u
 static uint8 Cte_ClockDividerGet(Cte_TimeTableDefType *timeTable0Ptr, Cte_TimeTableDefType *timeTable1Ptr)
 {
     uint8  i;
-    uint8  clockDivider;            /* final clock divider                                  */
     uint32 tableTimeMax;            /* max time value inside the time table [ns]            */
     uint32 tableTimeMax1;           /* max time value inside the time table 1 [ns]          */
     uint32 maxDelay;                /* max delay between consecutive events                 */
     uint32 maxDelay1;               /* max delay between consecutive events for table 1     */
-    uint32 largeIntCount;           /* special value to get correct uint32 computing        */
 
     tableTimeMax = 0;
     maxDelay = 0;
@@ -504,18 +589,7 @@ static uint8 Cte_ClockDividerGet(Cte_TimeTableDefType *timeTable0Ptr, Cte_TimeTa
             maxDelay = maxDelay1;
         }
     }
-    largeIntCount = Cte_64BitCounting(maxDelay, gsDriverData.cteWorkingFreq, 1u, /* remember, maxDelay is in ns      */
-            CTE_1G_FREQUENCY, CTE_MAX_TIME_COUNTER); /* divider is_equal to (maxDelay*CTE_clk_freq)/(1G*MAX_COUNTER) */
-    largeIntCount++;
-    if (largeIntCount > (uint32)CTE_CLOCK_DIVIDER_LIMIT)
-    {
-        clockDivider = CTE_CLOCK_DIVIDER_LIMIT;         /* divider limit exceeded       */
-    }
-    else
-    {
-        clockDivider = (uint8)largeIntCount;           /* the final divider            */
-    }
-    return clockDivider;
+    return Cte_ClockDividerFromDelay(maxDelay);
 }
 /*=== Cte_ClockDividerGet ===========================*/
 
@@ -648,6 +722,43 @@ static Std_ReturnType Cte_SignalMaskSet(Cte_SingleOutputDefType *signalDefPtr, C
 }
 /*=== Cte_SignalMaskset ===========================*/
 
+/*==================================================================================================*/
+/**
+ * @brief   Procedure to add the mask of an action to the mask value of an event.
+ * @details The FLEX outputs need no definition, all the other outputs must be defined.
+ *
+ * @param[in]   pointer to the action
+ * @param[in]   pointers to the signal definitions array
+ * @param[in]   pointer to the resulted mask
+ * @return      E_OK/RSDK_SUCCESS if successful, error if other
+ *
+ */
+static Std_ReturnType Cte_ActionMaskAdd(Cte_ActionType *actionPtr, Cte_SingleOutputDefType *signalDefPtr, uint64 *valPtr)
+{
+    Std_ReturnType  rez = (Std_ReturnType)E_OK;
+
+    switch ((uint8)actionPtr->outputSignal)
+    {
+    case (uint8)CTE_OUTPUT_FLEX_0:
+        if (actionPtr->cteOutputSignalType.newLogicState != CTE_LOGIC_SET_TO_LOW)
+        {
+            *valPtr |= CTE_FLEX_SIG_MASK;
+        }
+        break;
+    case (uint8)CTE_OUTPUT_FLEX_1:
+        if (actionPtr->cteOutputSignalType.newLogicState != CTE_LOGIC_SET_TO_LOW)
+        {
+            *valPtr |= (CTE_FLEX_SIG_MASK << 1u);
+        }
+        break;
+    default:                        /* for all remaining signals, RFS/RCS/SPT0...3/CTEP0...7    */
+        rez = Cte_SignalMaskSet(signalDefPtr, actionPtr, valPtr);
+        break;
+    }
+    return rez;
+}
+/*=== Cte_ActionMaskAdd ===========================*/
+
 /*==================================================================================================*/
 /**
  * @brief   Procedure to get the final mask value for time table.
@@ -668,30 +779,83 @@ static Std_ReturnType Cte_MaskValuesGet(Cte_ActionType *actionsPtr, Cte_SingleOu
     pwActions = actionsPtr;
     while (((uint8)pwActions->outputSignal < (uint8)CTE_OUTPUT_MAX) && (rez == (Std_ReturnType)E_OK))
     {
-        switch ((uint8)pwActions->outputSignal)
-        {
-        case (uint8)CTE_OUTPUT_FLEX_0:
-            if (pwActions->cteOutputSignalType.newLogicState != CTE_LOGIC_SET_TO_LOW)
-            {
-                *valPtr |= CTE_FLEX_SIG_MASK;
-            }
-            break;
-        case (uint8)CTE_OUTPUT_FLEX_1:
-            if (pwActions->cteOutputSignalType.newLogicState != CTE_LOGIC_SET_TO_LOW)
-            {
-                *valPtr |= (CTE_FLEX_SIG_MASK << 1u);
-            }
-            break;
-        default:                        /* for all remaining signals, RFS/RCS/SPT0...3/CTEP0...7    */
-            rez = Cte_SignalMaskSet(signalDefPtr, pwActions, valPtr);
-            break;
-        }
+        rez = Cte_ActionMaskAdd(pwActions, signalDefPtr, valPtr);
         pwActions++;                    /* move to the next action      */
     }
     return rez;
 }
 /*=== Get_MaskValues ===========================*/
 
+/*==================================================================================================*/
+/**
+ * @brief   Procedure to prepare the LUT part(s) of a table, before its events are written.
+ * @details The first event sets all outputs to low, the next ones keep them "unchanged"; the second LUT part,
+ *          used by a table longer than CTE_MAX_SMALL_TIME_TABLE_LEN, is erased.
+ *          It is the common part of all the LUT writers (driver tables, blob tables & LUT images).
+ *
+ * @param[in]   lutPartPtr      = pointer to the first LUT part of the table
+ * @param[in]   tableLength     = the table events number
+ * @return      nothing
+ *
+ */
+static void Cte_LutTableClear(volatile struct LUT *lutPartPtr, uint32 tableLength)
+{
+    uint32  i;
+
+    lutPartPtr[0].LSB[0] = 0u;
+    lutPartPtr[0].MSB[0] = 0u;
+    for (i = 1u; i < CTE_MAX_SMALL_TIME_TABLE_LEN; i++)
+    {
+        lutPartPtr[0].LSB[i] = 0u;              /* SPT events to low                          */
+        lutPartPtr[0].MSB[i] = 0x6fffffu;       /* FlexTime to 0, all other to "unchanged"    */
+    }
+    if (tableLength > CTE_MAX_SMALL_TIME_TABLE_LEN)
+    {                                           /* the second LUT part is used too            */
+        for (i = 0u; i < CTE_MAX_SMALL_TIME_TABLE_LEN; i++)
+        {
+            lutPartPtr[1].LSB[i] = 0u;
+            lutPartPtr[1].MSB[i] = 0u;
+        }
+    }
+}
+/*=== Cte_LutTableClear ===========================*/
+
+/*==================================================================================================*/
+/**
+ * @brief   Procedure to write one event of a table into its LUT part.
+ * @details The event time is converted to CTE ticks, relative to the previous event, never 0.
+ *          It is the common part of all the LUT writers (driver tables, blob tables & LUT images).
+ *
+ * @param[in]   lutPartPtr      = pointer to the first LUT part of the table
+ * @param[in]   eventIdx        = the event index in the table
+ * @param[in]   absTime         = the event absolute time, in ns
+ * @param[in]   outputsMask     = the event outputs mask (see Cte_ActionMaskAdd)
+ * @param[inout] lastTimeTickPtr = the previous event absolute time, in ticks; updated
+ * @return      nothing
+ * @pre         The CTE clock frequency and the main clock divider must be set before
+ *
+ */
+static void Cte_LutEventWrite(volatile struct LUT *lutPartPtr, uint32 eventIdx, uint32 absTime, uint64 outputsMask,
+        uint32 *lastTimeTickPtr)
+{
+    uint32  tmpVal, work32U;
+
+    tmpVal = Cte_64BitCounting(absTime, gsDriverData.cteWorkingFreq, 1u, gsDriverData.cteMainClockDivider,
+            CTE_1G_FREQUENCY);
+    work32U = tmpVal - *lastTimeTickPtr;
+    if (work32U == 0u)
+    {
+        work32U = 1u;                           /* time table value must not be 0   */
+    }
+    *lastTimeTickPtr = tmpVal;
+    lutPartPtr[eventIdx / CTE_MAX_SMALL_TIME_TABLE_LEN].LSB[eventIdx % CTE_MAX_SMALL_TIME_TABLE_LEN] =
+            work32U + (uint32)outputsMask;
+    outputsMask >>= 32u;                        /* get the MSB of the mask          */
+    lutPartPtr[eventIdx / CTE_MAX_SMALL_TIME_TABLE_LEN].MSB[eventIdx % CTE_MAX_SMALL_TIME_TABLE_LEN] =
+            (uint32)outputsMask;
+}
+/*=== Cte_LutEventWrite ===========================*/
+
 /*==================================================================================================*/
 /**
  * @brief   Procedure to set the timing table.
@@ -706,8 +870,7 @@ static Std_ReturnType Cte_TimingTableSet(Cte_TimeTableDefType *timeTablePtr, Cte
         volatile void* lutPtr)
 {
     uint64              longIntMask;                /* values for 64 bits computation       */
-    uint32              i, j, tmpVal, lastTimeTick, work32U;
-    volatile struct LUT *tmpLutPtr, *LutWPtr;
+    uint32              i, lastTimeTick;
     Std_ReturnType rez = (Std_ReturnType)E_OK;
 
     if(timeTablePtr->eventsPtr == NULL_PTR)
@@ -717,21 +880,10 @@ static Std_ReturnType Cte_TimingTableSet(Cte_TimeTableDefType *timeTablePtr, Cte
     }
     else
     {
-        tmpLutPtr = (volatile struct LUT *)lutPtr;
-        LutWPtr = (volatile struct LUT *)lutPtr;
-        /* for the first event set all output to low    */
-        tmpLutPtr->LSB[0] = 0u;
-        tmpLutPtr->MSB[0] = 0u;
-        /* set all consecutive events to "unchanged" (respectively high for clocks and low for SPT events)  */
-        for (i = 1; i < CTE_MAX_SMALL_TIME_TABLE_LEN; i++)
-        {
-            tmpLutPtr->LSB[i] = 0u;           /* SPT events to low                          */
-            tmpLutPtr->MSB[i] = 0x6fffffu;    /* FlexTime to 0, all other to "unchanged"    */
-        }
+        Cte_LutTableClear((volatile struct LUT *)lutPtr, timeTablePtr->tableLength);
         /* set the new values       */
-        i = 0;
         lastTimeTick = 0;
-        while ((i < timeTablePtr->tableLength) && (i < CTE_MAX_SMALL_TIME_TABLE_LEN))
+        for (i = 0u; i < timeTablePtr->tableLength; i++)
         {
             if(timeTablePtr->eventsPtr[i].eventActionsPtr == NULL_PTR)
             {
@@ -746,63 +898,9 @@ static Std_ReturnType Cte_TimingTableSet(Cte_TimeTableDefType *timeTablePtr, Cte
             {
                 break;                              /* error to get the signals mask, stop here */
             }
-            tmpVal = Cte_64BitCounting(timeTablePtr->eventsPtr[i].absTime, gsDriverData.cteWorkingFreq, 1u,
-                    gsDriverData.cteMainClockDivider, CTE_1G_FREQUENCY);
-            work32U = tmpVal - lastTimeTick;
-            if (work32U == 0u)
-            {
-                work32U = 1;                        /* time table value must not be 0   */
-            }
-            lastTimeTick = tmpVal;
-            LutWPtr->LSB[i] = work32U + (uint32)longIntMask;
-            longIntMask >>= 32u;                    /* get the MSB of the mask          */
-            LutWPtr->MSB[i] = (uint32)longIntMask;
-            i++;
-        }
-        if(rez == (Std_ReturnType)E_OK)
-        {
-            tmpLutPtr++;                                /* go to next LUT, if necessary (more than 32 events)   */
-            if (i < timeTablePtr->tableLength)
-            {           /* second table must be used too        */
-                /* erase the CTE time table first       */
-                for (i = 0; i < CTE_MAX_SMALL_TIME_TABLE_LEN; i++)
-                {
-                    tmpLutPtr->LSB[i] = 0u;
-                    tmpLutPtr->MSB[i] = 0u;
-                }
-            }
-            j = 0;
-            while (i < timeTablePtr->tableLength)
-            {
-                if(timeTablePtr->eventsPtr[i].eventActionsPtr == NULL_PTR)
-                {
-                    rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NULL_PTR_ACTIONS, CTE_E_PARAM_POINTER, CTE_SETUP_PARAM_CHECK);
-                    CTE_HALT_ON_ERROR;
-                }
-                if(rez == (Std_ReturnType)E_OK)
-                {
-                    rez = Cte_MaskValuesGet(timeTablePtr->eventsPtr[i].eventActionsPtr, signalDefPtr, &longIntMask);
-                }
-                if(rez != (Std_ReturnType)E_OK)
-                {
-                    break;                              /* error to get the signals mask, stop here     */
-                }
-                tmpVal = Cte_64BitCounting(timeTablePtr->eventsPtr[i].absTime, gsDriverData.cteWorkingFreq, 1u,
-                        gsDriverData.cteMainClockDivider, CTE_1G_FREQUENCY);
-                work32U = (uint32_t)tmpVal;
-                work32U -= lastTimeTick;
-                if (work32U == 0u)
-                {
-                    work32U = 1;                        /* time table value must not be 0               */
-                }
-                lastTimeTick = tmpVal;
-                tmpLutPtr->LSB[j] = work32U + (uint32)longIntMask;
-                longIntMask >>= 32u;                    /* get the MSB of the mask                      */
-                tmpLutPtr->MSB[j] = (uint32)longIntMask;
-                i++;
-                j++;
-            }
-        } /* if(rez == (Std_ReturnType)E_OK)    */
+            Cte_LutEventWrite((volatile struct LUT *)lutPtr, i, timeTablePtr->eventsPtr[i].absTime, longIntMask,
+                    &lastTimeTick);
+        }
     } /* if(timeTablePtr->eventsPtr == NULL_PTR)        */
     return rez;
 }
@@ -858,6 +956,30 @@ static void Cte_OutputSetup(Cte_SingleOutputDefType *signalDefPtr, uint8 idx)
 }
 /*=== Cte_OutputSetup ===========================*/
 
+/*==================================================================================================*/
+/**
+ * @brief   Procedure to get the number of LUT parts used by the timing table(s).
+ * @details The driver permit only three executions :
+ *          - one table of max 32 events, using only the first LUT part
+ *          - one table of max 64 events, using both LUT parts
+ *          - two tables in toggle mode, using both LUT parts
+ *
+ * @param[in]   pointers to the required time tables, in the correct order
+ * @return      The number of LUT parts used, 1 or 2
+ *
+ */
+static uint8 Cte_LutPartsGet(const Cte_TimeTableDefType *timeTable0Ptr, const Cte_TimeTableDefType *timeTable1Ptr)
+{
+    uint8 lutParts = 1u;
+
+    if ((timeTable1Ptr != NULL_PTR) || (timeTable0Ptr->tableLength > CTE_MAX_SMALL_TIME_TABLE_LEN))
+    {
+        lutParts = 2u;      /* two tables or a single table longer than one LUT part                     */
+    }
+    return lutParts;
+}
+/*=== Cte_LutPartsGet ===========================*/
+
 /*==================================================================================================*/
 /**
  * @brief   Procedure to set the running mode, continuous one table or toggle.
@@ -866,28 +988,21 @@ static void Cte_OutputSetup(Cte_SingleOutputDefType *signalDefPtr, uint8 idx)
  *          - one table of max 64 events
  *          - two tables in toggle mode
  *
- * @param[in]   pointers to the initialization params
- * @return      E_OK/RSDK_SUCCESS = success; other = error
+ * @param[in]   the number of used LUT parts, as returned by Cte_LutPartsGet
+ * @return      nothing
  *
  */
-static void Cte_RunModeSet(const Cte_SetupParamsType *cteInitParamsPtr)
+static void Cte_RunModeSet(uint8 lutPartsNr)
 {
     uint32 mask;
 
-    if (cteInitParamsPtr->timeTable1Ptr == NULL_PTR)
-    {                       /* only one table defined       */
-        if (cteInitParamsPtr->timeTable0Ptr->tableLength > CTE_MAX_SMALL_TIME_TABLE_LEN)
-        {
-            mask = 3u;      /* "toggle", but with only one table, to be correlated with the timing      */
-        }
-        else
-        {
-            mask = 2u;      /* single table, table 0        */
-        }
+    if (lutPartsNr > 1u)
+    {
+        mask = 3u;          /* toggle with two tables or "toggle" with only one table, correlated with the timing */
     }
     else
     {
-        mask = 3u;          /* toggle with two tables       */
+        mask = 2u;          /* single table, table 0        */
     }
     CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL, CTE_CNTRL_OPMOD_SL_MASK, CTE_CNTRL_OPMOD_SL(mask));
 }
@@ -895,53 +1010,76 @@ static void Cte_RunModeSet(const Cte_SetupParamsType *cteInitParamsPtr)
 
 /*==================================================================================================*/
 /**
- * @brief   Procedure to set the appropriate timing limits.
+ * @brief   Procedure to get the appropriate timing limits.
  * @details The driver permit only three executions :
  *          - one table of max 32 events
  *          - one table of max 64 events
  *          - two tables in toggle mode
- *          and the procedure must complete the correct settings
+ *          and the procedure must compute the correct settings
  *
- * @param[in]   pointers to the initialization params
- * @return      E_OK/RSDK_SUCCESS = success; other = error
+ * @param[in]   pointers to the required time tables, in the correct order
+ * @param[out]  pointer to the LUT_DUR/LUT_DUR1 values; the second value is not used for a single table of
+ *              max 32 events
+ * @return      nothing
+ * @pre         The CTE clock frequency and the main clock divider must be set before
  *
  */
-static void Cte_TableTimeLimitSet(const Cte_SetupParamsType *cteInitParamsPtr)
+static void Cte_TableTimeLimitsGet(const Cte_TimeTableDefType *timeTable0Ptr,
+        const Cte_TimeTableDefType *timeTable1Ptr, uint32 *lutDurPtr)
 {
-    uint32 lutDur0, lutDur1;
+    uint32 lutDur0;
 
-    lutDur0 = Cte_64BitCounting(cteInitParamsPtr->timeTable0Ptr->tableTimeExecLimit, gsDriverData.cteWorkingFreq, 1u,
+    lutDur0 = Cte_64BitCounting(timeTable0Ptr->tableTimeExecLimit, gsDriverData.cteWorkingFreq, 1u,
             gsDriverData.cteMainClockDivider, CTE_1G_FREQUENCY);
-    if (cteInitParamsPtr->timeTable1Ptr == NULL_PTR)
+    lutDurPtr[1] = 0u;
+    if (timeTable1Ptr == NULL_PTR)
     {                       /* only one table defined       */
-        if (cteInitParamsPtr->timeTable0Ptr->tableLength > CTE_MAX_SMALL_TIME_TABLE_LEN)
+        if (timeTable0Ptr->tableLength > CTE_MAX_SMALL_TIME_TABLE_LEN)
         {
-            gspCTEPtr->LUT_DUR = 0u;               /* the first LUT duration must be 0     */
+            lutDurPtr[0] = 0u;                     /* the first LUT duration must be 0     */
             /* use the appropriate value for LUTDUR1: table 0 duration (the normal solution)
                or the maximum table duration if all specified durations are 0       */
             if(lutDur0 != 0u)
             {
-                gspCTEPtr->LUT_DUR1 = lutDur0;
+                lutDurPtr[1] = lutDur0;
             }
             else
             {
-                gspCTEPtr->LUT_DUR1 = 0xffffffffu;
+                lutDurPtr[1] = 0xffffffffu;
             }
         }
         else
         {
             /* single table, table 0        */
-            gspCTEPtr->LUT_DUR = lutDur0;
+            lutDurPtr[0] = lutDur0;
         }
     }
     else
     {
-        /* two tables usage             */
-        lutDur1 = Cte_64BitCounting(cteInitParamsPtr->timeTable1Ptr->tableTimeExecLimit, gsDriverData.cteWorkingFreq, 1u,
+        /* two tables usage, toggle with two tables     */
+        lutDurPtr[0] = lutDur0;
+        lutDurPtr[1] = Cte_64BitCounting(timeTable1Ptr->tableTimeExecLimit, gsDriverData.cteWorkingFreq, 1u,
                 gsDriverData.cteMainClockDivider, CTE_1G_FREQUENCY);
-        /* toggle with two tables       */
-        gspCTEPtr->LUT_DUR = lutDur0;
-        gspCTEPtr->LUT_DUR1 = lutDur1;
+    }
+}
+/*=== Cte_TableTimeLimitsGet ===========================*/
+
+/*==================================================================================================*/
+/**
+ * @brief   Procedure to set the appropriate timing limits.
+ * @details The LUT_DUR1 is written only if the second LUT part is used.
+ *
+ * @param[in]   pointer to the LUT_DUR/LUT_DUR1 values, as returned by Cte_TableTimeLimitsGet
+ * @param[in]   the number of used LUT parts, as returned by Cte_LutPartsGet
+ * @return      nothing
+ *
+ */
+static void Cte_TableTimeLimitSet(const uint32 *lutDurPtr, uint8 lutPartsNr)
+{
+    gspCTEPtr->LUT_DUR = lutDurPtr[0];
+    if (lutPartsNr > 1u)
+    {
+        gspCTEPtr->LUT_DUR1 = lutDurPtr[1];
     }
 }
 /*=== Cte_TableTimeLimitSet ===========================*/
@@ -1218,433 +1356,2049 @@ static void Cte_OutputClockSelect(const Cte_SetupParamsType *cteInitParamsPtr)
 }
 /*=== Cte_OutputClockSelect ===========================*/
 
-/*==================================================================================================
- *                                       GLOBAL FUNCTIONS
- ==================================================================================================*/
-
-/*================================================================================================*/
+/*==================================================================================================*/
 /**
- * @brief   Low level initialization procedure for CTE driver
- * @details If called, the CTE function is stopped.
- *          After initialization the CTE is not started, a specific Cte_Start call must be used for this.
- *          The operation can be done at any moment; if the CTE is working, it will be stopped.
+ * @brief   Procedure to check the tables pointers against the existing CTE initialization.
+ * @details The table 1 can be used only if it was used at initialization too, and the reverse.
  *
- * @param[in]   cteInitParamsPtr    = pointer to the initialization structure
- * @param[in]   lutChecksumPtr      = pointer to a uint64 value, which will receive the final LUT checksum;
- *                                  this value can be checked later using Cte_GetLutChecksum
- * @return      E_OK/RSDK_SUCCESS = initialization succeeded
- *              other values      = initialization failed, use the appropriate tools to detect the issue
+ * @param[in]   table0Ptr,table1Ptr     = pointer to the new table(s)
+ * @return      E_OK/RSDK_SUCCESS = success; other = error
+ * @pre         The driver must be initialized before
  *
  */
-Std_ReturnType Cte_Setup(const Cte_SetupParamsType *cteInitParamsPtr, uint64 *lutChecksumPtr)
+static Std_ReturnType Cte_TablesLayoutCheck(const Cte_TimeTableDefType *table0Ptr,
+        const Cte_TimeTableDefType *table1Ptr)
 {
-    Std_ReturnType  rez;
-    uint8           cteClockDivider;            /* the clock divider        */
-    uint32          len;
-    #if defined(linux)
-        uint32          mask;
-    #else
-        volatile SRC_1_Type * pSrc_1;
-    #endif
+    Std_ReturnType rez = (Std_ReturnType)E_OK;
 
-    /* set the driver status to NOT_INITIALIZED     */
-    gsDriverData.cteDriverStatus = (uint8_t)CTE_DRIVER_STATE_NOT_INIT;
-    /* check the initialization parameters          */
-    if ((cteInitParamsPtr == NULL_PTR) || (lutChecksumPtr == NULL_PTR))
+    if (table0Ptr == NULL_PTR)
     {
-        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NULL_PTR_PARAMS, CTE_E_PARAM_POINTER, CTE_SETUP_PARAM_CHECK);
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NULL_PTR_TABLE0, CTE_E_PARAM_POINTER, CTE_SETUP_PARAM_CHECK);
         CTE_HALT_ON_ERROR;
     }
     else
     {
-        rez = Cte_InitParamsCheck(cteInitParamsPtr);
-    }
-    if (gspCTEPtr == NULL_PTR)
-    {
-#ifndef linux
-        gspCTEPtr = IP_CTE;
-#else
-        if(gpRsdkCteDevice != NULL_PTR)
-        {
-            gspCTEPtr = (volatile CTE_Type*)gpRsdkCteDevice->pMemMapVirtAddr;
-        }
-#endif
-        if (gspCTEPtr == NULL_PTR)
+        if (((table1Ptr == NULL_PTR)              /* table1 was provided at init but is not required now          */
+                && ((uint8)gsDriverData.signalDef1Ptr[0].outputSignal < (uint8)CTE_OUTPUT_MAX))
+                ||
+                ((table1Ptr != NULL_PTR)          /* table1 was not provided at init and is required now          */
+                        && ((uint8)gsDriverData.signalDef1Ptr[0].outputSignal >= (uint8)CTE_OUTPUT_MAX)))
         {
-            rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NOT_INITIALIZED, CTE_E_PARAM_POINTER, CTE_SETUP_PARAM_CHECK);
+            rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_WRG_PTR_TABLE1, CTE_E_PARAM_POINTER, CTE_SETUP_PARAM_CHECK);
             CTE_HALT_ON_ERROR;
         }
     }
+    return rez;
+}
+/*=== Cte_TablesLayoutCheck ===========================*/
+
+#if (CTE_LUT_IMAGE_USAGE == STD_ON) || (CTE_SHADOW_UPDATE_USAGE == STD_ON)
+/*==================================================================================================*/
+/**
+ * @brief   Procedure to build the LUT content for the timing table(s), into a memory image.
+ * @details The tables are checked against the current setup and the image parts, the number of used parts
+ *          and the tables time limits are filled. The hashes and the checksum are not changed.
+ *
+ * @param[in]   table0Ptr,table1Ptr     = pointer to the table(s)
+ * @param[out]  imagePtr                = pointer to the image
+ * @return      E_OK/RSDK_SUCCESS = success; other = error
+ * @pre         The driver must be initialized before
+ *
+ */
+static Std_ReturnType Cte_LutImageBuild(Cte_TimeTableDefType *table0Ptr, Cte_TimeTableDefType *table1Ptr,
+        Cte_LutImageType *imagePtr)
+{
+    uint32          i, j;
+    Std_ReturnType  rez;
+
+    rez = Cte_TablesLayoutCheck(table0Ptr, table1Ptr);
+#if (CTE_DEV_ERROR_DETECT == STD_ON)
     if (rez == (Std_ReturnType)E_OK)
     {
-        /* initialize the necessary data        */
-        gsDriverData.cteWorkingFreq = cteInitParamsPtr->cteClockFrecq; /* the working frequency for further computing */
-        cteClockDivider = Cte_ClockDividerGet(cteInitParamsPtr->timeTable0Ptr, cteInitParamsPtr->timeTable1Ptr);
-        if (cteClockDivider >= CTE_CLOCK_DIVIDER_LIMIT)
+        rez = Cte_TimeTableCheck(table0Ptr);
+    }
+    if ((rez == (Std_ReturnType)E_OK) && (table1Ptr != NULL_PTR))
+    {
+        if ((table0Ptr->tableLength > CTE_MAX_SMALL_TIME_TABLE_LEN) ||
+                (table1Ptr->tableLength > CTE_MAX_SMALL_TIME_TABLE_LEN))
         {
-            rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_CLK_DIVIDER_ERROR, CTE_E_PARAM_VALUE, CTE_SETUP_PARAM_CHECK);
+            rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_TABLE_TOO_LONG, CTE_E_PARAM_VALUE, CTE_SETUP_PARAM_CHECK);
             CTE_HALT_ON_ERROR;
         }
         else
         {
-            /* reset the CTE        */
-            /* set the bit to reset CTE.
-             * Initialization of CTE after reset
-             *
-             */
-            CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL, CTE_CNTRL_CTE_RST_MASK, CTE_CNTRL_CTE_RST(1u));
-            gsDriverData.cteMainClockDivider = cteClockDivider; /* keep the divider; simple delay to get the reset  */
-            /* reset the bit to be able to use the registry     */
-            CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL, CTE_CNTRL_CTE_RST_MASK, CTE_CNTRL_CTE_RST(0u));
-            /* compute the LUT checksum, including the MSBit    */
-            CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL, CTE_CNTRL1_CHKSM_MD_MASK, CTE_CNTRL1_CHKSM_MD(1u));
-
-            /* CTE specific initialization              */
-            /* 1. Configure time instances and corresponding signal states in the timing table register LUT_LSB_0.  */
-            /* 2. Configure remaining signal states in the timing table register LUT_MSB_0.                         */
-            rez = Cte_TimingTableSet(cteInitParamsPtr->timeTable0Ptr, cteInitParamsPtr->signalDef0Ptr,
-                    (volatile void *)gspCTEPtr->LUT);
-            /* 3. Configure time instances and corresponding signal states in the timing table register LUT_LSB_1.  */
+            rez = Cte_TimeTableCheck(table1Ptr);
+        }
+    }
+#endif
+    /* the tables must fit the timing of the current setup      */
+    if ((rez == (Std_ReturnType)E_OK) &&
+            (Cte_ClockDividerGet(table0Ptr, table1Ptr) > gsDriverData.cteMainClockDivider))
+    {
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_CLK_DIVIDER_ERROR, CTE_E_PARAM_VALUE, CTE_SETUP_PARAM_CHECK);
+        CTE_HALT_ON_ERROR;
+    }
+    if (rez == (Std_ReturnType)E_OK)
+    {
+        imagePtr->imageVersion = CTE_LUT_IMAGE_VERSION;
+        imagePtr->lutPartsNr = Cte_LutPartsGet(table0Ptr, table1Ptr);
+        for (i = 0u; i < sizeof(imagePtr->reserved); i++)
+        {
+            imagePtr->reserved[i] = 0u;
+        }
+        Cte_TableTimeLimitsGet(table0Ptr, table1Ptr, imagePtr->lutDuration);
+        imagePtr->setupHash = 0u;
+        /* the unused LUT words are 0, to get a content hash which depends only on the tables       */
+        for (i = 0u; i < CTE_LUT_COUNT; i++)
+        {
+            for (j = 0u; j < CTE_LUT_LUT_LSB_COUNT; j++)
+            {
+                imagePtr->lutParts[i].lsbWords[j] = 0u;
+                imagePtr->lutParts[i].msbWords[j] = 0u;
+            }
+        }
+        /* the image parts have the LUT registry layout     */
+        rez = Cte_TimingTableSet(table0Ptr, gsDriverData.signalDef0Ptr, (volatile void *)imagePtr->lutParts);
+        if ((rez == (Std_ReturnType)E_OK) && (table1Ptr != NULL_PTR))
+        {
+            rez = Cte_TimingTableSet(table1Ptr, gsDriverData.signalDef1Ptr, (volatile void *)&imagePtr->lutParts[1]);
+        }
+    }
+    return rez;
+}
+/*=== Cte_LutImageBuild ===========================*/
+
+/*==================================================================================================*/
+/**
+ * @brief   Procedure to write a part of a LUT image into the CTE registry.
+ * @details The part words and the part time limit (LUT_DUR for part 0, LUT_DUR1 for part 1) are written.
+ *
+ * @param[in]   imagePtr    = pointer to the image
+ * @param[in]   part        = the LUT part, 0 or 1
+ * @return      nothing
+ *
+ */
+static void Cte_LutPartWrite(const Cte_LutImageType *imagePtr, uint32 part)
+{
+    uint32 i;
+
+    for (i = 0u; i < CTE_LUT_LUT_LSB_COUNT; i++)
+    {
+        gspCTEPtr->LUT[part].LSB[i] = imagePtr->lutParts[part].lsbWords[i];
+        gspCTEPtr->LUT[part].MSB[i] = imagePtr->lutParts[part].msbWords[i];
+    }
+    if (part == 0u)
+    {
+        gspCTEPtr->LUT_DUR = imagePtr->lutDuration[0];
+    }
+    else
+    {
+        gspCTEPtr->LUT_DUR1 = imagePtr->lutDuration[1];
+    }
+}
+/*=== Cte_LutPartWrite ===========================*/
+#endif /* #if (CTE_LUT_IMAGE_USAGE == STD_ON) || (CTE_SHADOW_UPDATE_USAGE == STD_ON) */
+
+#if (CTE_SHADOW_UPDATE_USAGE == STD_ON)
+/*==================================================================================================*/
+/**
+ * @brief   Procedure to stage an image, to be written into the LUT at the next table end.
+ * @details The table end irq sources are enabled, even if not requested by the application; the enabled ones
+ *          are remembered, to be disabled after the update. The image must remain valid till the update end.
+ *
+ * @param[in]   imagePtr    = pointer to the staged image
+ * @return      nothing
+ *
+ */
+static void Cte_ShadowArm(const Cte_LutImageType *imagePtr)
+{
+    uint32 irqs = (uint32)CTE_IRQ_TT0_END | (uint32)CTE_IRQ_TABLE_EXEC_END;
+
+    if (imagePtr->lutPartsNr > 1u)
+    {
+        irqs |= (uint32)CTE_IRQ_TT1_END;
+    }
+    gsCteShadow.imagePtr = imagePtr;
+    gsCteShadow.pendingParts = (uint8)((1u << imagePtr->lutPartsNr) - 1u);
+    gsCteShadow.addedIrqs |= irqs & (~gspCTEPtr->INTEN);
+    CTE_WRITE_BARRIER();                        /* the staged data is complete before the irq sources enable   */
+    gspCTEPtr->INTEN |= gsCteShadow.addedIrqs;
+    CTE_WRITE_BARRIER();
+    gsCteShadow.state = (uint8)CTE_SHADOW_PENDING;
+}
+/*=== Cte_ShadowArm ===========================*/
+
+/*==================================================================================================*/
+/**
+ * @brief   Procedure to drop the staged image, without writing it.
+ * @details To be used only when the CTE is not running, so no table end can come.
+ *
+ * @return      nothing
+ *
+ */
+static void Cte_ShadowDrop(void)
+{
+    gspCTEPtr->INTEN &= ~gsCteShadow.addedIrqs;
+    gsCteShadow.addedIrqs = 0u;
+    gsCteShadow.pendingParts = 0u;
+    gsCteShadow.state = (uint8)CTE_SHADOW_IDLE;
+}
+/*=== Cte_ShadowDrop ===========================*/
+#endif /* #if (CTE_SHADOW_UPDATE_USAGE == STD_ON) */
+
+#if (CTE_LUT_IMAGE_USAGE == STD_ON)
+/*==================================================================================================*/
+/**
+ * @brief   Procedure to add a 32 bits word to a FNV-1a hash.
+ * @details The word is processed byte by byte, starting with the least significant one.
+ *
+ * @param[in]   hash    = the current hash value
+ * @param[in]   word    = the word to be added
+ * @return      The new hash value
+ *
+ */
+static uint64 Cte_HashWordAdd(uint64 hash, uint32 word)
+{
+    uint32 i;
+    uint32 val = word;
+
+    for (i = 0u; i < 4u; i++)
+    {
+        hash ^= (uint64)(val & 0xffu);
+        hash *= CTE_HASH_PRIME;
+        val >>= 8u;
+    }
+    return hash;
+}
+/*=== Cte_HashWordAdd ===========================*/
+
+/*==================================================================================================*/
+/**
+ * @brief   Procedure to get the hash of the current CTE setup.
+ * @details Only the setup data which changes the LUT content is used : the working frequency, the main clock
+ *          divider and the outputs definitions.
+ *
+ * @return      The setup hash
+ * @pre         The driver must be initialized before
+ *
+ */
+static uint64 Cte_SetupHashGet(void)
+{
+    uint32                  i;
+    uint64                  hash = CTE_HASH_OFFSET_BASIS;
+    Cte_SingleOutputDefType *defPtr;
+
+    hash = Cte_HashWordAdd(hash, gsDriverData.cteWorkingFreq);
+    hash = Cte_HashWordAdd(hash, (uint32)gsDriverData.cteMainClockDivider);
+    for (i = 0u; i < CTE_LUT_COUNT; i++)
+    {
+        defPtr = (i == 0u) ? gsDriverData.signalDef0Ptr : gsDriverData.signalDef1Ptr;
+        while ((uint8)defPtr->outputSignal < (uint8)CTE_OUTPUT_MAX)
+        {
+            hash = Cte_HashWordAdd(hash, (uint32)defPtr->outputSignal);
+            hash = Cte_HashWordAdd(hash, (uint32)defPtr->signalType);
+            hash = Cte_HashWordAdd(hash, defPtr->clockPeriod);
+            defPtr++;
+        }
+        hash = Cte_HashWordAdd(hash, (uint32)CTE_OUTPUT_MAX);   /* the end of the definitions table       */
+    }
+    return hash;
+}
+/*=== Cte_SetupHashGet ===========================*/
+
+/*==================================================================================================*/
+/**
+ * @brief   Procedure to get the content hash of a LUT image.
+ * @details All the image fields before contentHash are used.
+ *
+ * @param[in]   imagePtr    = pointer to the LUT image
+ * @return      The content hash
+ *
+ */
+static uint64 Cte_LutImageHashGet(const Cte_LutImageType *imagePtr)
+{
+    uint32 i, j;
+    uint64 hash = CTE_HASH_OFFSET_BASIS;
+
+    hash = Cte_HashWordAdd(hash, imagePtr->imageVersion);
+    hash = Cte_HashWordAdd(hash, (uint32)imagePtr->lutPartsNr);
+    for (i = 0u; i < CTE_LUT_COUNT; i++)
+    {
+        hash = Cte_HashWordAdd(hash, imagePtr->lutDuration[i]);
+    }
+    hash = Cte_HashWordAdd(hash, (uint32)imagePtr->setupHash);
+    hash = Cte_HashWordAdd(hash, (uint32)(imagePtr->setupHash >> 32u));
+    for (i = 0u; i < CTE_LUT_COUNT; i++)
+    {
+        for (j = 0u; j < CTE_LUT_LUT_LSB_COUNT; j++)
+        {
+            hash = Cte_HashWordAdd(hash, imagePtr->lutParts[i].lsbWords[j]);
+            hash = Cte_HashWordAdd(hash, imagePtr->lutParts[i].msbWords[j]);
+        }
+    }
+    return hash;
+}
+/*=== Cte_LutImageHashGet ===========================*/
+
+/*==================================================================================================*/
+/**
+ * @brief   Procedure to find a registered LUT image.
+ *
+ * @param[in]   contentHash = the image content hash
+ * @return      The cache index of the image, or CTE_LUT_IMAGE_CACHE_SIZE if not found
+ *
+ */
+static uint32 Cte_LutImageFind(uint64 contentHash)
+{
+    uint32 i;
+
+    for (i = 0u; i < CTE_LUT_IMAGE_CACHE_SIZE; i++)
+    {
+        if ((gsCteLutImageUsed[i] == TRUE) && (gsCteLutImages[i].contentHash == contentHash))
+        {
+            break;
+        }
+    }
+    return i;
+}
+/*=== Cte_LutImageFind ===========================*/
+#endif /* #if (CTE_LUT_IMAGE_USAGE == STD_ON) */
+
+/*==================================================================================================*/
+/**
+ * @brief   Procedure to reset the driver state, before a new setup.
+ * @details The driver is not initialized any more; the staged update, the playlist and the statistics are dropped.
+ *
+ * @return      nothing
+ *
+ */
+static void Cte_DriverStateReset(void)
+{
+    /* set the driver status to NOT_INITIALIZED     */
+    gsDriverData.cteDriverStatus = (uint8_t)CTE_DRIVER_STATE_NOT_INIT;
+#if (CTE_SHADOW_UPDATE_USAGE == STD_ON)
+    gsCteShadow.state = (uint8)CTE_SHADOW_IDLE;         /* a new setup drops any staged update      */
+    gsCteShadow.pendingParts = 0u;
+    gsCteShadow.addedIrqs = 0u;
+#endif
+#if (CTE_PLAYLIST_USAGE == STD_ON)
+    gsCtePlaylist.setsNr = 0u;                          /* and the playlist too                     */
+#endif
+#if (CTE_TIMING_STATS_USAGE == STD_ON)
+    gCteTimingStats = gsCteTimingStatsReset;            /* new statistics for the new setup         */
+    gCteTimingStats.counterFreq = CTE_GET_TIMESTAMP_FREQ();
+#endif
+}
+/*=== Cte_DriverStateReset ===========================*/
+
+/*==================================================================================================*/
+/**
+ * @brief   Procedure to get the pointer to the CTE registry, if not done before.
+ *
+ * @return      E_OK/RSDK_SUCCESS = success; other = error
+ *
+ */
+static Std_ReturnType Cte_RegistryPtrGet(void)
+{
+    Std_ReturnType rez = (Std_ReturnType)E_OK;
+
+    if (gspCTEPtr == NULL_PTR)
+    {
+#if (CTE_REGS_MODEL_USED == STD_ON)
+        gspCTEPtr = &gCteRegsModel;         /* host build, the registry is the in-memory model provided by the build */
+#elif !defined(linux)
+        gspCTEPtr = IP_CTE;
+#else
+        if(gpRsdkCteDevice != NULL_PTR)
+        {
+            gspCTEPtr = (volatile CTE_Type*)gpRsdkCteDevice->pMemMapVirtAddr;
+        }
+#endif
+        if (gspCTEPtr == NULL_PTR)
+        {
+            rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NOT_INITIALIZED, CTE_E_PARAM_POINTER, CTE_SETUP_PARAM_CHECK);
+            CTE_HALT_ON_ERROR;
+        }
+    }
+    return rez;
+}
+/*=== Cte_RegistryPtrGet ===========================*/
+
+/*==================================================================================================*/
+/**
+ * @brief   Procedure to reset the CTE, before the LUT is written.
+ *
+ * @param[in]   cteClockDivider     = the main clock divider to be used
+ * @return      nothing
+ *
+ */
+static void Cte_ModuleReset(uint8 cteClockDivider)
+{
+    /* reset the CTE        */
+    /* set the bit to reset CTE.
+     * Initialization of CTE after reset
+     *
+     */
+    CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL, CTE_CNTRL_CTE_RST_MASK, CTE_CNTRL_CTE_RST(1u));
+    gsDriverData.cteMainClockDivider = cteClockDivider; /* keep the divider; simple delay to get the reset  */
+    /* reset the bit to be able to use the registry     */
+    CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL, CTE_CNTRL_CTE_RST_MASK, CTE_CNTRL_CTE_RST(0u));
+    /* compute the LUT checksum, including the MSBit    */
+    CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL, CTE_CNTRL1_CHKSM_MD_MASK, CTE_CNTRL1_CHKSM_MD(1u));
+}
+/*=== Cte_ModuleReset ===========================*/
+
+/*==================================================================================================*/
+/**
+ * @brief   Procedure to configure the CTE, after the LUT was written.
+ * @details The output types, the working mode, the run mode, the time limits, the clocks and the irq are set.
+ *          Only the tables lengths and time limits are used from the time tables.
+ *
+ * @param[in]   cteInitParamsPtr    = pointer to the initialization structure
+ * @return      E_OK/RSDK_SUCCESS = success; other = error
+ *
+ */
+static Std_ReturnType Cte_ModuleConfigure(const Cte_SetupParamsType *cteInitParamsPtr)
+{
+    Std_ReturnType  rez;
+    uint8           lutPartsNr;                 /* the used LUT parts       */
+    uint32          lutDur[CTE_LUT_COUNT];      /* LUT_DUR/LUT_DUR1 values  */
+    #if defined(linux)
+        uint32          mask;
+    #else
+        volatile SRC_1_Type * pSrc_1;
+    #endif
+
+    /* 5. Configure signal types in signal type registers CTE_SIGTYPE0/1.                                   */
+    Cte_OutputSetup(cteInitParamsPtr->signalDef0Ptr, 0);
+    if (cteInitParamsPtr->signalDef1Ptr != NULL_PTR)
+    {
+        Cte_OutputSetup(cteInitParamsPtr->signalDef1Ptr, 1);
+    }
+    if(cteInitParamsPtr->timeTable0Ptr->tableLength > CTE_MAX_SMALL_TIME_TABLE_LEN)
+    {
+        Cte_OutputSetup(cteInitParamsPtr->signalDef0Ptr, 1);
+    }
+    /* 6. Configure MA_SL_ST bit in control register CTE_CNTRL.                                         */
+    if (cteInitParamsPtr->cteMode.workingMode == CTE_MASTER)
+    {               /* Master mode used     */
+        /* normally the bit must be already 0 after reset       */
+        CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL, CTE_CNTRL_MA_SL_ST_MASK, CTE_CNTRL_MA_SL_ST(0u));
+    }
+    else
+    {
+        /* set bit for Slave mode       */
+        CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL, CTE_CNTRL_MA_SL_ST_MASK, CTE_CNTRL_MA_SL_ST(0u));
+        /* set the appropriate registry values for the Slave mode       */
+#ifdef linux
+        mask = (uint32)cteInitParamsPtr->cteMode.workingMode - (uint32_t)RSDK_CTE_SLAVE_EXTERNAL;
+        mask += (uint32)cteInitParamsPtr->cteMode.cteWorkingParam1.cteCsi2Vc << 1u;
+        mask += (uint32)cteInitParamsPtr->cteMode.cteWorkingParam0.cteCsi2Unit << 3u;
+        ((volatile SRC_1_Type*)gpRsdkCteDevice->pSrc_1)->CTE_CTRL_REG = mask;
+#else
+#if (CTE_REGS_MODEL_USED == STD_ON)
+        pSrc_1 = &gCteSrc1Model;
+#else
+        pSrc_1 = IP_SRC_1;
+#endif
+        CTE_SET_REGISTRY32(&pSrc_1->CTE_CTRL_REG, SRC_1_CTE_CTRL_REG_IN_CTE_MASK,
+                SRC_1_CTE_CTRL_REG_IN_CTE(
+                        (uint32)cteInitParamsPtr->cteMode.workingMode - (uint32)RSDK_CTE_SLAVE_EXTERNAL));
+        CTE_SET_REGISTRY32(&pSrc_1->CTE_CTRL_REG, SRC_1_CTE_CTRL_REG_MIPICSI2_ID_MASK,
+              SRC_1_CTE_CTRL_REG_MIPICSI2_ID((uint32)cteInitParamsPtr->cteMode.cteWorkingParam0.cteCsi2Unit));
+        CTE_SET_REGISTRY32(&pSrc_1->CTE_CTRL_REG, SRC_1_CTE_CTRL_REG_VC_ID_MASK,
+                SRC_1_CTE_CTRL_REG_VC_ID((uint32_t)cteInitParamsPtr->cteMode.cteWorkingParam1.cteCsi2Vc));
+#endif /* #ifdef linux  */
+
+        CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL, CTE_CNTRL_RFS_DLY_MASK,
+                CTE_CNTRL_RFS_DLY((uint32)cteInitParamsPtr->cteMode.cteWorkingParam0.cteInternalRfsDelay));
+        CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL, CTE_CNTRL_RCS_DLY_MASK,
+                CTE_CNTRL_RCS_DLY((uint32)cteInitParamsPtr->cteMode.cteWorkingParam1.cteInternalRcsDelay));
+    } /* if (cteInitParamsPtr->cteMode.workingMode == CTE_MASTER) */
+    /* 7. Configure REP_CNT value in control register CTE_CNTRL.                                        */
+    CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL, CTE_CNTRL_REP_CNT_MASK,
+            CTE_CNTRL_REP_CNT((uint32)cteInitParamsPtr->repeatCount));
+    /* 8. Configure OPMOD_SL bits in register CTE_CNTRL to define continuous run mode or toggle mode.   */
+    lutPartsNr = Cte_LutPartsGet(cteInitParamsPtr->timeTable0Ptr, cteInitParamsPtr->timeTable1Ptr);
+    Cte_RunModeSet(lutPartsNr);
+    gsDriverData.cteLutPartsNr = lutPartsNr;
+    /* 9. Configure the duration counter for TT0 and TT1 execution in registers CTE_LUT_DUR and
+     * CTE_LUT_DUR1 respectively.       */
+    Cte_TableTimeLimitsGet(cteInitParamsPtr->timeTable0Ptr, cteInitParamsPtr->timeTable1Ptr, lutDur);
+    Cte_TableTimeLimitSet(lutDur, lutPartsNr);
+    /* 10. Configure timemode bit in CTE_CNTRL1 for absolute/relative mode of timing table execution.   */
+    /* only relative timing used        */
+    CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL1, CTE_CNTRL1_TIMEMODE_MASK, CTE_CNTRL1_TIMEMODE(0u));
+    /* 11. Configure CTECK_DV in CTE_CNTRL1 to define the CTE data path clock.                          */
+    CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL1, CTE_CNTRL1_CTECK_DV_MASK,
+            CTE_CNTRL1_CTECK_DV(gsDriverData.cteMainClockDivider));
+    /* 12. Configure CLKDIV_1-CLKDIV_4 in CTE_CNTRL1 to define clocks for external signals.             */
+    rez = Cte_ClockDividersSet(cteInitParamsPtr);
+    /* 13. Configure CLK_SEL0-CLK_SEL9 in clock select register CTE_CLKSEL to select the clock divider
+     * for the external signals.            */
+    if (rez == (Std_ReturnType)E_OK)
+    {
+        Cte_OutputClockSelect(cteInitParamsPtr);
+    }
+    /* Other necessary setup : IRQ      */
+    if (rez == (Std_ReturnType)E_OK)
+    {
+        rez = Cte_IrqInit(cteInitParamsPtr);
+        gsDriverData.cteReqEvents = (uint32)cteInitParamsPtr->cteIrqEvents;
+        gsDriverData.pCteCallback = cteInitParamsPtr->pCteCallback;
+    }
+    return rez;
+}
+/*=== Cte_ModuleConfigure ===========================*/
+
+#if (CTE_TABLES_BLOB_USAGE == STD_ON)
+/*==================================================================================================*/
+/**
+ * @brief   Procedure to get the outputs defined by a definitions list.
+ *
+ * @param[in]   signalDefPtr    = pointer to the definitions, ended by CTE_OUTPUT_MAX
+ * @return      The defined outputs, one bit for each Cte_OutputType value
+ *
+ */
+static uint32 Cte_DefinedOutputsGet(const Cte_SingleOutputDefType *signalDefPtr)
+{
+    const Cte_SingleOutputDefType   *pwSignalDef;
+    uint32                          definedMask = 0u;
+
+    pwSignalDef = signalDefPtr;
+    while ((uint8)pwSignalDef->outputSignal < (uint8)CTE_OUTPUT_MAX)
+    {
+        definedMask |= (uint32)1u << (uint8)pwSignalDef->outputSignal;
+        pwSignalDef++;
+    }
+    return definedMask;
+}
+/*=== Cte_DefinedOutputsGet ===========================*/
+
+/*==================================================================================================*/
+/**
+ * @brief   Procedure to check the output definitions of a blob table.
+ * @details The same rules as for Cte_SignalDefsCheck are applied; an output can be defined only once.
+ *
+ * @param[in]   outputPtr       = pointer to the first output definition of the table
+ * @param[in]   outputsNr       = the number of output definitions
+ * @param[out]  definedMaskPtr  = the defined outputs, one bit for each Cte_OutputType value
+ * @return      E_OK/RSDK_SUCCESS = success; other = the error, not reported yet
+ *
+ */
+static Std_ReturnType Cte_BlobOutputsCheck(const Cte_BlobOutputType *outputPtr, uint32 outputsNr,
+        uint32 *definedMaskPtr)
+{
+    uint32          i, bit;
+    uint8           defSPT = 0xffu;             /* the SPT outputs type, not defined yet            */
+    Std_ReturnType  rez = (Std_ReturnType)E_OK;
+
+    *definedMaskPtr = 0u;
+    for (i = 0u; (i < outputsNr) && (rez == (Std_ReturnType)E_OK); i++)
+    {
+        bit = (uint32)1u << (outputPtr[i].outputSignal & 0x1fu);
+        if ((outputPtr[i].outputSignal >= (uint8)CTE_OUTPUT_MAX) || (outputPtr[i].signalType >= (uint8)CTE_OUT_MAX)
+                || (outputPtr[i].reserved != 0u) || ((*definedMaskPtr & bit) != 0u))
+        {
+            rez = RSDK_CTE_DRV_BLOB_WRG_FORMAT;
+        }
+        else if (outputPtr[i].outputSignal < (uint8)CTE_OUTPUT_CTEP_0)
+        {                       /* SPT event type, LOGIC or TOGGLE, the same for all SPT outputs    */
+            if ((outputPtr[i].signalType != (uint8)CTE_OUT_LOGIC) && (outputPtr[i].signalType != (uint8)CTE_OUT_TOGGLE))
+            {
+                rez = RSDK_CTE_DRV_SIG_OUT_WRG_TYPE;
+            }
+            else if ((defSPT != 0xffu) && (defSPT != outputPtr[i].signalType))
+            {
+                rez = RSDK_CTE_DRV_SIG_OUT_DIF_TYPE;
+            }
+            else
+            {
+                defSPT = outputPtr[i].signalType;
+            }
+        }
+        else if ((outputPtr[i].outputSignal > (uint8)CTE_OUTPUT_SPT_RFS) &&
+                (outputPtr[i].signalType != (uint8)CTE_OUT_LOGIC))
+        {                       /* FLEX event type, only LOGIC                                      */
+            rez = RSDK_CTE_DRV_SIG_OUT_WRG_TYPE;
+        }
+        else
+        {
+            ;                   /* CTEP/RCS/RFS outputs, all the types accepted                     */
+        }
+        *definedMaskPtr |= bit;
+    }
+    return rez;
+}
+/*=== Cte_BlobOutputsCheck ===========================*/
+
+/*==================================================================================================*/
+/**
+ * @brief   Procedure to check the events and the actions of a blob table.
+ * @details The events times must increase, as for Cte_ClockDividerGet, and the maximum delay between consecutive
+ *          events is kept. Each action must use a defined output (the FLEX outputs excepted) and an event can
+ *          have at most one action for an output.
+ *
+ * @param[in,out]   viewPtr         = pointer to the blob view, with the sections set
+ * @param[in]       table           = the table, 0 or 1
+ * @param[in]       definedMask     = the outputs defined for the table
+ * @param[in,out]   actionIdxPtr    = the index of the first action of the table; at return, the index after
+ *                                    the last action of the table
+ * @return      E_OK/RSDK_SUCCESS = success; other = the error, not reported yet
+ *
+ */
+static Std_ReturnType Cte_BlobEventsCheck(Cte_BlobViewType *viewPtr, uint32 table, uint32 definedMask,
+        uint32 *actionIdxPtr)
+{
+    const Cte_BlobEventType     *eventPtr;
+    const Cte_BlobActionType    *actionPtr;
+    uint32                      i, j, bit, eventMask, lastTime, actionIdx;
+    Std_ReturnType              rez = (Std_ReturnType)E_OK;
+
+    eventPtr = &viewPtr->eventsPtr[(table == 0u) ? 0u : (uint32)viewPtr->hdrPtr->tableLen[0]];
+    actionIdx = *actionIdxPtr;
+    viewPtr->firstAction[table] = (uint16)actionIdx;
+    lastTime = 0u;
+    for (i = 0u; (i < viewPtr->hdrPtr->tableLen[table]) && (rez == (Std_ReturnType)E_OK); i++)
+    {
+        if (((eventPtr->reserved[0] | eventPtr->reserved[1] | eventPtr->reserved[2]) != 0u) ||
+                ((actionIdx + eventPtr->actionsNr) > viewPtr->hdrPtr->actionsNr))
+        {
+            rez = RSDK_CTE_DRV_BLOB_WRG_FORMAT;
+        }
+        else if (eventPtr->actionsNr > (uint8)CTE_OUTPUT_MAX)
+        {
+            rez = RSDK_CTE_DRV_TOO_MANY_ACTIONS;
+        }
+        else
+        {
+            if (lastTime < eventPtr->absTime)
+            {
+                if (viewPtr->maxDelay < (eventPtr->absTime - lastTime))
+                {
+                    viewPtr->maxDelay = eventPtr->absTime - lastTime;
+                }
+                lastTime = eventPtr->absTime;
+            }
+            else
+            {
+                viewPtr->maxDelay = CTE_TOO_BIG_TIME_DELAY; /* incorrect time sequence, no clock divider possible */
+            }
+            actionPtr = &viewPtr->actionsPtr[actionIdx];
+            eventMask = 0u;
+            for (j = 0u; (j < eventPtr->actionsNr) && (rez == (Std_ReturnType)E_OK); j++)
+            {
+                bit = (uint32)1u << (actionPtr[j].outputSignal & 0x1fu);
+                if (actionPtr[j].outputSignal >= (uint8)CTE_OUTPUT_MAX)
+                {
+                    rez = RSDK_CTE_DRV_SIG_NOT_DEF;
+                }
+                else if ((eventMask & bit) != 0u)
+                {
+                    rez = RSDK_CTE_DRV_TOO_MANY_ACTIONS;    /* more than one action for the output          */
+                }
+                else if ((actionPtr[j].outputSignal < (uint8)CTE_OUTPUT_FLEX_0) && ((definedMask & bit) == 0u))
+                {
+                    rez = RSDK_CTE_DRV_SIG_NOT_DEF;
+                }
+                else if (actionPtr[j].newState > (uint8)CTE_LOGIC_UNCHANGED)
+                {
+                    rez = RSDK_CTE_DRV_SIG_OUT_STATE_WRG;   /* all the output states enums have 4 values    */
+                }
+                else
+                {
+                    eventMask |= bit;
+                }
+            }
+            actionIdx += eventPtr->actionsNr;
+        }
+        eventPtr++;
+    }
+    *actionIdxPtr = actionIdx;
+    return rez;
+}
+/*=== Cte_BlobEventsCheck ===========================*/
+
+/*==================================================================================================*/
+/**
+ * @brief   Procedure to check a tables blob, in a single pass.
+ * @details The header, the sections lengths and all the sections content are checked and the blob view is filled.
+ *          After a successful check, the blob can be used without other checks.
+ *
+ * @param[in]   blobPtr         = pointer to the blob
+ * @param[in]   bufferSize      = the bytes available at blobPtr
+ * @param[in]   setupBlob       = TRUE for a setup blob, with output definitions; FALSE for a tables update,
+ *                                which uses the output definitions of the current setup
+ * @param[out]  viewPtr         = pointer to the blob view
+ * @return      E_OK/RSDK_SUCCESS = success; other = error
+ *
+ */
+static Std_ReturnType Cte_BlobCheck(const Cte_BlobHeaderType *blobPtr, uint32 bufferSize, boolean setupBlob,
+        Cte_BlobViewType *viewPtr)
+{
+    const uint8     *bytePtr;
+    uint32          tablesNr, outputsNr, eventsNr, blobSize, t, definedMask, actionIdx;
+    boolean         wrongOutputs;
+    Std_ReturnType  rez = (Std_ReturnType)E_OK;
+
+    if ((blobPtr == NULL_PTR) || (((uintptr_t)blobPtr & 3u) != 0u) ||
+            (bufferSize < (uint32)sizeof(Cte_BlobHeaderType)))
+    {                           /* the sections are used in place, so the blob must be 4 bytes aligned      */
+        rez = RSDK_CTE_DRV_BLOB_WRG_FORMAT;
+    }
+    else
+    {
+        tablesNr = (blobPtr->tableLen[1] == 0u) ? 1u : 2u;
+        outputsNr = (uint32)blobPtr->outputsNr[0] + (uint32)blobPtr->outputsNr[1];
+        eventsNr = (uint32)blobPtr->tableLen[0] + (uint32)blobPtr->tableLen[1];
+        blobSize = (uint32)sizeof(Cte_BlobHeaderType) + (outputsNr * (uint32)sizeof(Cte_BlobOutputType)) +
+                (eventsNr * (uint32)sizeof(Cte_BlobEventType)) +
+                ((uint32)blobPtr->actionsNr * (uint32)sizeof(Cte_BlobActionType));
+        blobSize = (blobSize + 3u) & (~3u);                 /* the padding to a multiple of 4 bytes     */
+        if (setupBlob == TRUE)
+        {                       /* each used table has output definitions, the unused table has none    */
+            wrongOutputs = ((blobPtr->outputsNr[0] == 0u) || (blobPtr->outputsNr[0] > (uint8)CTE_OUTPUT_MAX) ||
+                    (blobPtr->outputsNr[1] > (uint8)CTE_OUTPUT_MAX) ||
+                    ((tablesNr == 1u) == (blobPtr->outputsNr[1] != 0u))) ? TRUE : FALSE;
+        }
+        else
+        {                       /* the output definitions of the setup are used                         */
+            wrongOutputs = (outputsNr != 0u) ? TRUE : FALSE;
+        }
+        if ((blobPtr->blobVersion != CTE_TABLES_BLOB_VERSION) || (blobPtr->blobSize != blobSize) ||
+                (blobSize > bufferSize) || (blobPtr->reserved != 0u) || (blobPtr->tableLen[0] == 0u) ||
+                ((tablesNr == 1u) && (blobPtr->timeLimit[1] != 0u)) || (wrongOutputs == TRUE))
+        {
+            rez = RSDK_CTE_DRV_BLOB_WRG_FORMAT;
+        }
+        else if (((tablesNr == 1u) && (blobPtr->tableLen[0] > CTE_MAX_LARGE_TIME_TABLE_LEN)) ||
+                ((tablesNr == 2u) && ((blobPtr->tableLen[0] > CTE_MAX_SMALL_TIME_TABLE_LEN) ||
+                        (blobPtr->tableLen[1] > CTE_MAX_SMALL_TIME_TABLE_LEN))))
+        {
+            rez = RSDK_CTE_DRV_TABLE_TOO_LONG;
+        }
+        else
+        {
+            /* the sections follow the header, each one aligned for its items      */
+            bytePtr = (const uint8 *)(const void *)blobPtr;
+            bytePtr += sizeof(Cte_BlobHeaderType);
+            viewPtr->hdrPtr = blobPtr;
+            viewPtr->outputsPtr = (const Cte_BlobOutputType *)(const void *)bytePtr;
+            bytePtr += outputsNr * (uint32)sizeof(Cte_BlobOutputType);
+            viewPtr->eventsPtr = (const Cte_BlobEventType *)(const void *)bytePtr;
+            bytePtr += eventsNr * (uint32)sizeof(Cte_BlobEventType);
+            viewPtr->actionsPtr = (const Cte_BlobActionType *)(const void *)bytePtr;
+            viewPtr->maxDelay = 0u;
+            actionIdx = 0u;
+            for (t = 0u; (t < tablesNr) && (rez == (Std_ReturnType)E_OK); t++)
+            {
+                if (setupBlob == TRUE)
+                {
+                    rez = Cte_BlobOutputsCheck(&viewPtr->outputsPtr[(t == 0u) ? 0u : (uint32)blobPtr->outputsNr[0]],
+                            (uint32)blobPtr->outputsNr[t], &definedMask);
+                }
+                else
+                {
+                    definedMask = Cte_DefinedOutputsGet((t == 0u) ? gsDriverData.signalDef0Ptr :
+                            gsDriverData.signalDef1Ptr);
+                }
+                if (rez == (Std_ReturnType)E_OK)
+                {
+                    rez = Cte_BlobEventsCheck(viewPtr, t, definedMask, &actionIdx);
+                }
+                /* the table definition, without events, for the lengths and time limits computing          */
+                viewPtr->tables[t].tableLength = blobPtr->tableLen[t];
+                viewPtr->tables[t].tableTimeExecLimit = blobPtr->timeLimit[t];
+                viewPtr->tables[t].eventsPtr = NULL_PTR;
+            }
+            if ((rez == (Std_ReturnType)E_OK) && (actionIdx != blobPtr->actionsNr))
+            {
+                rez = RSDK_CTE_DRV_BLOB_WRG_FORMAT;         /* actions not used by the events               */
+            }
+        }
+    }
+    if (rez != (Std_ReturnType)E_OK)
+    {
+        rez = CTE_REPORT_ERROR(rez, CTE_E_PARAM_VALUE, CTE_TABLES_BLOB_CALL);
+        CTE_HALT_ON_ERROR;
+    }
+    return rez;
+}
+/*=== Cte_BlobCheck ===========================*/
+
+/*==================================================================================================*/
+/**
+ * @brief   Procedure to copy the output definitions of a setup blob into the driver data.
+ * @details Each definitions list is ended by CTE_OUTPUT_MAX; the list of an unused table is empty.
+ *
+ * @param[in]   viewPtr     = pointer to the blob view, the blob checked before
+ * @return      nothing
+ *
+ */
+static void Cte_BlobOutputsCopy(const Cte_BlobViewType *viewPtr)
+{
+    const Cte_BlobOutputType    *outputPtr;
+    Cte_SingleOutputDefType     *signalDefPtr;
+    uint32                      t, i;
+
+    outputPtr = viewPtr->outputsPtr;
+    for (t = 0u; t < CTE_LUT_COUNT; t++)
+    {
+        signalDefPtr = (t == 0u) ? gsDriverData.signalDef0Ptr : gsDriverData.signalDef1Ptr;
+        for (i = 0u; i < viewPtr->hdrPtr->outputsNr[t]; i++)
+        {
+            signalDefPtr[i].outputSignal = (Cte_OutputType)outputPtr->outputSignal;
+            signalDefPtr[i].signalType = (Cte_OutputTypeType)outputPtr->signalType;
+            signalDefPtr[i].clockPeriod = outputPtr->clockPeriod;
+            outputPtr++;
+        }
+        signalDefPtr[i].outputSignal = CTE_OUTPUT_MAX;
+    }
+}
+/*=== Cte_BlobOutputsCopy ===========================*/
+
+/*==================================================================================================*/
+/**
+ * @brief   Procedure to set the LUT for a blob table.
+ * @details The same LUT content as for Cte_TimingTableSet (the same LUT writers), but the events and actions are
+ *          used in place.
+ *
+ * @param[in]   viewPtr         = pointer to the blob view, the blob checked before
+ * @param[in]   table           = the table, 0 or 1
+ * @param[in]   signalDefPtr    = pointer to the output definitions of the table
+ * @param[in]   lutPtr          = pointer to the LUT part of the table
+ * @return      E_OK/RSDK_SUCCESS = success; other = error
+ * @pre         The CTE clock frequency and the main clock divider must be set before
+ *
+ */
+static Std_ReturnType Cte_BlobTableSet(const Cte_BlobViewType *viewPtr, uint32 table,
+        Cte_SingleOutputDefType *signalDefPtr, volatile void *lutPtr)
+{
+    const Cte_BlobEventType     *eventPtr;
+    const Cte_BlobActionType    *actionPtr;
+    Cte_ActionType              action;             /* the action, in the form used for the mask computing  */
+    uint64                      longIntMask;        /* values for 64 bits computation                       */
+    uint32                      i, j, lastTimeTick;
+    Std_ReturnType              rez = (Std_ReturnType)E_OK;
+
+    Cte_LutTableClear((volatile struct LUT *)lutPtr, viewPtr->hdrPtr->tableLen[table]);
+    eventPtr = &viewPtr->eventsPtr[(table == 0u) ? 0u : (uint32)viewPtr->hdrPtr->tableLen[0]];
+    actionPtr = &viewPtr->actionsPtr[viewPtr->firstAction[table]];
+    lastTimeTick = 0u;
+    for (i = 0u; (i < viewPtr->hdrPtr->tableLen[table]) && (rez == (Std_ReturnType)E_OK); i++)
+    {
+        longIntMask = 0u;
+        for (j = 0u; (j < eventPtr->actionsNr) && (rez == (Std_ReturnType)E_OK); j++)
+        {
+            action.outputSignal = (Cte_OutputType)actionPtr->outputSignal;
+            action.cteOutputSignalType.newLogicState = (Cte_LogicOutStatesType)actionPtr->newState;
+            rez = Cte_ActionMaskAdd(&action, signalDefPtr, &longIntMask);
+            actionPtr++;
+        }
+        Cte_LutEventWrite((volatile struct LUT *)lutPtr, i, eventPtr->absTime, longIntMask, &lastTimeTick);
+        eventPtr++;
+    }
+    return rez;
+}
+/*=== Cte_BlobTableSet ===========================*/
+
+/*==================================================================================================*/
+/**
+ * @brief   Procedure to write the LUT for the tables of a blob.
+ *
+ * @param[in]   viewPtr     = pointer to the blob view, the blob checked before
+ * @return      E_OK/RSDK_SUCCESS = success; other = error
+ * @pre         The output definitions must be in the driver data
+ *
+ */
+static Std_ReturnType Cte_BlobTablesWrite(const Cte_BlobViewType *viewPtr)
+{
+    Std_ReturnType rez;
+
+    rez = Cte_BlobTableSet(viewPtr, 0u, gsDriverData.signalDef0Ptr, (volatile void *)gspCTEPtr->LUT);
+    if ((rez == (Std_ReturnType)E_OK) && (viewPtr->hdrPtr->tableLen[1] != 0u))
+    {
+        rez = Cte_BlobTableSet(viewPtr, 1u, gsDriverData.signalDef1Ptr, (volatile void *)&gspCTEPtr->LUT[1]);
+    }
+    return rez;
+}
+/*=== Cte_BlobTablesWrite ===========================*/
+#endif /* #if (CTE_TABLES_BLOB_USAGE == STD_ON) */
+
+/*==================================================================================================
+ *                                       GLOBAL FUNCTIONS
+ ==================================================================================================*/
+
+/*================================================================================================*/
+/**
+ * @brief   Low level initialization procedure for CTE driver
+ * @details If called, the CTE function is stopped.
+ *          After initialization the CTE is not started, a specific Cte_Start call must be used for this.
+ *          The operation can be done at any moment; if the CTE is working, it will be stopped.
+ *
+ * @param[in]   cteInitParamsPtr    = pointer to the initialization structure
+ * @param[in]   lutChecksumPtr      = pointer to a uint64 value, which will receive the final LUT checksum;
+ *                                  this value can be checked later using Cte_GetLutChecksum
+ * @return      E_OK/RSDK_SUCCESS = initialization succeeded
+ *              other values      = initialization failed, use the appropriate tools to detect the issue
+ *
+ */
+Std_ReturnType Cte_Setup(const Cte_SetupParamsType *cteInitParamsPtr, uint64 *lutChecksumPtr)
+{
+    Std_ReturnType  rez, regRez;
+    uint8           cteClockDivider;            /* the clock divider        */
+    uint32          len;
+
+    Cte_DriverStateReset();
+    /* check the initialization parameters          */
+    if ((cteInitParamsPtr == NULL_PTR) || (lutChecksumPtr == NULL_PTR))
+    {
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NULL_PTR_PARAMS, CTE_E_PARAM_POINTER, CTE_SETUP_PARAM_CHECK);
+        CTE_HALT_ON_ERROR;
+    }
+    else
+    {
+        rez = Cte_InitParamsCheck(cteInitParamsPtr);
+    }
+    regRez = Cte_RegistryPtrGet();
+    if (regRez != (Std_ReturnType)E_OK)
+    {
+        rez = regRez;
+    }
+    if (rez == (Std_ReturnType)E_OK)
+    {
+        /* initialize the necessary data        */
+        gsDriverData.cteWorkingFreq = cteInitParamsPtr->cteClockFrecq; /* the working frequency for further computing */
+        cteClockDivider = Cte_ClockDividerGet(cteInitParamsPtr->timeTable0Ptr, cteInitParamsPtr->timeTable1Ptr);
+        if (cteClockDivider >= CTE_CLOCK_DIVIDER_LIMIT)
+        {
+            rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_CLK_DIVIDER_ERROR, CTE_E_PARAM_VALUE, CTE_SETUP_PARAM_CHECK);
+            CTE_HALT_ON_ERROR;
+        }
+        else
+        {
+            Cte_ModuleReset(cteClockDivider);
+            /* CTE specific initialization              */
+            /* 1. Configure time instances and corresponding signal states in the timing table register LUT_LSB_0.  */
+            /* 2. Configure remaining signal states in the timing table register LUT_MSB_0.                         */
+            rez = Cte_TimingTableSet(cteInitParamsPtr->timeTable0Ptr, cteInitParamsPtr->signalDef0Ptr,
+                    (volatile void *)gspCTEPtr->LUT);
+            /* 3. Configure time instances and corresponding signal states in the timing table register LUT_LSB_1.  */
             /* 4. Configure remaining signal states in the timing table register LUT_MSB_1.                         */
             if ((rez == (Std_ReturnType)E_OK) && (cteInitParamsPtr->timeTable1Ptr != NULL_PTR))
             {
-                rez = Cte_TimingTableSet(cteInitParamsPtr->timeTable1Ptr, cteInitParamsPtr->signalDef1Ptr,
-                        (volatile void *)&gspCTEPtr->LUT[1]);
+                rez = Cte_TimingTableSet(cteInitParamsPtr->timeTable1Ptr, cteInitParamsPtr->signalDef1Ptr,
+                        (volatile void *)&gspCTEPtr->LUT[1]);
+            }
+            *lutChecksumPtr = Cte_GetLutChecksum();
+            /* 5...13. and the IRQ                      */
+            if (rez == (Std_ReturnType)E_OK)
+            {
+                rez = Cte_ModuleConfigure(cteInitParamsPtr);
+            }
+            /* 14. Enable CTE by setting CTE_EN bit in CTE_CNTRL1.                                                  */
+            /* this step will be done in a separate procedure       */
+        } /* if (cteClockDivider >= CTE_CLOCK_DIVIDER_LIMIT)    */
+    } /* if (rez == (Std_ReturnType)E_OK)   */
+    if (rez == (Std_ReturnType)E_OK)
+    {
+        /* copy the outputs setup           */
+        len = 0u;
+        while (cteInitParamsPtr->signalDef0Ptr[len].outputSignal < CTE_OUTPUT_MAX)
+        {
+            gsDriverData.signalDef0Ptr[len] = cteInitParamsPtr->signalDef0Ptr[len];
+            len++;
+        }
+        gsDriverData.signalDef0Ptr[len].outputSignal = CTE_OUTPUT_MAX;
+        if (cteInitParamsPtr->signalDef1Ptr != NULL_PTR)
+        {
+            len = 0u;
+            while (cteInitParamsPtr->signalDef1Ptr[len].outputSignal < CTE_OUTPUT_MAX)
+            {
+                gsDriverData.signalDef1Ptr[len] = cteInitParamsPtr->signalDef1Ptr[len];
+                len++;
+            }
+            gsDriverData.signalDef1Ptr[len].outputSignal = CTE_OUTPUT_MAX;
+        }
+        else
+        {
+            gsDriverData.signalDef1Ptr[0].outputSignal = CTE_OUTPUT_MAX;      /* signal an empty table        */
+        }
+        /* set the driver status to NOT_INITIALIZED         */
+        gsDriverData.cteDriverStatus = (uint8)CTE_DRIVER_STATE_INITIALIZED;
+    }
+    return rez;
+}
+/*=== Cte_Setup ===========================*/
+
+
+#if (CTE_START_STOP_USAGE == STD_ON)
+/*==================================================================================================*/
+/**
+ * @brief   Low level start procedure for CTE
+ * @details After this call the CTE will start to work, if successful.
+ *          The procedure could be unsuccessful only if the driver was not initialized before.
+ *          Start after a Stop will use the previous initialization.
+ *
+ * @return  E_OK/RSDK_SUCCESS = start succeeded
+ *          other values      = start failed, use the appropriate tools to detect the issue
+ *
+ */
+Std_ReturnType Cte_Start(void)
+{
+    Std_ReturnType rez;
+
+    switch ((uint8)gsDriverData.cteDriverStatus)
+    {
+    case (uint8)CTE_DRIVER_STATE_NOT_INIT:
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NOT_INITIALIZED, CTE_E_WRONG_STATE, CTE_SETUP_MODULE_INIT);
+        CTE_HALT_ON_ERROR;
+        break;
+    case (uint8)CTE_DRIVER_STATE_RUNNING:
+        if (CTE_GET_REGISTRY32(&gspCTEPtr->DBG_REG, CTE_DBG_REG_FSM_ST_MASK, CTE_DBG_REG_FSM_ST_SHIFT) == 0u)
+        {                   /* the table execution finished         */
+            /* set enable bit in according to the operational mode      */
+            CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL1, CTE_CNTRL1_CTE_EN_MASK, CTE_CNTRL1_CTE_EN(0u));
+            gsDriverData.cteDriverStatus = (uint8)CTE_DRIVER_STATE_RUNNING;    /* start CTE execution          */
+            CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL1, CTE_CNTRL1_CTE_EN_MASK, CTE_CNTRL1_CTE_EN(1u));
+            rez = (Std_ReturnType)E_OK;
+        }
+        else
+        {
+            /* CTE is really running, so it must be stopped first       */
+            rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_RUNNING, CTE_E_WRONG_STATE, CTE_SETUP_MODULE_INIT);
+            CTE_HALT_ON_ERROR;
+        }
+        break;
+    default:
+        gsDriverData.cteDriverStatus = (uint8)CTE_DRIVER_STATE_RUNNING;    /* start CTE execution          */
+        CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL1, CTE_CNTRL1_CTE_EN_MASK, CTE_CNTRL1_CTE_EN(1u));
+        rez = (Std_ReturnType)E_OK;
+        break;
+    }
+    return rez;
+}
+/*=== Cte_Start ===========================*/
+
+/*==================================================================================================*/
+/**
+ * @brief   Low level stop procedure for CTE
+ * @details After this call the CTE will stop to work, if successful.
+ *          The procedure could be unsuccessful only if the driver is not working at the call time.
+ *
+ * @return  E_OK/RSDK_SUCCESS = stop succeeded
+ *          other values       = stop failed, use the appropriate tools to detect the issue
+ *
+ */
+Std_ReturnType Cte_Stop(void)
+{
+    Std_ReturnType rez;
+
+    switch ((uint8)gsDriverData.cteDriverStatus)
+    {
+    case (uint8)CTE_DRIVER_STATE_NOT_INIT:
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NOT_INITIALIZED, CTE_E_WRONG_STATE, CTE_SETUP_MODULE_INIT);
+        CTE_HALT_ON_ERROR;
+        break;
+    case (uint8)CTE_DRIVER_STATE_INITIALIZED:
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NOT_RUNNING, CTE_E_WRONG_STATE, CTE_SETUP_MODULE_INIT);
+        CTE_HALT_ON_ERROR;
+        break;
+    default:
+        /* set enable bit in according to the operational mode      */
+        CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL1, CTE_CNTRL1_CTE_EN_MASK, CTE_CNTRL1_CTE_EN(0u));
+        gsDriverData.cteDriverStatus = (uint8)CTE_DRIVER_STATE_INITIALIZED;    /* stop CTE execution       */
+#if (CTE_SHADOW_UPDATE_USAGE == STD_ON)
+        /* the table end will not come anymore, so the staged parts are written now     */
+        (void)Cte_ShadowCommit((uint32)CTE_IRQ_TABLE_EXEC_END);
+#endif
+        rez = (Std_ReturnType)E_OK;
+        break;
+    }
+    return rez;
+}
+/*=== Cte_Stop ===========================*/
+
+/*==================================================================================================*/
+/**
+ * @brief   Low level restart CTE.
+ * @details This procedure is a single call for Cte_Stop and a Cte_Start.
+ *
+ * @param[out]  E_OK/RSDK_SUCCESS = restart succeeded
+ *              other values      = restart failed, use the appropriate tools to detect the issue
+ *
+ */
+Std_ReturnType Cte_Restart(void)
+{
+    Std_ReturnType rez;
+
+    switch ((uint8)gsDriverData.cteDriverStatus)
+    {
+    case (uint8)CTE_DRIVER_STATE_NOT_INIT:             /* not initialized, nothing to do       */
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NOT_INITIALIZED, CTE_E_WRONG_STATE, CTE_SETUP_MODULE_INIT);
+        CTE_HALT_ON_ERROR;
+        break;
+    default:
+        (void)Cte_Stop();                 /* stop first           */
+        rez = Cte_Start();                /* start if the CTE was initialized before      */
+        break;
+    }
+    return rez;
+}
+/*=== Cte_Restart ===========================*/
+
+#endif  /* #if defined (CTE_START_STOP_USAGE == STD_ON)   */
+
+/*==================================================================================================*/
+/**
+ * @brief   Generate a RFS software signal.
+ * @details The procedure can be used only in Slave mode, to reset the time table execution.
+ *          The real CTE execution must be triggered by a RCS signal.
+ *          The CTE must be started before, or an error will be reported
+ *
+ * @param[out]  E_OK/RSDK_SUCCESS = call succeeded
+ *              other values      = call failed, use the appropriate tools to detect the issue
+ *
+ */
+Std_ReturnType Cte_RfsGenerate(void)
+{
+    Std_ReturnType rez = (Std_ReturnType)E_OK;
+
+    if (gsDriverData.cteDriverStatus == (uint8)CTE_DRIVER_STATE_NOT_INIT)
+    {
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NOT_INITIALIZED, CTE_E_WRONG_STATE, CTE_SETUP_MODULE_INIT);
+        CTE_HALT_ON_ERROR;
+    }
+    else
+    {
+        if (gsDriverData.cteDriverStatus == (uint8)CTE_DRIVER_STATE_INITIALIZED)
+        {
+            rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NOT_RUNNING, CTE_E_WRONG_STATE, CTE_SETUP_MODULE_INIT);
+            CTE_HALT_ON_ERROR;
+        }
+    }
+    if (rez == (Std_ReturnType)E_OK)
+    {
+        if (CTE_GET_REGISTRY32(&gspCTEPtr->DBG_REG, CTE_DBG_REG_FSM_ST_MASK, CTE_DBG_REG_FSM_ST_SHIFT) == 0u)
+        {                           /* CTE in HALT      */
+            rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NOT_RUNNING, CTE_E_WRONG_STATE, CTE_SETUP_MODULE_INIT);
+            CTE_HALT_ON_ERROR;
+            gsDriverData.cteDriverStatus = (uint8)CTE_DRIVER_STATE_INITIALIZED;
+            CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL1, CTE_CNTRL1_CTE_EN_MASK, CTE_CNTRL1_CTE_EN (0u));
+        }
+        else
+        {
+                CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL, CTE_CNTRL_RFS_PGEN_MASK, CTE_CNTRL_RFS_PGEN(1u));
+                CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL, CTE_CNTRL_RFS_PGEN_MASK, CTE_CNTRL_RFS_PGEN(0u));
+        }
+    }
+    return rez;
+}
+/*=== Cte_RfsGenerate ===========================*/
+
+/*==================================================================================================*/
+/**
+ * @brief   Low level procedure to update only the timing tables.
+ * @details The procedure can be used only after a previous successful CTE initialization.
+ *          If the CTE is working, it will be stopped and restarted after table changed.
+ *          If stopped, it will remains in the same state. It is recommendable to do like this.
+ *
+ * @param[in]   table0Ptr,table1Ptr     = pointer to the new table(s); first pointer must not be NULL_PTR;
+                                          if second is NULL_PTR, only one table used, else two tables used
+ * @param[in]   lutChecksumPtr          = pointer to a uint64 value, which will receive the final LUT checksum;
+ *                                        this value can be checked later using Cte_GetLutChecksum
+ * @param[out]  E_OK/RSDK_SUCCESS       = initialization succeeded
+ *              other values            = initialization failed, use the appropriate tools to detect the issue
+ *
+ */
+Std_ReturnType Cte_UpdateTables(Cte_TimeTableDefType *table0Ptr, Cte_TimeTableDefType *table1Ptr,
+        uint64 *lutChecksumPtr)
+{
+    Std_ReturnType rez = (Std_ReturnType)E_OK;
+
+    if (gsDriverData.cteDriverStatus == (uint8)CTE_DRIVER_STATE_NOT_INIT)
+    {
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NOT_INITIALIZED, CTE_E_WRONG_STATE, CTE_SETUP_MODULE_INIT);
+        CTE_HALT_ON_ERROR;
+    }
+    else
+    {
+        if (gsDriverData.cteDriverStatus == (uint8)CTE_DRIVER_STATE_RUNNING)
+        {
+            rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_RUNNING, CTE_E_WRONG_STATE, CTE_SETUP_MODULE_INIT);
+            CTE_HALT_ON_ERROR;
+        }
+        else
+        {
+            if(lutChecksumPtr == NULL_PTR)
+            {
+                rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NULL_PTR_PARAMS, CTE_E_PARAM_POINTER, CTE_SETUP_PARAM_CHECK);
+                CTE_HALT_ON_ERROR;
+            }
+        }
+    }
+    if (rez == (Std_ReturnType)E_OK)
+    {               /* ok till here, check the pointer compatibility        */
+        rez = Cte_TablesLayoutCheck(table0Ptr, table1Ptr);
+    }
+    if (rez == (Std_ReturnType)E_OK)
+    {
+        /* reset the LUT checksum       */
+        CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL1, CTE_CNTRL1_CKSM_RST_MASK, CTE_CNTRL1_CKSM_RST(1u));
+        /* enable the checksum computation      */
+        CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL1, CTE_CNTRL1_CKSM_RST_MASK, CTE_CNTRL1_CKSM_RST(0u));
+        rez = Cte_TimingTableSet(table0Ptr, gsDriverData.signalDef0Ptr, (volatile void *)gspCTEPtr->LUT);
+        if ((rez == (Std_ReturnType)E_OK) && (table1Ptr != NULL_PTR))
+        {
+            rez = Cte_TimingTableSet(table1Ptr, gsDriverData.signalDef1Ptr, (volatile void *)&gspCTEPtr->LUT[1]);
+        }
+        *lutChecksumPtr = Cte_GetLutChecksum();
+    }
+    return rez;
+}
+/*=== Cte_UpdateTables ===========================*/
+
+
+/*==================================================================================================*/
+/**
+ * @brief   Get the checksum of the timing LUT.
+ * @details This procedure returns the current checksum reported by the hardware, only 40 bits.
+ *          The value can be compared to the previous values.
+ *
+ * @return  LUT checksum
+ *
+ */
+uint64 Cte_GetLutChecksum(void)
+{
+    uint64 checkSum = (uint64)gspCTEPtr->CKSM_MSB;
+
+    checkSum <<= 32u;
+    checkSum += (uint64_t)gspCTEPtr->CKSM_LSB;
+    return checkSum;
+}
+/*=== Cte_GetLutChecksum ===========================*/
+
+#if (CTE_PLAYLIST_USAGE == STD_ON)
+/*==================================================================================================*/
+/**
+ * @brief   Procedure to move the playlist to the next table set.
+ * @details Called from the irq handler, when the staged table set was written. The written set becomes the active
+ *          one and the next set in the list is staged.
+ *
+ * @return      TRUE if a new table set was staged, FALSE else
+ *
+ */
+static boolean Cte_PlaylistAdvance(void)
+{
+    uint8   setsNr = gsCtePlaylist.setsNr;
+    boolean rez = FALSE;
+
+    if (setsNr != 0u)
+    {
+        gsCtePlaylist.activeIdx = gsCtePlaylist.stagedIdx;
+        gsCtePlaylist.switchesNr++;
+        if (setsNr > 1u)
+        {
+            gsCtePlaylist.stagedIdx = (uint8)((gsCtePlaylist.stagedIdx + 1u) % setsNr);
+            Cte_ShadowArm(&gsCteLutImages[gsCtePlaylist.imageIdx[gsCtePlaylist.stagedIdx]]);
+            rez = TRUE;
+        }
+    }
+    return rez;
+}
+/*=== Cte_PlaylistAdvance ===========================*/
+
+/*==================================================================================================*/
+/**
+ * @brief   Procedure to check if a cached image is used by the playlist.
+ *
+ * @param[in]   idx     = the image index into the driver cache
+ * @return      TRUE if the image is in the playlist or still staged, FALSE else
+ *
+ */
+static boolean Cte_PlaylistImageUsed(uint32 idx)
+{
+    uint32  i;
+    boolean rez = FALSE;
+
+    if ((gsCteShadow.state == (uint8)CTE_SHADOW_PENDING) && (gsCteShadow.imagePtr == &gsCteLutImages[idx]))
+    {
+        rez = TRUE;
+    }
+    for (i = 0u; i < gsCtePlaylist.setsNr; i++)
+    {
+        if (gsCtePlaylist.imageIdx[i] == idx)
+        {
+            rez = TRUE;
+        }
+    }
+    return rez;
+}
+/*=== Cte_PlaylistImageUsed ===========================*/
+#endif /* #if (CTE_PLAYLIST_USAGE == STD_ON) */
+
+#if (CTE_LUT_IMAGE_USAGE == STD_ON)
+/*==================================================================================================*/
+/**
+ * @brief   Compile the timing table(s) into a LUT image.
+ * @details The image contains the LUT content and the tables time limits, computed for the current CTE setup.
+ *          No CTE registry is changed, so the procedure can be used while the CTE is running.
+ *          The image is not registered; it can be saved and registered later using Cte_LutImageRegister.
+ *
+ * @param[in]   table0Ptr,table1Ptr     = pointer to the table(s); first pointer must not be NULL_PTR;
+                                          if second is NULL_PTR, only one table used, else two tables used
+ * @param[out]  imagePtr                = pointer to the resulting image
+ * @return      E_OK/RSDK_SUCCESS       = compile succeeded
+ *              other values            = compile failed, use the appropriate tools to detect the issue
+ *
+ */
+Std_ReturnType Cte_LutImageCompile(Cte_TimeTableDefType *table0Ptr, Cte_TimeTableDefType *table1Ptr,
+        Cte_LutImageType *imagePtr)
+{
+    Std_ReturnType  rez = (Std_ReturnType)E_OK;
+
+    if (gsDriverData.cteDriverStatus == (uint8)CTE_DRIVER_STATE_NOT_INIT)
+    {
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NOT_INITIALIZED, CTE_E_WRONG_STATE, CTE_LUT_IMAGE_CALL);
+        CTE_HALT_ON_ERROR;
+    }
+    else if (imagePtr == NULL_PTR)
+    {
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NULL_PTR_PARAMS, CTE_E_PARAM_POINTER, CTE_LUT_IMAGE_CALL);
+        CTE_HALT_ON_ERROR;
+    }
+    else
+    {
+        rez = Cte_LutImageBuild(table0Ptr, table1Ptr, imagePtr);
+    }
+    if (rez == (Std_ReturnType)E_OK)
+    {
+        imagePtr->setupHash = Cte_SetupHashGet();
+        imagePtr->contentHash = Cte_LutImageHashGet(imagePtr);
+        imagePtr->lutChecksum = 0u;             /* known only after the first load      */
+    }
+    return rez;
+}
+/*=== Cte_LutImageCompile ===========================*/
+
+/*==================================================================================================*/
+/**
+ * @brief   Register a LUT image into the driver cache.
+ * @details The image is checked (version, layout, content hash) and copied into the driver cache.
+ *          If the same image is already registered, only its expected checksum is completed, if necessary.
+ *          The image can be registered at any moment, even before the driver initialization.
+ *
+ * @param[in]   imagePtr                = pointer to the image
+ * @param[out]  contentHashPtr          = pointer to the image identifier, to be used for Cte_LutImageLoad
+ * @return      E_OK/RSDK_SUCCESS       = registration succeeded
+ *              other values            = registration failed, use the appropriate tools to detect the issue
+ *
+ */
+Std_ReturnType Cte_LutImageRegister(const Cte_LutImageType *imagePtr, uint64 *contentHashPtr)
+{
+    uint32          idx;
+    Std_ReturnType  rez = (Std_ReturnType)E_OK;
+
+    if ((imagePtr == NULL_PTR) || (contentHashPtr == NULL_PTR))
+    {
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NULL_PTR_PARAMS, CTE_E_PARAM_POINTER, CTE_LUT_IMAGE_CALL);
+        CTE_HALT_ON_ERROR;
+    }
+    else if ((imagePtr->imageVersion != CTE_LUT_IMAGE_VERSION) || (imagePtr->lutPartsNr == 0u) ||
+            (imagePtr->lutPartsNr > CTE_LUT_COUNT) || (Cte_LutImageHashGet(imagePtr) != imagePtr->contentHash))
+    {
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_LUT_IMAGE_WRG, CTE_E_PARAM_VALUE, CTE_LUT_IMAGE_CALL);
+        CTE_HALT_ON_ERROR;
+    }
+    else
+    {
+        idx = Cte_LutImageFind(imagePtr->contentHash);
+        if (idx < CTE_LUT_IMAGE_CACHE_SIZE)
+        {               /* already registered, keep the recorded checksum if any    */
+            if (gsCteLutImages[idx].lutChecksum == 0u)
+            {
+                gsCteLutImages[idx].lutChecksum = imagePtr->lutChecksum;
             }
-            *lutChecksumPtr = Cte_GetLutChecksum();
-            /* 5. Configure signal types in signal type registers CTE_SIGTYPE0/1.                                   */
-            if (rez == (Std_ReturnType)E_OK)
+        }
+        else
+        {
+            for (idx = 0u; idx < CTE_LUT_IMAGE_CACHE_SIZE; idx++)
             {
-                Cte_OutputSetup(cteInitParamsPtr->signalDef0Ptr, 0);
-                if (cteInitParamsPtr->signalDef1Ptr != NULL_PTR)
+                if (gsCteLutImageUsed[idx] == FALSE)
                 {
-                    Cte_OutputSetup(cteInitParamsPtr->signalDef1Ptr, 1);
-                }
-                if(cteInitParamsPtr->timeTable0Ptr->tableLength > CTE_MAX_SMALL_TIME_TABLE_LEN)
-                {
-                    Cte_OutputSetup(cteInitParamsPtr->signalDef0Ptr, 1);
+                    gsCteLutImages[idx] = *imagePtr;
+                    gsCteLutImageUsed[idx] = TRUE;
+                    break;
                 }
             }
-            if (rez == (Std_ReturnType)E_OK)
+            if (idx == CTE_LUT_IMAGE_CACHE_SIZE)
             {
-                /* 6. Configure MA_SL_ST bit in control register CTE_CNTRL.                                         */
-                if (cteInitParamsPtr->cteMode.workingMode == CTE_MASTER)
-                {               /* Master mode used     */
-                    /* normally the bit must be already 0 after reset       */
-                    CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL, CTE_CNTRL_MA_SL_ST_MASK, CTE_CNTRL_MA_SL_ST(0u));
-                }
-                else
-                {
-                    /* set bit for Slave mode       */
-                    CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL, CTE_CNTRL_MA_SL_ST_MASK, CTE_CNTRL_MA_SL_ST(0u));
-                    /* set the appropriate registry values for the Slave mode       */
-#ifdef linux
-                    mask = (uint32)cteInitParamsPtr->cteMode.workingMode - (uint32_t)RSDK_CTE_SLAVE_EXTERNAL;
-                    mask += (uint32)cteInitParamsPtr->cteMode.cteWorkingParam1.cteCsi2Vc << 1u;
-                    mask += (uint32)cteInitParamsPtr->cteMode.cteWorkingParam0.cteCsi2Unit << 3u;
-                    ((volatile SRC_1_Type*)gpRsdkCteDevice->pSrc_1)->CTE_CTRL_REG = mask;
-#else
-                    pSrc_1 = IP_SRC_1;
-                    CTE_SET_REGISTRY32(&pSrc_1->CTE_CTRL_REG, SRC_1_CTE_CTRL_REG_IN_CTE_MASK,
-                            SRC_1_CTE_CTRL_REG_IN_CTE(
-                                    (uint32)cteInitParamsPtr->cteMode.workingMode - (uint32)RSDK_CTE_SLAVE_EXTERNAL));
-                    CTE_SET_REGISTRY32(&pSrc_1->CTE_CTRL_REG, SRC_1_CTE_CTRL_REG_MIPICSI2_ID_MASK,
-                          SRC_1_CTE_CTRL_REG_MIPICSI2_ID((uint32)cteInitParamsPtr->cteMode.cteWorkingParam0.cteCsi2Unit));
-                    CTE_SET_REGISTRY32(&pSrc_1->CTE_CTRL_REG, SRC_1_CTE_CTRL_REG_VC_ID_MASK,
-                            SRC_1_CTE_CTRL_REG_VC_ID((uint32_t)cteInitParamsPtr->cteMode.cteWorkingParam1.cteCsi2Vc));
-#endif /* #ifdef linux  */
+                rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_LUT_CACHE_FULL, CTE_E_PARAM_VALUE, CTE_LUT_IMAGE_CALL);
+                CTE_HALT_ON_ERROR;
+            }
+        }
+        *contentHashPtr = imagePtr->contentHash;
+    }
+    return rez;
+}
+/*=== Cte_LutImageRegister ===========================*/
 
-                    CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL, CTE_CNTRL_RFS_DLY_MASK,
-                            CTE_CNTRL_RFS_DLY((uint32)cteInitParamsPtr->cteMode.cteWorkingParam0.cteInternalRfsDelay));
-                    CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL, CTE_CNTRL_RCS_DLY_MASK,
-                            CTE_CNTRL_RCS_DLY((uint32)cteInitParamsPtr->cteMode.cteWorkingParam1.cteInternalRcsDelay));
-                } /* if (cteInitParamsPtr->cteMode.workingMode == CTE_MASTER) */
-                /* 7. Configure REP_CNT value in control register CTE_CNTRL.                                        */
-                CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL, CTE_CNTRL_REP_CNT_MASK,
-                        CTE_CNTRL_REP_CNT((uint32)cteInitParamsPtr->repeatCount));
-                /* 8. Configure OPMOD_SL bits in register CTE_CNTRL to define continuous run mode or toggle mode.   */
-                Cte_RunModeSet(cteInitParamsPtr);
-                /* 9. Configure the duration counter for TT0 and TT1 execution in registers CTE_LUT_DUR and
-                 * CTE_LUT_DUR1 respectively.       */
-                Cte_TableTimeLimitSet(cteInitParamsPtr);
-                /* 10. Configure timemode bit in CTE_CNTRL1 for absolute/relative mode of timing table execution.   */
-                /* only relative timing used        */
-                CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL1, CTE_CNTRL1_TIMEMODE_MASK, CTE_CNTRL1_TIMEMODE(0u));
-                /* 11. Configure CTECK_DV in CTE_CNTRL1 to define the CTE data path clock.                          */
-                CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL1, CTE_CNTRL1_CTECK_DV_MASK,
-                        CTE_CNTRL1_CTECK_DV(gsDriverData.cteMainClockDivider));
-                /* 12. Configure CLKDIV_1-CLKDIV_4 in CTE_CNTRL1 to define clocks for external signals.             */
-                rez = Cte_ClockDividersSet(cteInitParamsPtr);
-            } /* if (rez == (Std_ReturnType)E_OK)   */
-            /* 13. Configure CLK_SEL0-CLK_SEL9 in clock select register CTE_CLKSEL to select the clock divider
-             * for the external signals.            */
-            if (rez == (Std_ReturnType)E_OK)
+/*==================================================================================================*/
+/**
+ * @brief   Load a registered LUT image.
+ * @details The image content is copied into the LUT, and the run mode and the tables time limits are set.
+ *          The procedure can be used only if the CTE is initialized and not running, with the same setup used
+ *          for the image compilation.
+ *          The LUT checksum is recorded at the first load of the image and checked at the next loads.
+ *
+ * @param[in]   contentHash             = the image identifier, as reported by Cte_LutImageRegister
+ * @param[out]  lutChecksumPtr          = pointer to a uint64 value, which will receive the final LUT checksum
+ * @return      E_OK/RSDK_SUCCESS       = load succeeded
+ *              other values            = load failed, use the appropriate tools to detect the issue
+ *
+ */
+Std_ReturnType Cte_LutImageLoad(uint64 contentHash, uint64 *lutChecksumPtr)
+{
+    uint32                  i, idx = CTE_LUT_IMAGE_CACHE_SIZE;
+    Cte_LutImageType        *imagePtr;
+    Std_ReturnType          rez = (Std_ReturnType)E_OK;
+
+    if (gsDriverData.cteDriverStatus == (uint8)CTE_DRIVER_STATE_NOT_INIT)
+    {
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NOT_INITIALIZED, CTE_E_WRONG_STATE, CTE_LUT_IMAGE_CALL);
+        CTE_HALT_ON_ERROR;
+    }
+    else if (gsDriverData.cteDriverStatus == (uint8)CTE_DRIVER_STATE_RUNNING)
+    {
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_RUNNING, CTE_E_WRONG_STATE, CTE_LUT_IMAGE_CALL);
+        CTE_HALT_ON_ERROR;
+    }
+    else if (lutChecksumPtr == NULL_PTR)
+    {
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NULL_PTR_PARAMS, CTE_E_PARAM_POINTER, CTE_LUT_IMAGE_CALL);
+        CTE_HALT_ON_ERROR;
+    }
+    else
+    {
+        idx = Cte_LutImageFind(contentHash);
+        if (idx == CTE_LUT_IMAGE_CACHE_SIZE)
+        {
+            rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_LUT_IMAGE_NOT_FOUND, CTE_E_PARAM_VALUE, CTE_LUT_IMAGE_CALL);
+            CTE_HALT_ON_ERROR;
+        }
+        else if (gsCteLutImages[idx].setupHash != Cte_SetupHashGet())
+        {
+            rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_LUT_IMAGE_STALE, CTE_E_PARAM_VALUE, CTE_LUT_IMAGE_CALL);
+            CTE_HALT_ON_ERROR;
+        }
+        else
+        {
+            ;   /* the image can be used        */
+        }
+    }
+    if (rez == (Std_ReturnType)E_OK)
+    {
+        imagePtr = &gsCteLutImages[idx];
+#if (CTE_PLAYLIST_USAGE == STD_ON)
+        if (gsCtePlaylist.setsNr != 0u)
+        {           /* the loaded image replaces the playlist       */
+            gsCtePlaylist.setsNr = 0u;
+            Cte_ShadowDrop();
+        }
+#endif
+        /* reset the LUT checksum and enable the checksum computation       */
+        CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL1, CTE_CNTRL1_CKSM_RST_MASK, CTE_CNTRL1_CKSM_RST(1u));
+        CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL1, CTE_CNTRL1_CKSM_RST_MASK, CTE_CNTRL1_CKSM_RST(0u));
+        for (i = 0u; i < imagePtr->lutPartsNr; i++)
+        {
+            Cte_LutPartWrite(imagePtr, i);
+        }
+        /* a single long table uses the table 0 outputs for the second LUT part too     */
+        if ((imagePtr->lutPartsNr > 1u) && ((uint8)gsDriverData.signalDef1Ptr[0].outputSignal >= (uint8)CTE_OUTPUT_MAX))
+        {
+            Cte_OutputSetup(gsDriverData.signalDef0Ptr, 1);
+        }
+        Cte_RunModeSet(imagePtr->lutPartsNr);
+        gsDriverData.cteLutPartsNr = imagePtr->lutPartsNr;
+        *lutChecksumPtr = Cte_GetLutChecksum();
+        if (imagePtr->lutChecksum == 0u)
+        {
+            imagePtr->lutChecksum = *lutChecksumPtr;        /* first load, record the checksum      */
+        }
+        else if (imagePtr->lutChecksum != *lutChecksumPtr)
+        {
+            rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_LUT_CHECKSUM_ERROR, CTE_E_HW_ERROR, CTE_LUT_IMAGE_CALL);
+            CTE_HALT_ON_ERROR;
+        }
+        else
+        {
+            ;   /* the expected checksum        */
+        }
+    }
+    return rez;
+}
+/*=== Cte_LutImageLoad ===========================*/
+
+/*==================================================================================================*/
+/**
+ * @brief   Remove a LUT image from the driver cache.
+ *
+ * @param[in]   contentHash             = the image identifier, as reported by Cte_LutImageRegister
+ * @return      E_OK/RSDK_SUCCESS       = the image was removed
+ *              other values            = the image was not found
+ *
+ */
+Std_ReturnType Cte_LutImageRemove(uint64 contentHash)
+{
+    uint32          idx;
+    Std_ReturnType  rez = (Std_ReturnType)E_OK;
+
+    idx = Cte_LutImageFind(contentHash);
+    if (idx == CTE_LUT_IMAGE_CACHE_SIZE)
+    {
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_LUT_IMAGE_NOT_FOUND, CTE_E_PARAM_VALUE, CTE_LUT_IMAGE_CALL);
+        CTE_HALT_ON_ERROR;
+    }
+#if (CTE_PLAYLIST_USAGE == STD_ON)
+    else if (Cte_PlaylistImageUsed(idx) == TRUE)
+    {
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_LUT_IMAGE_IN_USE, CTE_E_WRONG_STATE, CTE_LUT_IMAGE_CALL);
+        CTE_HALT_ON_ERROR;
+    }
+#endif
+    else
+    {
+        gsCteLutImageUsed[idx] = FALSE;
+    }
+    return rez;
+}
+/*=== Cte_LutImageRemove ===========================*/
+#endif /* #if (CTE_LUT_IMAGE_USAGE == STD_ON) */
+
+#if (CTE_SHADOW_UPDATE_USAGE == STD_ON)
+/*==================================================================================================*/
+/**
+ * @brief   Stage a timing tables update, to be committed at the table end.
+ * @details The new LUT content is computed into a driver copy, without any change of the CTE registry.
+ *          If the CTE is running, each LUT part is written by the CTE interrupt handler at the end of its table
+ *          execution (TTx_END, or table execution end), so the running table is not changed; the
+ *          CTE_IRQ_TABLES_UPDATED event is reported when all the parts were written. A table started again
+ *          while its part is written is detected and reported by CTE_IRQ_TABLES_TORN (see Cte_ShadowCommit).
+ *          If the CTE is not running, the update is done immediately.
+ *          The new tables must use the same run mode (number of LUT parts) as the current ones.
+ *
+ * @param[in]   table0Ptr,table1Ptr     = pointer to the new table(s); first pointer must not be NULL_PTR;
+                                          if second is NULL_PTR, only one table used, else two tables used
+ * @return      E_OK/RSDK_SUCCESS       = the update was staged (or done, if the CTE is not running)
+ *              other values            = the update failed, use the appropriate tools to detect the issue
+ *
+ */
+Std_ReturnType Cte_UpdateTablesShadow(Cte_TimeTableDefType *table0Ptr, Cte_TimeTableDefType *table1Ptr)
+{
+    Std_ReturnType  rez = (Std_ReturnType)E_OK;
+
+    if (gsDriverData.cteDriverStatus == (uint8)CTE_DRIVER_STATE_NOT_INIT)
+    {
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NOT_INITIALIZED, CTE_E_WRONG_STATE, CTE_SHADOW_UPDATE_CALL);
+        CTE_HALT_ON_ERROR;
+    }
+    else if ((gsCteShadow.state == (uint8)CTE_SHADOW_PENDING)
+#if (CTE_PLAYLIST_USAGE == STD_ON)
+            || (gsCtePlaylist.setsNr != 0u)     /* the playlist stages its own updates     */
+#endif
+            )
+    {
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_UPDATE_PENDING, CTE_E_WRONG_STATE, CTE_SHADOW_UPDATE_CALL);
+        CTE_HALT_ON_ERROR;
+    }
+    else
+    {
+        rez = Cte_LutImageBuild(table0Ptr, table1Ptr, &gsCteShadow.image);
+    }
+    if ((rez == (Std_ReturnType)E_OK) && (gsCteShadow.image.lutPartsNr != gsDriverData.cteLutPartsNr))
+    {               /* the run mode can't be changed at the table end       */
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_UPDATE_WRG_LAYOUT, CTE_E_PARAM_VALUE, CTE_SHADOW_UPDATE_CALL);
+        CTE_HALT_ON_ERROR;
+    }
+    if (rez == (Std_ReturnType)E_OK)
+    {
+        Cte_ShadowArm(&gsCteShadow.image);
+        if (gsDriverData.cteDriverStatus != (uint8)CTE_DRIVER_STATE_RUNNING)
+        {           /* no table end will come, the update is done now      */
+            (void)Cte_ShadowCommit((uint32)CTE_IRQ_TABLE_EXEC_END);
+        }
+    }
+    return rez;
+}
+/*=== Cte_UpdateTablesShadow ===========================*/
+
+/*==================================================================================================*/
+/**
+ * @brief   Get the status of the last staged tables update.
+ *
+ * @param[out]  lutChecksumPtr          = pointer to a uint64 value, which will receive the LUT checksum after
+ *                                        the update; can be NULL_PTR
+ * @return      E_OK/RSDK_SUCCESS       = the update was committed (or no update staged)
+ *              RSDK_CTE_DRV_UPDATE_PENDING = the update is waiting for the table end
+ *
+ */
+Std_ReturnType Cte_UpdateTablesShadowStatus(uint64 *lutChecksumPtr)
+{
+    Std_ReturnType  rez = (Std_ReturnType)E_OK;
+
+    if (gsCteShadow.state == (uint8)CTE_SHADOW_PENDING)
+    {
+        rez = (Std_ReturnType)RSDK_CTE_DRV_UPDATE_PENDING;      /* not an error, only a status     */
+    }
+    else if (lutChecksumPtr != NULL_PTR)
+    {
+        *lutChecksumPtr = (gsCteShadow.state == (uint8)CTE_SHADOW_DONE) ? gsCteShadow.lutChecksum :
+                Cte_GetLutChecksum();
+    }
+    else
+    {
+        ;                                       /* nothing to report            */
+    }
+    return rez;
+}
+/*=== Cte_UpdateTablesShadowStatus ===========================*/
+
+/*==================================================================================================*/
+/**
+ * @brief   Commit step of the staged tables update.
+ * @details Called by the CTE interrupt handler with the irq status read (and cleared) at the handler entry. A LUT
+ *          part is written only at the end of its table execution, if the same table was not started again
+ *          (TTx_START in the same status); at the table execution end, all the remaining parts are written.
+ *          The status is only a snapshot: a table can be started again after it, while its LUT part is written.
+ *          So INTSTAT is read again after the writes; a table start signaled meanwhile means that execution could
+ *          use a mix of the old and new events, which is reported by CTE_IRQ_TABLES_TORN (the LUT content is the
+ *          new one, the next executions are not affected; the start itself is reported by the next interrupt).
+ *          The window left is a start during the last CTE clocks of the writes, not yet visible in INTSTAT.
+ *          When a playlist is used, the next table set is staged as soon as the current one was written.
+ *
+ * @param[in]   cteEvents   = the irq status
+ * @return      CTE_IRQ_TABLES_UPDATED if the update was completed now, CTE_IRQ_TABLES_TORN if a table was started
+ *              during the writes, 0 else
+ *
+ */
+uint32 Cte_ShadowCommit(uint32 cteEvents)
+{
+    uint32  writeParts = 0u;
+    uint32  i;
+    uint32  rez = 0u;
+    boolean rearmed = FALSE;
+
+    if (gsCteShadow.state == (uint8)CTE_SHADOW_PENDING)
+    {
+        if ((cteEvents & (uint32)CTE_IRQ_TABLE_EXEC_END) != 0u)
+        {
+            writeParts = gsCteShadow.pendingParts;
+        }
+        else
+        {
+            if ((cteEvents & ((uint32)CTE_IRQ_TT0_END | (uint32)CTE_IRQ_TT0_START)) == (uint32)CTE_IRQ_TT0_END)
+            {
+                writeParts |= 1u;
+            }
+            if ((cteEvents & ((uint32)CTE_IRQ_TT1_END | (uint32)CTE_IRQ_TT1_START)) == (uint32)CTE_IRQ_TT1_END)
+            {
+                writeParts |= 2u;
+            }
+            writeParts &= gsCteShadow.pendingParts;
+        }
+        if ((writeParts != 0u) && (gsCteShadow.pendingParts == (uint8)((1u << gsCteShadow.imagePtr->lutPartsNr) - 1u)))
+        {           /* first part written, reset the LUT checksum       */
+            CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL1, CTE_CNTRL1_CKSM_RST_MASK, CTE_CNTRL1_CKSM_RST(1u));
+            CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL1, CTE_CNTRL1_CKSM_RST_MASK, CTE_CNTRL1_CKSM_RST(0u));
+        }
+        for (i = 0u; i < gsCteShadow.imagePtr->lutPartsNr; i++)
+        {
+            if ((writeParts & (1u << i)) != 0u)
+            {
+                Cte_LutPartWrite(gsCteShadow.imagePtr, i);
+            }
+        }
+        if ((writeParts != 0u) &&
+                ((gspCTEPtr->INTSTAT & ((uint32)CTE_IRQ_TT0_START | (uint32)CTE_IRQ_TT1_START)) != 0u))
+        {           /* a table was started after the irq status snapshot, while its LUT was written    */
+            rez = (uint32)CTE_IRQ_TABLES_TORN;
+        }
+        gsCteShadow.pendingParts &= (uint8)(~writeParts);
+        if (gsCteShadow.pendingParts == 0u)
+        {
+            gsCteShadow.lutChecksum = Cte_GetLutChecksum();
+            rez |= (uint32)CTE_IRQ_TABLES_UPDATED;
+#if (CTE_PLAYLIST_USAGE == STD_ON)
+            rearmed = Cte_PlaylistAdvance();
+#endif
+            if (rearmed == FALSE)
+            {
+                gspCTEPtr->INTEN &= ~gsCteShadow.addedIrqs;
+                gsCteShadow.addedIrqs = 0u;
+                CTE_WRITE_BARRIER();            /* the checksum is visible before the state        */
+                gsCteShadow.state = (uint8)CTE_SHADOW_DONE;
+            }
+        }
+    }
+    return rez;
+}
+/*=== Cte_ShadowCommit ===========================*/
+#endif /* #if (CTE_SHADOW_UPDATE_USAGE == STD_ON) */
+
+#if (CTE_PLAYLIST_USAGE == STD_ON)
+/*==================================================================================================*/
+/**
+ * @brief   Set a playlist of registered LUT images.
+ * @details Each image is a validated table set. The first set is loaded now; after the CTE start, the interrupt
+ *          handler switches to the next set at each table end (per LUT part, as for Cte_UpdateTablesShadow),
+ *          cyclically, without any application action. The events reported to the callback contain the index of
+ *          the active set (CTE_IRQ_SET_INDEX_MASK); CTE_IRQ_TABLES_UPDATED is reported at each switch.
+ *          All the images must be compiled for the current setup and must use the same run mode.
+ *          The CTE must not be running. A Cte_Stop writes the staged set, so a restart continues with it.
+ *
+ * @param[in]   contentHashPtr          = pointer to the images identifiers, in the execution order
+ * @param[in]   setsNr                  = the number of table sets, 1 to CTE_PLAYLIST_MAX_LEN
+ * @return      E_OK/RSDK_SUCCESS       = the playlist was set
+ *              other values            = the playlist was not accepted, use the appropriate tools to detect the issue
+ *
+ */
+Std_ReturnType Cte_PlaylistSet(const uint64 *contentHashPtr, uint8 setsNr)
+{
+    uint32          i, idx;
+    uint8           imageIdx[CTE_PLAYLIST_MAX_LEN];
+    uint64          lutChecksum;
+    uint64          setupHash;
+    Std_ReturnType  rez = (Std_ReturnType)E_OK;
+
+    if (gsDriverData.cteDriverStatus == (uint8)CTE_DRIVER_STATE_NOT_INIT)
+    {
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NOT_INITIALIZED, CTE_E_WRONG_STATE, CTE_PLAYLIST_CALL);
+        CTE_HALT_ON_ERROR;
+    }
+    else if (gsDriverData.cteDriverStatus == (uint8)CTE_DRIVER_STATE_RUNNING)
+    {
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_RUNNING, CTE_E_WRONG_STATE, CTE_PLAYLIST_CALL);
+        CTE_HALT_ON_ERROR;
+    }
+    else if (contentHashPtr == NULL_PTR)
+    {
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NULL_PTR_PARAMS, CTE_E_PARAM_POINTER, CTE_PLAYLIST_CALL);
+        CTE_HALT_ON_ERROR;
+    }
+    else if ((setsNr == 0u) || (setsNr > CTE_PLAYLIST_MAX_LEN))
+    {
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_PLAYLIST_WRG, CTE_E_PARAM_VALUE, CTE_PLAYLIST_CALL);
+        CTE_HALT_ON_ERROR;
+    }
+    else
+    {
+        /* all the sets are checked before any change       */
+        setupHash = Cte_SetupHashGet();
+        for (i = 0u; (i < setsNr) && (rez == (Std_ReturnType)E_OK); i++)
+        {
+            idx = Cte_LutImageFind(contentHashPtr[i]);
+            if (idx == CTE_LUT_IMAGE_CACHE_SIZE)
+            {
+                rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_LUT_IMAGE_NOT_FOUND, CTE_E_PARAM_VALUE, CTE_PLAYLIST_CALL);
+                CTE_HALT_ON_ERROR;
+            }
+            else if (gsCteLutImages[idx].setupHash != setupHash)
             {
-                Cte_OutputClockSelect(cteInitParamsPtr);
+                rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_LUT_IMAGE_STALE, CTE_E_PARAM_VALUE, CTE_PLAYLIST_CALL);
+                CTE_HALT_ON_ERROR;
             }
-            /* Other necessary setup : IRQ      */
-            if (rez == (Std_ReturnType)E_OK)
+            else if ((i != 0u) && (gsCteLutImages[idx].lutPartsNr != gsCteLutImages[imageIdx[0]].lutPartsNr))
+            {           /* the run mode can't be changed at the table end       */
+                rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_PLAYLIST_WRG, CTE_E_PARAM_VALUE, CTE_PLAYLIST_CALL);
+                CTE_HALT_ON_ERROR;
+            }
+            else
             {
-                rez = Cte_IrqInit(cteInitParamsPtr);
-                gsDriverData.cteReqEvents = (uint32)cteInitParamsPtr->cteIrqEvents;
-                gsDriverData.pCteCallback = cteInitParamsPtr->pCteCallback;
+                imageIdx[i] = (uint8)idx;
             }
-            /* 14. Enable CTE by setting CTE_EN bit in CTE_CNTRL1.                                                  */
-            /* this step will be done in a separate procedure       */
-        } /* if (cteClockDivider >= CTE_CLOCK_DIVIDER_LIMIT)    */
-    } /* if (rez == (Std_ReturnType)E_OK)   */
+        }
+    }
     if (rez == (Std_ReturnType)E_OK)
     {
-        /* copy the outputs setup           */
-        len = 0u;
-        while (cteInitParamsPtr->signalDef0Ptr[len].outputSignal < CTE_OUTPUT_MAX)
-        {
-            gsDriverData.signalDef0Ptr[len] = cteInitParamsPtr->signalDef0Ptr[len];
-            len++;
-        }
-        gsDriverData.signalDef0Ptr[len].outputSignal = CTE_OUTPUT_MAX;
-        if (cteInitParamsPtr->signalDef1Ptr != NULL_PTR)
+        rez = Cte_LutImageLoad(contentHashPtr[0], &lutChecksum);    /* the first set, any old playlist dropped */
+    }
+    if (rez == (Std_ReturnType)E_OK)
+    {
+        for (i = 0u; i < setsNr; i++)
         {
-            len = 0u;
-            while (cteInitParamsPtr->signalDef1Ptr[len].outputSignal < CTE_OUTPUT_MAX)
-            {
-                gsDriverData.signalDef1Ptr[len] = cteInitParamsPtr->signalDef1Ptr[len];
-                len++;
-            }
-            gsDriverData.signalDef1Ptr[len].outputSignal = CTE_OUTPUT_MAX;
+            gsCtePlaylist.imageIdx[i] = imageIdx[i];
         }
-        else
+        gsCtePlaylist.activeIdx = 0u;
+        gsCtePlaylist.stagedIdx = 0u;
+        gsCtePlaylist.switchesNr = 0u;
+        gsCtePlaylist.setsNr = setsNr;
+        if (setsNr > 1u)
         {
-            gsDriverData.signalDef1Ptr[0].outputSignal = CTE_OUTPUT_MAX;      /* signal an empty table        */
+            gsCtePlaylist.stagedIdx = 1u;
+            Cte_ShadowArm(&gsCteLutImages[imageIdx[1]]);
         }
-        /* set the driver status to NOT_INITIALIZED         */
-        gsDriverData.cteDriverStatus = (uint8)CTE_DRIVER_STATE_INITIALIZED;
     }
     return rez;
 }
-/*=== Cte_Setup ===========================*/
-
+/*=== Cte_PlaylistSet ===========================*/
 
-#if (CTE_START_STOP_USAGE == STD_ON)
 /*==================================================================================================*/
 /**
- * @brief   Low level start procedure for CTE
- * @details After this call the CTE will start to work, if successful.
- *          The procedure could be unsuccessful only if the driver was not initialized before.
- *          Start after a Stop will use the previous initialization.
+ * @brief   Stop the playlist usage.
+ * @details If the CTE is running, the already staged table set is still written at the next table end, and then
+ *          the LUT remains unchanged. If not running, the staged set is dropped.
  *
- * @return  E_OK/RSDK_SUCCESS = start succeeded
- *          other values      = start failed, use the appropriate tools to detect the issue
+ * @return      E_OK/RSDK_SUCCESS       = the playlist was cleared
+ *              other values            = no playlist used
  *
  */
-Std_ReturnType Cte_Start(void)
+Std_ReturnType Cte_PlaylistClear(void)
 {
-    Std_ReturnType rez;
+    Std_ReturnType  rez = (Std_ReturnType)E_OK;
 
-    switch ((uint8)gsDriverData.cteDriverStatus)
+    if (gsCtePlaylist.setsNr == 0u)
     {
-    case (uint8)CTE_DRIVER_STATE_NOT_INIT:
-        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NOT_INITIALIZED, CTE_E_WRONG_STATE, CTE_SETUP_MODULE_INIT);
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_PLAYLIST_WRG, CTE_E_WRONG_STATE, CTE_PLAYLIST_CALL);
         CTE_HALT_ON_ERROR;
-        break;
-    case (uint8)CTE_DRIVER_STATE_RUNNING:
-        if (CTE_GET_REGISTRY32(&gspCTEPtr->DBG_REG, CTE_DBG_REG_FSM_ST_MASK, CTE_DBG_REG_FSM_ST_SHIFT) == 0u)
-        {                   /* the table execution finished         */
-            /* set enable bit in according to the operational mode      */
-            CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL1, CTE_CNTRL1_CTE_EN_MASK, CTE_CNTRL1_CTE_EN(0u));
-            gsDriverData.cteDriverStatus = (uint8)CTE_DRIVER_STATE_RUNNING;    /* start CTE execution          */
-            CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL1, CTE_CNTRL1_CTE_EN_MASK, CTE_CNTRL1_CTE_EN(1u));
-            rez = (Std_ReturnType)E_OK;
-        }
-        else
+    }
+    else
+    {
+        gsCtePlaylist.setsNr = 0u;              /* no new set will be staged            */
+        if (gsDriverData.cteDriverStatus != (uint8)CTE_DRIVER_STATE_RUNNING)
         {
-            /* CTE is really running, so it must be stopped first       */
-            rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_RUNNING, CTE_E_WRONG_STATE, CTE_SETUP_MODULE_INIT);
-            CTE_HALT_ON_ERROR;
+            Cte_ShadowDrop();
         }
-        break;
-    default:
-        gsDriverData.cteDriverStatus = (uint8)CTE_DRIVER_STATE_RUNNING;    /* start CTE execution          */
-        CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL1, CTE_CNTRL1_CTE_EN_MASK, CTE_CNTRL1_CTE_EN(1u));
-        rez = (Std_ReturnType)E_OK;
-        break;
     }
     return rez;
 }
-/*=== Cte_Start ===========================*/
+/*=== Cte_PlaylistClear ===========================*/
 
 /*==================================================================================================*/
 /**
- * @brief   Low level stop procedure for CTE
- * @details After this call the CTE will stop to work, if successful.
- *          The procedure could be unsuccessful only if the driver is not working at the call time.
+ * @brief   Get the playlist status.
  *
- * @return  E_OK/RSDK_SUCCESS = stop succeeded
- *          other values       = stop failed, use the appropriate tools to detect the issue
+ * @param[out]  activeIdxPtr            = pointer to the index of the table set in execution
+ * @param[out]  switchesNrPtr           = pointer to the number of table sets switches since the playlist was set;
+ *                                        can be NULL_PTR
+ * @return      E_OK/RSDK_SUCCESS       = the status was reported
+ *              other values            = no playlist used or wrong parameters
  *
  */
-Std_ReturnType Cte_Stop(void)
+Std_ReturnType Cte_PlaylistStatusGet(uint8 *activeIdxPtr, uint32 *switchesNrPtr)
 {
-    Std_ReturnType rez;
+    Std_ReturnType  rez = (Std_ReturnType)E_OK;
 
-    switch ((uint8)gsDriverData.cteDriverStatus)
+    if (activeIdxPtr == NULL_PTR)
     {
-    case (uint8)CTE_DRIVER_STATE_NOT_INIT:
-        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NOT_INITIALIZED, CTE_E_WRONG_STATE, CTE_SETUP_MODULE_INIT);
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NULL_PTR_PARAMS, CTE_E_PARAM_POINTER, CTE_PLAYLIST_CALL);
         CTE_HALT_ON_ERROR;
-        break;
-    case (uint8)CTE_DRIVER_STATE_INITIALIZED:
-        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NOT_RUNNING, CTE_E_WRONG_STATE, CTE_SETUP_MODULE_INIT);
+    }
+    else if (gsCtePlaylist.setsNr == 0u)
+    {
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_PLAYLIST_WRG, CTE_E_WRONG_STATE, CTE_PLAYLIST_CALL);
         CTE_HALT_ON_ERROR;
-        break;
-    default:
-        /* set enable bit in according to the operational mode      */
-        CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL1, CTE_CNTRL1_CTE_EN_MASK, CTE_CNTRL1_CTE_EN(0u));
-        gsDriverData.cteDriverStatus = (uint8)CTE_DRIVER_STATE_INITIALIZED;    /* stop CTE execution       */
-        rez = (Std_ReturnType)E_OK;
-        break;
+    }
+    else
+    {
+        *activeIdxPtr = gsCtePlaylist.activeIdx;
+        if (switchesNrPtr != NULL_PTR)
+        {
+            *switchesNrPtr = gsCtePlaylist.switchesNr;
+        }
     }
     return rez;
 }
-/*=== Cte_Stop ===========================*/
+/*=== Cte_PlaylistStatusGet ===========================*/
 
 /*==================================================================================================*/
 /**
- * @brief   Low level restart CTE.
- * @details This procedure is a single call for Cte_Stop and a Cte_Start.
+ * @brief   Add the active table set index to the events reported by the irq handler.
  *
- * @param[out]  E_OK/RSDK_SUCCESS = restart succeeded
- *              other values      = restart failed, use the appropriate tools to detect the issue
+ * @param[in]   cteEvents   = the events to be reported
+ * @return      the events, with the active set index in the upper byte if a playlist is used
  *
  */
-Std_ReturnType Cte_Restart(void)
+uint32 Cte_PlaylistEventsGet(uint32 cteEvents)
 {
-    Std_ReturnType rez;
+    uint32 rez = cteEvents;
 
-    switch ((uint8)gsDriverData.cteDriverStatus)
+    if ((cteEvents != 0u) && (gsCtePlaylist.setsNr != 0u))
     {
-    case (uint8)CTE_DRIVER_STATE_NOT_INIT:             /* not initialized, nothing to do       */
-        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NOT_INITIALIZED, CTE_E_WRONG_STATE, CTE_SETUP_MODULE_INIT);
-        CTE_HALT_ON_ERROR;
-        break;
-    default:
-        (void)Cte_Stop();                 /* stop first           */
-        rez = Cte_Start();                /* start if the CTE was initialized before      */
-        break;
+        rez |= ((uint32)gsCtePlaylist.activeIdx << CTE_IRQ_SET_INDEX_SHIFT) & CTE_IRQ_SET_INDEX_MASK;
     }
     return rez;
 }
-/*=== Cte_Restart ===========================*/
+/*=== Cte_PlaylistEventsGet ===========================*/
+#endif /* #if (CTE_PLAYLIST_USAGE == STD_ON) */
 
-#endif  /* #if defined (CTE_START_STOP_USAGE == STD_ON)   */
 
+#if (CTE_TIMING_STATS_USAGE == STD_ON)
 /*==================================================================================================*/
 /**
- * @brief   Generate a RFS software signal.
- * @details The procedure can be used only in Slave mode, to reset the time table execution.
- *          The real CTE execution must be triggered by a RCS signal.
- *          The CTE must be started before, or an error will be reported
+ * @brief   Get the events timing statistics.
+ * @details The statistics are updated lock-free by the interrupt handler, the only writer, so they can be read at
+ *          any time; a value can be seen in the middle of its update. They are reset by Cte_Setup.
  *
- * @param[out]  E_OK/RSDK_SUCCESS = call succeeded
- *              other values      = call failed, use the appropriate tools to detect the issue
+ * @return  pointer to the statistics
  *
  */
-Std_ReturnType Cte_RfsGenerate(void)
+const Cte_TimingStatsType *Cte_GetTimingStats(void)
 {
-    Std_ReturnType rez = (Std_ReturnType)E_OK;
+    return &gCteTimingStats;
+}
+/*=== Cte_GetTimingStats ===========================*/
+#endif /* #if (CTE_TIMING_STATS_USAGE == STD_ON) */
 
-    if (gsDriverData.cteDriverStatus == (uint8)CTE_DRIVER_STATE_NOT_INIT)
+
+#if (CTE_TABLES_BLOB_USAGE == STD_ON)
+/*==================================================================================================*/
+/**
+ * @brief   Low level initialization procedure for CTE driver, with the tables and outputs in a blob.
+ * @details The same as Cte_Setup, but the time tables and the output definitions are taken from a flat blob,
+ *          checked in a single pass and used in place, without other copies than the output definitions.
+ *          The tables and outputs pointers of the initialization structure are not used.
+ *
+ * @param[in]   cteInitParamsPtr    = pointer to the initialization structure, for the mode, clock, repeat count
+ *                                    and irq
+ * @param[in]   blobPtr             = pointer to the blob, aligned to 4 bytes
+ * @param[in]   bufferSize          = the bytes available at blobPtr, at least the blob size
+ * @param[in]   lutChecksumPtr      = pointer to a uint64 value, which will receive the final LUT checksum;
+ *                                  this value can be checked later using Cte_GetLutChecksum
+ * @return      E_OK/RSDK_SUCCESS = initialization succeeded
+ *              other values      = initialization failed, use the appropriate tools to detect the issue
+ *
+ */
+Std_ReturnType Cte_SetupBlob(const Cte_SetupParamsType *cteInitParamsPtr, const Cte_BlobHeaderType *blobPtr,
+        uint32 bufferSize, uint64 *lutChecksumPtr)
+{
+    Std_ReturnType      rez, regRez;
+    uint8               cteClockDivider;            /* the clock divider                    */
+    Cte_BlobViewType    blobView;
+    Cte_SetupParamsType setupParams;                /* the parameters, with the blob tables */
+
+    Cte_DriverStateReset();
+    /* check the initialization parameters          */
+    if ((cteInitParamsPtr == NULL_PTR) || (lutChecksumPtr == NULL_PTR))
     {
-        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NOT_INITIALIZED, CTE_E_WRONG_STATE, CTE_SETUP_MODULE_INIT);
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NULL_PTR_PARAMS, CTE_E_PARAM_POINTER, CTE_SETUP_PARAM_CHECK);
         CTE_HALT_ON_ERROR;
     }
     else
     {
-        if (gsDriverData.cteDriverStatus == (uint8)CTE_DRIVER_STATE_INITIALIZED)
+        rez = Cte_ModeParamsCheck(cteInitParamsPtr);
+        /* check the irq logic      */
+        if ((rez == (Std_ReturnType)E_OK) && ((uint32)cteInitParamsPtr->cteIrqEvents != 0u) &&
+                (cteInitParamsPtr->pCteCallback == NULL_PTR))
         {
-            rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NOT_RUNNING, CTE_E_WRONG_STATE, CTE_SETUP_MODULE_INIT);
+            rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NULL_CALLBACK, CTE_E_PARAM_POINTER, CTE_SETUP_PARAM_CHECK);
             CTE_HALT_ON_ERROR;
         }
     }
     if (rez == (Std_ReturnType)E_OK)
     {
-        if (CTE_GET_REGISTRY32(&gspCTEPtr->DBG_REG, CTE_DBG_REG_FSM_ST_MASK, CTE_DBG_REG_FSM_ST_SHIFT) == 0u)
-        {                           /* CTE in HALT      */
-            rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NOT_RUNNING, CTE_E_WRONG_STATE, CTE_SETUP_MODULE_INIT);
+        rez = Cte_BlobCheck(blobPtr, bufferSize, TRUE, &blobView);
+    }
+    regRez = Cte_RegistryPtrGet();
+    if (regRez != (Std_ReturnType)E_OK)
+    {
+        rez = regRez;
+    }
+    if (rez == (Std_ReturnType)E_OK)
+    {
+        /* the output definitions are needed for the LUT masks      */
+        Cte_BlobOutputsCopy(&blobView);
+        setupParams = *cteInitParamsPtr;
+        setupParams.signalDef0Ptr = gsDriverData.signalDef0Ptr;
+        setupParams.timeTable0Ptr = &blobView.tables[0];
+        if (blobView.hdrPtr->tableLen[1] != 0u)
+        {
+            setupParams.signalDef1Ptr = gsDriverData.signalDef1Ptr;
+            setupParams.timeTable1Ptr = &blobView.tables[1];
+        }
+        else
+        {
+            setupParams.signalDef1Ptr = NULL_PTR;
+            setupParams.timeTable1Ptr = NULL_PTR;
+        }
+        /* initialize the necessary data        */
+        gsDriverData.cteWorkingFreq = cteInitParamsPtr->cteClockFrecq; /* the working frequency for further computing */
+        cteClockDivider = Cte_ClockDividerFromDelay(blobView.maxDelay);
+        if (cteClockDivider >= CTE_CLOCK_DIVIDER_LIMIT)
+        {
+            rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_CLK_DIVIDER_ERROR, CTE_E_PARAM_VALUE, CTE_SETUP_PARAM_CHECK);
             CTE_HALT_ON_ERROR;
-            gsDriverData.cteDriverStatus = (uint8)CTE_DRIVER_STATE_INITIALIZED;
-            CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL1, CTE_CNTRL1_CTE_EN_MASK, CTE_CNTRL1_CTE_EN (0u));
         }
         else
         {
-                CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL, CTE_CNTRL_RFS_PGEN_MASK, CTE_CNTRL_RFS_PGEN(1u));
-                CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL, CTE_CNTRL_RFS_PGEN_MASK, CTE_CNTRL_RFS_PGEN(0u));
+            Cte_ModuleReset(cteClockDivider);
+            /* 1...4. the LUT, directly from the blob   */
+            rez = Cte_BlobTablesWrite(&blobView);
+            *lutChecksumPtr = Cte_GetLutChecksum();
+            /* 5...13. and the IRQ                      */
+            if (rez == (Std_ReturnType)E_OK)
+            {
+                rez = Cte_ModuleConfigure(&setupParams);
+            }
         }
     }
+    if (rez == (Std_ReturnType)E_OK)
+    {
+        gsDriverData.cteDriverStatus = (uint8)CTE_DRIVER_STATE_INITIALIZED;
+    }
     return rez;
 }
-/*=== Cte_RfsGenerate ===========================*/
+/*=== Cte_SetupBlob ===========================*/
 
 /*==================================================================================================*/
 /**
- * @brief   Low level procedure to update only the timing tables.
- * @details The procedure can be used only after a previous successful CTE initialization.
- *          If the CTE is working, it will be stopped and restarted after table changed.
- *          If stopped, it will remains in the same state. It is recommendable to do like this.
+ * @brief   Low level procedure to update only the timing tables, with the tables in a blob.
+ * @details The same as Cte_UpdateTables, but the time tables are taken from a flat blob, without output
+ *          definitions; the output definitions of the current setup are used.
  *
- * @param[in]   table0Ptr,table1Ptr     = pointer to the new table(s); first pointer must not be NULL_PTR;
-                                          if second is NULL_PTR, only one table used, else two tables used
+ * @param[in]   blobPtr                 = pointer to the blob, aligned to 4 bytes
+ * @param[in]   bufferSize              = the bytes available at blobPtr, at least the blob size
  * @param[in]   lutChecksumPtr          = pointer to a uint64 value, which will receive the final LUT checksum;
  *                                        this value can be checked later using Cte_GetLutChecksum
- * @param[out]  E_OK/RSDK_SUCCESS       = initialization succeeded
- *              other values            = initialization failed, use the appropriate tools to detect the issue
+ * @return      E_OK/RSDK_SUCCESS       = update succeeded
+ *              other values            = update failed, use the appropriate tools to detect the issue
  *
  */
-Std_ReturnType Cte_UpdateTables(Cte_TimeTableDefType *table0Ptr, Cte_TimeTableDefType *table1Ptr,
-        uint64 *lutChecksumPtr)
+Std_ReturnType Cte_UpdateTablesBlob(const Cte_BlobHeaderType *blobPtr, uint32 bufferSize, uint64 *lutChecksumPtr)
 {
-    Std_ReturnType rez = (Std_ReturnType)E_OK;
+    Cte_BlobViewType    blobView;
+    Std_ReturnType      rez = (Std_ReturnType)E_OK;
 
     if (gsDriverData.cteDriverStatus == (uint8)CTE_DRIVER_STATE_NOT_INIT)
     {
         rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NOT_INITIALIZED, CTE_E_WRONG_STATE, CTE_SETUP_MODULE_INIT);
         CTE_HALT_ON_ERROR;
     }
+    else if (gsDriverData.cteDriverStatus == (uint8)CTE_DRIVER_STATE_RUNNING)
+    {
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_RUNNING, CTE_E_WRONG_STATE, CTE_SETUP_MODULE_INIT);
+        CTE_HALT_ON_ERROR;
+    }
+    else if (lutChecksumPtr == NULL_PTR)
+    {
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NULL_PTR_PARAMS, CTE_E_PARAM_POINTER, CTE_SETUP_PARAM_CHECK);
+        CTE_HALT_ON_ERROR;
+    }
     else
     {
-        if (gsDriverData.cteDriverStatus == (uint8)CTE_DRIVER_STATE_RUNNING)
-        {
-            rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_RUNNING, CTE_E_WRONG_STATE, CTE_SETUP_MODULE_INIT);
-            CTE_HALT_ON_ERROR;
-        }
-        else
-        {
-            if(lutChecksumPtr == NULL_PTR)
-            {
-                rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NULL_PTR_PARAMS, CTE_E_PARAM_POINTER, CTE_SETUP_PARAM_CHECK);
-                CTE_HALT_ON_ERROR;
-            }
-        }
+        rez = Cte_BlobCheck(blobPtr, bufferSize, FALSE, &blobView);
     }
-    if (rez == (Std_ReturnType)E_OK)
-    {               /* ok till here, check the pointer compatibility        */
-        if (table0Ptr == NULL_PTR)
-        {
-            rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_NULL_PTR_TABLE0, CTE_E_PARAM_POINTER, CTE_SETUP_PARAM_CHECK);
-            CTE_HALT_ON_ERROR;
-        }
-        else
-        {
-            if (((table1Ptr == NULL_PTR)              /* table1 was provided at init but is not required now          */
-                    && ((uint8)gsDriverData.signalDef1Ptr[0].outputSignal < (uint8)CTE_OUTPUT_MAX))
-                    ||
-                    ((table1Ptr != NULL_PTR)          /* table1 was not provided at init and is required now          */
-                            && ((uint8)gsDriverData.signalDef1Ptr[0].outputSignal >= (uint8)CTE_OUTPUT_MAX)))
-            {
-                rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_WRG_PTR_TABLE1, CTE_E_PARAM_POINTER, CTE_SETUP_PARAM_CHECK);
-                CTE_HALT_ON_ERROR;
-            }
-        }
+    /* the tables must fit the layout and the timing of the current setup       */
+    if ((rez == (Std_ReturnType)E_OK) && ((blobView.hdrPtr->tableLen[1] != 0u) !=
+            ((uint8)gsDriverData.signalDef1Ptr[0].outputSignal < (uint8)CTE_OUTPUT_MAX)))
+    {
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_WRG_PTR_TABLE1, CTE_E_PARAM_POINTER, CTE_SETUP_PARAM_CHECK);
+        CTE_HALT_ON_ERROR;
+    }
+    if ((rez == (Std_ReturnType)E_OK) &&
+            (Cte_ClockDividerFromDelay(blobView.maxDelay) > gsDriverData.cteMainClockDivider))
+    {
+        rez = CTE_REPORT_ERROR(RSDK_CTE_DRV_CLK_DIVIDER_ERROR, CTE_E_PARAM_VALUE, CTE_SETUP_PARAM_CHECK);
+        CTE_HALT_ON_ERROR;
     }
     if (rez == (Std_ReturnType)E_OK)
     {
@@ -1652,37 +3406,13 @@ Std_ReturnType Cte_UpdateTables(Cte_TimeTableDefType *table0Ptr, Cte_TimeTableDe
         CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL1, CTE_CNTRL1_CKSM_RST_MASK, CTE_CNTRL1_CKSM_RST(1u));
         /* enable the checksum computation      */
         CTE_SET_REGISTRY32(&gspCTEPtr->CNTRL1, CTE_CNTRL1_CKSM_RST_MASK, CTE_CNTRL1_CKSM_RST(0u));
-        rez = Cte_TimingTableSet(table0Ptr, gsDriverData.signalDef0Ptr, (volatile void *)gspCTEPtr->LUT);
-        if ((rez == (Std_ReturnType)E_OK) && (table1Ptr != NULL_PTR))
-        {
-            rez = Cte_TimingTableSet(table1Ptr, gsDriverData.signalDef1Ptr, (volatile void *)&gspCTEPtr->LUT[1]);
-        }
+        rez = Cte_BlobTablesWrite(&blobView);
         *lutChecksumPtr = Cte_GetLutChecksum();
     }
     return rez;
 }
-/*=== Cte_UpdateTables ===========================*/
-
-
-/*==================================================================================================*/
-/**
- * @brief   Get the checksum of the timing LUT.
- * @details This procedure returns the current checksum reported by the hardware, only 40 bits.
- *          The value can be compared to the previous values.
- *
- * @return  LUT checksum
- *
- */
-uint64 Cte_GetLutChecksum(void)
-{
-    uint64 checkSum = (uint64)gspCTEPtr->CKSM_MSB;
-
-    checkSum <<= 32u;
-    checkSum += (uint64_t)gspCTEPtr->CKSM_LSB;
-    return checkSum;
-}
-/*=== Cte_GetLutChecksum ===========================*/
-
+/*=== Cte_UpdateTablesBlob ===========================*/
+#endif /* #if (CTE_TABLES_BLOB_USAGE == STD_ON) */
 
 
 #ifdef __cplusplus
@@ -128,6 +128,137 @@ extern "C"{
 /*==================================================================================================
  *                                       LOCAL FUNCTIONS
  ==================================================================================================*/
+#if (CTE_TIMING_STATS_USAGE == STD_ON)
+/*==================================================================================================*/
+/**
+ * @brief   Get the histogram bin for a time.
+ * @details The bin is the number of significant bits of the time, so the bins are on a log2 scale.
+ *
+ * @param[in]   timeVal     = the time, in system counter ticks
+ * @return      the bin, 0 to CTE_STATS_HIST_BINS - 1
+ *
+ */
+static uint32 Cte_StatsBinGet(uint64 timeVal)
+{
+    uint64 val = timeVal;
+    uint32 bin = 0u;
+
+    while ((val != 0u) && (bin < (CTE_STATS_HIST_BINS - 1u)))
+    {
+        val >>= 1u;
+        bin++;
+    }
+    return bin;
+}
+/*=== Cte_StatsBinGet ===========================*/
+
+/*==================================================================================================*/
+/**
+ * @brief   Get the rounded number of average periods in a period.
+ * @details Shift & subtract, so the interrupt path has no 64 bits division (a library call on 32 bits cores);
+ *          at most 32 steps, for up to 2^32 periods.
+ *
+ * @param[in]   period      = the period, in system counter ticks
+ * @param[in]   periodAvg   = the average period, not 0
+ * @return      round(period / periodAvg)
+ *
+ */
+static uint32 Cte_StatsPeriodsGet(uint64 period, uint64 periodAvg)
+{
+    uint64 rest = period + (periodAvg >> 1u);
+    uint64 div = periodAvg;
+    uint32 shift = 0u;
+    uint32 periods = 0u;
+
+    while ((div <= (rest >> 1u)) && (shift < 31u))
+    {
+        div <<= 1u;
+        shift++;
+    }
+    while (div >= periodAvg)
+    {
+        if (rest >= div)
+        {
+            rest -= div;
+            periods |= (uint32)1u << shift;
+        }
+        div >>= 1u;
+        shift--;
+    }
+    return periods;
+}
+/*=== Cte_StatsPeriodsGet ===========================*/
+
+/*==================================================================================================*/
+/**
+ * @brief   Update the timing statistics of the events reported by an interrupt.
+ * @details A period longer than 1.5 x the average period means at least one event was missed (the status bit can
+ *          record only one event); the missed period is not used for the average, min and max.
+ *
+ * @param[in]   cteEvents   = the irq status
+ * @param[in]   timeStamp   = the irq handler start time
+ *
+ */
+static void Cte_TimingStatsEvents(uint32 cteEvents, uint64 timeStamp)
+{
+    uint32                  i, mask;
+    uint64                  period, missed;
+    Cte_EvtTimingStatsType  *pEvt;
+
+    mask = cteEvents;
+    for (i = 0u; (i < CTE_STATS_EVT_BITS) && (mask != 0u); i++)
+    {
+        if ((mask & 1u) != 0u)
+        {
+            pEvt = &gCteTimingStats.evt[i];
+            if (pEvt->eventsNum != 0u)
+            {
+                period = timeStamp - pEvt->lastTime;
+                pEvt->periodSum += period;
+                pEvt->periodHist[Cte_StatsBinGet(period)]++;
+                pEvt->periodsNum++;
+                if ((pEvt->periodAvg != 0u) && (period > (pEvt->periodAvg + (pEvt->periodAvg >> 1u))))
+                {           /* rare case, the periods are counted without division      */
+                    missed = (uint64)Cte_StatsPeriodsGet(period, pEvt->periodAvg) - 1u;
+                    pEvt->missedNum += (uint32)missed;
+                }
+                else
+                {
+                    pEvt->periodMin = ((period < pEvt->periodMin) || (pEvt->periodsNum == 1u)) ? period :
+                                        pEvt->periodMin;
+                    pEvt->periodMax = (period > pEvt->periodMax) ? period : pEvt->periodMax;
+                    /* average over about 8 periods, division free      */
+                    pEvt->periodAvg = (pEvt->periodAvg == 0u) ? period :
+                                        ((pEvt->periodAvg - (pEvt->periodAvg >> 3u)) + (period >> 3u));
+                }
+            }
+            pEvt->lastTime = timeStamp;
+            pEvt->eventsNum++;
+        }
+        mask >>= 1u;
+    }
+}
+/*=== Cte_TimingStatsEvents ===========================*/
+
+/*==================================================================================================*/
+/**
+ * @brief   Update the irq service time statistics.
+ *
+ * @param[in]   timeStart   = the irq handler start time
+ *
+ */
+static void Cte_TimingStatsService(uint64 timeStart)
+{
+    uint64 delta = CTE_GET_TIMESTAMP() - timeStart;
+
+    gCteTimingStats.serviceMax = (delta > gCteTimingStats.serviceMax) ? delta : gCteTimingStats.serviceMax;
+    gCteTimingStats.serviceSum += delta;
+    gCteTimingStats.serviceHist[Cte_StatsBinGet(delta)]++;
+    gCteTimingStats.callsNum++;
+}
+/*=== Cte_TimingStatsService ===========================*/
+#endif /* #if (CTE_TIMING_STATS_USAGE == STD_ON) */
+
 /**
  * @brief   Interrupt handler for CTE.
  * @details Low level interrupt handler for CTE driver.
@@ -148,11 +279,30 @@ void Cte_IrqHandler(
     (void)(pParams);
 #endif
     uint32 cteEvents;
+#if (CTE_TIMING_STATS_USAGE == STD_ON)
+    uint64 timeStamp = CTE_GET_TIMESTAMP();
+#endif
 
     cteEvents = gspCTEPtr->INTSTAT;
     gspCTEPtr->INTSTAT = cteEvents;          /* clear all bits       */
+#if (CTE_TIMING_STATS_USAGE == STD_ON)
+    Cte_TimingStatsEvents(cteEvents, timeStamp);
+#endif
+#if (CTE_SHADOW_UPDATE_USAGE == STD_ON)
+    cteEvents |= Cte_ShadowCommit(cteEvents);   /* write the staged tables, if the table end was reached    */
+#endif
     cteEvents &= gsDriverData.cteReqEvents;
-    gsDriverData.pCteCallback(cteEvents);
+#if (CTE_PLAYLIST_USAGE == STD_ON)
+    cteEvents = Cte_PlaylistEventsGet(cteEvents);
+#endif
+    /* the irq sources can be enabled by the driver too, so only the requested events are reported          */
+    if ((cteEvents != 0u) && (gsDriverData.pCteCallback != NULL_PTR))
+    {
+        gsDriverData.pCteCallback(cteEvents);
+    }
+#if (CTE_TIMING_STATS_USAGE == STD_ON)
+    Cte_TimingStatsService(timeStamp);
+#endif
 }
 /*=== Cte_IrqHandler ===========================*/
 
@@ -190,7 +340,7 @@ Std_ReturnType Cte_IrqInit(const Cte_SetupParamsType *cteInitParamsPtr)
 #endif
         )
     {                       /* events callback requested        */
-        gspCTEPtr->INTEN = (uint32)cteInitParamsPtr->cteIrqEvents;
+        gspCTEPtr->INTEN = (uint32)cteInitParamsPtr->cteIrqEvents & CTE_IRQ_HW_MASK;   /* no software events */
     }
     return rez;
 }
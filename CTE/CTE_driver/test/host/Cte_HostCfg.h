@@ -0,0 +1,36 @@
+/*
+ * Copyright 2023 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef CTE_HOSTCFG_H
+#define CTE_HOSTCFG_H
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*==================================================================================================
+*                                       DEFINES AND MACROS
+==================================================================================================*/
+/* Platform definitions of the host build, included before any driver source (-include).
+ * The timing statistics use the model counter, in ns, moved only by the tests, so the statistics are exact.     */
+#define CTE_GET_TIMESTAMP()         ((uint64)CteHost_GetTime())
+#define CTE_GET_TIMESTAMP_FREQ()    ((uint64)1000000000u)
+
+/*==================================================================================================
+*                                       FUNCTION PROTOTYPES
+==================================================================================================*/
+uint64_t CteHost_GetTime(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CTE_HOSTCFG_H */
@@ -0,0 +1,83 @@
+/*
+ * Copyright 2023 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <string.h>
+#include "Cte_HostModel.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*==================================================================================================
+*                                        GLOBAL VARIABLES
+==================================================================================================*/
+/* The CTE and SRC_1 registries, in memory (CTE_REGS_MODEL_USED)                                    */
+volatile CTE_Type gCteRegsModel;
+volatile SRC_1_Type gCteSrc1Model;
+rsdkIrqHandler_t gCteHostIrqHandler = NULL;
+uint32 gCteHostFails = 0u;
+
+/*==================================================================================================
+*                                         LOCAL VARIABLES
+==================================================================================================*/
+static uint64 gsCteHostTime = 0u;               /* the model counter, in ns                         */
+
+/*==================================================================================================
+*                                        GLOBAL FUNCTIONS
+==================================================================================================*/
+/*================================================================================================*/
+/*
+ * @brief       The model counter, in ns, used as the timing statistics counter.
+ *
+ */
+uint64_t CteHost_GetTime(void)
+{
+    return (uint64_t)gsCteHostTime;
+}
+
+/*================================================================================================*/
+void CteHost_TimeAdvance(const uint64 ticks)
+{
+    gsCteHostTime += ticks;
+}
+
+/*================================================================================================*/
+void CteHost_ModelReset(void)
+{
+    (void)memset((void *)&gCteRegsModel, 0, sizeof(CTE_Type));
+    (void)memset((void *)&gCteSrc1Model, 0, sizeof(SRC_1_Type));
+    gsCteHostTime = 0u;
+}
+
+/*================================================================================================*/
+void CteHost_LutChecksumSet(const uint64 lutChecksum)
+{
+    /* computed by the CTE from the LUT writes, set here as the test needs                                         */
+    gCteRegsModel.CKSM_MSB = (uint32)(lutChecksum >> 32u);
+    gCteRegsModel.CKSM_LSB = (uint32)lutChecksum;
+}
+
+/*================================================================================================*/
+boolean CteHost_RaiseIrq(const uint32 intStat)
+{
+    boolean called = FALSE;
+
+    gCteRegsModel.INTSTAT |= intStat;
+    if (((gCteRegsModel.INTSTAT & gCteRegsModel.INTEN) != 0u) && (gCteHostIrqHandler != NULL))
+    {
+        gCteHostIrqHandler();
+        gCteRegsModel.INTSTAT = 0u;
+        called = TRUE;
+    }
+    return called;
+}
+
+#ifdef __cplusplus
+}
+#endif
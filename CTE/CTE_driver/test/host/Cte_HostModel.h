@@ -0,0 +1,81 @@
+/*
+ * Copyright 2023 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef CTE_HOSTMODEL_H
+#define CTE_HOSTMODEL_H
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <stdio.h>
+#include "CDD_Cte.h"
+#include "Cte_Specific.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*==================================================================================================
+*                                       DEFINES AND MACROS
+==================================================================================================*/
+/* test check : the failure is reported and counted, the test goes on                               */
+#define CTE_HOST_CHECK(cond)                                                                            \
+    do {                                                                                                \
+        if (!(cond))                                                                                    \
+        {                                                                                               \
+            (void)printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);                      \
+            gCteHostFails++;                                                                            \
+        }                                                                                               \
+    } while (0)
+
+/*==================================================================================================
+*                                  GLOBAL VARIABLE DECLARATIONS
+==================================================================================================*/
+extern uint32 gCteHostFails;                    /* the failed checks number                         */
+
+/*==================================================================================================
+*                                       FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+ * @brief       Reset the registers model, to the state after the power-on reset, and the model counter to 0.
+ */
+void CteHost_ModelReset(void);
+
+/**
+ * @brief       Move the model counter, used for the timing statistics.
+ *
+ * @param[in]   ticks       - the counter ticks, in ns
+ *
+ */
+void CteHost_TimeAdvance(const uint64 ticks);
+
+/**
+ * @brief       Set the LUT checksum registers.
+ * @details     The model has no checksum unit, so the registers keep the value set here, whatever the LUT writes.
+ *
+ * @param[in]   lutChecksum - the value of CKSM_MSB:CKSM_LSB
+ *
+ */
+void CteHost_LutChecksumSet(const uint64 lutChecksum);
+
+/**
+ * @brief       Raise CTE events on the registers model.
+ * @details     The events are added to INTSTAT; if an enabled event is pending, the registered handler is called,
+ *              as for the interrupt controller. The model has no write 1 to clear: the status read again by the
+ *              handler still has the raised bits, as if raised again meanwhile; the status is cleared after the
+ *              handler. A disabled event is kept and seen by the next handler call, as for the CTE.
+ *
+ * @param[in]   intStat     - the events, a combination of Cte_IrqDefinitionType hardware elements
+ * @return      TRUE if the handler was called, FALSE else
+ *
+ */
+boolean CteHost_RaiseIrq(const uint32 intStat);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CTE_HOSTMODEL_H */
@@ -0,0 +1,451 @@
+/*
+ * Copyright 2023 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <string.h>
+#include "Cte_HostModel.h"
+
+/*==================================================================================================
+*                                          LOCAL MACROS
+==================================================================================================*/
+#define TEST_MAX_EVENTS     64u
+#define TEST_ACTIONS        3u                  /* SPT_0, CTEP_0 and the list end                                   */
+#define TEST_BLOB_WORDS     1024u               /* the blob buffer, in 32 bits words                                */
+#define TEST_WRG_FORMAT     RSDK_CTE_DRV_BLOB_WRG_FORMAT
+
+/*==================================================================================================
+*                                  LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+/* a time table, with its events and actions                                                        */
+typedef struct {
+    Cte_TimeTableDefType    table;
+    Cte_TimingEventType     events[TEST_MAX_EVENTS];
+    Cte_ActionType          actions[TEST_MAX_EVENTS][TEST_ACTIONS];
+} Test_TableType;
+
+/*==================================================================================================
+*                                         LOCAL VARIABLES
+==================================================================================================*/
+static Cte_SingleOutputDefType  gsTestOutputs[] = {
+    { CTE_OUTPUT_SPT_0, CTE_OUT_TOGGLE, 0u },
+    { CTE_OUTPUT_CTEP_0, CTE_OUT_LOGIC, 0u },
+    { CTE_OUTPUT_CTEP_1, CTE_OUT_LOGIC, 0u },
+    { CTE_OUTPUT_MAX, CTE_OUT_HIZ, 0u }
+};
+static Cte_SingleOutputDefType  gsTestOutputs1[] = {        /* for the table 1, with a CTEP not defined for table 0 */
+    { CTE_OUTPUT_SPT_0, CTE_OUT_TOGGLE, 0u },
+    { CTE_OUTPUT_CTEP_0, CTE_OUT_LOGIC, 0u },
+    { CTE_OUTPUT_CTEP_2, CTE_OUT_LOGIC, 0u },
+    { CTE_OUTPUT_MAX, CTE_OUT_HIZ, 0u }
+};
+#define TEST_OUTPUTS_NR     3u                  /* the outputs defined above, for each table                        */
+static Cte_SetupParamsType      gsTestParams;
+static Test_TableType           gsTestTabA, gsTestTabB, gsTestTabLong, gsTestTabSlow;
+static uint32                   gsTestBlobBuf[TEST_BLOB_WORDS];     /* 4 bytes aligned                      */
+static Cte_BlobHeaderType       *gspTestBlob = (Cte_BlobHeaderType *)(void *)gsTestBlobBuf;
+static CTE_Type                 gsTestRegs;     /* the registry after the same operation with the tables structures */
+
+/*==================================================================================================
+*                                         LOCAL FUNCTIONS
+==================================================================================================*/
+/*
+ * @brief       Build a table : an event each period, SPT_0 flipped and CTEP_0 alternated at each event.
+ *
+ */
+static void Test_TableBuild(Test_TableType *pTab, const uint32 eventsNr, const uint32 period, const uint32 timeLimit)
+{
+    uint32  i;
+
+    for (i = 0u; i < eventsNr; i++)
+    {
+        pTab->actions[i][0].outputSignal = CTE_OUTPUT_SPT_0;
+        pTab->actions[i][0].cteOutputSignalType.newToggleState = CTE_TOGGLE_FLIP;
+        pTab->actions[i][1].outputSignal = CTE_OUTPUT_CTEP_0;
+        pTab->actions[i][1].cteOutputSignalType.newLogicState = ((i & 1u) == 0u) ? CTE_LOGIC_SET_TO_HIGH :
+                                                                                  CTE_LOGIC_SET_TO_LOW;
+        pTab->actions[i][2].outputSignal = CTE_OUTPUT_MAX;
+        pTab->events[i].absTime = period * (i + 1u);
+        pTab->events[i].eventActionsPtr = pTab->actions[i];
+    }
+    pTab->table.tableLength = (uint8)eventsNr;
+    pTab->table.tableTimeExecLimit = timeLimit;
+    pTab->table.eventsPtr = pTab->events;
+}
+
+/*================================================================================================*/
+/*
+ * @brief       The blob sections, after the header.
+ *
+ */
+static Cte_BlobOutputType *Test_BlobOutputs(void)
+{
+    return (Cte_BlobOutputType *)(void *)&gspTestBlob[1];
+}
+
+static Cte_BlobEventType *Test_BlobEvents(void)
+{
+    return (Cte_BlobEventType *)(void *)&Test_BlobOutputs()[gspTestBlob->outputsNr[0] + gspTestBlob->outputsNr[1]];
+}
+
+static Cte_BlobActionType *Test_BlobActions(void)
+{
+    return (Cte_BlobActionType *)(void *)&Test_BlobEvents()[gspTestBlob->tableLen[0] + gspTestBlob->tableLen[1]];
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Set the blob size for the sections lengths of the header, the sections content is not moved.
+ *
+ */
+static void Test_BlobResize(void)
+{
+    uint32  blobSize;
+
+    blobSize = (uint32)sizeof(Cte_BlobHeaderType) +
+               (((uint32)gspTestBlob->outputsNr[0] + gspTestBlob->outputsNr[1]) * (uint32)sizeof(Cte_BlobOutputType)) +
+               (((uint32)gspTestBlob->tableLen[0] + gspTestBlob->tableLen[1]) * (uint32)sizeof(Cte_BlobEventType)) +
+               ((uint32)gspTestBlob->actionsNr * (uint32)sizeof(Cte_BlobActionType));
+    gspTestBlob->blobSize = (blobSize + 3u) & (~3u);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Build the blob of one or two tables, with the test outputs for each table (setup blob) or without
+ *              outputs (tables update blob).
+ *
+ */
+static void Test_BlobBuild(const Test_TableType *pTab0, const Test_TableType *pTab1, const boolean withOutputs)
+{
+    const Test_TableType            *pTabs[CTE_LUT_COUNT];
+    const Cte_SingleOutputDefType   *pDefs;
+    Cte_BlobOutputType              *pOut;
+    Cte_BlobEventType               *pEvt;
+    Cte_BlobActionType              *pAct;
+    uint32                          t, i, j;
+
+    (void)memset(gsTestBlobBuf, 0, sizeof(gsTestBlobBuf));
+    pTabs[0] = pTab0;
+    pTabs[1] = pTab1;
+    gspTestBlob->blobVersion = CTE_TABLES_BLOB_VERSION;
+    gspTestBlob->actionsNr = 0u;
+    for (t = 0u; t < CTE_LUT_COUNT; t++)
+    {
+        gspTestBlob->tableLen[t] = (pTabs[t] == NULL_PTR) ? 0u : pTabs[t]->table.tableLength;
+        gspTestBlob->outputsNr[t] = ((pTabs[t] == NULL_PTR) || (withOutputs == FALSE)) ? 0u : (uint8)TEST_OUTPUTS_NR;
+        gspTestBlob->timeLimit[t] = (pTabs[t] == NULL_PTR) ? 0u : pTabs[t]->table.tableTimeExecLimit;
+    }
+    pOut = Test_BlobOutputs();
+    for (t = 0u; t < CTE_LUT_COUNT; t++)
+    {
+        pDefs = (t == 0u) ? gsTestOutputs : gsTestOutputs1;
+        for (i = 0u; i < gspTestBlob->outputsNr[t]; i++)
+        {
+            pOut->outputSignal = (uint8)pDefs[i].outputSignal;
+            pOut->signalType = (uint8)pDefs[i].signalType;
+            pOut->clockPeriod = pDefs[i].clockPeriod;
+            pOut++;
+        }
+    }
+    pEvt = Test_BlobEvents();
+    pAct = Test_BlobActions();              /* the actions number is not used by the sections before   */
+    for (t = 0u; t < CTE_LUT_COUNT; t++)
+    {
+        for (i = 0u; i < gspTestBlob->tableLen[t]; i++)
+        {
+            pEvt->absTime = pTabs[t]->events[i].absTime;
+            for (j = 0u; pTabs[t]->events[i].eventActionsPtr[j].outputSignal != CTE_OUTPUT_MAX; j++)
+            {
+                pAct->outputSignal = (uint8)pTabs[t]->events[i].eventActionsPtr[j].outputSignal;
+                pAct->newState = (uint8)pTabs[t]->events[i].eventActionsPtr[j].cteOutputSignalType.newLogicState;
+                pAct++;
+            }
+            pEvt->actionsNr = (uint8)j;
+            gspTestBlob->actionsNr += (uint16)j;
+            pEvt++;
+        }
+    }
+    Test_BlobResize();
+}
+
+/*================================================================================================*/
+/*
+ * @brief       The setup parameters, without tables and outputs; the tables structures are set for Cte_Setup.
+ *
+ */
+static void Test_ParamsSet(const Test_TableType *pTab0, const Test_TableType *pTab1)
+{
+    CteHost_ModelReset();
+    (void)memset(&gsTestParams, 0, sizeof(gsTestParams));
+    gsTestParams.cteMode.workingMode = CTE_MASTER;
+    gsTestParams.cteClockFrecq = CTE_DEFAULT_INPUT_CLOCK;
+    gsTestParams.signalDef0Ptr = gsTestOutputs;
+    gsTestParams.timeTable0Ptr = (Cte_TimeTableDefType *)&pTab0->table;
+    gsTestParams.signalDef1Ptr = (pTab1 == NULL_PTR) ? NULL_PTR : gsTestOutputs1;
+    gsTestParams.timeTable1Ptr = (pTab1 == NULL_PTR) ? NULL_PTR : (Cte_TimeTableDefType *)&pTab1->table;
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Keep the registry, then compare the registry with the kept one.
+ *
+ */
+static void Test_RegsKeep(void)
+{
+    (void)memcpy(&gsTestRegs, (const void *)&gCteRegsModel, sizeof(gsTestRegs));
+}
+
+static boolean Test_RegsEqual(void)
+{
+    return (memcmp(&gsTestRegs, (const void *)&gCteRegsModel, sizeof(gsTestRegs)) == 0) ? TRUE : FALSE;
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Set up with the blob of the current buffer, for the single table A.
+ *
+ */
+static Std_ReturnType Test_SetupBlob(const Cte_BlobHeaderType *pBlob, const uint32 bufferSize)
+{
+    uint64  lutChecksum;
+
+    Test_ParamsSet(&gsTestTabA, NULL_PTR);
+    return Cte_SetupBlob(&gsTestParams, pBlob, bufferSize, &lutChecksum);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       A blob setup gives the same registry (LUT, LUT_DUR, signal types, clocks) as the tables structures.
+ *
+ */
+static void Test_SetupEqual(void)
+{
+    static Test_TableType   *pTabs[][CTE_LUT_COUNT] = {
+        { &gsTestTabA, NULL_PTR }, { &gsTestTabLong, NULL_PTR }, { &gsTestTabA, &gsTestTabB }
+    };
+    uint64                  lutChecksum, blobChecksum;
+    uint32                  i;
+
+    for (i = 0u; i < (sizeof(pTabs) / sizeof(pTabs[0])); i++)
+    {
+        Test_ParamsSet(pTabs[i][0], pTabs[i][1]);
+        CTE_HOST_CHECK(Cte_Setup(&gsTestParams, &lutChecksum) == (Std_ReturnType)E_OK);
+        Test_RegsKeep();
+        Test_BlobBuild(pTabs[i][0], pTabs[i][1], TRUE);
+        Test_ParamsSet(pTabs[i][0], pTabs[i][1]);
+        gsTestParams.signalDef0Ptr = NULL_PTR;          /* not used by the blob setup                       */
+        gsTestParams.timeTable0Ptr = NULL_PTR;
+        CTE_HOST_CHECK(Cte_SetupBlob(&gsTestParams, gspTestBlob, gspTestBlob->blobSize, &blobChecksum)
+                       == (Std_ReturnType)E_OK);
+        CTE_HOST_CHECK(Test_RegsEqual() == TRUE);
+        CTE_HOST_CHECK(blobChecksum == lutChecksum);
+        CTE_HOST_CHECK(gCteRegsModel.LUT_DUR == gsTestRegs.LUT_DUR);
+    }
+}
+
+/*================================================================================================*/
+/*
+ * @brief       The blob refused by the check, with the error of the rule.
+ *
+ */
+static void Test_BadHeader(void)
+{
+    uint64  lutChecksum;
+
+    Test_BlobBuild(&gsTestTabA, NULL_PTR, TRUE);
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, gspTestBlob->blobSize) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Test_SetupBlob(NULL_PTR, sizeof(gsTestBlobBuf)) == TEST_WRG_FORMAT);
+    CTE_HOST_CHECK(Test_SetupBlob((const Cte_BlobHeaderType *)(const void *)((uint8 *)gsTestBlobBuf + 2u),
+                                  sizeof(gsTestBlobBuf) - 2u) == TEST_WRG_FORMAT);
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(Cte_BlobHeaderType) - 1u) == TEST_WRG_FORMAT);
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, gspTestBlob->blobSize - 4u) == TEST_WRG_FORMAT);
+    /* a refused setup leaves the driver not initialized                                                            */
+    CTE_HOST_CHECK(Cte_UpdateTablesBlob(gspTestBlob, sizeof(gsTestBlobBuf), &lutChecksum)
+                   == RSDK_CTE_DRV_NOT_INITIALIZED);
+    Test_BlobBuild(&gsTestTabA, NULL_PTR, TRUE);
+    gspTestBlob->blobVersion = CTE_TABLES_BLOB_VERSION + 1u;
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(gsTestBlobBuf)) == TEST_WRG_FORMAT);
+    Test_BlobBuild(&gsTestTabA, NULL_PTR, TRUE);
+    gspTestBlob->blobSize += 4u;
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(gsTestBlobBuf)) == TEST_WRG_FORMAT);
+    Test_BlobBuild(&gsTestTabA, NULL_PTR, TRUE);
+    gspTestBlob->reserved = 1u;
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(gsTestBlobBuf)) == TEST_WRG_FORMAT);
+    Test_BlobBuild(&gsTestTabA, NULL_PTR, TRUE);
+    gspTestBlob->timeLimit[1] = 1u;                     /* a time limit for the unused table                */
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(gsTestBlobBuf)) == TEST_WRG_FORMAT);
+    Test_BlobBuild(&gsTestTabA, NULL_PTR, TRUE);
+    gspTestBlob->tableLen[0] = 0u;
+    Test_BlobResize();
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(gsTestBlobBuf)) == TEST_WRG_FORMAT);
+    /* the output definitions numbers                                                                               */
+    Test_BlobBuild(&gsTestTabA, NULL_PTR, TRUE);
+    gspTestBlob->outputsNr[0] = 0u;
+    Test_BlobResize();
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(gsTestBlobBuf)) == TEST_WRG_FORMAT);
+    Test_BlobBuild(&gsTestTabA, NULL_PTR, TRUE);
+    gspTestBlob->outputsNr[0] = (uint8)CTE_OUTPUT_MAX + 1u;
+    Test_BlobResize();
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(gsTestBlobBuf)) == TEST_WRG_FORMAT);
+    Test_BlobBuild(&gsTestTabA, NULL_PTR, TRUE);
+    gspTestBlob->outputsNr[1] = 1u;                     /* outputs for the unused table                     */
+    Test_BlobResize();
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(gsTestBlobBuf)) == TEST_WRG_FORMAT);
+    Test_BlobBuild(&gsTestTabA, &gsTestTabB, TRUE);
+    gspTestBlob->outputsNr[1] = 0u;                     /* no outputs for the used table                    */
+    Test_BlobResize();
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(gsTestBlobBuf)) == TEST_WRG_FORMAT);
+    /* the tables lengths                                                                                           */
+    Test_BlobBuild(&gsTestTabA, NULL_PTR, TRUE);
+    gspTestBlob->tableLen[0] = (uint8)CTE_MAX_LARGE_TIME_TABLE_LEN + 1u;
+    Test_BlobResize();
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(gsTestBlobBuf)) == RSDK_CTE_DRV_TABLE_TOO_LONG);
+    Test_BlobBuild(&gsTestTabA, &gsTestTabB, TRUE);
+    gspTestBlob->tableLen[1] = (uint8)CTE_MAX_SMALL_TIME_TABLE_LEN + 1u;
+    Test_BlobResize();
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(gsTestBlobBuf)) == RSDK_CTE_DRV_TABLE_TOO_LONG);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       The output definitions of a setup blob.
+ *
+ */
+static void Test_BadOutputs(void)
+{
+    Test_BlobBuild(&gsTestTabA, NULL_PTR, TRUE);
+    Test_BlobOutputs()[2].outputSignal = (uint8)CTE_OUTPUT_MAX;
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(gsTestBlobBuf)) == TEST_WRG_FORMAT);
+    Test_BlobBuild(&gsTestTabA, NULL_PTR, TRUE);
+    Test_BlobOutputs()[2].signalType = (uint8)CTE_OUT_MAX;
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(gsTestBlobBuf)) == TEST_WRG_FORMAT);
+    Test_BlobBuild(&gsTestTabA, NULL_PTR, TRUE);
+    Test_BlobOutputs()[2].reserved = 1u;
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(gsTestBlobBuf)) == TEST_WRG_FORMAT);
+    Test_BlobBuild(&gsTestTabA, NULL_PTR, TRUE);
+    Test_BlobOutputs()[2].outputSignal = (uint8)CTE_OUTPUT_CTEP_0;     /* defined twice                    */
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(gsTestBlobBuf)) == TEST_WRG_FORMAT);
+    /* the output types                                                                                             */
+    Test_BlobBuild(&gsTestTabA, NULL_PTR, TRUE);
+    Test_BlobOutputs()[0].signalType = (uint8)CTE_OUT_CLOCK;
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(gsTestBlobBuf)) == RSDK_CTE_DRV_SIG_OUT_WRG_TYPE);
+    Test_BlobBuild(&gsTestTabA, NULL_PTR, TRUE);
+    Test_BlobOutputs()[2].outputSignal = (uint8)CTE_OUTPUT_SPT_1;       /* LOGIC, while SPT_0 is TOGGLE     */
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(gsTestBlobBuf)) == RSDK_CTE_DRV_SIG_OUT_DIF_TYPE);
+    Test_BlobBuild(&gsTestTabA, NULL_PTR, TRUE);
+    Test_BlobOutputs()[2].outputSignal = (uint8)CTE_OUTPUT_FLEX_0;
+    Test_BlobOutputs()[2].signalType = (uint8)CTE_OUT_TOGGLE;
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(gsTestBlobBuf)) == RSDK_CTE_DRV_SIG_OUT_WRG_TYPE);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       The events and the actions of a blob.
+ *
+ */
+static void Test_BadEvents(void)
+{
+    Test_BlobBuild(&gsTestTabA, NULL_PTR, TRUE);
+    Test_BlobEvents()[3].reserved[1] = 1u;
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(gsTestBlobBuf)) == TEST_WRG_FORMAT);
+    Test_BlobBuild(&gsTestTabA, NULL_PTR, TRUE);
+    Test_BlobEvents()[gsTestTabA.table.tableLength - 1u].actionsNr++;   /* after the last action            */
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(gsTestBlobBuf)) == TEST_WRG_FORMAT);
+    Test_BlobBuild(&gsTestTabA, NULL_PTR, TRUE);
+    gspTestBlob->actionsNr++;                           /* an action not used by the events                 */
+    Test_BlobResize();
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(gsTestBlobBuf)) == TEST_WRG_FORMAT);
+    /* the actions                                                                                                  */
+    Test_BlobBuild(&gsTestTabA, NULL_PTR, TRUE);
+    gspTestBlob->actionsNr += (uint16)CTE_OUTPUT_MAX;
+    Test_BlobResize();
+    Test_BlobEvents()[gsTestTabA.table.tableLength - 1u].actionsNr += (uint8)CTE_OUTPUT_MAX;
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(gsTestBlobBuf)) == RSDK_CTE_DRV_TOO_MANY_ACTIONS);
+    Test_BlobBuild(&gsTestTabA, NULL_PTR, TRUE);
+    Test_BlobActions()[1].outputSignal = Test_BlobActions()[0].outputSignal;
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(gsTestBlobBuf)) == RSDK_CTE_DRV_TOO_MANY_ACTIONS);
+    Test_BlobBuild(&gsTestTabA, NULL_PTR, TRUE);
+    Test_BlobActions()[5].outputSignal = (uint8)CTE_OUTPUT_MAX;
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(gsTestBlobBuf)) == RSDK_CTE_DRV_SIG_NOT_DEF);
+    Test_BlobBuild(&gsTestTabA, NULL_PTR, TRUE);
+    Test_BlobActions()[5].outputSignal = (uint8)CTE_OUTPUT_CTEP_2;     /* not defined                      */
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(gsTestBlobBuf)) == RSDK_CTE_DRV_SIG_NOT_DEF);
+    Test_BlobBuild(&gsTestTabA, NULL_PTR, TRUE);
+    Test_BlobActions()[5].newState = (uint8)CTE_LOGIC_UNCHANGED + 1u;
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(gsTestBlobBuf)) == RSDK_CTE_DRV_SIG_OUT_STATE_WRG);
+    /* the events times must increase, from a time after 0                                                          */
+    Test_BlobBuild(&gsTestTabA, NULL_PTR, TRUE);
+    Test_BlobEvents()[4].absTime = Test_BlobEvents()[3].absTime;
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(gsTestBlobBuf)) == RSDK_CTE_DRV_CLK_DIVIDER_ERROR);
+    Test_BlobBuild(&gsTestTabA, NULL_PTR, TRUE);
+    Test_BlobEvents()[0].absTime = 0u;
+    CTE_HOST_CHECK(Test_SetupBlob(gspTestBlob, sizeof(gsTestBlobBuf)) == RSDK_CTE_DRV_CLK_DIVIDER_ERROR);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       The tables update with a blob : the same registry as Cte_UpdateTables, and the update errors.
+ *
+ */
+static void Test_Update(void)
+{
+    uint64  lutChecksum, blobChecksum;
+
+    Test_ParamsSet(&gsTestTabA, NULL_PTR);
+    CTE_HOST_CHECK(Cte_Setup(&gsTestParams, &lutChecksum) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Cte_UpdateTables(&gsTestTabB.table, NULL_PTR, &lutChecksum) == (Std_ReturnType)E_OK);
+    Test_RegsKeep();
+    Test_ParamsSet(&gsTestTabA, NULL_PTR);
+    CTE_HOST_CHECK(Cte_Setup(&gsTestParams, &blobChecksum) == (Std_ReturnType)E_OK);
+    Test_BlobBuild(&gsTestTabB, NULL_PTR, FALSE);
+    CTE_HOST_CHECK(Cte_UpdateTablesBlob(gspTestBlob, gspTestBlob->blobSize, &blobChecksum) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Test_RegsEqual() == TRUE);
+    CTE_HOST_CHECK(blobChecksum == lutChecksum);
+    /* the errors                                                                                                   */
+    CTE_HOST_CHECK(Cte_UpdateTablesBlob(gspTestBlob, gspTestBlob->blobSize, NULL_PTR)
+                   == RSDK_CTE_DRV_NULL_PTR_PARAMS);
+    CTE_HOST_CHECK(Cte_Start() == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Cte_UpdateTablesBlob(gspTestBlob, gspTestBlob->blobSize, &blobChecksum) == RSDK_CTE_DRV_RUNNING);
+    CTE_HOST_CHECK(Cte_Stop() == (Std_ReturnType)E_OK);
+    Test_BlobBuild(&gsTestTabB, NULL_PTR, TRUE);        /* the outputs of the setup are used                */
+    CTE_HOST_CHECK(Cte_UpdateTablesBlob(gspTestBlob, gspTestBlob->blobSize, &blobChecksum) == TEST_WRG_FORMAT);
+    Test_BlobBuild(&gsTestTabSlow, NULL_PTR, FALSE);    /* a larger clock divider than the setup one        */
+    CTE_HOST_CHECK(Cte_UpdateTablesBlob(gspTestBlob, gspTestBlob->blobSize, &blobChecksum)
+                   == RSDK_CTE_DRV_CLK_DIVIDER_ERROR);
+    Test_BlobBuild(&gsTestTabB, NULL_PTR, FALSE);
+    Test_BlobActions()[1].outputSignal = (uint8)CTE_OUTPUT_CTEP_2;     /* not defined by the setup         */
+    CTE_HOST_CHECK(Cte_UpdateTablesBlob(gspTestBlob, gspTestBlob->blobSize, &blobChecksum)
+                   == RSDK_CTE_DRV_SIG_NOT_DEF);
+    CTE_HOST_CHECK(Test_RegsEqual() == TRUE);           /* the LUT is not changed by a refused blob         */
+    /* the layout of the setup : two tables                                                                         */
+    Test_ParamsSet(&gsTestTabA, &gsTestTabB);
+    CTE_HOST_CHECK(Cte_Setup(&gsTestParams, &lutChecksum) == (Std_ReturnType)E_OK);
+    Test_BlobBuild(&gsTestTabB, NULL_PTR, FALSE);
+    CTE_HOST_CHECK(Cte_UpdateTablesBlob(gspTestBlob, gspTestBlob->blobSize, &blobChecksum)
+                   == RSDK_CTE_DRV_WRG_PTR_TABLE1);
+    Test_BlobBuild(&gsTestTabB, &gsTestTabA, FALSE);
+    CTE_HOST_CHECK(Cte_UpdateTablesBlob(gspTestBlob, gspTestBlob->blobSize, &blobChecksum) == (Std_ReturnType)E_OK);
+}
+
+/*==================================================================================================
+*                                        GLOBAL FUNCTIONS
+==================================================================================================*/
+int main(void)
+{
+    Test_TableBuild(&gsTestTabA, 8u, 2000u, 20000u);
+    Test_TableBuild(&gsTestTabB, 12u, 1500u, 25000u);
+    Test_TableBuild(&gsTestTabLong, 40u, 1000u, 45000u);
+    Test_TableBuild(&gsTestTabSlow, 4u, 2000000u, 0u);
+    Test_SetupEqual();
+    Test_BadHeader();
+    Test_BadOutputs();
+    Test_BadEvents();
+    Test_Update();
+    (void)printf("Cte_TestBlob : %s (%u failed checks)\n", (gCteHostFails == 0u) ? "PASS" : "FAIL",
+                 (unsigned)gCteHostFails);
+    return (gCteHostFails == 0u) ? 0 : 1;
+}
@@ -0,0 +1,296 @@
+/*
+ * Copyright 2023 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <string.h>
+#include "Cte_HostModel.h"
+
+/*==================================================================================================
+*                                          LOCAL MACROS
+==================================================================================================*/
+#define TEST_MAX_EVENTS     64u
+#define TEST_ACTIONS        3u                  /* SPT_0, CTEP_0 and the list end                   */
+#define TEST_CLOCK_FREQ     CTE_DEFAULT_INPUT_CLOCK
+
+/*==================================================================================================
+*                                  LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+/* a time table, with its events and actions                                                        */
+typedef struct {
+    Cte_TimeTableDefType    table;
+    Cte_TimingEventType     events[TEST_MAX_EVENTS];
+    Cte_ActionType          actions[TEST_MAX_EVENTS][TEST_ACTIONS];
+} Test_TableType;
+
+/*==================================================================================================
+*                                         LOCAL VARIABLES
+==================================================================================================*/
+static Cte_SingleOutputDefType  gsTestOutputs[] = {
+    { CTE_OUTPUT_SPT_0, CTE_OUT_TOGGLE, 0u },
+    { CTE_OUTPUT_CTEP_0, CTE_OUT_LOGIC, 0u },
+    { CTE_OUTPUT_CTEP_1, CTE_OUT_LOGIC, 0u },
+    { CTE_OUTPUT_MAX, CTE_OUT_HIZ, 0u }
+};
+static Cte_SetupParamsType      gsTestParams;
+static Test_TableType           gsTestTabA, gsTestTabB, gsTestTabLong;
+static Cte_LutImageType         gsTestImgA, gsTestImgB, gsTestImg;
+
+/*==================================================================================================
+*                                         LOCAL FUNCTIONS
+==================================================================================================*/
+/*================================================================================================*/
+/*
+ * @brief       Build a table : an event each period, SPT_0 flipped and CTEP_0 alternated at each event.
+ *
+ */
+static void Test_TableBuild(Test_TableType *pTab, const uint32 eventsNr, const uint32 period, const uint32 timeLimit)
+{
+    uint32  i;
+
+    for (i = 0u; i < eventsNr; i++)
+    {
+        pTab->actions[i][0].outputSignal = CTE_OUTPUT_SPT_0;
+        pTab->actions[i][0].cteOutputSignalType.newToggleState = CTE_TOGGLE_FLIP;
+        pTab->actions[i][1].outputSignal = CTE_OUTPUT_CTEP_0;
+        pTab->actions[i][1].cteOutputSignalType.newLogicState = ((i & 1u) == 0u) ? CTE_LOGIC_SET_TO_HIGH :
+                                                                                  CTE_LOGIC_SET_TO_LOW;
+        pTab->actions[i][2].outputSignal = CTE_OUTPUT_MAX;
+        pTab->events[i].absTime = period * (i + 1u);
+        pTab->events[i].eventActionsPtr = pTab->actions[i];
+    }
+    pTab->table.tableLength = (uint8)eventsNr;
+    pTab->table.tableTimeExecLimit = timeLimit;
+    pTab->table.eventsPtr = pTab->events;
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Set up the CTE in master mode, with a single table.
+ *
+ */
+static Std_ReturnType Test_Setup(Test_TableType *pTab, const uint32 clockFreq, uint64 *pLutChecksum)
+{
+    CteHost_ModelReset();
+    (void)memset(&gsTestParams, 0, sizeof(gsTestParams));
+    gsTestParams.cteMode.workingMode = CTE_MASTER;
+    gsTestParams.cteClockFrecq = clockFreq;
+    gsTestParams.signalDef0Ptr = gsTestOutputs;
+    gsTestParams.timeTable0Ptr = &pTab->table;
+    return Cte_Setup(&gsTestParams, pLutChecksum);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Check a LUT part of the registry against the same part of an image.
+ *
+ */
+static boolean Test_LutPartEqual(const Cte_LutImageType *pImg, const uint32 part)
+{
+    uint32  i;
+    boolean rez = TRUE;
+
+    for (i = 0u; i < CTE_LUT_LUT_LSB_COUNT; i++)
+    {
+        if ((gCteRegsModel.LUT[part].LSB[i] != pImg->lutParts[part].lsbWords[i]) ||
+            (gCteRegsModel.LUT[part].MSB[i] != pImg->lutParts[part].msbWords[i]))
+        {
+            rez = FALSE;
+        }
+    }
+    return rez;
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Compile : the image has the LUT written by Cte_Setup for the same table, the hash depends only on
+ *              the tables.
+ *
+ */
+static void Test_Compile(void)
+{
+    uint64  lutChecksum;
+
+    CTE_HOST_CHECK(Cte_LutImageCompile(&gsTestTabA.table, NULL_PTR, &gsTestImgA) == RSDK_CTE_DRV_NOT_INITIALIZED);
+    CTE_HOST_CHECK(Test_Setup(&gsTestTabA, TEST_CLOCK_FREQ, &lutChecksum) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Cte_LutImageCompile(&gsTestTabA.table, NULL_PTR, &gsTestImgA) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(gsTestImgA.imageVersion == CTE_LUT_IMAGE_VERSION);
+    CTE_HOST_CHECK(gsTestImgA.lutPartsNr == 1u);
+    CTE_HOST_CHECK(gsTestImgA.lutDuration[0] == gCteRegsModel.LUT_DUR);
+    CTE_HOST_CHECK(gsTestImgA.lutChecksum == 0u);
+    CTE_HOST_CHECK(Test_LutPartEqual(&gsTestImgA, 0u) == TRUE);
+    /* the same tables give the same image, other tables another one                                                */
+    CTE_HOST_CHECK(Cte_LutImageCompile(&gsTestTabA.table, NULL_PTR, &gsTestImg) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(memcmp(&gsTestImg, &gsTestImgA, sizeof(gsTestImg)) == 0);
+    CTE_HOST_CHECK(Cte_LutImageCompile(&gsTestTabB.table, NULL_PTR, &gsTestImgB) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(gsTestImgB.contentHash != gsTestImgA.contentHash);
+    CTE_HOST_CHECK(gsTestImgB.setupHash == gsTestImgA.setupHash);
+    /* the layout of the setup is kept : no second table                                                            */
+    CTE_HOST_CHECK(Cte_LutImageCompile(&gsTestTabA.table, &gsTestTabB.table, &gsTestImg) ==
+                   RSDK_CTE_DRV_WRG_PTR_TABLE1);
+    CTE_HOST_CHECK(Cte_LutImageCompile(&gsTestTabA.table, NULL_PTR, NULL_PTR) == RSDK_CTE_DRV_NULL_PTR_PARAMS);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Register & load : the loaded image is the registry LUT; the checksum is recorded at the first load
+ *              and checked at the next ones.
+ *
+ */
+static void Test_RegisterLoad(void)
+{
+    uint64  hashA, hashB, hash, lutChecksum;
+
+    CTE_HOST_CHECK(Test_Setup(&gsTestTabA, TEST_CLOCK_FREQ, &lutChecksum) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Cte_LutImageRegister(&gsTestImgA, &hashA) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(hashA == gsTestImgA.contentHash);
+    CTE_HOST_CHECK(Cte_LutImageRegister(&gsTestImgB, &hashB) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(hashB == gsTestImgB.contentHash);
+    CTE_HOST_CHECK(Cte_LutImageRegister(&gsTestImgA, &hash) == (Std_ReturnType)E_OK);   /* already registered   */
+    CTE_HOST_CHECK(hash == hashA);
+    /* the first load records the checksum                                                                          */
+    CteHost_LutChecksumSet(0x12345678abull);
+    CTE_HOST_CHECK(Cte_LutImageLoad(hashB, &lutChecksum) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(lutChecksum == 0x12345678abull);
+    CTE_HOST_CHECK(Test_LutPartEqual(&gsTestImgB, 0u) == TRUE);
+    CTE_HOST_CHECK(gCteRegsModel.LUT_DUR == gsTestImgB.lutDuration[0]);
+    CTE_HOST_CHECK((gCteRegsModel.CNTRL & CTE_CNTRL_OPMOD_SL_MASK) == CTE_CNTRL_OPMOD_SL(2u));
+    CteHost_LutChecksumSet(0x2222222222ull);
+    CTE_HOST_CHECK(Cte_LutImageLoad(hashA, &lutChecksum) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Test_LutPartEqual(&gsTestImgA, 0u) == TRUE);
+    /* the next loads : the same checksum is expected                                                               */
+    CteHost_LutChecksumSet(0x12345678abull);
+    CTE_HOST_CHECK(Cte_LutImageLoad(hashB, &lutChecksum) == (Std_ReturnType)E_OK);
+    CteHost_LutChecksumSet(0x12345678acull);
+    CTE_HOST_CHECK(Cte_LutImageLoad(hashB, &lutChecksum) == RSDK_CTE_DRV_LUT_CHECKSUM_ERROR);
+    CTE_HOST_CHECK(lutChecksum == 0x12345678acull);
+    CteHost_LutChecksumSet(0x2222222222ull);
+    CTE_HOST_CHECK(Cte_LutImageLoad(hashA, &lutChecksum) == (Std_ReturnType)E_OK);
+    /* the CTE state and the parameters                                                                             */
+    CTE_HOST_CHECK(Cte_LutImageLoad(hashA, NULL_PTR) == RSDK_CTE_DRV_NULL_PTR_PARAMS);
+    CTE_HOST_CHECK(Cte_LutImageLoad(hashA ^ 1u, &lutChecksum) == RSDK_CTE_DRV_LUT_IMAGE_NOT_FOUND);
+    CTE_HOST_CHECK(Cte_Start() == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Cte_LutImageLoad(hashA, &lutChecksum) == RSDK_CTE_DRV_RUNNING);
+    CTE_HOST_CHECK(Cte_Stop() == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Test_Setup(&gsTestTabA, TEST_CLOCK_FREQ, NULL_PTR) == RSDK_CTE_DRV_NULL_PTR_PARAMS);
+    CTE_HOST_CHECK(Cte_LutImageLoad(hashA, &lutChecksum) == RSDK_CTE_DRV_NOT_INITIALIZED);
+    CTE_HOST_CHECK(Cte_LutImageRemove(hashA) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Cte_LutImageRemove(hashB) == (Std_ReturnType)E_OK);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       A single table longer than a LUT part : both parts and LUT_DUR1 are loaded, in toggle run mode.
+ *
+ */
+static void Test_LongTable(void)
+{
+    uint64  hash, lutChecksum;
+
+    CTE_HOST_CHECK(Test_Setup(&gsTestTabA, TEST_CLOCK_FREQ, &lutChecksum) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Cte_LutImageCompile(&gsTestTabLong.table, NULL_PTR, &gsTestImg) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(gsTestImg.lutPartsNr == 2u);
+    CTE_HOST_CHECK(gsTestImg.lutDuration[0] == 0u);
+    CTE_HOST_CHECK(gsTestImg.lutDuration[1] != 0u);
+    CTE_HOST_CHECK(Cte_LutImageRegister(&gsTestImg, &hash) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Cte_LutImageLoad(hash, &lutChecksum) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Test_LutPartEqual(&gsTestImg, 0u) == TRUE);
+    CTE_HOST_CHECK(Test_LutPartEqual(&gsTestImg, 1u) == TRUE);
+    CTE_HOST_CHECK(gCteRegsModel.LUT_DUR == 0u);
+    CTE_HOST_CHECK(gCteRegsModel.LUT_DUR1 == gsTestImg.lutDuration[1]);
+    CTE_HOST_CHECK((gCteRegsModel.CNTRL & CTE_CNTRL_OPMOD_SL_MASK) == CTE_CNTRL_OPMOD_SL(3u));
+    CTE_HOST_CHECK(gCteRegsModel.SIGTYPE0[1] == gCteRegsModel.SIGTYPE0[0]);     /* the table 0 outputs      */
+    /* the same LUT as the setup of the long table                                                                  */
+    CTE_HOST_CHECK(Test_Setup(&gsTestTabLong, TEST_CLOCK_FREQ, &lutChecksum) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Test_LutPartEqual(&gsTestImg, 0u) == TRUE);
+    CTE_HOST_CHECK(Test_LutPartEqual(&gsTestImg, 1u) == TRUE);
+    CTE_HOST_CHECK(Cte_LutImageRemove(hash) == (Std_ReturnType)E_OK);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       The images not valid are refused, the images of another setup are not loaded.
+ *
+ */
+static void Test_BadImages(void)
+{
+    uint64  hash, lutChecksum;
+
+    CTE_HOST_CHECK(Test_Setup(&gsTestTabA, TEST_CLOCK_FREQ, &lutChecksum) == (Std_ReturnType)E_OK);
+    gsTestImg = gsTestImgA;
+    gsTestImg.lutParts[0].lsbWords[3] ^= 1u;                                /* content changed          */
+    CTE_HOST_CHECK(Cte_LutImageRegister(&gsTestImg, &hash) == RSDK_CTE_DRV_LUT_IMAGE_WRG);
+    gsTestImg = gsTestImgA;
+    gsTestImg.imageVersion = CTE_LUT_IMAGE_VERSION + 1u;
+    CTE_HOST_CHECK(Cte_LutImageRegister(&gsTestImg, &hash) == RSDK_CTE_DRV_LUT_IMAGE_WRG);
+    gsTestImg = gsTestImgA;
+    gsTestImg.lutPartsNr = 0u;
+    CTE_HOST_CHECK(Cte_LutImageRegister(&gsTestImg, &hash) == RSDK_CTE_DRV_LUT_IMAGE_WRG);
+    gsTestImg.lutPartsNr = (uint8)(CTE_LUT_COUNT + 1u);
+    CTE_HOST_CHECK(Cte_LutImageRegister(&gsTestImg, &hash) == RSDK_CTE_DRV_LUT_IMAGE_WRG);
+    CTE_HOST_CHECK(Cte_LutImageRegister(NULL_PTR, &hash) == RSDK_CTE_DRV_NULL_PTR_PARAMS);
+    CTE_HOST_CHECK(Cte_LutImageRegister(&gsTestImgA, NULL_PTR) == RSDK_CTE_DRV_NULL_PTR_PARAMS);
+    /* an image is valid only for the setup it was compiled for : the clock, then the outputs                       */
+    CTE_HOST_CHECK(Cte_LutImageRegister(&gsTestImgA, &hash) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Test_Setup(&gsTestTabA, TEST_CLOCK_FREQ / 2u, &lutChecksum) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Cte_LutImageLoad(hash, &lutChecksum) == RSDK_CTE_DRV_LUT_IMAGE_STALE);
+    gsTestOutputs[2].signalType = CTE_OUT_TOGGLE;
+    CTE_HOST_CHECK(Test_Setup(&gsTestTabA, TEST_CLOCK_FREQ, &lutChecksum) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Cte_LutImageLoad(hash, &lutChecksum) == RSDK_CTE_DRV_LUT_IMAGE_STALE);
+    gsTestOutputs[2].signalType = CTE_OUT_LOGIC;
+    CTE_HOST_CHECK(Test_Setup(&gsTestTabA, TEST_CLOCK_FREQ, &lutChecksum) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Cte_LutImageLoad(hash, &lutChecksum) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Cte_LutImageRemove(hash) == (Std_ReturnType)E_OK);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       The cache : CTE_LUT_IMAGE_CACHE_SIZE images, a removed slot is used again.
+ *
+ */
+static void Test_Cache(void)
+{
+    uint64  hash[CTE_LUT_IMAGE_CACHE_SIZE + 1u], lutChecksum;
+    uint32  i;
+
+    CTE_HOST_CHECK(Test_Setup(&gsTestTabA, TEST_CLOCK_FREQ, &lutChecksum) == (Std_ReturnType)E_OK);
+    for (i = 0u; i <= CTE_LUT_IMAGE_CACHE_SIZE; i++)
+    {
+        Test_TableBuild(&gsTestTabB, 8u, 1000u + (i * 100u), 0u);
+        CTE_HOST_CHECK(Cte_LutImageCompile(&gsTestTabB.table, NULL_PTR, &gsTestImg) == (Std_ReturnType)E_OK);
+        CTE_HOST_CHECK(Cte_LutImageRegister(&gsTestImg, &hash[i]) ==
+                       ((i < CTE_LUT_IMAGE_CACHE_SIZE) ? (Std_ReturnType)E_OK : RSDK_CTE_DRV_LUT_CACHE_FULL));
+    }
+    CTE_HOST_CHECK(Cte_LutImageRemove(hash[2]) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Cte_LutImageRemove(hash[2]) == RSDK_CTE_DRV_LUT_IMAGE_NOT_FOUND);
+    CTE_HOST_CHECK(Cte_LutImageLoad(hash[2], &lutChecksum) == RSDK_CTE_DRV_LUT_IMAGE_NOT_FOUND);
+    CTE_HOST_CHECK(Cte_LutImageRegister(&gsTestImg, &hash[2]) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Cte_LutImageLoad(hash[2], &lutChecksum) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Test_LutPartEqual(&gsTestImg, 0u) == TRUE);
+    for (i = 0u; i < CTE_LUT_IMAGE_CACHE_SIZE; i++)
+    {
+        CTE_HOST_CHECK(Cte_LutImageRemove(hash[i]) == (Std_ReturnType)E_OK);
+    }
+}
+
+/*==================================================================================================
+*                                        GLOBAL FUNCTIONS
+==================================================================================================*/
+int main(void)
+{
+    Test_TableBuild(&gsTestTabA, 8u, 2000u, 20000u);
+    Test_TableBuild(&gsTestTabB, 8u, 2500u, 25000u);
+    Test_TableBuild(&gsTestTabLong, 40u, 1000u, 45000u);
+    Test_Compile();
+    Test_RegisterLoad();
+    Test_LongTable();
+    Test_BadImages();
+    Test_Cache();
+    (void)printf("Cte_TestLutImage : %s (%u failed checks)\n", (gCteHostFails == 0u) ? "PASS" : "FAIL",
+                 (unsigned)gCteHostFails);
+    return (gCteHostFails == 0u) ? 0 : 1;
+}
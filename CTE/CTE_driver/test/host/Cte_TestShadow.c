@@ -0,0 +1,275 @@
+/*
+ * Copyright 2023 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <string.h>
+#include "Cte_HostModel.h"
+
+/*==================================================================================================
+*                                          LOCAL MACROS
+==================================================================================================*/
+#define TEST_MAX_EVENTS     64u
+#define TEST_ACTIONS        3u                  /* SPT_0, CTEP_0 and the list end                   */
+#define TEST_CLOCK_FREQ     CTE_DEFAULT_INPUT_CLOCK
+#define TEST_SW_EVENTS      ((uint32)CTE_IRQ_TABLES_UPDATED | (uint32)CTE_IRQ_TABLES_TORN)
+#define TEST_END_IRQS       ((uint32)CTE_IRQ_TT0_END | (uint32)CTE_IRQ_TT1_END | (uint32)CTE_IRQ_TABLE_EXEC_END)
+
+/*==================================================================================================
+*                                  LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+/* a time table, with its events and actions                                                        */
+typedef struct {
+    Cte_TimeTableDefType    table;
+    Cte_TimingEventType     events[TEST_MAX_EVENTS];
+    Cte_ActionType          actions[TEST_MAX_EVENTS][TEST_ACTIONS];
+} Test_TableType;
+
+/*==================================================================================================
+*                                         LOCAL VARIABLES
+==================================================================================================*/
+static Cte_SingleOutputDefType  gsTestOutputs[] = {
+    { CTE_OUTPUT_SPT_0, CTE_OUT_TOGGLE, 0u },
+    { CTE_OUTPUT_CTEP_0, CTE_OUT_LOGIC, 0u },
+    { CTE_OUTPUT_MAX, CTE_OUT_HIZ, 0u }
+};
+static Cte_SetupParamsType      gsTestParams;
+static Test_TableType           gsTestTabA, gsTestTabB, gsTestTabLong;
+static Cte_LutImageType         gsTestImgOld, gsTestImgNew;
+static uint32                   gsTestCalls, gsTestEvents;
+
+/*==================================================================================================
+*                                         LOCAL FUNCTIONS
+==================================================================================================*/
+static void Test_Callback(uint32 cteIrqReport)
+{
+    gsTestCalls++;
+    gsTestEvents |= cteIrqReport;
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Build a table : an event each period, SPT_0 flipped and CTEP_0 alternated at each event.
+ *
+ */
+static void Test_TableBuild(Test_TableType *pTab, const uint32 eventsNr, const uint32 period, const uint32 timeLimit)
+{
+    uint32  i;
+
+    for (i = 0u; i < eventsNr; i++)
+    {
+        pTab->actions[i][0].outputSignal = CTE_OUTPUT_SPT_0;
+        pTab->actions[i][0].cteOutputSignalType.newToggleState = CTE_TOGGLE_FLIP;
+        pTab->actions[i][1].outputSignal = CTE_OUTPUT_CTEP_0;
+        pTab->actions[i][1].cteOutputSignalType.newLogicState = ((i & 1u) == 0u) ? CTE_LOGIC_SET_TO_HIGH :
+                                                                                  CTE_LOGIC_SET_TO_LOW;
+        pTab->actions[i][2].outputSignal = CTE_OUTPUT_MAX;
+        pTab->events[i].absTime = period * (i + 1u);
+        pTab->events[i].eventActionsPtr = pTab->actions[i];
+    }
+    pTab->table.tableLength = (uint8)eventsNr;
+    pTab->table.tableTimeExecLimit = timeLimit;
+    pTab->table.eventsPtr = pTab->events;
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Set up the CTE in master mode, with one or two tables and only the software events requested;
+ *              the images of the old and of the new tables are compiled for the checks.
+ *
+ */
+static Std_ReturnType Test_Setup(Test_TableType *pTab0, Test_TableType *pTab1, Test_TableType *pNew0,
+                                 Test_TableType *pNew1)
+{
+    Cte_TimeTableDefType    *pTable1 = (pTab1 == NULL_PTR) ? NULL_PTR : &pTab1->table;
+    Cte_TimeTableDefType    *pNewTable1 = (pNew1 == NULL_PTR) ? NULL_PTR : &pNew1->table;
+    uint64                  lutChecksum;
+    Std_ReturnType          rez;
+
+    CteHost_ModelReset();
+    (void)memset(&gsTestParams, 0, sizeof(gsTestParams));
+    gsTestParams.cteMode.workingMode = CTE_MASTER;
+    gsTestParams.cteClockFrecq = TEST_CLOCK_FREQ;
+    gsTestParams.signalDef0Ptr = gsTestOutputs;
+    gsTestParams.timeTable0Ptr = &pTab0->table;
+    gsTestParams.signalDef1Ptr = (pTab1 == NULL_PTR) ? NULL_PTR : gsTestOutputs;
+    gsTestParams.timeTable1Ptr = pTable1;
+    gsTestParams.cteIrqEvents = (Cte_IrqDefinitionType)TEST_SW_EVENTS;
+    gsTestParams.pCteCallback = Test_Callback;
+    gsTestCalls = 0u;
+    gsTestEvents = 0u;
+    rez = Cte_Setup(&gsTestParams, &lutChecksum);
+    if (rez == (Std_ReturnType)E_OK)
+    {
+        rez = Cte_LutImageCompile(&pTab0->table, pTable1, &gsTestImgOld);
+    }
+    if (rez == (Std_ReturnType)E_OK)
+    {
+        rez = Cte_LutImageCompile(&pNew0->table, pNewTable1, &gsTestImgNew);
+    }
+    return rez;
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Check a LUT part of the registry against the same part of an image.
+ *
+ */
+static boolean Test_LutPartEqual(const Cte_LutImageType *pImg, const uint32 part)
+{
+    uint32  i;
+    boolean rez = TRUE;
+
+    for (i = 0u; i < CTE_LUT_LUT_LSB_COUNT; i++)
+    {
+        if ((gCteRegsModel.LUT[part].LSB[i] != pImg->lutParts[part].lsbWords[i]) ||
+            (gCteRegsModel.LUT[part].MSB[i] != pImg->lutParts[part].msbWords[i]))
+        {
+            rez = FALSE;
+        }
+    }
+    return rez;
+}
+
+/*================================================================================================*/
+/*
+ * @brief       CTE not running : the update is written at once, without any irq.
+ *
+ */
+static void Test_NotRunning(void)
+{
+    uint64  lutChecksum = 0u;
+
+    CTE_HOST_CHECK(Cte_UpdateTablesShadow(&gsTestTabB.table, NULL_PTR) == RSDK_CTE_DRV_NOT_INITIALIZED);
+    CTE_HOST_CHECK(Test_Setup(&gsTestTabA, NULL_PTR, &gsTestTabB, NULL_PTR) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Test_LutPartEqual(&gsTestImgOld, 0u) == TRUE);
+    CteHost_LutChecksumSet(0x1111111111ull);
+    CTE_HOST_CHECK(Cte_UpdateTablesShadow(&gsTestTabB.table, NULL_PTR) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Test_LutPartEqual(&gsTestImgNew, 0u) == TRUE);
+    CTE_HOST_CHECK(gCteRegsModel.LUT_DUR == gsTestImgNew.lutDuration[0]);
+    CTE_HOST_CHECK(Cte_UpdateTablesShadowStatus(&lutChecksum) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(lutChecksum == 0x1111111111ull);
+    CTE_HOST_CHECK(gCteRegsModel.INTEN == 0u);                  /* the table end irqs released      */
+    CTE_HOST_CHECK(gsTestCalls == 0u);
+    /* the LUT layout and the tables                                                                                */
+    CTE_HOST_CHECK(Cte_UpdateTablesShadow(&gsTestTabLong.table, NULL_PTR) == RSDK_CTE_DRV_UPDATE_WRG_LAYOUT);
+    CTE_HOST_CHECK(Cte_UpdateTablesShadow(&gsTestTabA.table, &gsTestTabB.table) == RSDK_CTE_DRV_WRG_PTR_TABLE1);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       CTE running, one LUT part : the update waits for a table end without a new start of the table.
+ *
+ */
+static void Test_OnePart(void)
+{
+    uint64  lutChecksum = 0u;
+
+    CTE_HOST_CHECK(Test_Setup(&gsTestTabA, NULL_PTR, &gsTestTabB, NULL_PTR) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Cte_Start() == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Cte_UpdateTablesShadow(&gsTestTabB.table, NULL_PTR) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Cte_UpdateTablesShadowStatus(&lutChecksum) == RSDK_CTE_DRV_UPDATE_PENDING);
+    CTE_HOST_CHECK(Cte_UpdateTablesShadow(&gsTestTabA.table, NULL_PTR) == RSDK_CTE_DRV_UPDATE_PENDING);
+    CTE_HOST_CHECK(gCteRegsModel.INTEN == ((uint32)CTE_IRQ_TT0_END | (uint32)CTE_IRQ_TABLE_EXEC_END));
+    CTE_HOST_CHECK(Test_LutPartEqual(&gsTestImgOld, 0u) == TRUE);
+    /* a start alone is not enabled; with the end in the same status, the table runs again, so it is not changed    */
+    CTE_HOST_CHECK(CteHost_RaiseIrq((uint32)CTE_IRQ_TT0_START) == FALSE);
+    CTE_HOST_CHECK(CteHost_RaiseIrq((uint32)CTE_IRQ_TT0_END) == TRUE);
+    CTE_HOST_CHECK(Test_LutPartEqual(&gsTestImgOld, 0u) == TRUE);
+    CTE_HOST_CHECK(Cte_UpdateTablesShadowStatus(&lutChecksum) == RSDK_CTE_DRV_UPDATE_PENDING);
+    CTE_HOST_CHECK(gsTestCalls == 0u);
+    /* the table end : the new LUT, the update reported with its checksum                                          */
+    CteHost_LutChecksumSet(0x2222222222ull);
+    CTE_HOST_CHECK(CteHost_RaiseIrq((uint32)CTE_IRQ_TT0_END) == TRUE);
+    CTE_HOST_CHECK(Test_LutPartEqual(&gsTestImgNew, 0u) == TRUE);
+    CTE_HOST_CHECK(gCteRegsModel.LUT_DUR == gsTestImgNew.lutDuration[0]);
+    CTE_HOST_CHECK(gsTestCalls == 1u);
+    CTE_HOST_CHECK(gsTestEvents == (uint32)CTE_IRQ_TABLES_UPDATED);
+    CTE_HOST_CHECK(gCteRegsModel.INTEN == 0u);
+    CteHost_LutChecksumSet(0x3333333333ull);
+    CTE_HOST_CHECK(Cte_UpdateTablesShadowStatus(&lutChecksum) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(lutChecksum == 0x2222222222ull);              /* the checksum after the update    */
+    CTE_HOST_CHECK(CteHost_RaiseIrq((uint32)CTE_IRQ_TT0_END) == FALSE);
+    CTE_HOST_CHECK(Cte_Stop() == (Std_ReturnType)E_OK);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       CTE running, two tables : each LUT part is written at the end of its own table.
+ *
+ */
+static void Test_TwoParts(void)
+{
+    CTE_HOST_CHECK(Test_Setup(&gsTestTabA, &gsTestTabB, &gsTestTabB, &gsTestTabA) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Cte_Start() == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Cte_UpdateTablesShadow(&gsTestTabB.table, NULL_PTR) == RSDK_CTE_DRV_WRG_PTR_TABLE1);
+    CTE_HOST_CHECK(Cte_UpdateTablesShadow(&gsTestTabB.table, &gsTestTabA.table) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(gCteRegsModel.INTEN == TEST_END_IRQS);
+    /* table 1 restarted in the same status : nothing written; then only the part 0                                */
+    CTE_HOST_CHECK(CteHost_RaiseIrq((uint32)CTE_IRQ_TT1_START | (uint32)CTE_IRQ_TT1_END) == TRUE);
+    CTE_HOST_CHECK(Test_LutPartEqual(&gsTestImgOld, 1u) == TRUE);
+    CTE_HOST_CHECK(CteHost_RaiseIrq((uint32)CTE_IRQ_TT0_END) == TRUE);
+    CTE_HOST_CHECK(Test_LutPartEqual(&gsTestImgNew, 0u) == TRUE);
+    CTE_HOST_CHECK(Test_LutPartEqual(&gsTestImgOld, 1u) == TRUE);
+    CTE_HOST_CHECK(gCteRegsModel.LUT_DUR1 == gsTestImgOld.lutDuration[1]);
+    CTE_HOST_CHECK(gsTestCalls == 0u);
+    CTE_HOST_CHECK(Cte_UpdateTablesShadowStatus(NULL_PTR) == RSDK_CTE_DRV_UPDATE_PENDING);
+    CTE_HOST_CHECK(CteHost_RaiseIrq((uint32)CTE_IRQ_TT0_END) == TRUE);           /* part 0 is written once   */
+    CTE_HOST_CHECK(gsTestCalls == 0u);
+    CTE_HOST_CHECK(CteHost_RaiseIrq((uint32)CTE_IRQ_TT1_END) == TRUE);
+    CTE_HOST_CHECK(Test_LutPartEqual(&gsTestImgNew, 1u) == TRUE);
+    CTE_HOST_CHECK(gCteRegsModel.LUT_DUR1 == gsTestImgNew.lutDuration[1]);
+    CTE_HOST_CHECK(gsTestCalls == 1u);
+    CTE_HOST_CHECK(gsTestEvents == (uint32)CTE_IRQ_TABLES_UPDATED);
+    CTE_HOST_CHECK(gCteRegsModel.INTEN == 0u);
+    CTE_HOST_CHECK(Cte_UpdateTablesShadowStatus(NULL_PTR) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Cte_Stop() == (Std_ReturnType)E_OK);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       The table execution end writes all the parts; a table start seen after the writes is reported as a
+ *              torn update. The irqs requested by the application are kept.
+ *
+ */
+static void Test_TornAndStop(void)
+{
+    CTE_HOST_CHECK(Test_Setup(&gsTestTabA, &gsTestTabB, &gsTestTabB, &gsTestTabA) == (Std_ReturnType)E_OK);
+    gCteRegsModel.INTEN = (uint32)CTE_IRQ_TT0_END;      /* as if requested at setup                         */
+    CTE_HOST_CHECK(Cte_Start() == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Cte_UpdateTablesShadow(&gsTestTabB.table, &gsTestTabA.table) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(CteHost_RaiseIrq((uint32)CTE_IRQ_TABLE_EXEC_END | (uint32)CTE_IRQ_TT0_START) == TRUE);
+    CTE_HOST_CHECK(Test_LutPartEqual(&gsTestImgNew, 0u) == TRUE);
+    CTE_HOST_CHECK(Test_LutPartEqual(&gsTestImgNew, 1u) == TRUE);
+    CTE_HOST_CHECK(gsTestCalls == 1u);
+    CTE_HOST_CHECK(gsTestEvents == TEST_SW_EVENTS);
+    CTE_HOST_CHECK(gCteRegsModel.INTEN == (uint32)CTE_IRQ_TT0_END);
+    /* a pending update is written by the stop, no table end will come                                             */
+    CTE_HOST_CHECK(Cte_UpdateTablesShadow(&gsTestTabA.table, &gsTestTabB.table) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Cte_Stop() == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(Test_LutPartEqual(&gsTestImgOld, 0u) == TRUE);
+    CTE_HOST_CHECK(Test_LutPartEqual(&gsTestImgOld, 1u) == TRUE);
+    CTE_HOST_CHECK(Cte_UpdateTablesShadowStatus(NULL_PTR) == (Std_ReturnType)E_OK);
+    CTE_HOST_CHECK(gCteRegsModel.INTEN == (uint32)CTE_IRQ_TT0_END);
+}
+
+/*==================================================================================================
+*                                        GLOBAL FUNCTIONS
+==================================================================================================*/
+int main(void)
+{
+    Test_TableBuild(&gsTestTabA, 8u, 2000u, 20000u);
+    Test_TableBuild(&gsTestTabB, 12u, 1500u, 25000u);
+    Test_TableBuild(&gsTestTabLong, 40u, 1000u, 45000u);
+    Test_NotRunning();
+    Test_OnePart();
+    Test_TwoParts();
+    Test_TornAndStop();
+    (void)printf("Cte_TestShadow : %s (%u failed checks)\n", (gCteHostFails == 0u) ? "PASS" : "FAIL",
+                 (unsigned)gCteHostFails);
+    return (gCteHostFails == 0u) ? 0 : 1;
+}
@@ -0,0 +1,226 @@
+/*
+ * Copyright 2023 NXP
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <string.h>
+#include "Cte_HostModel.h"
+
+/*==================================================================================================
+*                                          LOCAL MACROS
+==================================================================================================*/
+#define TEST_EVENTS_NR      4u
+#define TEST_TT0_END_BIT    2u                  /* the statistics index of CTE_IRQ_TT0_END                          */
+#define TEST_TT1_END_BIT    3u                  /* the statistics index of CTE_IRQ_TT1_END                          */
+#define TEST_REQ_EVENTS     ((uint32)CTE_IRQ_TT0_END | (uint32)CTE_IRQ_TT1_END)
+
+/*==================================================================================================
+*                                         LOCAL VARIABLES
+==================================================================================================*/
+static Cte_SingleOutputDefType  gsTestOutputs[] = {
+    { CTE_OUTPUT_CTEP_0, CTE_OUT_LOGIC, 0u },
+    { CTE_OUTPUT_MAX, CTE_OUT_HIZ, 0u }
+};
+static Cte_ActionType           gsTestActions[TEST_EVENTS_NR][2];
+static Cte_TimingEventType      gsTestEvents[TEST_EVENTS_NR];
+static Cte_TimeTableDefType     gsTestTable;
+static Cte_SetupParamsType      gsTestParams;
+static uint64                   gsTestServiceTicks;     /* the time spent by the callback                   */
+static uint32                   gsTestCalls;
+
+/*==================================================================================================
+*                                         LOCAL FUNCTIONS
+==================================================================================================*/
+static void Test_Callback(uint32 cteIrqReport)
+{
+    (void)cteIrqReport;
+    gsTestCalls++;
+    CteHost_TimeAdvance(gsTestServiceTicks);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Set up the CTE with a small table, the table ends requested with a callback.
+ *
+ */
+static Std_ReturnType Test_Setup(void)
+{
+    uint32  i;
+    uint64  lutChecksum;
+
+    for (i = 0u; i < TEST_EVENTS_NR; i++)
+    {
+        gsTestActions[i][0].outputSignal = CTE_OUTPUT_CTEP_0;
+        gsTestActions[i][0].cteOutputSignalType.newLogicState = ((i & 1u) == 0u) ? CTE_LOGIC_SET_TO_HIGH :
+                                                                                  CTE_LOGIC_SET_TO_LOW;
+        gsTestActions[i][1].outputSignal = CTE_OUTPUT_MAX;
+        gsTestEvents[i].absTime = 1000u * (i + 1u);
+        gsTestEvents[i].eventActionsPtr = gsTestActions[i];
+    }
+    gsTestTable.tableLength = (uint8)TEST_EVENTS_NR;
+    gsTestTable.tableTimeExecLimit = 5000u;
+    gsTestTable.eventsPtr = gsTestEvents;
+    CteHost_ModelReset();
+    (void)memset(&gsTestParams, 0, sizeof(gsTestParams));
+    gsTestParams.cteMode.workingMode = CTE_MASTER;
+    gsTestParams.cteClockFrecq = CTE_DEFAULT_INPUT_CLOCK;
+    gsTestParams.signalDef0Ptr = gsTestOutputs;
+    gsTestParams.timeTable0Ptr = &gsTestTable;
+    gsTestParams.cteIrqEvents = (Cte_IrqDefinitionType)TEST_REQ_EVENTS;
+    gsTestParams.pCteCallback = Test_Callback;
+    gsTestServiceTicks = 0u;
+    gsTestCalls = 0u;
+    return Cte_Setup(&gsTestParams, &lutChecksum);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       Raise the TT0_END event after a period.
+ *
+ */
+static void Test_Period(const uint64 period)
+{
+    CteHost_TimeAdvance(period);
+    CTE_HOST_CHECK(CteHost_RaiseIrq((uint32)CTE_IRQ_TT0_END) == TRUE);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       A new setup starts new statistics, with the counter frequency of the platform.
+ *
+ */
+static void Test_Reset(void)
+{
+    Cte_TimingStatsType         expStats;
+    const Cte_TimingStatsType   *pStats;
+
+    CTE_HOST_CHECK(Test_Setup() == (Std_ReturnType)E_OK);
+    Test_Period(100u);
+    Test_Period(100u);
+    pStats = Cte_GetTimingStats();
+    CTE_HOST_CHECK(pStats->callsNum == 2u);
+    CTE_HOST_CHECK(pStats->evt[TEST_TT0_END_BIT].eventsNum == 2u);
+    CTE_HOST_CHECK(Test_Setup() == (Std_ReturnType)E_OK);
+    (void)memset(&expStats, 0, sizeof(expStats));
+    expStats.counterFreq = 1000000000u;
+    CTE_HOST_CHECK(pStats == Cte_GetTimingStats());
+    CTE_HOST_CHECK(memcmp(pStats, &expStats, sizeof(expStats)) == 0);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       The histogram bin is the number of significant bits of the period, up to the last bin.
+ *
+ */
+static void Test_Bins(void)
+{
+    static const uint64         periods[] = { 0u, 1u, 2u, 3u, 4u, 7u, 8u, 0x3fffffffu, 0x40000000u, 0x7fffffffu,
+                                              0x80000000u, 0x10000000000u };
+    static const uint32         bins[] = { 0u, 1u, 2u, 2u, 3u, 3u, 4u, 30u, 31u, 31u, 31u, 31u };
+    uint32                      expHist[CTE_STATS_HIST_BINS];
+    uint64                      expSum = 0u;
+    uint32                      i;
+    const Cte_TimingStatsType   *pStats = Cte_GetTimingStats();
+
+    CTE_HOST_CHECK(Test_Setup() == (Std_ReturnType)E_OK);
+    (void)memset(expHist, 0, sizeof(expHist));
+    Test_Period(5u);                                    /* the first event has no period                    */
+    for (i = 0u; i < (sizeof(periods) / sizeof(periods[0])); i++)
+    {
+        Test_Period(periods[i]);
+        expHist[bins[i]]++;
+        expSum += periods[i];
+    }
+    CTE_HOST_CHECK(memcmp(pStats->evt[TEST_TT0_END_BIT].periodHist, expHist, sizeof(expHist)) == 0);
+    CTE_HOST_CHECK(pStats->evt[TEST_TT0_END_BIT].periodsNum == (sizeof(periods) / sizeof(periods[0])));
+    CTE_HOST_CHECK(pStats->evt[TEST_TT0_END_BIT].eventsNum == ((sizeof(periods) / sizeof(periods[0])) + 1u));
+    CTE_HOST_CHECK(pStats->evt[TEST_TT0_END_BIT].periodSum == expSum);
+    CTE_HOST_CHECK(pStats->evt[TEST_TT1_END_BIT].eventsNum == 0u);
+    /* no time spent by the handler                                                                                */
+    CTE_HOST_CHECK(pStats->serviceHist[0] == pStats->callsNum);
+    CTE_HOST_CHECK(pStats->serviceMax == 0u);
+}
+
+/*================================================================================================*/
+/*
+ * @brief       The min, max and moving average of the periods, the missed events estimated from a long period.
+ *
+ */
+static void Test_Periods(void)
+{
+    const Cte_EvtTimingStatsType    *pEvt = &Cte_GetTimingStats()->evt[TEST_TT0_END_BIT];
+
+    CTE_HOST_CHECK(Test_Setup() == (Std_ReturnType)E_OK);
+    Test_Period(1u);
+    Test_Period(1000u);
+    CTE_HOST_CHECK((pEvt->periodMin == 1000u) && (pEvt->periodMax == 1000u) && (pEvt->periodAvg == 1000u));
+    Test_Period(1000u);
+    Test_Period(800u);                                  /* avg = 1000 - 125 + 100                           */
+    CTE_HOST_CHECK((pEvt->periodMin == 800u) && (pEvt->periodMax == 1000u) && (pEvt->periodAvg == 975u));
+    Test_Period(1200u);                                 /* avg = 975 - 121 + 150                            */
+    CTE_HOST_CHECK((pEvt->periodMin == 800u) && (pEvt->periodMax == 1200u) && (pEvt->periodAvg == 1004u));
+    CTE_HOST_CHECK(pEvt->missedNum == 0u);
+    /* 3.39 average periods : 2 events missed, the period is not used for min, max and average                     */
+    Test_Period(3400u);
+    CTE_HOST_CHECK(pEvt->missedNum == 2u);
+    CTE_HOST_CHECK((pEvt->periodMin == 800u) && (pEvt->periodMax == 1200u) && (pEvt->periodAvg == 1004u));
+    /* 1.5 average periods is still a period                                                                       */
+    Test_Period(1506u);                                 /* avg = 1004 - 125 + 188                           */
+    CTE_HOST_CHECK((pEvt->missedNum == 2u) && (pEvt->periodMax == 1506u) && (pEvt->periodAvg == 1067u));
+    /* 2.5 average periods is rounded up                                                                            */
+    Test_Period(2668u);
+    CTE_HOST_CHECK(pEvt->missedNum == 4u);
+    CTE_HOST_CHECK(pEvt->periodsNum == 7u);
+    CTE_HOST_CHECK(pEvt->eventsNum == 8u);
+    CTE_HOST_CHECK(pEvt->periodSum == (1000u + 1000u + 800u + 1200u + 3400u + 1506u + 2668u));
+    CTE_HOST_CHECK(pEvt->lastTime == CteHost_GetTime());
+}
+
+/*================================================================================================*/
+/*
+ * @brief       The irq service time includes the callback; each event of the status has its own statistics.
+ *
+ */
+static void Test_Service(void)
+{
+    const Cte_TimingStatsType   *pStats = Cte_GetTimingStats();
+
+    CTE_HOST_CHECK(Test_Setup() == (Std_ReturnType)E_OK);
+    gsTestServiceTicks = 100u;
+    CTE_HOST_CHECK(CteHost_RaiseIrq((uint32)CTE_IRQ_TT0_END | (uint32)CTE_IRQ_TT1_END) == TRUE);
+    gsTestServiceTicks = 5000u;
+    CteHost_TimeAdvance(1000u);
+    CTE_HOST_CHECK(CteHost_RaiseIrq((uint32)CTE_IRQ_TT1_END) == TRUE);
+    /* an event not requested : no callback, but the handler was called                                            */
+    CTE_HOST_CHECK(CteHost_RaiseIrq((uint32)CTE_IRQ_TT0_START) == FALSE);
+    CTE_HOST_CHECK(CteHost_RaiseIrq((uint32)CTE_IRQ_TT0_END) == TRUE);
+    CTE_HOST_CHECK(gsTestCalls == 3u);
+    CTE_HOST_CHECK(pStats->callsNum == 3u);
+    CTE_HOST_CHECK(pStats->serviceMax == 5000u);
+    CTE_HOST_CHECK(pStats->serviceSum == 10100u);
+    CTE_HOST_CHECK(pStats->serviceHist[7] == 1u);       /* 100 has 7 significant bits                       */
+    CTE_HOST_CHECK(pStats->serviceHist[13] == 2u);      /* 5000 has 13 significant bits                     */
+    CTE_HOST_CHECK(pStats->evt[TEST_TT0_END_BIT].eventsNum == 2u);
+    CTE_HOST_CHECK(pStats->evt[TEST_TT0_END_BIT].periodSum == (100u + 1000u + 5000u));
+    CTE_HOST_CHECK(pStats->evt[TEST_TT1_END_BIT].eventsNum == 2u);
+    CTE_HOST_CHECK(pStats->evt[TEST_TT1_END_BIT].periodSum == (100u + 1000u));
+    CTE_HOST_CHECK(pStats->evt[0].eventsNum == 1u);     /* TT0_START, seen with the next status             */
+}
+
+/*==================================================================================================
+*                                        GLOBAL FUNCTIONS
+==================================================================================================*/
+int main(void)
+{
+    Test_Reset();
+    Test_Bins();
+    Test_Periods();
+    Test_Service();
+    (void)printf("Cte_TestTimingStats : %s (%u failed checks)\n", (gCteHostFails == 0u) ? "PASS" : "FAIL",
+                 (unsigned)gCteHostFails);
+    return (gCteHostFails == 0u) ? 0 : 1;
+}
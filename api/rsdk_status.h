@@ -613,6 +613,21 @@ typedef enum
     RSDK_CTE_DRV_ERR_START_EVT_MGR,         /**< Error starting the events manager */
     RSDK_CTE_DRV_ERR_TT1_IN_EXECUTION,      /**< TimeTable 1 execution, which not allow sw RFS generation */
     RSDK_CTE_DRV_ERR_SW_RFS_ERROR,          /**< TimeTable 1 execution after software RFS, which is not normal */
+    RSDK_CTE_DRV_LUT_IMAGE_WRG,             /**< The LUT image is not valid : unknown version, wrong layout or the
+                                             content hash does not match the image content                           */
+    RSDK_CTE_DRV_LUT_IMAGE_STALE,           /**< The LUT image was compiled for another CTE setup (clock frequency,
+                                             clock divider or output definitions)                                     */
+    RSDK_CTE_DRV_LUT_IMAGE_NOT_FOUND,       /**< No LUT image registered for the requested content hash              */
+    RSDK_CTE_DRV_LUT_CACHE_FULL,            /**< No free place in the driver LUT images cache                        */
+    RSDK_CTE_DRV_LUT_CHECKSUM_ERROR,        /**< The LUT checksum after the image load is not the expected one       */
+    RSDK_CTE_DRV_UPDATE_PENDING,            /**< A tables update staged while running was not committed yet          */
+    RSDK_CTE_DRV_UPDATE_WRG_LAYOUT,         /**< The staged tables need another run mode (number of LUT parts)       */
+    RSDK_CTE_DRV_PLAYLIST_WRG,              /**< The playlist is not valid : wrong length or the table sets use
+                                             different run modes                                                      */
+    RSDK_CTE_DRV_LUT_IMAGE_IN_USE,          /**< The LUT image is used by the current playlist                       */
+    RSDK_CTE_DRV_EVT_STREAM_CLOSED,         /**< The events stream was closed by RSDK_CTE_LX_CTE_EVTMGR_STOP - Linux only */
+    RSDK_CTE_DRV_BLOB_WRG_FORMAT,           /**< The tables blob is not valid : unknown version, not aligned, wrong
+                                             size, sections lengths or reserved fields                               */
 
     /*-------------------------------------------------------------------------*/
     /*SPT Driver API error codes:*/